@@ -0,0 +1,79 @@
+// allocation_counter.c
+// CIEEE754BenchmarkSupport
+//
+// Process-wide heap allocation counter for the benchmark executable
+
+#include "include/allocation_counter.h"
+#include <errno.h>
+#include <stdatomic.h>
+#include <stddef.h>
+
+static _Atomic uint64_t allocation_count = 0;
+
+static inline void count_allocation(void) {
+    atomic_fetch_add_explicit(&allocation_count, 1, memory_order_relaxed);
+}
+
+uint64_t ieee754_bench_allocation_count(void) {
+    return atomic_load_explicit(&allocation_count, memory_order_relaxed);
+}
+
+#if defined(__linux__) && defined(__GLIBC__)
+
+// The executable's definitions take precedence over libc for every shared
+// library in the process (including the Swift runtime); each one forwards to
+// glibc's internal entry points after bumping the counter.
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t count, size_t size);
+extern void* __libc_realloc(void* pointer, size_t size);
+extern void* __libc_memalign(size_t alignment, size_t size);
+
+int ieee754_bench_allocation_counting_available(void) {
+    return 1;
+}
+
+void* malloc(size_t size) {
+    count_allocation();
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    count_allocation();
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, size_t size) {
+    count_allocation();
+    return __libc_realloc(pointer, size);
+}
+
+void* memalign(size_t alignment, size_t size) {
+    count_allocation();
+    return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    count_allocation();
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** result, size_t alignment, size_t size) {
+    if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0) {
+        return EINVAL;
+    }
+    count_allocation();
+    void* pointer = __libc_memalign(alignment, size);
+    if (pointer == NULL) {
+        return ENOMEM;
+    }
+    *result = pointer;
+    return 0;
+}
+
+#else
+
+int ieee754_bench_allocation_counting_available(void) {
+    return 0;
+}
+
+#endif
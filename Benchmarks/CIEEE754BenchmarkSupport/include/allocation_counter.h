@@ -0,0 +1,30 @@
+#ifndef IEEE754_ALLOCATION_COUNTER_H
+#define IEEE754_ALLOCATION_COUNTER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// =============================================================================
+// MARK: - Allocation Counting
+// =============================================================================
+
+/// Whether heap allocations are being counted in this process
+///
+/// Counting interposes `malloc` and friends, which is only done on glibc.
+/// Elsewhere the counter stays at zero and this returns 0.
+int ieee754_bench_allocation_counting_available(void);
+
+/// Total number of heap allocations made by the process so far
+///
+/// Counts every call to `malloc`, `calloc`, `realloc`, `posix_memalign`,
+/// `aligned_alloc` and `memalign` from any thread.
+uint64_t ieee754_bench_allocation_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IEEE754_ALLOCATION_COUNTER_H
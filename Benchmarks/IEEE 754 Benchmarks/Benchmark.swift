@@ -0,0 +1,139 @@
+// Benchmark.swift
+// swift-ieee-754
+//
+// Measurement harness: timing, percentiles, throughput and allocation counts
+
+import CIEEE754BenchmarkSupport
+
+/// A single named measurement
+///
+/// One iteration processes `elements` values (and `bytes` bytes, when the
+/// operation moves serialized data). Latency is reported per element, so
+/// batch and scalar operations are directly comparable.
+struct Benchmark: Sendable {
+    let name: String
+    let elements: Int
+    let bytes: Int
+    let body: @Sendable () async -> Void
+
+    init(_ name: String, elements: Int, bytes: Int = 0, body: @escaping @Sendable () async -> Void) {
+        self.name = name
+        self.elements = elements
+        self.bytes = bytes
+        self.body = body
+    }
+}
+
+// MARK: - Results
+
+/// Measured statistics for one benchmark, as stored in JSON baselines
+struct BenchmarkResult: Codable, Sendable {
+    /// Nanoseconds per element at common percentiles
+    struct Latency: Codable, Sendable {
+        var min: Double
+        var p50: Double
+        var p90: Double
+        var p99: Double
+    }
+
+    var name: String
+    var iterations: Int
+    var elementsPerIteration: Int
+    var nanosecondsPerElement: Latency
+    var valuesPerSecond: Double
+    var gigabytesPerSecond: Double?
+    /// Heap allocations per iteration, or nil where counting is unavailable
+    var allocationsPerIteration: Double?
+}
+
+/// A set of results written to or read from disk
+struct Baseline: Codable, Sendable {
+    var version: Int = 1
+    var results: [BenchmarkResult]
+}
+
+// MARK: - Runner
+
+struct BenchmarkRunner {
+    /// Minimum measured time per benchmark
+    var minimumTime: Duration = .milliseconds(500)
+    var minimumIterations = 10
+    var maximumIterations = 100_000
+    var warmupIterations = 3
+
+    func run(_ benchmark: Benchmark) async -> BenchmarkResult {
+        for _ in 0..<warmupIterations {
+            await benchmark.body()
+        }
+
+        let allocations = await countAllocations(benchmark)
+
+        let clock = ContinuousClock()
+        var samples: [Double] = []
+        samples.reserveCapacity(minimumIterations)
+        var elapsed: Duration = .zero
+
+        while samples.count < maximumIterations
+            && (samples.count < minimumIterations || elapsed < minimumTime)
+        {
+            let duration = await clock.measure { await benchmark.body() }
+            elapsed += duration
+            samples.append(duration.nanoseconds / Double(benchmark.elements))
+        }
+
+        samples.sort()
+        let totalNanoseconds = elapsed.nanoseconds
+        let totalElements = Double(samples.count * benchmark.elements)
+        let seconds = totalNanoseconds / 1e9
+
+        return BenchmarkResult(
+            name: benchmark.name,
+            iterations: samples.count,
+            elementsPerIteration: benchmark.elements,
+            nanosecondsPerElement: .init(
+                min: samples[0],
+                p50: percentile(samples, 0.50),
+                p90: percentile(samples, 0.90),
+                p99: percentile(samples, 0.99)
+            ),
+            valuesPerSecond: totalElements / seconds,
+            gigabytesPerSecond: benchmark.bytes > 0
+                ? Double(samples.count * benchmark.bytes) / seconds / 1e9
+                : nil,
+            allocationsPerIteration: allocations
+        )
+    }
+
+    /// Average heap allocations over a few dedicated iterations
+    private func countAllocations(_ benchmark: Benchmark) async -> Double? {
+        guard ieee754_bench_allocation_counting_available() != 0 else { return nil }
+
+        let iterations = 5
+        let before = ieee754_bench_allocation_count()
+        for _ in 0..<iterations {
+            await benchmark.body()
+        }
+        let after = ieee754_bench_allocation_count()
+        return Double(after - before) / Double(iterations)
+    }
+
+    /// Nearest-rank percentile of sorted samples
+    private func percentile(_ sorted: [Double], _ fraction: Double) -> Double {
+        let rank = Int((fraction * Double(sorted.count)).rounded(.up)) - 1
+        return sorted[min(max(rank, 0), sorted.count - 1)]
+    }
+}
+
+extension Duration {
+    var nanoseconds: Double {
+        let (seconds, attoseconds) = components
+        return Double(seconds) * 1e9 + Double(attoseconds) / 1e9
+    }
+}
+
+// MARK: - Optimization Barrier
+
+/// Keeps a computed value alive so the optimizer cannot drop the work
+@inline(never)
+@_optimize(none)
+func blackHole<T>(_ value: T) {}
@@ -0,0 +1,75 @@
+// Report.swift
+// swift-ieee-754
+//
+// Console output and baseline comparison
+
+import Foundation
+
+enum Report {
+    static let header = [
+        column("benchmark", 52, left: true),
+        column("p50 ns", 10),
+        column("p90 ns", 10),
+        column("p99 ns", 10),
+        column("Mvalues/s", 11),
+        column("GB/s", 8),
+        column("allocs/it", 10),
+    ].joined(separator: " ")
+
+    static func row(_ result: BenchmarkResult) -> String {
+        [
+            column(result.name, 52, left: true),
+            column(format(result.nanosecondsPerElement.p50), 10),
+            column(format(result.nanosecondsPerElement.p90), 10),
+            column(format(result.nanosecondsPerElement.p99), 10),
+            column(format(result.valuesPerSecond / 1e6), 11),
+            column(result.gigabytesPerSecond.map(format) ?? "-", 8),
+            column(result.allocationsPerIteration.map(format) ?? "n/a", 10),
+        ].joined(separator: " ")
+    }
+
+    /// Prints a line per benchmark that got slower or allocates more than its baseline
+    ///
+    /// - Returns: Names of the regressed benchmarks
+    static func compare(
+        _ results: [BenchmarkResult],
+        against baseline: Baseline,
+        tolerance: Double
+    ) -> [String] {
+        let previous = Dictionary(baseline.results.map { ($0.name, $0) }, uniquingKeysWith: { first, _ in first })
+        var regressions: [String] = []
+
+        print("")
+        for result in results {
+            guard let old = previous[result.name] else {
+                print("  new      \(result.name)")
+                continue
+            }
+
+            let ratio = result.nanosecondsPerElement.p50 / old.nanosecondsPerElement.p50
+            let slower = ratio > 1 + tolerance
+            let allocates = (result.allocationsPerIteration ?? 0) > (old.allocationsPerIteration ?? .infinity)
+
+            let status = slower || allocates ? "REGRESS" : (ratio < 1 - tolerance ? "faster " : "ok     ")
+            var line = "  \(status)  \(result.name): p50 x\(format(ratio))"
+            if allocates {
+                line += ", allocs \(format(old.allocationsPerIteration ?? 0)) -> \(format(result.allocationsPerIteration ?? 0))"
+            }
+            print(line)
+
+            if slower || allocates {
+                regressions.append(result.name)
+            }
+        }
+        return regressions
+    }
+
+    private static func format(_ value: Double) -> String {
+        String(format: value >= 100 ? "%.0f" : "%.2f", value)
+    }
+
+    private static func column(_ text: String, _ width: Int, left: Bool = false) -> String {
+        let padding = String(repeating: " ", count: max(0, width - text.count))
+        return left ? text + padding : padding + text
+    }
+}
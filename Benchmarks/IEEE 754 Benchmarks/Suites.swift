@@ -0,0 +1,328 @@
+// Suites.swift
+// swift-ieee-754
+//
+// Benchmark definitions for serialization, comparison, binary128, rounding and exceptions
+
+import IEEE_754
+
+#if canImport(CIEEE754)
+    import CIEEE754
+#endif
+
+enum Suites {
+    /// Values per iteration for per-element operations
+    static let count = 4_096
+
+    /// Workers used by the contention benchmark
+    static var processorCount: Int {
+        #if canImport(CIEEE754)
+            Int(ieee754_processor_count())
+        #else
+            4
+        #endif
+    }
+
+    static func all() -> [Benchmark] {
+        serialization() + comparison() + minMax() + reductions() + binary128() + rounding() + exceptions() + signaling()
+    }
+
+    /// Deterministic inputs spanning normals, subnormals and specials
+    static func inputs(_ count: Int, seed: UInt64 = 0x9E37_79B9_7F4A_7C15) -> [Double] {
+        var state = seed
+        return (0..<count).map { index in
+            // splitmix64
+            state &+= 0x9E37_79B9_7F4A_7C15
+            var z = state
+            z = (z ^ (z >> 30)) &* 0xBF58_476D_1CE4_E5B9
+            z = (z ^ (z >> 27)) &* 0x94D0_49BB_1331_11EB
+            z ^= z >> 31
+            switch index % 64 {
+            case 0: return .nan
+            case 1: return -0.0
+            case 2: return .infinity
+            case 3: return .leastNonzeroMagnitude
+            default: return Double(bitPattern: z)
+            }
+        }
+    }
+
+    /// Sequential radix sort by totalOrder
+    ///
+    /// Benchmark bodies are async, where the `async` (concurrent) overload of
+    /// `sortedByTotalOrder()` would be chosen; this synchronous context selects
+    /// the sequential one.
+    static func sequentialSort(_ values: [Double]) -> [Double] {
+        values.sortedByTotalOrder()
+    }
+
+    // MARK: - Serialization
+
+    static func serialization() -> [Benchmark] {
+        let values = inputs(count)
+        let encoded = values.map { IEEE_754.Binary64.bytes(from: $0) }
+        let flat = values.flatMap { IEEE_754.Binary64.bytes(from: $0) }
+        let flatBig = values.flatMap { IEEE_754.Binary64.bytes(from: $0, endianness: .big) }
+        let large = inputs(1 << 20)
+
+        return [
+            Benchmark("Binary64.bytes(from:)", elements: count, bytes: count * 8) {
+                for value in values {
+                    blackHole(IEEE_754.Binary64.bytes(from: value))
+                }
+            },
+            Benchmark("Binary64.value(from:)", elements: count, bytes: count * 8) {
+                for bytes in encoded {
+                    blackHole(IEEE_754.Binary64.value(from: bytes))
+                }
+            },
+            Benchmark("[Double](bytes:) little", elements: count, bytes: count * 8) {
+                blackHole([Double](bytes: flat))
+            },
+            Benchmark("[Double](bytes:) big", elements: count, bytes: count * 8) {
+                blackHole([Double](bytes: flatBig, endianness: .big))
+            },
+            Benchmark("Binary64.bytes(from: [Double]) big", elements: count, bytes: count * 8) {
+                blackHole(IEEE_754.Binary64.bytes(from: values, endianness: .big))
+            },
+            Benchmark("[Double].sortedByTotalOrder() 1M", elements: large.count, bytes: large.count * 8) {
+                blackHole(sequentialSort(large))
+            },
+            Benchmark("[Double].sortedByTotalOrder() async 1M", elements: large.count, bytes: large.count * 8) {
+                blackHole(await large.sortedByTotalOrder())
+            },
+        ]
+    }
+
+    // MARK: - Comparison
+
+    static func comparison() -> [Benchmark] {
+        let lhs = inputs(count, seed: 1)
+        let rhs = inputs(count, seed: 2)
+
+        func predicate(
+            _ name: String,
+            _ compare: @escaping @Sendable (Double, Double) -> Bool
+        ) -> Benchmark {
+            Benchmark("Comparison.\(name)", elements: count) {
+                var matches = 0
+                for index in 0..<lhs.count where compare(lhs[index], rhs[index]) {
+                    matches &+= 1
+                }
+                blackHole(matches)
+            }
+        }
+
+        return [
+            predicate("isEqual", IEEE_754.Comparison.isEqual),
+            predicate("isLess", IEEE_754.Comparison.isLess),
+            predicate("isLessEqual", IEEE_754.Comparison.isLessEqual),
+            predicate("isGreater", IEEE_754.Comparison.isGreater),
+            predicate("compare(using: .ordering(.less))") {
+                IEEE_754.Comparison.compare($0, $1, using: .ordering(.less(orEqual: false)))
+            },
+            predicate("totalOrder", IEEE_754.Comparison.totalOrder),
+            predicate("totalOrderMag", IEEE_754.Comparison.totalOrderMag),
+            Benchmark("Comparison.mask(using: .ordering(.less))", elements: count) {
+                blackHole(IEEE_754.Comparison.mask(lhs, rhs, using: .compare(.ordering(.less(orEqual: false)))))
+            },
+            Benchmark("Comparison.mask(using: .totalOrder)", elements: count) {
+                blackHole(IEEE_754.Comparison.mask(lhs, rhs, using: .totalOrder))
+            },
+            Benchmark("Comparison.filter(scalar, using: .ordering(.less))", elements: count) {
+                blackHole(IEEE_754.Comparison.filter(lhs, 0, using: .compare(.ordering(.less(orEqual: false)))))
+            },
+        ]
+    }
+
+    // MARK: - Min/Max
+
+    static func minMax() -> [Benchmark] {
+        let lhs = inputs(count, seed: 3)
+        let rhs = inputs(count, seed: 4)
+
+        func apply(_ name: String, _ operation: IEEE_754.MinMax.Operation) -> Benchmark {
+            Benchmark("MinMax.apply(\(name))", elements: count) {
+                var accumulator = 0.0
+                for index in 0..<lhs.count {
+                    accumulator += IEEE_754.MinMax.apply(lhs[index], rhs[index], operation: operation)
+                }
+                blackHole(accumulator)
+            }
+        }
+
+        return [
+            apply(".standard(.minimum)", .standard(.minimum)),
+            apply(".number(.maximum)", .number(.maximum)),
+            apply(".magnitude(.minimum)", .magnitude(.minimum, preferNumber: false)),
+            apply(".magnitude(.maximum, preferNumber)", .magnitude(.maximum, preferNumber: true)),
+        ]
+    }
+
+    // MARK: - Reductions
+
+    static func reductions() -> [Benchmark] {
+        let values = inputs(1 << 20, seed: 9).map { $0.isFinite ? $0.truncatingRemainder(dividingBy: 1e6) : 1 }
+        let other = inputs(1 << 20, seed: 10).map { $0.isFinite ? $0.truncatingRemainder(dividingBy: 1e6) : 1 }
+
+        return [
+            Benchmark("[Double].reduce(0, +) 1M", elements: values.count, bytes: values.count * 8) {
+                blackHole(values.reduce(0, +))
+            },
+            Benchmark("Arithmetic.sum 1M", elements: values.count, bytes: values.count * 8) {
+                blackHole(IEEE_754.Arithmetic.sum(values[...]))
+            },
+            Benchmark("Arithmetic.reproducibleSum 1M", elements: values.count, bytes: values.count * 8) {
+                blackHole(IEEE_754.Arithmetic.reproducibleSum(values[...]))
+            },
+            Benchmark("Arithmetic.reproducibleDot 1M", elements: values.count, bytes: values.count * 16) {
+                blackHole(IEEE_754.Arithmetic.reproducibleDot(values[...], other[...]))
+            },
+            Benchmark("Arithmetic.reproducibleNorm 1M", elements: values.count, bytes: values.count * 8) {
+                blackHole(IEEE_754.Arithmetic.reproducibleNorm(values[...]))
+            },
+        ]
+    }
+
+    // MARK: - Binary128
+
+    /// Scalar and batch binary128 arithmetic
+    ///
+    /// The native entry points hold roundTiesToEven and keep the caller's
+    /// flags around each call. x86-64, gcc -O2, ns per element on the C entry
+    /// points (nearest / upward):
+    ///
+    /// | operation | unscoped  | <fenv.h> scope | register scope |
+    /// |-----------|-----------|----------------|----------------|
+    /// | add       | 35.9/32.4 | 118.6/129.0    | 28.3/30.3      |
+    /// | div       | 51.3/46.4 | 134.7/144.3    | 43.0/45.0      |
+    /// | to double | 17.9/16.2 | 111.5/122.4    | 18.8/21.8      |
+    /// | sum       | 27.1/24.6 | 22.9/22.9      | 21.4/21.4      |
+    ///
+    /// Unscoped calls followed the caller's upward mode; both scopes round to
+    /// nearest in either column.
+    static func binary128() -> [Benchmark] {
+        typealias Quad = IEEE_754.Binary128
+        let doubles = inputs(count, seed: 11).map { $0.isFinite ? $0.truncatingRemainder(dividingBy: 1e6) + 2 : 3 }
+        let lhs = doubles.map(Quad.init)
+        let rhs = doubles.reversed().map(Quad.init)
+
+        return [
+            Benchmark("Binary128 +", elements: count) {
+                var accumulator = Quad.zero
+                for value in lhs {
+                    accumulator += value
+                }
+                blackHole(accumulator)
+            },
+            Benchmark("Binary128 + upward", elements: count) {
+                let accumulator = IEEE_754.RoundingControl.withMode(.upward) {
+                    lhs.reduce(Quad.zero, +)
+                }
+                blackHole(accumulator)
+            },
+            Benchmark("Binary128 /", elements: count) {
+                for index in 0..<lhs.count {
+                    blackHole(lhs[index] / rhs[index])
+                }
+            },
+            Benchmark("Binary128.sum [Double]", elements: count, bytes: count * 8) {
+                blackHole(Quad.sum(doubles))
+            },
+            Benchmark("Binary128.addition(_:_:into:)", elements: count, bytes: count * 32) {
+                var result = [Quad](repeating: .zero, count: lhs.count)
+                lhs.withUnsafeBufferPointer { a in
+                    rhs.withUnsafeBufferPointer { b in
+                        result.withUnsafeMutableBufferPointer { Quad.addition(a, b, into: $0) }
+                    }
+                }
+                blackHole(result)
+            },
+        ]
+    }
+
+    // MARK: - Rounding
+
+    static func rounding() -> [Benchmark] {
+        let values = inputs(count, seed: 5).map { $0.isFinite ? $0.truncatingRemainder(dividingBy: 1e6) : $0 }
+
+        func apply(_ name: String, _ direction: IEEE_754.Rounding.Direction) -> Benchmark {
+            Benchmark("Rounding.apply(\(name))", elements: count) {
+                var accumulator = 0.0
+                for value in values {
+                    accumulator += IEEE_754.Rounding.apply(value, direction: direction)
+                }
+                blackHole(accumulator)
+            }
+        }
+
+        return [
+            apply(".toNearest(.toEven)", .toNearest(.toEven)),
+            apply(".toNearest(.awayFromZero)", .toNearest(.awayFromZero)),
+            apply(".towardZero", .towardZero),
+            apply(".towardInfinity(.negative)", .towardInfinity(.negative)),
+        ]
+    }
+
+    // MARK: - Exceptions
+
+    static func exceptions() -> [Benchmark] {
+        let raisesPerWorker = 100_000
+        let workers = max(2, processorCount)
+        let flags: [IEEE_754.Exceptions.Flag] = [.inexact, .underflow]
+
+        return [
+            Benchmark("Exceptions.raise uncontended", elements: raisesPerWorker) {
+                for index in 0..<raisesPerWorker {
+                    IEEE_754.Exceptions.raise(flags[index & 1])
+                }
+                IEEE_754.Exceptions.clearAll()
+            },
+            Benchmark("Exceptions.raise contended x\(workers)", elements: raisesPerWorker * workers) {
+                await withTaskGroup(of: Void.self) { group in
+                    for _ in 0..<workers {
+                        group.addTask {
+                            for index in 0..<raisesPerWorker {
+                                IEEE_754.Exceptions.raise(flags[index & 1])
+                                if index & 1023 == 0 {
+                                    blackHole(IEEE_754.Exceptions.testFlag(.inexact))
+                                }
+                            }
+                            IEEE_754.Exceptions.clearAll()
+                        }
+                    }
+                }
+            },
+        ]
+    }
+
+    // MARK: - Signaling Comparisons
+
+    static func signaling() -> [Benchmark] {
+        #if canImport(CIEEE754)
+            let lhs = inputs(count, seed: 6)
+            let rhs = inputs(count, seed: 7)
+
+            return [
+                Benchmark("ieee754_signaling_less (per element)", elements: count) {
+                    var matches: Int32 = 0
+                    for index in 0..<lhs.count {
+                        matches &+= ieee754_signaling_less(lhs[index], rhs[index])
+                    }
+                    blackHole(matches)
+                    ieee754_clear_all_exceptions()
+                },
+                Benchmark("Comparison.Signaling.less([Double], [Double])", elements: count) {
+                    blackHole(IEEE_754.Comparison.Signaling.less(lhs, rhs))
+                    ieee754_clear_all_exceptions()
+                },
+                Benchmark("ieee754_signaling_less_array", elements: count) {
+                    var out = [UInt8](repeating: 0, count: lhs.count)
+                    blackHole(ieee754_signaling_less_array(lhs, rhs, &out, lhs.count))
+                    ieee754_clear_all_exceptions()
+                },
+            ]
+        #else
+            return []
+        #endif
+    }
+}
@@ -0,0 +1,86 @@
+// main.swift
+// swift-ieee-754
+//
+// Benchmark executable entry point
+//
+// Usage:
+//
+//     swift run -c release "IEEE 754 Benchmarks" [options]
+//
+// Options:
+//
+//     --filter <text>       Only run benchmarks whose name contains <text>
+//     --save <path>         Write results to a JSON baseline at <path>
+//     --baseline <path>     Compare against a JSON baseline; exit 1 on regression
+//     --tolerance <ratio>   Allowed p50 slowdown before a regression (default 0.10)
+//     --min-time <ms>       Minimum measured time per benchmark (default 500)
+//     --list                Print benchmark names and exit
+//
+// Foundation is used here for JSON and file I/O only; the library itself
+// stays Foundation-free.
+
+import Foundation
+
+struct Options {
+    var filter: String?
+    var savePath: String?
+    var baselinePath: String?
+    var tolerance = 0.10
+    var minimumTime: Duration = .milliseconds(500)
+    var list = false
+
+    init(_ arguments: [String]) {
+        var iterator = arguments.makeIterator()
+        while let argument = iterator.next() {
+            switch argument {
+            case "--filter": filter = iterator.next()
+            case "--save": savePath = iterator.next()
+            case "--baseline": baselinePath = iterator.next()
+            case "--tolerance": tolerance = iterator.next().flatMap(Double.init) ?? tolerance
+            case "--min-time": minimumTime = .milliseconds(iterator.next().flatMap(Int.init) ?? 500)
+            case "--list": list = true
+            default:
+                FileHandle.standardError.write(Data("Unknown option: \(argument)\n".utf8))
+                exit(2)
+            }
+        }
+    }
+}
+
+let options = Options(Array(CommandLine.arguments.dropFirst()))
+let benchmarks = Suites.all().filter { benchmark in
+    options.filter.map { benchmark.name.contains($0) } ?? true
+}
+
+if options.list {
+    benchmarks.forEach { print($0.name) }
+    exit(0)
+}
+
+let runner = BenchmarkRunner(minimumTime: options.minimumTime)
+var results: [BenchmarkResult] = []
+
+print(Report.header)
+for benchmark in benchmarks {
+    let result = await runner.run(benchmark)
+    results.append(result)
+    print(Report.row(result))
+}
+
+if let path = options.savePath {
+    let encoder = JSONEncoder()
+    encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+    try encoder.encode(Baseline(results: results)).write(to: URL(fileURLWithPath: path))
+    print("\nSaved baseline to \(path)")
+}
+
+if let path = options.baselinePath {
+    let data = try Data(contentsOf: URL(fileURLWithPath: path))
+    let baseline = try JSONDecoder().decode(Baseline.self, from: data)
+    let regressions = Report.compare(results, against: baseline, tolerance: options.tolerance)
+    if !regressions.isEmpty {
+        print("\n\(regressions.count) regression(s) against \(path)")
+        exit(1)
+    }
+    print("\nNo regressions against \(path)")
+}
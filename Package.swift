@@ -14,6 +14,8 @@ import PackageDescription
 //
 // Pure Swift implementation with no Foundation dependencies,
 // suitable for Swift Embedded and constrained environments.
+// (The "IEEE 754 Benchmarks" executable uses Foundation for JSON baselines;
+// it is not part of any product.)
 
 let package = Package(
     name: "swift-ieee-754",
@@ -45,6 +47,20 @@ let package = Package(
                 .target(name: "CIEEE754", condition: .when(platforms: [.macOS, .linux, .iOS, .tvOS, .watchOS]))
             ]
         ),
+        .target(
+            name: "CIEEE754BenchmarkSupport",
+            dependencies: [],
+            path: "Benchmarks/CIEEE754BenchmarkSupport"
+        ),
+        .executableTarget(
+            name: "IEEE 754 Benchmarks",
+            dependencies: [
+                "IEEE 754",
+                "CIEEE754BenchmarkSupport",
+                .target(name: "CIEEE754", condition: .when(platforms: [.macOS, .linux, .iOS, .tvOS, .watchOS]))
+            ],
+            path: "Benchmarks/IEEE 754 Benchmarks"
+        ),
         .testTarget(
             name: "IEEE 754".tests,
             dependencies: [
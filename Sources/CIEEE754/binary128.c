@@ -0,0 +1,349 @@
+// binary128.c
+// CIEEE754
+//
+// IEEE 754-2019 Section 3.6: binary128 arithmetic through the compiler's quad type
+//
+// x86 has no quad-precision hardware; `__float128` lowers to the compiler
+// runtime (__addtf3 and friends), which is still well ahead of soft-float
+// reached through a Swift call per operation. The batch entry points keep
+// the accumulator in a register across the whole loop.
+//
+// The quad type follows the dynamic rounding mode and raises hardware
+// flags; the Swift software path does neither. Every entry point runs in a
+// scope that selects roundTiesToEven and puts the caller's flags back, so
+// both paths give the same results with no side effects.
+
+#include "include/ieee754_fpu.h"
+#include <fenv.h>
+#include <string.h>
+
+#if IEEE754_BINARY128_NATIVE
+
+#if defined(__x86_64__) || defined(__i386__)
+typedef __float128 quad;
+#else
+typedef long double quad;
+#endif
+
+_Static_assert(sizeof(quad) == 16, "binary128 must be 16 bytes");
+
+// Assemble through a 128-bit integer so the halves land correctly on either
+// byte order
+static inline quad to_quad(IEEE754Binary128 value) {
+    unsigned __int128 bits = ((unsigned __int128)value.high << 64) | value.low;
+    quad result;
+    memcpy(&result, &bits, sizeof result);
+    return result;
+}
+
+static inline IEEE754Binary128 from_quad(quad value) {
+    unsigned __int128 bits;
+    memcpy(&bits, &value, sizeof bits);
+    IEEE754Binary128 result = {(uint64_t)bits, (uint64_t)(bits >> 64)};
+    return result;
+}
+
+// =============================================================================
+// MARK: - Rounding Scope
+// =============================================================================
+
+// Hardware flags and rounding mode of the caller, saved around one call.
+//
+// Entering and leaving touch the control and status registers directly, as
+// fpu_rounding.c does: a few cycles, where the <fenv.h> calls cost more
+// than the quad arithmetic itself. The mode is only written when it is not
+// already round-to-nearest, and the flags only when the call changed them.
+#if defined(__x86_64__)
+
+// The quad runtime reads the rounding mode from MXCSR and raises inexact
+// and invalid there, but overflow, underflow and denormal in the x87 status
+// word, so both are saved. MXCSR RC is bits 14:13; flags are bits 5:0 of
+// MXCSR and of the x87 status word.
+#define MXCSR_RC_MASK (3u << 13)
+#define X87_FLAGS_MASK 0x3Fu
+
+typedef struct {
+    uint32_t mxcsr;
+    uint16_t x87;
+    fexcept_t saved; // Only read when x87 flags were already raised on entry
+} quad_scope;
+
+static inline void quad_begin(quad_scope* scope) {
+    __asm__ __volatile__("stmxcsr %0" : "=m"(scope->mxcsr));
+    __asm__ __volatile__("fnstsw %0" : "=m"(scope->x87));
+    if (scope->x87 & X87_FLAGS_MASK) {
+        fegetexceptflag(&scope->saved, FE_ALL_EXCEPT);
+    }
+    if (scope->mxcsr & MXCSR_RC_MASK) {
+        uint32_t nearest = scope->mxcsr & ~MXCSR_RC_MASK;
+        __asm__ __volatile__("ldmxcsr %0" : : "m"(nearest));
+    }
+}
+
+static inline void quad_end(const quad_scope* scope) {
+    uint32_t mxcsr;
+    uint16_t x87;
+    __asm__ __volatile__("stmxcsr %0" : "=m"(mxcsr));
+    if (mxcsr != scope->mxcsr) {
+        __asm__ __volatile__("ldmxcsr %0" : : "m"(scope->mxcsr));
+    }
+    __asm__ __volatile__("fnstsw %0" : "=m"(x87));
+    if ((x87 ^ scope->x87) & X87_FLAGS_MASK) {
+        if (scope->x87 & X87_FLAGS_MASK) {
+            fesetexceptflag(&scope->saved, FE_ALL_EXCEPT);
+            __asm__ __volatile__("ldmxcsr %0" : : "m"(scope->mxcsr));
+        } else {
+            __asm__ __volatile__("fnclex");
+        }
+    }
+}
+
+#elif defined(__aarch64__)
+
+// FPCR RMode is bits 23:22; FPSR holds the cumulative flags
+#define FPCR_RMODE_MASK (UINT64_C(3) << 22)
+
+typedef struct {
+    uint64_t fpcr;
+    uint64_t fpsr;
+} quad_scope;
+
+static inline void quad_begin(quad_scope* scope) {
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(scope->fpcr));
+    __asm__ __volatile__("mrs %0, fpsr" : "=r"(scope->fpsr));
+    if (scope->fpcr & FPCR_RMODE_MASK) {
+        __asm__ __volatile__("msr fpcr, %0" : : "r"(scope->fpcr & ~FPCR_RMODE_MASK));
+    }
+}
+
+static inline void quad_end(const quad_scope* scope) {
+    uint64_t fpsr;
+    __asm__ __volatile__("mrs %0, fpsr" : "=r"(fpsr));
+    if (fpsr != scope->fpsr) {
+        __asm__ __volatile__("msr fpsr, %0" : : "r"(scope->fpsr));
+    }
+    if (scope->fpcr & FPCR_RMODE_MASK) {
+        __asm__ __volatile__("msr fpcr, %0" : : "r"(scope->fpcr));
+    }
+}
+
+#else
+
+typedef struct {
+    fexcept_t saved;
+    int rounding;
+} quad_scope;
+
+static inline void quad_begin(quad_scope* scope) {
+    fegetexceptflag(&scope->saved, FE_ALL_EXCEPT);
+    scope->rounding = fegetround();
+    if (scope->rounding != FE_TONEAREST) {
+        fesetround(FE_TONEAREST);
+    }
+}
+
+static inline void quad_end(const quad_scope* scope) {
+    if (scope->rounding != FE_TONEAREST) {
+        fesetround(scope->rounding);
+    }
+    fesetexceptflag(&scope->saved, FE_ALL_EXCEPT);
+}
+
+#endif
+
+// Pins a value to memory so the compiler cannot move the arithmetic that
+// produces or consumes it across the scope's register accesses
+static inline void quad_fence(quad* value) {
+    __asm__ __volatile__("" : "+m"(*value));
+}
+
+// =============================================================================
+// MARK: - Arithmetic
+// =============================================================================
+
+IEEE754Binary128 ieee754_binary128_add(IEEE754Binary128 a, IEEE754Binary128 b) {
+    quad_scope scope;
+    quad_begin(&scope);
+    quad x = to_quad(a), y = to_quad(b);
+    quad_fence(&x);
+    quad_fence(&y);
+    quad result = x + y;
+    quad_fence(&result);
+    quad_end(&scope);
+    return from_quad(result);
+}
+
+IEEE754Binary128 ieee754_binary128_sub(IEEE754Binary128 a, IEEE754Binary128 b) {
+    quad_scope scope;
+    quad_begin(&scope);
+    quad x = to_quad(a), y = to_quad(b);
+    quad_fence(&x);
+    quad_fence(&y);
+    quad result = x - y;
+    quad_fence(&result);
+    quad_end(&scope);
+    return from_quad(result);
+}
+
+IEEE754Binary128 ieee754_binary128_mul(IEEE754Binary128 a, IEEE754Binary128 b) {
+    quad_scope scope;
+    quad_begin(&scope);
+    quad x = to_quad(a), y = to_quad(b);
+    quad_fence(&x);
+    quad_fence(&y);
+    quad result = x * y;
+    quad_fence(&result);
+    quad_end(&scope);
+    return from_quad(result);
+}
+
+IEEE754Binary128 ieee754_binary128_div(IEEE754Binary128 a, IEEE754Binary128 b) {
+    quad_scope scope;
+    quad_begin(&scope);
+    quad x = to_quad(a), y = to_quad(b);
+    quad_fence(&x);
+    quad_fence(&y);
+    quad result = x / y;
+    quad_fence(&result);
+    quad_end(&scope);
+    return from_quad(result);
+}
+
+IEEE754Binary128 ieee754_binary128_from_double(double value) {
+    quad_scope scope;
+    quad_begin(&scope);
+    quad result = (quad)value;
+    quad_fence(&result);
+    quad_end(&scope);
+    return from_quad(result);
+}
+
+double ieee754_binary128_to_double(IEEE754Binary128 value) {
+    quad_scope scope;
+    quad_begin(&scope);
+    quad x = to_quad(value);
+    quad_fence(&x);
+    double result = (double)x;
+    __asm__ __volatile__("" : "+m"(result));
+    quad_end(&scope);
+    return result;
+}
+
+IEEE754Binary128 ieee754_binary128_sum(const IEEE754Binary128* values, size_t n) {
+    quad_scope scope;
+    quad_begin(&scope);
+    quad sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += to_quad(values[i]);
+    }
+    quad_fence(&sum);
+    quad_end(&scope);
+    return from_quad(sum);
+}
+
+IEEE754Binary128 ieee754_binary128_sum_f64(const double* values, size_t n) {
+    quad_scope scope;
+    quad_begin(&scope);
+    quad sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += (quad)values[i];
+    }
+    quad_fence(&sum);
+    quad_end(&scope);
+    return from_quad(sum);
+}
+
+IEEE754Binary128 ieee754_binary128_dot_f64(const double* x, const double* y, size_t n) {
+    quad_scope scope;
+    quad_begin(&scope);
+    quad sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += (quad)x[i] * (quad)y[i];
+    }
+    quad_fence(&sum);
+    quad_end(&scope);
+    return from_quad(sum);
+}
+
+void ieee754_binary128_add_array(
+    const IEEE754Binary128* a, const IEEE754Binary128* b, IEEE754Binary128* dst, size_t n) {
+    quad_scope scope;
+    quad_begin(&scope);
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = from_quad(to_quad(a[i]) + to_quad(b[i]));
+    }
+    quad_end(&scope);
+}
+
+void ieee754_binary128_mul_array(
+    const IEEE754Binary128* a, const IEEE754Binary128* b, IEEE754Binary128* dst, size_t n) {
+    quad_scope scope;
+    quad_begin(&scope);
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = from_quad(to_quad(a[i]) * to_quad(b[i]));
+    }
+    quad_end(&scope);
+}
+
+#else
+
+// Never called: Swift checks IEEE754_BINARY128_NATIVE and uses its software
+// implementation instead. Defined so the symbols exist on every target.
+static const IEEE754Binary128 zero = {0, 0};
+
+IEEE754Binary128 ieee754_binary128_add(IEEE754Binary128 a, IEEE754Binary128 b) {
+    (void)a, (void)b;
+    return zero;
+}
+
+IEEE754Binary128 ieee754_binary128_sub(IEEE754Binary128 a, IEEE754Binary128 b) {
+    (void)a, (void)b;
+    return zero;
+}
+
+IEEE754Binary128 ieee754_binary128_mul(IEEE754Binary128 a, IEEE754Binary128 b) {
+    (void)a, (void)b;
+    return zero;
+}
+
+IEEE754Binary128 ieee754_binary128_div(IEEE754Binary128 a, IEEE754Binary128 b) {
+    (void)a, (void)b;
+    return zero;
+}
+
+IEEE754Binary128 ieee754_binary128_from_double(double value) {
+    (void)value;
+    return zero;
+}
+
+double ieee754_binary128_to_double(IEEE754Binary128 value) {
+    (void)value;
+    return 0;
+}
+
+IEEE754Binary128 ieee754_binary128_sum(const IEEE754Binary128* values, size_t n) {
+    (void)values, (void)n;
+    return zero;
+}
+
+IEEE754Binary128 ieee754_binary128_sum_f64(const double* values, size_t n) {
+    (void)values, (void)n;
+    return zero;
+}
+
+IEEE754Binary128 ieee754_binary128_dot_f64(const double* x, const double* y, size_t n) {
+    (void)x, (void)y, (void)n;
+    return zero;
+}
+
+void ieee754_binary128_add_array(
+    const IEEE754Binary128* a, const IEEE754Binary128* b, IEEE754Binary128* dst, size_t n) {
+    (void)a, (void)b, (void)dst, (void)n;
+}
+
+void ieee754_binary128_mul_array(
+    const IEEE754Binary128* a, const IEEE754Binary128* b, IEEE754Binary128* dst, size_t n) {
+    (void)a, (void)b, (void)dst, (void)n;
+}
+
+#endif
@@ -0,0 +1,473 @@
+// binary16_arithmetic.c
+// CIEEE754
+//
+// IEEE 754-2019 Section 5.4.1: Element-wise binary16 arithmetic and widening
+
+#include "include/ieee754_fpu.h"
+#include "binary16_rounding.h"
+#include <fenv.h>
+#include <math.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define IEEE754_BINARY16_X86 1
+#if (defined(__clang__) && __clang_major__ >= 14) || (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 12)
+#define IEEE754_BINARY16_AVX512FP16 1
+#endif
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define IEEE754_BINARY16_NEON 1
+#endif
+
+// =============================================================================
+// MARK: - Batch Exception Scope
+// =============================================================================
+
+// Hardware flags and rounding mode of the caller, saved for one batch.
+// Kernels run with cleared flags in roundTiesToEven; the flags they raise
+// are collected at the end and raised once, together with the flags the
+// software paths computed.
+typedef struct {
+    fexcept_t saved;
+    int rounding;
+} batch_scope;
+
+static void batch_begin(batch_scope* scope) {
+    fegetexceptflag(&scope->saved, FE_ALL_EXCEPT);
+    feclearexcept(FE_ALL_EXCEPT);
+    scope->rounding = fegetround();
+    if (scope->rounding != FE_TONEAREST) {
+        fesetround(FE_TONEAREST);
+    }
+}
+
+static uint8_t batch_end(batch_scope* scope, unsigned software) {
+    int hardware = fetestexcept(FE_ALL_EXCEPT);
+    if (scope->rounding != FE_TONEAREST) {
+        fesetround(scope->rounding);
+    }
+    fesetexceptflag(&scope->saved, FE_ALL_EXCEPT);
+
+    uint8_t mask = 0;
+    int fe = 0;
+    if ((hardware & FE_INVALID) || (software & CONVERSION_INVALID)) {
+        mask |= IEEE754_EXCEPTION_MASK_INVALID;
+        fe |= FE_INVALID;
+    }
+    if (hardware & FE_DIVBYZERO) {
+        mask |= IEEE754_EXCEPTION_MASK_DIVBYZERO;
+        fe |= FE_DIVBYZERO;
+    }
+    if ((hardware & FE_OVERFLOW) || (software & CONVERSION_OVERFLOW)) {
+        mask |= IEEE754_EXCEPTION_MASK_OVERFLOW;
+        fe |= FE_OVERFLOW;
+    }
+    if ((hardware & FE_UNDERFLOW) || (software & CONVERSION_UNDERFLOW)) {
+        mask |= IEEE754_EXCEPTION_MASK_UNDERFLOW;
+        fe |= FE_UNDERFLOW;
+    }
+    if ((hardware & FE_INEXACT) || (software & CONVERSION_INEXACT)) {
+        mask |= IEEE754_EXCEPTION_MASK_INEXACT;
+        fe |= FE_INEXACT;
+    }
+
+    if (mask) {
+        feraiseexcept(fe);
+        ieee754_raise_exceptions_mask(mask);
+    }
+    return mask;
+}
+
+// =============================================================================
+// MARK: - Software binary16 Operations
+// =============================================================================
+
+static inline int half_is_nan(uint16_t h) {
+    return (h & 0x7FFF) > 0x7C00;
+}
+
+static inline int half_is_signaling(uint16_t h) {
+    return half_is_nan(h) && !(h & 0x0200);
+}
+
+// Exact widening; signaling NaNs are quieted with their payload kept
+static inline float half_to_float(uint16_t h, unsigned* flags) {
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t exponent = (h >> 10) & 0x1F;
+    uint32_t fraction = h & 0x3FF;
+    uint32_t bits;
+
+    if (exponent == 0x1F) {
+        bits = sign | 0x7F800000 | fraction << 13;
+        if (half_is_signaling(h)) {
+            bits |= 0x00400000;
+            *flags |= CONVERSION_INVALID;
+        }
+    } else if (exponent == 0) {
+        float magnitude = (float)fraction * 0x1p-24f;
+        memcpy(&bits, &magnitude, sizeof bits);
+        bits |= sign;
+    } else {
+        bits = sign | (exponent + 112) << 23 | fraction << 13;
+    }
+
+    float value;
+    memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+static inline double half_to_double(uint16_t h) {
+    unsigned ignored = 0;
+    return (double)half_to_float(h, &ignored);
+}
+
+// Result for operands of which at least one is NaN: the first NaN, quieted
+static inline uint16_t propagate_nan(uint16_t a, uint16_t b, uint16_t c, unsigned* flags) {
+    if (half_is_signaling(a) || half_is_signaling(b) || half_is_signaling(c)) {
+        *flags |= CONVERSION_INVALID;
+    }
+    uint16_t first = half_is_nan(a) ? a : half_is_nan(b) ? b : c;
+    return first | 0x0200;
+}
+
+// Sums of two binary16 values are exact in binary64, so the only rounding
+// is the final narrowing
+static inline uint16_t half_add(uint16_t a, uint16_t b, unsigned* flags) {
+    if (half_is_nan(a) || half_is_nan(b)) {
+        return propagate_nan(a, b, b, flags);
+    }
+    double sum = half_to_double(a) + half_to_double(b);
+    if (isnan(sum)) {
+        *flags |= CONVERSION_INVALID;
+        return 0x7E00;
+    }
+    return double_to_half_bits(sum, flags);
+}
+
+// Products of two 11-bit significands are exact in binary64
+static inline uint16_t half_mul(uint16_t a, uint16_t b, unsigned* flags) {
+    if (half_is_nan(a) || half_is_nan(b)) {
+        return propagate_nan(a, b, b, flags);
+    }
+    double product = half_to_double(a) * half_to_double(b);
+    if (isnan(product)) {
+        *flags |= CONVERSION_INVALID;
+        return 0x7E00;
+    }
+    return double_to_half_bits(product, flags);
+}
+
+// The product is exact in binary64 but the sum may not be. The sum is
+// rounded to odd (truncated, with the last bit set when inexact) using
+// the exact TwoSum error, which makes the final narrowing a single
+// correct rounding of a × b + c.
+static inline uint16_t half_fma(uint16_t a, uint16_t b, uint16_t c, unsigned* flags) {
+    if (half_is_nan(a) || half_is_nan(b) || half_is_nan(c)) {
+        return propagate_nan(a, b, c, flags);
+    }
+    double product = half_to_double(a) * half_to_double(b);
+    double addend = half_to_double(c);
+    double sum = product + addend;
+    if (isnan(sum)) {
+        *flags |= CONVERSION_INVALID;
+        return 0x7E00;
+    }
+
+    if (isfinite(product) && isfinite(addend)) {
+        double virtual_addend = sum - product;
+        double error = (product - (sum - virtual_addend)) + (addend - virtual_addend);
+        if (error != 0) {
+            uint64_t bits;
+            memcpy(&bits, &sum, sizeof bits);
+            if (!(bits & 1)) {
+                bits = ((error > 0) == (sum > 0)) ? bits + 1 : bits - 1;
+                memcpy(&sum, &bits, sizeof sum);
+            }
+        }
+    }
+    return double_to_half_bits(sum, flags);
+}
+
+// =============================================================================
+// MARK: - Hardware Kernels
+// =============================================================================
+//
+// Each kernel processes whole vectors and returns the number of elements
+// done; the caller finishes the tail in software. Exceptions are raised in
+// the hardware flags and collected by the batch scope.
+
+#if defined(IEEE754_BINARY16_X86)
+
+#if defined(IEEE754_BINARY16_AVX512FP16)
+
+static _Atomic int avx512fp16_level = -1;
+
+static int avx512fp16_available(void) {
+    int level = atomic_load_explicit(&avx512fp16_level, memory_order_relaxed);
+    if (level < 0) {
+        __builtin_cpu_init();
+        level = __builtin_cpu_supports("avx512fp16") && __builtin_cpu_supports("avx512bw");
+        atomic_store_explicit(&avx512fp16_level, level, memory_order_relaxed);
+    }
+    return level;
+}
+
+// Native binary16 arithmetic, 32 lanes at a time
+__attribute__((target("avx512f,avx512bw,avx512fp16")))
+static size_t half_add_avx512(const uint16_t* a, const uint16_t* b, uint16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m512h x = _mm512_loadu_ph(a + i);
+        __m512h y = _mm512_loadu_ph(b + i);
+        _mm512_storeu_ph(dst + i, _mm512_add_ph(x, y));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f,avx512bw,avx512fp16")))
+static size_t half_mul_avx512(const uint16_t* a, const uint16_t* b, uint16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m512h x = _mm512_loadu_ph(a + i);
+        __m512h y = _mm512_loadu_ph(b + i);
+        _mm512_storeu_ph(dst + i, _mm512_mul_ph(x, y));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f,avx512bw,avx512fp16")))
+static size_t half_fma_avx512(const uint16_t* a, const uint16_t* b, const uint16_t* c, uint16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m512h x = _mm512_loadu_ph(a + i);
+        __m512h y = _mm512_loadu_ph(b + i);
+        __m512h z = _mm512_loadu_ph(c + i);
+        _mm512_storeu_ph(dst + i, _mm512_fmadd_ph(x, y, z));
+    }
+    return i;
+}
+
+#endif
+
+// F16C widening, eight lanes at a time
+__attribute__((target("avx,f16c")))
+static size_t half_widen_f16c(const uint16_t* src, float* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+    }
+    return i;
+}
+
+// Widen with F16C, operate in binary32, narrow with F16C. binary32 has
+// more than 2 × 11 + 2 significand bits, so rounding the binary32 sum
+// again to binary16 equals rounding the exact sum once; products are
+// exact in binary32.
+__attribute__((target("avx,f16c")))
+static size_t half_add_f16c(const uint16_t* a, const uint16_t* b, uint16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(a + i)));
+        __m256 y = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(b + i)));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm256_cvtps_ph(_mm256_add_ps(x, y), _MM_FROUND_TO_NEAREST_INT));
+    }
+    return i;
+}
+
+__attribute__((target("avx,f16c")))
+static size_t half_mul_f16c(const uint16_t* a, const uint16_t* b, uint16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(a + i)));
+        __m256 y = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(b + i)));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm256_cvtps_ph(_mm256_mul_ps(x, y), _MM_FROUND_TO_NEAREST_INT));
+    }
+    return i;
+}
+
+#elif defined(IEEE754_BINARY16_NEON)
+
+static size_t half_widen_neon(const uint16_t* src, float* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+    }
+    return i;
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+
+// Native ARMv8.2 FP16 arithmetic, eight lanes at a time
+static size_t half_add_neon(const uint16_t* a, const uint16_t* b, uint16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        float16x8_t x = vreinterpretq_f16_u16(vld1q_u16(a + i));
+        float16x8_t y = vreinterpretq_f16_u16(vld1q_u16(b + i));
+        vst1q_u16(dst + i, vreinterpretq_u16_f16(vaddq_f16(x, y)));
+    }
+    return i;
+}
+
+static size_t half_mul_neon(const uint16_t* a, const uint16_t* b, uint16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        float16x8_t x = vreinterpretq_f16_u16(vld1q_u16(a + i));
+        float16x8_t y = vreinterpretq_f16_u16(vld1q_u16(b + i));
+        vst1q_u16(dst + i, vreinterpretq_u16_f16(vmulq_f16(x, y)));
+    }
+    return i;
+}
+
+static size_t half_fma_neon(const uint16_t* a, const uint16_t* b, const uint16_t* c, uint16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        float16x8_t x = vreinterpretq_f16_u16(vld1q_u16(a + i));
+        float16x8_t y = vreinterpretq_f16_u16(vld1q_u16(b + i));
+        float16x8_t z = vreinterpretq_f16_u16(vld1q_u16(c + i));
+        vst1q_u16(dst + i, vreinterpretq_u16_f16(vfmaq_f16(z, x, y)));
+    }
+    return i;
+}
+
+#else
+
+// Widen, operate in binary32 and narrow with fcvtn; exact for the same
+// reason as the F16C kernels
+static size_t half_add_neon(const uint16_t* a, const uint16_t* b, uint16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t x = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(a + i)));
+        float32x4_t y = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(b + i)));
+        vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vaddq_f32(x, y))));
+    }
+    return i;
+}
+
+static size_t half_mul_neon(const uint16_t* a, const uint16_t* b, uint16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t x = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(a + i)));
+        float32x4_t y = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(b + i)));
+        vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vmulq_f32(x, y))));
+    }
+    return i;
+}
+
+#endif
+
+#endif
+
+// =============================================================================
+// MARK: - Public Entry Points
+// =============================================================================
+
+int ieee754_binary16_native_arithmetic(void) {
+#if defined(IEEE754_BINARY16_AVX512FP16)
+    return avx512fp16_available();
+#elif defined(IEEE754_BINARY16_NEON) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+uint8_t ieee754_binary16_widen_array(const uint16_t* src, float* dst, size_t n) {
+    batch_scope scope;
+    batch_begin(&scope);
+    unsigned flags = 0;
+    size_t i = 0;
+
+#if defined(IEEE754_BINARY16_X86)
+    if (f16c_available()) {
+        i = half_widen_f16c(src, dst, n);
+    }
+#elif defined(IEEE754_BINARY16_NEON)
+    i = half_widen_neon(src, dst, n);
+#endif
+
+    for (; i < n; i++) {
+        dst[i] = half_to_float(src[i], &flags);
+    }
+    return batch_end(&scope, flags);
+}
+
+uint8_t ieee754_binary16_add_array(const uint16_t* a, const uint16_t* b, uint16_t* dst, size_t n) {
+    batch_scope scope;
+    batch_begin(&scope);
+    unsigned flags = 0;
+    size_t i = 0;
+
+#if defined(IEEE754_BINARY16_X86)
+#if defined(IEEE754_BINARY16_AVX512FP16)
+    if (avx512fp16_available()) {
+        i = half_add_avx512(a, b, dst, n);
+    } else
+#endif
+    if (f16c_available()) {
+        i = half_add_f16c(a, b, dst, n);
+    }
+#elif defined(IEEE754_BINARY16_NEON)
+    i = half_add_neon(a, b, dst, n);
+#endif
+
+    for (; i < n; i++) {
+        unsigned element = 0;
+        dst[i] = half_add(a[i], b[i], &element);
+        flags |= element;
+    }
+    return batch_end(&scope, flags);
+}
+
+uint8_t ieee754_binary16_mul_array(const uint16_t* a, const uint16_t* b, uint16_t* dst, size_t n) {
+    batch_scope scope;
+    batch_begin(&scope);
+    unsigned flags = 0;
+    size_t i = 0;
+
+#if defined(IEEE754_BINARY16_X86)
+#if defined(IEEE754_BINARY16_AVX512FP16)
+    if (avx512fp16_available()) {
+        i = half_mul_avx512(a, b, dst, n);
+    } else
+#endif
+    if (f16c_available()) {
+        i = half_mul_f16c(a, b, dst, n);
+    }
+#elif defined(IEEE754_BINARY16_NEON)
+    i = half_mul_neon(a, b, dst, n);
+#endif
+
+    for (; i < n; i++) {
+        unsigned element = 0;
+        dst[i] = half_mul(a[i], b[i], &element);
+        flags |= element;
+    }
+    return batch_end(&scope, flags);
+}
+
+uint8_t ieee754_binary16_fma_array(
+    const uint16_t* a, const uint16_t* b, const uint16_t* c, uint16_t* dst, size_t n
+) {
+    batch_scope scope;
+    batch_begin(&scope);
+    unsigned flags = 0;
+    size_t i = 0;
+
+    // Without native binary16 FMA there is no single-rounding hardware path:
+    // a binary32 FMA followed by narrowing can round twice
+#if defined(IEEE754_BINARY16_AVX512FP16)
+    if (avx512fp16_available()) {
+        i = half_fma_avx512(a, b, c, dst, n);
+    }
+#elif defined(IEEE754_BINARY16_NEON) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+    i = half_fma_neon(a, b, c, dst, n);
+#endif
+
+    for (; i < n; i++) {
+        unsigned element = 0;
+        dst[i] = half_fma(a[i], b[i], c[i], &element);
+        flags |= element;
+    }
+    return batch_end(&scope, flags);
+}
@@ -0,0 +1,135 @@
+// binary16_rounding.h
+// CIEEE754
+//
+// Software binary16 narrowing (roundTiesToEven) shared by the bulk kernels
+
+#ifndef IEEE754_BINARY16_ROUNDING_H
+#define IEEE754_BINARY16_ROUNDING_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+// Per-element exception bits, accumulated by the callers
+enum {
+    CONVERSION_INVALID = 1 << 0,
+    CONVERSION_OVERFLOW = 1 << 1,
+    CONVERSION_UNDERFLOW = 1 << 2,
+    CONVERSION_INEXACT = 1 << 3
+};
+
+// Rounds the `shift` low bits off `significand` to nearest, ties to even.
+// Sets CONVERSION_INEXACT in `flags` when any discarded bit is set.
+static inline uint64_t round_significand(uint64_t significand, unsigned shift, unsigned* flags) {
+    uint64_t result = significand >> shift;
+    uint64_t remainder = significand & ((UINT64_C(1) << shift) - 1);
+    uint64_t half = UINT64_C(1) << (shift - 1);
+
+    if (remainder != 0) {
+        *flags |= CONVERSION_INEXACT;
+    }
+    if (remainder > half || (remainder == half && (result & 1))) {
+        result += 1;
+    }
+    return result;
+}
+
+// Narrow an IEEE 754 value with `mantissa_bits` fraction bits and exponent
+// bias `bias` to binary16 with a single rounding. Tininess is detected
+// before rounding.
+static inline uint16_t narrow_to_half(
+    uint64_t bits, unsigned total_bits, unsigned mantissa_bits, int bias, unsigned* flags
+) {
+    const uint64_t sign_bit = UINT64_C(1) << (total_bits - 1);
+    const uint64_t magnitude = bits & (sign_bit - 1);
+    const uint64_t exponent_mask = ((sign_bit - 1) >> mantissa_bits) << mantissa_bits;
+    const uint64_t mantissa_mask = (UINT64_C(1) << mantissa_bits) - 1;
+    const uint16_t sign = (bits & sign_bit) ? 0x8000 : 0;
+
+    if (magnitude > exponent_mask) {
+        // NaN: keep the leading payload bits, quiet it
+        if (!(magnitude & (UINT64_C(1) << (mantissa_bits - 1)))) {
+            *flags |= CONVERSION_INVALID;
+        }
+        return sign | 0x7E00 | (uint16_t)((magnitude >> (mantissa_bits - 10)) & 0x3FF);
+    }
+    if (magnitude == exponent_mask) {
+        return sign | 0x7C00;
+    }
+    if (magnitude == 0) {
+        return sign;
+    }
+
+    int exponent = (int)(magnitude >> mantissa_bits) - bias;
+    uint64_t significand = magnitude & mantissa_mask;
+    uint16_t result;
+
+    if (exponent >= 16) {
+        *flags |= CONVERSION_OVERFLOW | CONVERSION_INEXACT;
+        return sign | 0x7C00;
+    }
+
+    if (exponent >= -14) {
+        // Normal range: a carry out of the significand bumps the exponent,
+        // reaching 0x7C00 (infinity) exactly when the value overflows
+        uint64_t biased = ((uint64_t)(exponent + 15) << mantissa_bits) | significand;
+        result = (uint16_t)round_significand(biased, mantissa_bits - 10, flags);
+        if (result >= 0x7C00) {
+            *flags |= CONVERSION_OVERFLOW | CONVERSION_INEXACT;
+        }
+        return sign | result;
+    }
+
+    // Subnormal binary16 (or smaller than half the least subnormal)
+    if (exponent < -25) {
+        *flags |= CONVERSION_UNDERFLOW | CONVERSION_INEXACT;
+        return sign;
+    }
+
+    if ((magnitude >> mantissa_bits) != 0) {
+        significand |= UINT64_C(1) << mantissa_bits;
+    }
+    // Tiny and inexact is decided for this value alone: `flags` may already
+    // hold INEXACT from earlier elements of a batch
+    unsigned rounding = 0;
+    result = (uint16_t)round_significand(significand, (unsigned)(mantissa_bits - 10 + (-14 - exponent)), &rounding);
+    if (rounding & CONVERSION_INEXACT) {
+        rounding |= CONVERSION_UNDERFLOW;
+    }
+    *flags |= rounding;
+    return sign | result;
+}
+
+static inline uint16_t float_to_half_bits(float value, unsigned* flags) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof bits);
+    return narrow_to_half(bits, 32, 23, 127, flags);
+}
+
+static inline uint16_t double_to_half_bits(double value, unsigned* flags) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof bits);
+    return narrow_to_half(bits, 64, 52, 1023, flags);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// Whether the CPU has AVX and F16C, checked once per translation unit
+static inline int f16c_available(void) {
+    static _Atomic int f16c_level = -1;
+    int level = atomic_load_explicit(&f16c_level, memory_order_relaxed);
+    if (level < 0) {
+        __builtin_cpu_init();
+        level = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+        atomic_store_explicit(&f16c_level, level, memory_order_relaxed);
+    }
+    return level;
+}
+
+#endif
+
+#endif // IEEE754_BINARY16_ROUNDING_H
@@ -0,0 +1,225 @@
+// byte_order.c
+// CIEEE754
+//
+// IEEE 754-2019 Section 3.4: Bulk byte-order conversion of binary interchange formats
+
+#include "include/ieee754_fpu.h"
+#include <stdatomic.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define IEEE754_BYTE_ORDER_X86 1
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#define IEEE754_BYTE_ORDER_NEON 1
+#endif
+
+// =============================================================================
+// MARK: - Scalar Kernels
+// =============================================================================
+
+// Scalar tails operate through memcpy so neither buffer needs to be aligned.
+
+static void byteswap16_scalar(uint8_t* dst, const uint8_t* src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint16_t value;
+        memcpy(&value, src + i * 2, sizeof value);
+        value = __builtin_bswap16(value);
+        memcpy(dst + i * 2, &value, sizeof value);
+    }
+}
+
+static void byteswap32_scalar(uint8_t* dst, const uint8_t* src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t value;
+        memcpy(&value, src + i * 4, sizeof value);
+        value = __builtin_bswap32(value);
+        memcpy(dst + i * 4, &value, sizeof value);
+    }
+}
+
+static void byteswap64_scalar(uint8_t* dst, const uint8_t* src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint64_t value;
+        memcpy(&value, src + i * 8, sizeof value);
+        value = __builtin_bswap64(value);
+        memcpy(dst + i * 8, &value, sizeof value);
+    }
+}
+
+// =============================================================================
+// MARK: - x86 Kernels (SSSE3 / AVX2 pshufb)
+// =============================================================================
+
+#if defined(IEEE754_BYTE_ORDER_X86)
+
+// pshufb control masks, repeated for both 128-bit lanes of an AVX2 register
+static const uint8_t shuffle16[32] = {
+    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+};
+
+static const uint8_t shuffle32[32] = {
+    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+};
+
+static const uint8_t shuffle64[32] = {
+    7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+    7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+};
+
+// Returns the number of bytes processed; the caller finishes the tail
+__attribute__((target("ssse3")))
+static size_t byteswap_ssse3(uint8_t* dst, const uint8_t* src, size_t bytes, const uint8_t* pattern) {
+    const __m128i mask = _mm_loadu_si128((const __m128i*)pattern);
+    size_t offset = 0;
+
+    for (; offset + 16 <= bytes; offset += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(src + offset));
+        _mm_storeu_si128((__m128i*)(dst + offset), _mm_shuffle_epi8(block, mask));
+    }
+
+    return offset;
+}
+
+__attribute__((target("avx2")))
+static size_t byteswap_avx2(uint8_t* dst, const uint8_t* src, size_t bytes, const uint8_t* pattern) {
+    const __m256i mask = _mm256_loadu_si256((const __m256i*)pattern);
+    size_t offset = 0;
+
+    for (; offset + 64 <= bytes; offset += 64) {
+        __m256i first = _mm256_loadu_si256((const __m256i*)(src + offset));
+        __m256i second = _mm256_loadu_si256((const __m256i*)(src + offset + 32));
+        _mm256_storeu_si256((__m256i*)(dst + offset), _mm256_shuffle_epi8(first, mask));
+        _mm256_storeu_si256((__m256i*)(dst + offset + 32), _mm256_shuffle_epi8(second, mask));
+    }
+
+    for (; offset + 32 <= bytes; offset += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(src + offset));
+        _mm256_storeu_si256((__m256i*)(dst + offset), _mm256_shuffle_epi8(block, mask));
+    }
+
+    return offset;
+}
+
+enum {
+    BYTE_ORDER_LEVEL_UNKNOWN = -1,
+    BYTE_ORDER_LEVEL_SCALAR = 0,
+    BYTE_ORDER_LEVEL_SSSE3 = 1,
+    BYTE_ORDER_LEVEL_AVX2 = 2
+};
+
+static _Atomic int byte_order_level = BYTE_ORDER_LEVEL_UNKNOWN;
+
+// Detect the widest available shuffle once and cache it process-wide
+static int byte_order_dispatch_level(void) {
+    int level = atomic_load_explicit(&byte_order_level, memory_order_relaxed);
+    if (level != BYTE_ORDER_LEVEL_UNKNOWN) {
+        return level;
+    }
+
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        level = BYTE_ORDER_LEVEL_AVX2;
+    } else if (__builtin_cpu_supports("ssse3")) {
+        level = BYTE_ORDER_LEVEL_SSSE3;
+    } else {
+        level = BYTE_ORDER_LEVEL_SCALAR;
+    }
+
+    atomic_store_explicit(&byte_order_level, level, memory_order_relaxed);
+    return level;
+}
+
+static size_t byteswap_vector(uint8_t* dst, const uint8_t* src, size_t bytes, const uint8_t* pattern) {
+    switch (byte_order_dispatch_level()) {
+        case BYTE_ORDER_LEVEL_AVX2:
+            return byteswap_avx2(dst, src, bytes, pattern);
+        case BYTE_ORDER_LEVEL_SSSE3:
+            return byteswap_ssse3(dst, src, bytes, pattern);
+        default:
+            return 0;
+    }
+}
+
+#endif
+
+// =============================================================================
+// MARK: - arm64 Kernels (NEON vrev)
+// =============================================================================
+
+#if defined(IEEE754_BYTE_ORDER_NEON)
+
+static size_t byteswap16_neon(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    size_t offset = 0;
+    for (; offset + 16 <= bytes; offset += 16) {
+        vst1q_u8(dst + offset, vrev16q_u8(vld1q_u8(src + offset)));
+    }
+    return offset;
+}
+
+static size_t byteswap32_neon(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    size_t offset = 0;
+    for (; offset + 16 <= bytes; offset += 16) {
+        vst1q_u8(dst + offset, vrev32q_u8(vld1q_u8(src + offset)));
+    }
+    return offset;
+}
+
+static size_t byteswap64_neon(uint8_t* dst, const uint8_t* src, size_t bytes) {
+    size_t offset = 0;
+    for (; offset + 16 <= bytes; offset += 16) {
+        vst1q_u8(dst + offset, vrev64q_u8(vld1q_u8(src + offset)));
+    }
+    return offset;
+}
+
+#endif
+
+// =============================================================================
+// MARK: - Public Entry Points
+// =============================================================================
+
+void ieee754_byteswap16(void* dst, const void* src, size_t count) {
+    uint8_t* out = dst;
+    const uint8_t* in = src;
+    size_t done = 0;
+
+#if defined(IEEE754_BYTE_ORDER_X86)
+    done = byteswap_vector(out, in, count * 2, shuffle16);
+#elif defined(IEEE754_BYTE_ORDER_NEON)
+    done = byteswap16_neon(out, in, count * 2);
+#endif
+
+    byteswap16_scalar(out + done, in + done, count - done / 2);
+}
+
+void ieee754_byteswap32(void* dst, const void* src, size_t count) {
+    uint8_t* out = dst;
+    const uint8_t* in = src;
+    size_t done = 0;
+
+#if defined(IEEE754_BYTE_ORDER_X86)
+    done = byteswap_vector(out, in, count * 4, shuffle32);
+#elif defined(IEEE754_BYTE_ORDER_NEON)
+    done = byteswap32_neon(out, in, count * 4);
+#endif
+
+    byteswap32_scalar(out + done, in + done, count - done / 4);
+}
+
+void ieee754_byteswap64(void* dst, const void* src, size_t count) {
+    uint8_t* out = dst;
+    const uint8_t* in = src;
+    size_t done = 0;
+
+#if defined(IEEE754_BYTE_ORDER_X86)
+    done = byteswap_vector(out, in, count * 8, shuffle64);
+#elif defined(IEEE754_BYTE_ORDER_NEON)
+    done = byteswap64_neon(out, in, count * 8);
+#endif
+
+    byteswap64_scalar(out + done, in + done, count - done / 8);
+}
@@ -0,0 +1,224 @@
+// conversions.c
+// CIEEE754
+//
+// IEEE 754-2019 Section 5.4.2: Bulk narrowing formatOf conversions
+
+#include "include/ieee754_fpu.h"
+#include "binary16_rounding.h"
+#include <fenv.h>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define IEEE754_CONVERSIONS_X86 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define IEEE754_CONVERSIONS_NEON 1
+#endif
+
+static inline void summary_add(IEEE754ConversionSummary* summary, unsigned flags) {
+    summary->invalid += (flags & CONVERSION_INVALID) != 0;
+    summary->overflow += (flags & CONVERSION_OVERFLOW) != 0;
+    summary->underflow += (flags & CONVERSION_UNDERFLOW) != 0;
+    summary->inexact += (flags & CONVERSION_INEXACT) != 0;
+}
+
+// Raise each exception that occurred anywhere in the batch exactly once
+static void summary_raise(const IEEE754ConversionSummary* summary) {
+    uint8_t mask = 0;
+    int fe = 0;
+
+    if (summary->invalid) {
+        mask |= IEEE754_EXCEPTION_MASK_INVALID;
+        fe |= FE_INVALID;
+    }
+    if (summary->overflow) {
+        mask |= IEEE754_EXCEPTION_MASK_OVERFLOW;
+        fe |= FE_OVERFLOW;
+    }
+    if (summary->underflow) {
+        mask |= IEEE754_EXCEPTION_MASK_UNDERFLOW;
+        fe |= FE_UNDERFLOW;
+    }
+    if (summary->inexact) {
+        mask |= IEEE754_EXCEPTION_MASK_INEXACT;
+        fe |= FE_INEXACT;
+    }
+
+    if (mask) {
+        feraiseexcept(fe);
+        ieee754_raise_exceptions_mask(mask);
+    }
+}
+
+// =============================================================================
+// MARK: - Hardware binary32 → binary16 Kernels
+// =============================================================================
+
+#if defined(IEEE754_CONVERSIONS_X86)
+
+// vcvtps2ph with an explicit round-to-nearest immediate, eight lanes at a
+// time. Exceptions are derived from the round trip back to binary32.
+// Returns the number of elements processed; the caller finishes the tail.
+__attribute__((target("avx,f16c")))
+static size_t float_to_half_f16c(const float* src, uint16_t* dst, size_t n, IEEE754ConversionSummary* summary) {
+    const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    const __m256 largest = _mm256_set1_ps(FLT_MAX);
+    const __m256 overflow_limit = _mm256_set1_ps(65536.0f);
+    const __m256 smallest_normal = _mm256_set1_ps(0x1p-14f);
+    const __m256 infinity = _mm256_set1_ps(INFINITY);
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_loadu_ps(src + i);
+        __m128i half = _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i*)(dst + i), half);
+
+        __m256 back = _mm256_cvtph_ps(half);
+        __m256 magnitude = _mm256_and_ps(x, abs_mask);
+        __m256 finite = _mm256_cmp_ps(magnitude, largest, _CMP_LE_OQ);
+        __m256 inexact = _mm256_and_ps(finite, _mm256_cmp_ps(back, x, _CMP_NEQ_UQ));
+        __m256 overflow = _mm256_and_ps(
+            finite,
+            _mm256_or_ps(
+                _mm256_cmp_ps(_mm256_and_ps(back, abs_mask), infinity, _CMP_EQ_OQ),
+                _mm256_cmp_ps(magnitude, overflow_limit, _CMP_GE_OQ)
+            )
+        );
+        __m256 underflow = _mm256_and_ps(inexact, _mm256_cmp_ps(magnitude, smallest_normal, _CMP_LT_OQ));
+
+        summary->inexact += (size_t)__builtin_popcount((unsigned)_mm256_movemask_ps(inexact));
+        summary->overflow += (size_t)__builtin_popcount((unsigned)_mm256_movemask_ps(overflow));
+        summary->underflow += (size_t)__builtin_popcount((unsigned)_mm256_movemask_ps(underflow));
+
+        // Signaling NaNs are rare; only inspect lanes when a block holds a NaN
+        if (_mm256_movemask_ps(_mm256_cmp_ps(x, x, _CMP_UNORD_Q))) {
+            for (size_t lane = 0; lane < 8; lane++) {
+                unsigned flags = 0;
+                (void)float_to_half_bits(src[i + lane], &flags);
+                summary->invalid += (flags & CONVERSION_INVALID) != 0;
+            }
+        }
+    }
+
+    return i;
+}
+
+#elif defined(IEEE754_CONVERSIONS_NEON)
+
+// fcvtn four lanes at a time. It rounds in the FPCR mode, so the caller only
+// runs it under FE_TONEAREST.
+static size_t float_to_half_neon(const float* src, uint16_t* dst, size_t n, IEEE754ConversionSummary* summary) {
+    const float32x4_t largest = vdupq_n_f32(FLT_MAX);
+    const float32x4_t overflow_limit = vdupq_n_f32(65536.0f);
+    const float32x4_t smallest_normal = vdupq_n_f32(0x1p-14f);
+    const float32x4_t infinity = vdupq_n_f32(INFINITY);
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t x = vld1q_f32(src + i);
+        float16x4_t half = vcvt_f16_f32(x);
+        vst1_u16(dst + i, vreinterpret_u16_f16(half));
+
+        float32x4_t back = vcvt_f32_f16(half);
+        float32x4_t magnitude = vabsq_f32(x);
+        uint32x4_t finite = vcleq_f32(magnitude, largest);
+        uint32x4_t inexact = vandq_u32(finite, vmvnq_u32(vceqq_f32(back, x)));
+        uint32x4_t overflow = vandq_u32(
+            finite, vorrq_u32(vceqq_f32(vabsq_f32(back), infinity), vcgeq_f32(magnitude, overflow_limit))
+        );
+        uint32x4_t underflow = vandq_u32(inexact, vcltq_f32(magnitude, smallest_normal));
+
+        summary->inexact += vaddvq_u32(vshrq_n_u32(inexact, 31));
+        summary->overflow += vaddvq_u32(vshrq_n_u32(overflow, 31));
+        summary->underflow += vaddvq_u32(vshrq_n_u32(underflow, 31));
+
+        if (vmaxvq_u32(vmvnq_u32(vceqq_f32(x, x)))) {
+            for (size_t lane = 0; lane < 4; lane++) {
+                unsigned flags = 0;
+                (void)float_to_half_bits(src[i + lane], &flags);
+                summary->invalid += (flags & CONVERSION_INVALID) != 0;
+            }
+        }
+    }
+
+    return i;
+}
+
+#endif
+
+// =============================================================================
+// MARK: - Public Entry Points
+// =============================================================================
+
+IEEE754ConversionSummary ieee754_convert_f64_to_f32_array(const double* src, float* dst, size_t n) {
+    IEEE754ConversionSummary summary = {0, 0, 0, 0};
+    size_t inexact = 0, overflow = 0, underflow = 0, invalid = 0;
+
+    // Branch-free so the compiler can vectorize the conversion and the counts
+    for (size_t i = 0; i < n; i++) {
+        double value = src[i];
+        float narrowed = (float)value;
+        dst[i] = narrowed;
+
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof bits);
+        double magnitude = fabs(value);
+        int finite = magnitude <= DBL_MAX;
+        int is_inexact = finite & ((double)narrowed != value);
+
+        inexact += (size_t)is_inexact;
+        overflow += (size_t)(finite & ((fabsf(narrowed) == INFINITY) | (magnitude >= 0x1p128)));
+        underflow += (size_t)(is_inexact & (magnitude < (double)FLT_MIN));
+        invalid += (size_t)(((bits & UINT64_C(0x7FFFFFFFFFFFFFFF)) > UINT64_C(0x7FF0000000000000))
+                            & !(bits & UINT64_C(0x0008000000000000)));
+    }
+
+    summary.inexact = inexact;
+    summary.overflow = overflow;
+    summary.underflow = underflow;
+    summary.invalid = invalid;
+    summary_raise(&summary);
+    return summary;
+}
+
+IEEE754ConversionSummary ieee754_convert_f32_to_f16_array(const float* src, uint16_t* dst, size_t n) {
+    IEEE754ConversionSummary summary = {0, 0, 0, 0};
+    size_t i = 0;
+
+#if defined(IEEE754_CONVERSIONS_X86)
+    if (f16c_available()) {
+        i = float_to_half_f16c(src, dst, n, &summary);
+    }
+#elif defined(IEEE754_CONVERSIONS_NEON)
+    // In a directed mode the software path keeps roundTiesToEven
+    if (fegetround() == FE_TONEAREST) {
+        i = float_to_half_neon(src, dst, n, &summary);
+    }
+#endif
+
+    for (; i < n; i++) {
+        unsigned flags = 0;
+        dst[i] = float_to_half_bits(src[i], &flags);
+        summary_add(&summary, flags);
+    }
+
+    summary_raise(&summary);
+    return summary;
+}
+
+IEEE754ConversionSummary ieee754_convert_f64_to_f16_array(const double* src, uint16_t* dst, size_t n) {
+    IEEE754ConversionSummary summary = {0, 0, 0, 0};
+
+    // Converting through binary32 would round twice; narrow directly instead
+    for (size_t i = 0; i < n; i++) {
+        unsigned flags = 0;
+        dst[i] = double_to_half_bits(src[i], &flags);
+        summary_add(&summary, flags);
+    }
+
+    summary_raise(&summary);
+    return summary;
+}
@@ -0,0 +1,820 @@
+// decimal_text.c
+// CIEEE754
+//
+// Shortest round-trip decimal formatting and correctly rounded parsing for binary16/32/64
+
+#include "include/ieee754_fpu.h"
+#include "decimal_tables.h"
+#include <string.h>
+
+// Formatting is Schubfach (Giulietti, "The Schubfach way to render
+// doubles"): the shortest decimal in the rounding interval, closest to the
+// value, ties to even digits, from three multiplications by a 128-bit (64
+// for binary32 and binary16) power of ten. Parsing is Eisel-Lemire
+// ("Number Parsing at a Gigabyte per Second"): one or two 64×64-bit
+// products against the same table give the correctly rounded result
+// unless more than 19 significant digits decide it, which falls back to an
+// exact big-integer comparison. Neither side touches the floating-point
+// environment, so results never depend on the rounding mode and no
+// exceptions are signaled.
+
+typedef struct {
+    uint64_t high;
+    uint64_t low;
+} U128;
+
+static inline U128 multiply_64(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = (unsigned __int128)a * b;
+    return (U128){(uint64_t)(product >> 64), (uint64_t)product};
+#else
+    uint64_t a_low = (uint32_t)a, a_high = a >> 32;
+    uint64_t b_low = (uint32_t)b, b_high = b >> 32;
+    uint64_t low_low = a_low * b_low;
+    uint64_t high_low = a_high * b_low;
+    uint64_t low_high = a_low * b_high;
+    uint64_t middle = high_low + (low_low >> 32) + (uint32_t)low_high;
+    return (U128){a_high * b_high + (middle >> 32) + (low_high >> 32), (middle << 32) | (uint32_t)low_low};
+#endif
+}
+
+static inline uint64_t double_bits(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+static inline double bits_double(uint64_t bits) {
+    double value;
+    memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+static inline uint32_t float_bits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+static inline float bits_float(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+// floor(log2(10^e)) and floor(log10(2^e)), exact over the table's range
+static inline int floor_log2_pow10(int e) {
+    return (e * 1741647) >> 19;
+}
+
+static inline int floor_log10_pow2(int e) {
+    return (e * 1262611) >> 22;
+}
+
+// floor(log10(3/4 × 2^e)), for values whose lower neighbour is closer
+static inline int floor_log10_three_quarters_pow2(int e) {
+    return (e * 1262611 - 524031) >> 22;
+}
+
+// =============================================================================
+// MARK: - Schubfach
+// =============================================================================
+
+typedef struct {
+    uint64_t digits;
+    int exponent;
+} Decimal;
+
+// Schubfach's g: the table entry rounded up, so that it over-approximates 10^k
+static inline U128 schubfach_pow10_128(int k) {
+    const uint64_t* entry = ieee754_pow10_128[k - IEEE754_POW10_MIN];
+    uint64_t low = entry[1] + 1;
+    return (U128){entry[0] + (low == 0), low};
+}
+
+static inline uint64_t schubfach_pow10_64(int k) {
+    return ieee754_pow10_128[k - IEEE754_POW10_MIN][0] + 1;
+}
+
+// The middle 64 bits of g × cp, with the bits below rounded to odd
+static inline uint64_t round_to_odd_64(U128 g, uint64_t cp) {
+    U128 low = multiply_64(g.low, cp);
+    U128 high = multiply_64(g.high, cp);
+    uint64_t middle = high.low + low.high;
+    high.high += middle < low.high;
+    return high.high | (middle > 1);
+}
+
+static inline uint32_t round_to_odd_32(uint64_t g, uint32_t cp) {
+    U128 p = multiply_64(g, cp);
+    uint32_t y1 = (uint32_t)p.high;
+    uint32_t y0 = (uint32_t)(p.low >> 32);
+    return y1 | (y0 > 1);
+}
+
+// Shortest decimal for c × 2^q; `closer` is set for powers of two whose lower
+// neighbour is half as far away
+static Decimal schubfach_64(uint64_t c, int q, int closer) {
+    int even = (c & 1) == 0;
+    uint64_t cbl = 4 * c - 2 + (uint64_t)closer;
+    uint64_t cb = 4 * c;
+    uint64_t cbr = 4 * c + 2;
+
+    int k = closer ? floor_log10_three_quarters_pow2(q) : floor_log10_pow2(q);
+    int h = q + floor_log2_pow10(-k) + 1;
+    U128 g = schubfach_pow10_128(-k);
+
+    uint64_t vbl = round_to_odd_64(g, cbl << h);
+    uint64_t vb = round_to_odd_64(g, cb << h);
+    uint64_t vbr = round_to_odd_64(g, cbr << h);
+    uint64_t lower = vbl + !even;
+    uint64_t upper = vbr - !even;
+
+    // One digit shorter if exactly one of its two candidates is inside
+    uint64_t s = vb / 4;
+    if (s >= 10) {
+        uint64_t sp = s / 10;
+        int up_inside = lower <= 40 * sp;
+        int wp_inside = 40 * sp + 40 <= upper;
+        if (up_inside != wp_inside) {
+            return (Decimal){sp + (uint64_t)wp_inside, k + 1};
+        }
+    }
+    int u_inside = lower <= 4 * s;
+    int w_inside = 4 * s + 4 <= upper;
+    if (u_inside != w_inside) {
+        return (Decimal){s + (uint64_t)w_inside, k};
+    }
+    uint64_t mid = 4 * s + 2;
+    int round_up = vb > mid || (vb == mid && (s & 1) != 0);
+    return (Decimal){s + (uint64_t)round_up, k};
+}
+
+static Decimal schubfach_32(uint32_t c, int q, int closer) {
+    int even = (c & 1) == 0;
+    uint32_t cbl = 4 * c - 2 + (uint32_t)closer;
+    uint32_t cb = 4 * c;
+    uint32_t cbr = 4 * c + 2;
+
+    int k = closer ? floor_log10_three_quarters_pow2(q) : floor_log10_pow2(q);
+    int h = q + floor_log2_pow10(-k) + 1;
+    uint64_t g = schubfach_pow10_64(-k);
+
+    uint32_t vbl = round_to_odd_32(g, cbl << h);
+    uint32_t vb = round_to_odd_32(g, cb << h);
+    uint32_t vbr = round_to_odd_32(g, cbr << h);
+    uint32_t lower = vbl + !even;
+    uint32_t upper = vbr - !even;
+
+    uint32_t s = vb / 4;
+    if (s >= 10) {
+        uint32_t sp = s / 10;
+        int up_inside = lower <= 40 * sp;
+        int wp_inside = 40 * sp + 40 <= upper;
+        if (up_inside != wp_inside) {
+            return (Decimal){sp + (uint32_t)wp_inside, k + 1};
+        }
+    }
+    int u_inside = lower <= 4 * s;
+    int w_inside = 4 * s + 4 <= upper;
+    if (u_inside != w_inside) {
+        return (Decimal){s + (uint32_t)w_inside, k};
+    }
+    uint32_t mid = 4 * s + 2;
+    int round_up = vb > mid || (vb == mid && (s & 1) != 0);
+    return (Decimal){s + (uint32_t)round_up, k};
+}
+
+// Shortest decimal for the finite nonzero magnitude with the given fields.
+// Integers below 2^(p) are their own shortest form.
+static Decimal shortest(uint64_t fraction, int field, int fraction_bits, int bias) {
+    uint64_t c;
+    int q;
+    if (field != 0) {
+        c = fraction | ((uint64_t)1 << fraction_bits);
+        q = field - bias - fraction_bits;
+        if (q <= 0 && -q <= fraction_bits && (c & (((uint64_t)1 << -q) - 1)) == 0) {
+            return (Decimal){c >> -q, 0};
+        }
+    } else {
+        c = fraction;
+        q = 1 - bias - fraction_bits;
+    }
+    int closer = fraction == 0 && field > 1;
+    if (fraction_bits > 23) {
+        return schubfach_64(c, q, closer);
+    }
+    return schubfach_32((uint32_t)c, q, closer);
+}
+
+// =============================================================================
+// MARK: - Layout
+// =============================================================================
+
+static const char digit_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Writes the decimal digits of `value` (nonzero) and returns their count
+static int write_digits(uint64_t value, uint8_t* out) {
+    uint8_t scratch[20];
+    int position = 20;
+    while (value >= 100) {
+        uint64_t pair = value % 100;
+        value /= 100;
+        position -= 2;
+        memcpy(scratch + position, digit_pairs + 2 * pair, 2);
+    }
+    if (value >= 10) {
+        position -= 2;
+        memcpy(scratch + position, digit_pairs + 2 * value, 2);
+    } else {
+        scratch[--position] = (uint8_t)('0' + value);
+    }
+    memcpy(out, scratch + position, (size_t)(20 - position));
+    return 20 - position;
+}
+
+// Lays out digits × 10^exponent as ECMAScript's Number::toString does:
+// plain integers and decimals while the point falls within 21 digits (or
+// up to six zeros after it), scientific notation with a signed exponent
+// otherwise. Trailing zeros have already been stripped.
+static size_t layout(int negative, Decimal decimal, uint8_t* out) {
+    uint8_t digits[20];
+    int count = write_digits(decimal.digits, digits);
+    int point = count + decimal.exponent;
+    uint8_t* cursor = out;
+
+    if (negative) {
+        *cursor++ = '-';
+    }
+    if (count <= point && point <= 21) {
+        memcpy(cursor, digits, (size_t)count);
+        memset(cursor + count, '0', (size_t)(point - count));
+        cursor += point;
+    } else if (0 < point && point <= 21) {
+        memcpy(cursor, digits, (size_t)point);
+        cursor[point] = '.';
+        memcpy(cursor + point + 1, digits + point, (size_t)(count - point));
+        cursor += count + 1;
+    } else if (-6 < point && point <= 0) {
+        cursor[0] = '0';
+        cursor[1] = '.';
+        memset(cursor + 2, '0', (size_t)-point);
+        memcpy(cursor + 2 - point, digits, (size_t)count);
+        cursor += 2 - point + count;
+    } else {
+        *cursor++ = digits[0];
+        if (count > 1) {
+            *cursor++ = '.';
+            memcpy(cursor, digits + 1, (size_t)(count - 1));
+            cursor += count - 1;
+        }
+        int exponent = point - 1;
+        *cursor++ = 'e';
+        *cursor++ = exponent < 0 ? '-' : '+';
+        cursor += write_digits((uint64_t)(exponent < 0 ? -exponent : exponent), cursor);
+    }
+    return (size_t)(cursor - out);
+}
+
+static size_t write_text(uint8_t* out, const char* text) {
+    size_t length = strlen(text);
+    memcpy(out, text, length);
+    return length;
+}
+
+static size_t format_fields(int negative, uint64_t fraction, int field, int fraction_bits, int exponent_bits,
+                            uint8_t* out) {
+    int max_field = (1 << exponent_bits) - 1;
+    if (field == max_field) {
+        if (fraction == 0) {
+            return write_text(out, negative ? "-inf" : "inf");
+        }
+        int quiet = (fraction >> (fraction_bits - 1)) & 1;
+        return write_text(out, quiet ? (negative ? "-nan" : "nan") : (negative ? "-snan" : "snan"));
+    }
+    if (field == 0 && fraction == 0) {
+        return write_text(out, negative ? "-0" : "0");
+    }
+
+    Decimal decimal = shortest(fraction, field, fraction_bits, (1 << (exponent_bits - 1)) - 1);
+    while (decimal.digits % 10 == 0) {
+        decimal.digits /= 10;
+        decimal.exponent += 1;
+    }
+    return layout(negative, decimal, out);
+}
+
+size_t ieee754_format_f64(double value, void* buffer) {
+    uint64_t bits = double_bits(value);
+    return format_fields((int)(bits >> 63), bits & 0xFFFFFFFFFFFFF, (int)((bits >> 52) & 0x7FF), 52, 11, buffer);
+}
+
+size_t ieee754_format_f32(float value, void* buffer) {
+    uint32_t bits = float_bits(value);
+    return format_fields((int)(bits >> 31), bits & 0x7FFFFF, (int)((bits >> 23) & 0xFF), 23, 8, buffer);
+}
+
+size_t ieee754_format_f16(uint16_t bits, void* buffer) {
+    return format_fields(bits >> 15, bits & 0x3FF, (bits >> 10) & 0x1F, 10, 5, buffer);
+}
+
+size_t ieee754_format_f64_array(const double* src, size_t n, uint8_t separator, void* dst) {
+    uint8_t* const start = dst;
+    uint8_t* cursor = start;
+    for (size_t i = 0; i < n; i++) {
+        if (i > 0) {
+            *cursor++ = separator;
+        }
+        cursor += ieee754_format_f64(src[i], cursor);
+    }
+    return (size_t)(cursor - start);
+}
+
+size_t ieee754_format_f32_array(const float* src, size_t n, uint8_t separator, void* dst) {
+    uint8_t* const start = dst;
+    uint8_t* cursor = start;
+    for (size_t i = 0; i < n; i++) {
+        if (i > 0) {
+            *cursor++ = separator;
+        }
+        cursor += ieee754_format_f32(src[i], cursor);
+    }
+    return (size_t)(cursor - start);
+}
+
+size_t ieee754_format_f16_array(const uint16_t* src, size_t n, uint8_t separator, void* dst) {
+    uint8_t* const start = dst;
+    uint8_t* cursor = start;
+    for (size_t i = 0; i < n; i++) {
+        if (i > 0) {
+            *cursor++ = separator;
+        }
+        cursor += ieee754_format_f16(src[i], cursor);
+    }
+    return (size_t)(cursor - start);
+}
+
+// =============================================================================
+// MARK: - Eisel-Lemire
+// =============================================================================
+
+typedef struct {
+    int fraction_bits;
+    int exponent_bits;
+    int smallest_power_of_ten;
+    int largest_power_of_ten;
+    int min_exponent_round_to_even;
+    int max_exponent_round_to_even;
+} Format;
+
+// Powers of ten outside [smallest, largest] always round to zero or
+// overflow; exact ties between normal results only occur within the
+// round-to-even range
+static const Format binary64_format = {52, 11, -342, 308, -4, 23};
+static const Format binary32_format = {23, 8, -64, 38, -17, 10};
+static const Format binary16_format = {10, 5, -27, 4, -22, 5};
+
+static inline uint64_t infinity_encoding(const Format* format) {
+    return (((uint64_t)1 << format->exponent_bits) - 1) << format->fraction_bits;
+}
+
+static inline int exponent_bias(const Format* format) {
+    return (1 << (format->exponent_bits - 1)) - 1;
+}
+
+// The table entry for 5^q: truncated, except that fast_float's rounded-up
+// entries for q in [-27, -1] are what its exactness checks rely on
+static inline void lemire_pow10(int q, uint64_t* high, uint64_t* low) {
+    const uint64_t* entry = ieee754_pow10_128[q - IEEE754_POW10_MIN];
+    *high = entry[0];
+    *low = entry[1];
+    if (q >= -27 && q < 0) {
+        *low += 1;
+        *high += *low == 0;
+    }
+}
+
+// The encoding (without sign) of w × 10^q rounded to nearest, ties to even.
+// `*ambiguous` is set when the product cannot tell whether w × 10^q is a
+// tie between two subnormals; the result is then the lower of the two.
+static uint64_t lemire(const Format* format, int64_t q, uint64_t w, int* ambiguous) {
+    const int bits = format->fraction_bits;
+    const int infinite_power = (1 << format->exponent_bits) - 1;
+    *ambiguous = 0;
+    if (w == 0 || q < format->smallest_power_of_ten) {
+        return 0;
+    }
+    if (q > format->largest_power_of_ten) {
+        return infinity_encoding(format);
+    }
+
+    int lz = __builtin_clzll(w);
+    w <<= lz;
+
+    uint64_t table_high, table_low;
+    lemire_pow10((int)q, &table_high, &table_low);
+    U128 first = multiply_64(w, table_high);
+    uint64_t high = first.high;
+    uint64_t low = first.low;
+    uint64_t precision_mask = UINT64_MAX >> (bits + 3);
+    if ((high & precision_mask) == precision_mask) {
+        uint64_t carry = multiply_64(w, table_low).high;
+        low += carry;
+        high += low < carry;
+    }
+
+    int upper_bit = (int)(high >> 63);
+    int shift = upper_bit + 64 - bits - 3;
+    uint64_t mantissa = high >> shift;
+    int power2 = (int)((((152170 + 65536) * q) >> 16) + 63) + upper_bit - lz + exponent_bias(format);
+
+    if (power2 <= 0) {
+        int total = shift - power2 + 1;
+        if (total >= 64) {
+            return 0;
+        }
+        // The lowest kept bit is the round bit. Within the product's error of
+        // a tie, let the caller decide exactly.
+        mantissa = high >> total;
+        uint64_t rest_mask = ((uint64_t)1 << total) - 1;
+        uint64_t rest = high & rest_mask;
+        if ((mantissa & 1) ? rest == 0 : rest == rest_mask) {
+            *ambiguous = 1;
+            return mantissa >> 1;
+        }
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        return mantissa;
+    }
+
+    if (low <= 1 && q >= format->min_exponent_round_to_even && q <= format->max_exponent_round_to_even &&
+        (mantissa & 3) == 1 && (mantissa << shift) == high) {
+        mantissa &= ~(uint64_t)1;
+    }
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= ((uint64_t)2 << bits)) {
+        mantissa = (uint64_t)1 << bits;
+        power2 += 1;
+    }
+    mantissa &= ~((uint64_t)1 << bits);
+    if (power2 >= infinite_power) {
+        return infinity_encoding(format);
+    }
+    return ((uint64_t)power2 << bits) | mantissa;
+}
+
+// =============================================================================
+// MARK: - Exact Comparison
+// =============================================================================
+
+// Enough for the longest decimal that can decide a binary64 rounding (767
+// significant digits) scaled against its halfway point
+#define BIG_LIMBS 160
+#define MAX_DIGITS 800
+
+typedef struct {
+    uint32_t limbs[BIG_LIMBS];
+    int count;
+} Big;
+
+static void big_mul_add(Big* big, uint32_t factor, uint32_t addend) {
+    uint64_t carry = addend;
+    for (int i = 0; i < big->count; i++) {
+        uint64_t product = (uint64_t)big->limbs[i] * factor + carry;
+        big->limbs[i] = (uint32_t)product;
+        carry = product >> 32;
+    }
+    if (carry && big->count < BIG_LIMBS) {
+        big->limbs[big->count++] = (uint32_t)carry;
+    }
+}
+
+static void big_pow5(Big* big, int exponent) {
+    while (exponent >= 13) {
+        big_mul_add(big, 1220703125, 0);
+        exponent -= 13;
+    }
+    static const uint32_t small[13] = {1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625,
+                                       48828125, 244140625};
+    big_mul_add(big, small[exponent], 0);
+}
+
+static void big_shl(Big* big, int shift) {
+    int words = shift / 32;
+    int bits = shift % 32;
+    if (big->count == 0) {
+        return;
+    }
+    int count = big->count + words + 1;
+    count = count < BIG_LIMBS ? count : BIG_LIMBS;
+    for (int i = count - 1; i >= 0; i--) {
+        int source = i - words;
+        uint32_t upper = source >= 0 && source < big->count ? big->limbs[source] : 0;
+        uint32_t lower = source >= 1 && source - 1 < big->count ? big->limbs[source - 1] : 0;
+        big->limbs[i] = bits ? (upper << bits) | (lower >> (32 - bits)) : upper;
+    }
+    big->count = count;
+    while (big->count > 0 && big->limbs[big->count - 1] == 0) {
+        big->count--;
+    }
+}
+
+static int big_compare(const Big* a, const Big* b) {
+    if (a->count != b->count) {
+        return a->count < b->count ? -1 : 1;
+    }
+    for (int i = a->count - 1; i >= 0; i--) {
+        if (a->limbs[i] != b->limbs[i]) {
+            return a->limbs[i] < b->limbs[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+// Rounds digits × 10^exponent (plus a nonzero tail when `sticky`) given
+// that the result is `lower` or the encoding after it: compares the value
+// against their midpoint exactly.
+static uint64_t round_exact(const Format* format, const uint8_t* digits, int count, int sticky, int64_t exponent,
+                            uint64_t lower) {
+    const int bits = format->fraction_bits;
+    const int bias = exponent_bias(format);
+    int field = (int)(lower >> bits);
+    uint64_t m = lower & (((uint64_t)1 << bits) - 1);
+    int e = 1 - bias - bits;
+    if (field != 0) {
+        m |= (uint64_t)1 << bits;
+        e = field - bias - bits;
+    }
+
+    // value: digits × 5^exponent × 2^exponent; halfway: (2m + 1) × 2^(e - 1)
+    Big value = {{0}, 0};
+    Big halfway = {{0}, 0};
+    for (int i = 0; i < count; i += 9) {
+        uint32_t chunk = 0, scale = 1;
+        for (int j = i; j < count && j < i + 9; j++) {
+            chunk = chunk * 10 + digits[j];
+            scale *= 10;
+        }
+        if (value.count == 0) {
+            value.limbs[0] = chunk;
+            value.count = chunk != 0;
+        } else {
+            big_mul_add(&value, scale, chunk);
+        }
+    }
+    halfway.limbs[0] = (uint32_t)(2 * m + 1);
+    halfway.limbs[1] = (uint32_t)((2 * m + 1) >> 32);
+    halfway.count = halfway.limbs[1] ? 2 : 1;
+
+    int64_t binary = exponent - (e - 1);
+    if (exponent >= 0) {
+        big_pow5(&value, (int)exponent);
+    } else {
+        big_pow5(&halfway, (int)-exponent);
+    }
+    if (binary >= 0) {
+        big_shl(&value, (int)binary);
+    } else {
+        big_shl(&halfway, (int)-binary);
+    }
+
+    int order = big_compare(&value, &halfway);
+    if (order == 0 && sticky) {
+        order = 1;
+    }
+    return lower + (order > 0 || (order == 0 && (m & 1)));
+}
+
+// =============================================================================
+// MARK: - Parsing
+// =============================================================================
+
+static inline int lower_ascii(uint8_t c) {
+    return c | 0x20;
+}
+
+static int matches(const uint8_t* text, size_t length, const char* word) {
+    size_t n = strlen(word);
+    if (length != n) {
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (lower_ascii(text[i]) != word[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Parses the whole of `text` into an encoding of `format`; returns 0 if the
+// text is not a decimal number, infinity or NaN
+static int parse(const Format* format, const uint8_t* text, size_t length, uint64_t* result) {
+    const int bits = format->fraction_bits;
+    const uint64_t sign_bit = (uint64_t)1 << (bits + format->exponent_bits);
+    if (length == 0) {
+        return 0;
+    }
+    const uint8_t* p = text;
+    const uint8_t* end = text + length;
+    uint64_t sign = 0;
+
+    if (p < end && (*p == '-' || *p == '+')) {
+        sign = *p == '-' ? sign_bit : 0;
+        p++;
+    }
+    if (p < end && (lower_ascii(*p) == 'i' || lower_ascii(*p) == 'n' || lower_ascii(*p) == 's')) {
+        size_t rest = (size_t)(end - p);
+        uint64_t exponent_mask = infinity_encoding(format);
+        if (matches(p, rest, "inf") || matches(p, rest, "infinity")) {
+            *result = sign | exponent_mask;
+            return 1;
+        }
+        if (matches(p, rest, "nan")) {
+            *result = sign | exponent_mask | ((uint64_t)1 << (bits - 1));
+            return 1;
+        }
+        if (matches(p, rest, "snan")) {
+            *result = sign | exponent_mask | 1;
+            return 1;
+        }
+        return 0;
+    }
+
+    // Digits: keep the first 19 significant ones in w
+    uint64_t w = 0;
+    int significant = 0;
+    int truncated = 0;
+    int64_t scale = 0;
+    int any_digit = 0;
+    int in_fraction = 0;
+    const uint8_t* first_digit = p;
+    for (; p < end; p++) {
+        uint8_t c = *p;
+        if (c == '.' && !in_fraction) {
+            in_fraction = 1;
+            continue;
+        }
+        uint8_t d = (uint8_t)(c - '0');
+        if (d > 9) {
+            break;
+        }
+        any_digit = 1;
+        if (significant == 0 && d == 0) {
+            scale -= in_fraction;
+        } else if (significant < 19) {
+            w = w * 10 + d;
+            significant++;
+            scale -= in_fraction;
+        } else {
+            truncated |= d != 0;
+            scale += !in_fraction;
+        }
+    }
+    const uint8_t* digits_end = p;
+    if (!any_digit) {
+        return 0;
+    }
+
+    int64_t exponent = 0;
+    if (p < end && lower_ascii(*p) == 'e') {
+        p++;
+        int negative = 0;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative = *p == '-';
+            p++;
+        }
+        if (p == end) {
+            return 0;
+        }
+        for (; p < end; p++) {
+            uint8_t d = (uint8_t)(*p - '0');
+            if (d > 9) {
+                return 0;
+            }
+            exponent = exponent < 100000000 ? exponent * 10 + d : exponent;
+        }
+        exponent = negative ? -exponent : exponent;
+    }
+    if (p != end) {
+        return 0;
+    }
+
+    int64_t q = scale + exponent;
+    q = q < -100000000 ? -100000000 : q > 100000000 ? 100000000 : q;
+    int ambiguous;
+    uint64_t encoding = lemire(format, q, w, &ambiguous);
+    if (truncated || ambiguous) {
+        int ambiguous_next = 0;
+        uint64_t next = truncated ? lemire(format, q, w + 1, &ambiguous_next) : encoding;
+        if (ambiguous || ambiguous_next || next != encoding) {
+            // Collect every significant digit, past which a nonzero tail only matters as a sticky bit
+            uint8_t digits[MAX_DIGITS];
+            int count = 0;
+            int sticky = 0;
+            int64_t point = 0;
+            int seen_point = 0;
+            for (const uint8_t* c = first_digit; c < digits_end; c++) {
+                if (*c == '.') {
+                    seen_point = 1;
+                    continue;
+                }
+                uint8_t d = (uint8_t)(*c - '0');
+                if (count == 0 && d == 0) {
+                    point -= seen_point;
+                } else if (count < MAX_DIGITS) {
+                    digits[count++] = d;
+                    point -= seen_point;
+                } else {
+                    sticky |= d != 0;
+                    point += !seen_point;
+                }
+            }
+            encoding = round_exact(format, digits, count, sticky, point + exponent, encoding);
+        }
+    }
+    *result = sign | encoding;
+    return 1;
+}
+
+int ieee754_parse_f64(const void* text, size_t length, double* result) {
+    uint64_t bits;
+    if (!parse(&binary64_format, text, length, &bits)) {
+        return 0;
+    }
+    *result = bits_double(bits);
+    return 1;
+}
+
+int ieee754_parse_f32(const void* text, size_t length, float* result) {
+    uint64_t bits;
+    if (!parse(&binary32_format, text, length, &bits)) {
+        return 0;
+    }
+    *result = bits_float((uint32_t)bits);
+    return 1;
+}
+
+int ieee754_parse_f16(const void* text, size_t length, uint16_t* result) {
+    uint64_t bits;
+    if (!parse(&binary16_format, text, length, &bits)) {
+        return 0;
+    }
+    *result = (uint16_t)bits;
+    return 1;
+}
+
+// =============================================================================
+// MARK: - Fields
+// =============================================================================
+
+size_t ieee754_decimal_field_count(const void* text, size_t length, uint8_t separator) {
+    const uint8_t* bytes = text;
+    if (length == 0) {
+        return 0;
+    }
+    size_t count = 1;
+    for (size_t i = 0; i + 1 < length; i++) {
+        count += bytes[i] == separator;
+    }
+    return count;
+}
+
+// Calls `parse_one` on each field; a single trailing separator ends the last one
+#define PARSE_FIELDS(parse_one)                                                     \
+    do {                                                                            \
+        if (length == 0) {                                                          \
+            return 1;                                                               \
+        }                                                                           \
+        const uint8_t* cursor = text;                                               \
+        const uint8_t* end = cursor + length;                                       \
+        if (end[-1] == separator) {                                                 \
+            end--;                                                                  \
+        }                                                                           \
+        size_t index = 0;                                                           \
+        while (cursor <= end) {                                                     \
+            const uint8_t* stop = memchr(cursor, separator, (size_t)(end - cursor)); \
+            stop = stop ? stop : end;                                               \
+            if (!parse_one(cursor, (size_t)(stop - cursor), dst + index)) {         \
+                return 0;                                                           \
+            }                                                                       \
+            index++;                                                                \
+            cursor = stop + 1;                                                      \
+        }                                                                           \
+        return 1;                                                                   \
+    } while (0)
+
+int ieee754_parse_f64_array(const void* text, size_t length, uint8_t separator, double* dst) {
+    PARSE_FIELDS(ieee754_parse_f64);
+}
+
+int ieee754_parse_f32_array(const void* text, size_t length, uint8_t separator, float* dst) {
+    PARSE_FIELDS(ieee754_parse_f32);
+}
+
+int ieee754_parse_f16_array(const void* text, size_t length, uint8_t separator, uint16_t* dst) {
+    PARSE_FIELDS(ieee754_parse_f16);
+}
@@ -5,6 +5,7 @@
 
 #include "include/ieee754_fpu.h"
 #include <fenv.h>
+#include <string.h>
 
 IEEE754Exceptions ieee754_test_fpu_exceptions(void) {
     int flags = fetestexcept(FE_ALL_EXCEPT);
@@ -22,3 +23,43 @@ IEEE754Exceptions ieee754_test_fpu_exceptions(void) {
 void ieee754_clear_fpu_exceptions(void) {
     feclearexcept(FE_ALL_EXCEPT);
 }
+
+// =============================================================================
+// MARK: - Exception Capture
+// =============================================================================
+
+_Static_assert(sizeof(fexcept_t) <= sizeof(uint64_t), "fexcept_t does not fit IEEE754ExceptionScope");
+
+static uint8_t exceptions_mask(int flags) {
+    uint8_t mask = 0;
+    if (flags & FE_INVALID) mask |= IEEE754_EXCEPTION_MASK_INVALID;
+    if (flags & FE_DIVBYZERO) mask |= IEEE754_EXCEPTION_MASK_DIVBYZERO;
+    if (flags & FE_OVERFLOW) mask |= IEEE754_EXCEPTION_MASK_OVERFLOW;
+    if (flags & FE_UNDERFLOW) mask |= IEEE754_EXCEPTION_MASK_UNDERFLOW;
+    if (flags & FE_INEXACT) mask |= IEEE754_EXCEPTION_MASK_INEXACT;
+    return mask;
+}
+
+void ieee754_exception_scope_begin(IEEE754ExceptionScope* scope) {
+    fexcept_t saved;
+    fegetexceptflag(&saved, FE_ALL_EXCEPT);
+    feclearexcept(FE_ALL_EXCEPT);
+
+    scope->hardware = 0;
+    memcpy(&scope->hardware, &saved, sizeof saved);
+    scope->software = ieee754_swap_exceptions_mask(0);
+}
+
+uint8_t ieee754_exception_scope_end(const IEEE754ExceptionScope* scope, int merge) {
+    fexcept_t saved;
+    memcpy(&saved, &scope->hardware, sizeof saved);
+
+    // Restoring only the flags the scope left clear keeps the raised ones
+    int raised = fetestexcept(FE_ALL_EXCEPT);
+    fesetexceptflag(&saved, merge ? (FE_ALL_EXCEPT & ~raised) : FE_ALL_EXCEPT);
+
+    uint8_t captured = ieee754_get_exceptions_mask();
+    captured = ieee754_swap_exceptions_mask(merge ? (uint8_t)(scope->software | captured) : scope->software);
+
+    return (uint8_t)(exceptions_mask(raised) | captured);
+}
@@ -2,10 +2,90 @@
 // CIEEE754
 //
 // IEEE 754-2019 Section 4.3: Rounding Direction Attributes
+//
+// On x86-64 and arm64 the rounding direction is read and written in the
+// floating-point control register directly, bypassing fegetround/fesetround.
+// The live register doubles as the per-thread cache: a set that would not
+// change the mode is a single register read and no write. Other platforms
+// fall back to <fenv.h>.
 
 #include "include/ieee754_fpu.h"
 #include <fenv.h>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define IEEE754_ROUNDING_MXCSR 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define IEEE754_ROUNDING_FPCR 1
+#endif
+
+#if IEEE754_ROUNDING_MXCSR
+
+// MXCSR RC, bits 14:13, and the x87 control word RC, bits 11:10, share the
+// encoding of IEEE754RoundingMode: nearest, down, up, toward zero.
+#define MXCSR_RC_SHIFT 13
+#define MXCSR_RC_MASK (UINT64_C(3) << MXCSR_RC_SHIFT)
+#define X87_RC_SHIFT 10
+#define X87_RC_MASK (3u << X87_RC_SHIFT)
+
+static inline uint64_t read_control(void) {
+    uint32_t mxcsr;
+    __asm__ __volatile__("stmxcsr %0" : "=m"(mxcsr));
+    return mxcsr;
+}
+
+// fesetround keeps x87 in step with SSE so that long double arithmetic
+// rounds the same way; do the same.
+static inline void write_control(uint64_t control) {
+    uint32_t mxcsr = (uint32_t)control;
+    uint16_t x87;
+    __asm__ __volatile__("fnstcw %0" : "=m"(x87));
+    x87 = (uint16_t)((x87 & ~X87_RC_MASK) | (((mxcsr & MXCSR_RC_MASK) >> MXCSR_RC_SHIFT) << X87_RC_SHIFT));
+    __asm__ __volatile__("fldcw %0" : : "m"(x87));
+    __asm__ __volatile__("ldmxcsr %0" : : "m"(mxcsr));
+}
+
+static inline uint64_t control_with_mode(uint64_t control, IEEE754RoundingMode mode) {
+    return (control & ~MXCSR_RC_MASK) | ((uint64_t)mode << MXCSR_RC_SHIFT);
+}
+
+static inline IEEE754RoundingMode mode_from_control(uint64_t control) {
+    return (IEEE754RoundingMode)((control & MXCSR_RC_MASK) >> MXCSR_RC_SHIFT);
+}
+
+#elif IEEE754_ROUNDING_FPCR
+
+// FPCR RMode, bits 23:22: RN, RP (upward), RM (downward), RZ.
+#define FPCR_RMODE_SHIFT 22
+#define FPCR_RMODE_MASK (UINT64_C(3) << FPCR_RMODE_SHIFT)
+
+static const uint64_t mode_to_rmode[4] = {0, 2, 1, 3};
+static const IEEE754RoundingMode rmode_to_mode[4] = {
+    IEEE754_ROUND_TONEAREST,
+    IEEE754_ROUND_UPWARD,
+    IEEE754_ROUND_DOWNWARD,
+    IEEE754_ROUND_TOWARDZERO,
+};
+
+static inline uint64_t read_control(void) {
+    uint64_t fpcr;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+    return fpcr;
+}
+
+static inline void write_control(uint64_t control) {
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(control));
+}
+
+static inline uint64_t control_with_mode(uint64_t control, IEEE754RoundingMode mode) {
+    return (control & ~FPCR_RMODE_MASK) | (mode_to_rmode[mode] << FPCR_RMODE_SHIFT);
+}
+
+static inline IEEE754RoundingMode mode_from_control(uint64_t control) {
+    return rmode_to_mode[(control & FPCR_RMODE_MASK) >> FPCR_RMODE_SHIFT];
+}
+
+#else
+
 // Map IEEE754RoundingMode to C99 fesetround constants
 static int ieee754_to_fe_round(IEEE754RoundingMode mode) {
     switch (mode) {
@@ -38,12 +118,59 @@ static IEEE754RoundingMode fe_round_to_ieee754(int fe_mode) {
     }
 }
 
+// Without direct register access the token is the fegetround value
+static inline uint64_t read_control(void) {
+    return (uint64_t)(unsigned)fegetround();
+}
+
+static inline void write_control(uint64_t control) {
+    fesetround((int)control);
+}
+
+static inline uint64_t control_with_mode(uint64_t control, IEEE754RoundingMode mode) {
+    (void)control;
+    return (uint64_t)(unsigned)ieee754_to_fe_round(mode);
+}
+
+static inline IEEE754RoundingMode mode_from_control(uint64_t control) {
+    return fe_round_to_ieee754((int)control);
+}
+
+#endif
+
+// Out-of-range modes select round-to-nearest, as fesetround(FE_TONEAREST) did
+static inline IEEE754RoundingMode sanitized(IEEE754RoundingMode mode) {
+    return (unsigned)mode <= IEEE754_ROUND_TOWARDZERO ? mode : IEEE754_ROUND_TONEAREST;
+}
+
 int ieee754_set_rounding_mode(IEEE754RoundingMode mode) {
-    int fe_mode = ieee754_to_fe_round(mode);
-    return fesetround(fe_mode);
+    uint64_t control = read_control();
+    uint64_t updated = control_with_mode(control, sanitized(mode));
+    if (updated != control) {
+        write_control(updated);
+    }
+    return 0;
 }
 
 IEEE754RoundingMode ieee754_get_rounding_mode(void) {
-    int fe_mode = fegetround();
-    return fe_round_to_ieee754(fe_mode);
+    return mode_from_control(read_control());
+}
+
+IEEE754RoundingState ieee754_swap_rounding_mode(IEEE754RoundingMode mode) {
+    uint64_t control = read_control();
+    uint64_t updated = control_with_mode(control, sanitized(mode));
+    if (updated != control) {
+        write_control(updated);
+    }
+    return control;
+}
+
+// Only the rounding field is restored: MXCSR also holds the sticky exception
+// flags, and those raised inside the scope must survive it.
+void ieee754_restore_rounding_mode(IEEE754RoundingState state) {
+    uint64_t control = read_control();
+    uint64_t updated = control_with_mode(control, mode_from_control(state));
+    if (updated != control) {
+        write_control(updated);
+    }
 }
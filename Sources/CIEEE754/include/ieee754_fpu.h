@@ -1,6 +1,7 @@
 #ifndef IEEE754_FPU_H
 #define IEEE754_FPU_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -35,7 +36,9 @@ typedef enum {
 /// Set the floating-point rounding mode for the current thread
 ///
 /// Changes the FPU rounding direction for all subsequent floating-point
-/// operations in the current thread.
+/// operations in the current thread. On x86-64 and arm64 this reads and
+/// writes MXCSR/FPCR directly and skips the write when the mode is already
+/// set.
 ///
 /// - Parameter mode: The rounding mode to set
 /// - Returns: 0 on success, non-zero on error
@@ -48,6 +51,26 @@ int ieee754_set_rounding_mode(IEEE754RoundingMode mode);
 /// - Returns: The current rounding mode
 IEEE754RoundingMode ieee754_get_rounding_mode(void);
 
+/// Saved rounding state returned by `ieee754_swap_rounding_mode`
+///
+/// The raw control register (MXCSR or FPCR) where it is accessed directly,
+/// otherwise the `fegetround` value. Only its rounding field is meaningful.
+typedef uint64_t IEEE754RoundingState;
+
+/// Set the rounding mode and return the previous state in one register read
+///
+/// - Parameter mode: The rounding mode to set
+/// - Returns: State to pass to `ieee754_restore_rounding_mode`
+IEEE754RoundingState ieee754_swap_rounding_mode(IEEE754RoundingMode mode);
+
+/// Restore the rounding mode saved by `ieee754_swap_rounding_mode`
+///
+/// Restores only the rounding direction; exception flags raised since the
+/// swap are kept. Does not write the register if the mode is unchanged.
+///
+/// - Parameter state: State returned by `ieee754_swap_rounding_mode`
+void ieee754_restore_rounding_mode(IEEE754RoundingState state);
+
 // =============================================================================
 // MARK: - Exception Flags
 // =============================================================================
@@ -86,6 +109,19 @@ typedef enum {
     IEEE754_EXCEPTION_INEXACT = 4
 } IEEE754ExceptionFlag;
 
+/// Packed exception mask bits
+///
+/// A mask holds one bit per `IEEE754ExceptionFlag`, at bit position equal to
+/// the flag's value. Only the low five bits are meaningful.
+enum {
+    IEEE754_EXCEPTION_MASK_INVALID = 1 << IEEE754_EXCEPTION_INVALID,
+    IEEE754_EXCEPTION_MASK_DIVBYZERO = 1 << IEEE754_EXCEPTION_DIVBYZERO,
+    IEEE754_EXCEPTION_MASK_OVERFLOW = 1 << IEEE754_EXCEPTION_OVERFLOW,
+    IEEE754_EXCEPTION_MASK_UNDERFLOW = 1 << IEEE754_EXCEPTION_UNDERFLOW,
+    IEEE754_EXCEPTION_MASK_INEXACT = 1 << IEEE754_EXCEPTION_INEXACT,
+    IEEE754_EXCEPTION_MASK_ALL = 0x1F
+};
+
 // =============================================================================
 // MARK: - Thread-Local Exception State
 // =============================================================================
@@ -97,7 +133,10 @@ typedef enum {
 /// - Parameter flag: The exception flag to raise (0-4)
 ///
 /// Note: This manages thread-local software exception state, separate from
-/// hardware FPU exception flags.
+/// hardware FPU exception flags. The state is a single packed atomic byte
+/// per thread, found through native `_Thread_local` storage where the
+/// compiler supports it, with a pthread-key fallback elsewhere. Raising is
+/// lock-free and never writes memory shared with other threads.
 void ieee754_raise_exception(IEEE754ExceptionFlag flag);
 
 /// Test if an exception flag is raised in thread-local storage
@@ -111,6 +150,34 @@ int ieee754_test_exception(IEEE754ExceptionFlag flag);
 /// - Parameter flag: The exception flag to clear (0-4)
 void ieee754_clear_exception(IEEE754ExceptionFlag flag);
 
+/// Raise several exception flags in thread-local storage at once
+///
+/// ORs `mask` into the current thread's flags in a single store. Bits
+/// outside `IEEE754_EXCEPTION_MASK_ALL` are ignored.
+///
+/// - Parameter mask: Packed flags (see `IEEE754_EXCEPTION_MASK_*`)
+void ieee754_raise_exceptions_mask(uint8_t mask);
+
+/// Get all thread-local exception flags as a packed mask
+///
+/// - Returns: Packed flags (see `IEEE754_EXCEPTION_MASK_*`)
+uint8_t ieee754_get_exceptions_mask(void);
+
+/// Clear several thread-local exception flags at once
+///
+/// - Parameter mask: Packed flags to clear (see `IEEE754_EXCEPTION_MASK_*`)
+void ieee754_clear_exceptions_mask(uint8_t mask);
+
+/// Replace the thread-local exception flags, returning the previous ones
+///
+/// Stores `mask` in a single atomic exchange. Unlike raising, this is not
+/// counted by exception accounting: it moves existing state rather than
+/// signaling new exceptions.
+///
+/// - Parameter mask: Packed flags to install (see `IEEE754_EXCEPTION_MASK_*`)
+/// - Returns: The flags that were set before the call
+uint8_t ieee754_swap_exceptions_mask(uint8_t mask);
+
 /// Get all thread-local exception flags
 ///
 /// - Returns: Structure containing all exception flag states
@@ -119,6 +186,81 @@ IEEE754Exceptions ieee754_get_exceptions(void);
 /// Clear all thread-local exception flags
 void ieee754_clear_all_exceptions(void);
 
+/// Get the union of exception flags across all threads
+///
+/// Merges, on read, the flags of every live thread plus those of threads
+/// that have exited since the last aggregate clear. Raising never touches
+/// shared state, so this is the only operation that visits other threads.
+///
+/// - Returns: Packed flags (see `IEEE754_EXCEPTION_MASK_*`)
+uint8_t ieee754_get_aggregate_exceptions_mask(void);
+
+/// Clear exception flags on every thread
+///
+/// Resets every thread's flags and the flags retained from exited threads.
+/// A flag raised concurrently on another thread may survive the clear.
+void ieee754_clear_aggregate_exceptions(void);
+
+// =============================================================================
+// MARK: - Exception Accounting
+// =============================================================================
+
+/// Maximum number of distinct accounting scopes
+///
+/// Scope 0 is the unlabeled scope; once every other scope is in use, new
+/// labels share the last one, labelled `"other"`.
+#define IEEE754_ACCOUNTING_MAX_SCOPES 64
+
+/// Number of times each exception was raised
+typedef struct {
+    uint64_t invalid;
+    uint64_t divByZero;
+    uint64_t overflow;
+    uint64_t underflow;
+    uint64_t inexact;
+} IEEE754ExceptionCounts;
+
+/// Find or register the accounting scope for `label`
+///
+/// Labels are compared by content and kept for the life of the process.
+/// A NULL or empty label is the unlabeled scope 0.
+///
+/// - Returns: Scope index in `0..<IEEE754_ACCOUNTING_MAX_SCOPES`
+int ieee754_accounting_scope(const char* label);
+
+/// Label of a registered scope
+///
+/// - Returns: The label (`""` for scope 0), or NULL if `scope` is unused
+const char* ieee754_accounting_scope_label(int scope);
+
+/// Start counting the current thread's raised exceptions under `scope`
+///
+/// While a thread is in a scope, every raise of a thread-local flag adds
+/// one to that flag's counter for the scope, even when the flag is already
+/// set. Counters are per thread and written only by their thread; outside
+/// any scope raising costs one extra predictable branch.
+///
+/// - Returns: The scope the thread was in before, or -1 for none; pass it
+///   to `ieee754_accounting_exit`
+int ieee754_accounting_enter(int scope);
+
+/// Return to the scope that `ieee754_accounting_enter` replaced
+void ieee754_accounting_exit(int previous);
+
+/// Counts for `scope`, summed over every thread
+///
+/// Visits each thread's counters on read, including those of threads that
+/// have exited.
+IEEE754ExceptionCounts ieee754_accounting_counts(int scope);
+
+/// Reset every counter on every thread
+///
+/// Records each counter's current value as a baseline that reads subtract;
+/// the counters themselves stay owner-only. A count added on another thread
+/// while the reset runs is either cleared or kept, and earlier counts never
+/// come back.
+void ieee754_accounting_reset(void);
+
 // =============================================================================
 // MARK: - Hardware FPU Exception Detection
 // =============================================================================
@@ -139,6 +281,43 @@ IEEE754Exceptions ieee754_test_fpu_exceptions(void);
 /// Resets all exception flags in the FPU status register.
 void ieee754_clear_fpu_exceptions(void);
 
+// =============================================================================
+// MARK: - Exception Capture
+// =============================================================================
+
+/// Saved hardware and thread-local exception state of a capture scope
+///
+/// `hardware` holds the platform's opaque `fexcept_t`; treat both fields
+/// as private to `ieee754_exception_scope_begin` and `_end`.
+typedef struct {
+    uint64_t hardware;
+    uint8_t software;
+} IEEE754ExceptionScope;
+
+/// Begin capturing the exceptions raised by a block of code
+///
+/// Saves the hardware FPU flags and the thread-local flags into `scope`,
+/// then clears both, with one `fegetexceptflag` and one atomic exchange.
+///
+/// - Parameter scope: Storage for the saved state
+void ieee754_exception_scope_begin(IEEE754ExceptionScope* scope);
+
+/// End a capture scope, restoring the saved state
+///
+/// Reads the flags raised since `ieee754_exception_scope_begin`, both in
+/// hardware and thread-local storage, then restores the saved state with
+/// one `fesetexceptflag` and one atomic exchange. With `merge` nonzero the
+/// captured flags stay raised on top of the saved ones, as if no scope had
+/// been entered; with `merge` zero they are discarded.
+///
+/// Call on the thread that began the scope.
+///
+/// - Parameters:
+///   - scope: State saved by `ieee754_exception_scope_begin`
+///   - merge: Nonzero to keep the captured flags raised
+/// - Returns: Packed flags raised within the scope (see `IEEE754_EXCEPTION_MASK_*`)
+uint8_t ieee754_exception_scope_end(const IEEE754ExceptionScope* scope, int merge);
+
 // =============================================================================
 // MARK: - Signaling Comparisons
 // =============================================================================
@@ -208,6 +387,392 @@ int ieee754_signaling_greater_f(float x, float y);
 int ieee754_signaling_greater_equal_f(float x, float y);
 int ieee754_signaling_not_equal_f(float x, float y);
 
+// =============================================================================
+// MARK: - Batch Signaling Comparisons
+// =============================================================================
+
+/// Element-wise signaling comparisons over arrays
+///
+/// Writes 1 or 0 to `out[i]` for the predicate applied to `x[i]` and `y[i]`.
+/// NaN detection and the comparison are evaluated a vector at a time, and
+/// the invalid exception (hardware and thread-local) is raised at most once
+/// per call, only if some lane is unordered. Unordered lanes compare false,
+/// except for not-equal, which yields 1, matching the scalar predicates.
+///
+/// - Parameters:
+///   - x: First operand array of `n` elements
+///   - y: Second operand array of `n` elements
+///   - out: Result array of `n` bytes
+///   - n: Number of elements
+/// - Returns: Number of unordered lanes (either operand NaN)
+///
+/// IEEE 754-2019 Section 5.6.1: compareSignaling predicates
+size_t ieee754_signaling_equal_array(const double* x, const double* y, uint8_t* out, size_t n);
+size_t ieee754_signaling_less_array(const double* x, const double* y, uint8_t* out, size_t n);
+size_t ieee754_signaling_less_equal_array(const double* x, const double* y, uint8_t* out, size_t n);
+size_t ieee754_signaling_greater_array(const double* x, const double* y, uint8_t* out, size_t n);
+size_t ieee754_signaling_greater_equal_array(const double* x, const double* y, uint8_t* out, size_t n);
+size_t ieee754_signaling_not_equal_array(const double* x, const double* y, uint8_t* out, size_t n);
+
+/// Float (binary32) batch signaling comparisons
+size_t ieee754_signaling_equal_array_f(const float* x, const float* y, uint8_t* out, size_t n);
+size_t ieee754_signaling_less_array_f(const float* x, const float* y, uint8_t* out, size_t n);
+size_t ieee754_signaling_less_equal_array_f(const float* x, const float* y, uint8_t* out, size_t n);
+size_t ieee754_signaling_greater_array_f(const float* x, const float* y, uint8_t* out, size_t n);
+size_t ieee754_signaling_greater_equal_array_f(const float* x, const float* y, uint8_t* out, size_t n);
+size_t ieee754_signaling_not_equal_array_f(const float* x, const float* y, uint8_t* out, size_t n);
+
+// =============================================================================
+// MARK: - Byte Order Conversion
+// =============================================================================
+
+/// Reverse the byte order of an array of binary16 values
+///
+/// Converts `count` consecutive 2-byte elements between little- and
+/// big-endian. Dispatches at runtime to SSSE3/AVX2 `pshufb` on x86 and
+/// uses NEON `vrev16` on arm64, with a scalar tail.
+///
+/// - Parameters:
+///   - dst: Destination buffer of at least `count * 2` bytes
+///   - src: Source buffer of at least `count * 2` bytes
+///   - count: Number of elements (not bytes)
+///
+/// Neither buffer needs to be aligned. `dst` may equal `src` for an
+/// in-place swap; other overlapping ranges are not supported.
+///
+/// IEEE 754-2019 Section 3.4: Binary interchange format encodings
+void ieee754_byteswap16(void* dst, const void* src, size_t count);
+
+/// Reverse the byte order of an array of binary32 values
+///
+/// Same contract as `ieee754_byteswap16` with 4-byte elements (NEON `vrev32`).
+void ieee754_byteswap32(void* dst, const void* src, size_t count);
+
+/// Reverse the byte order of an array of binary64 values
+///
+/// Same contract as `ieee754_byteswap16` with 8-byte elements (NEON `vrev64`).
+void ieee754_byteswap64(void* dst, const void* src, size_t count);
+
+// =============================================================================
+// MARK: - Bulk Narrowing Conversions
+// =============================================================================
+
+/// Exception counts for one bulk conversion
+///
+/// Each field counts the elements whose conversion signaled that exception
+/// under default exception handling. Underflow is counted only for inexact
+/// tiny results, with tininess detected before rounding.
+typedef struct {
+    size_t invalid;   ///< Signaling NaN inputs (converted to quiet NaN)
+    size_t overflow;  ///< Finite inputs whose rounded result exceeds the format
+    size_t underflow; ///< Inexact results below the smallest normal
+    size_t inexact;   ///< Results that differ from the input value
+} IEEE754ConversionSummary;
+
+/// Convert an array of binary64 values to binary32
+///
+/// Uses the hardware conversion in the current rounding mode. Each exception
+/// that occurred in the batch is raised once (hardware and thread-local).
+///
+/// - Parameters:
+///   - src: `n` binary64 values
+///   - dst: Storage for `n` binary32 values
+///   - n: Number of elements
+/// - Returns: Per-exception element counts
+///
+/// IEEE 754-2019 Section 5.4.2: formatOf-convertFormat
+IEEE754ConversionSummary ieee754_convert_f64_to_f32_array(const double* src, float* dst, size_t n);
+
+/// Convert an array of binary32 values to binary16 bit patterns
+///
+/// Rounds to nearest, ties to even. Uses F16C (`vcvtps2ph`, selected at
+/// runtime) on x86 and NEON `fcvtn` on arm64, with a software tail.
+///
+/// Same exception contract as `ieee754_convert_f64_to_f32_array`.
+IEEE754ConversionSummary ieee754_convert_f32_to_f16_array(const float* src, uint16_t* dst, size_t n);
+
+/// Convert an array of binary64 values to binary16 bit patterns
+///
+/// Rounds once, to nearest with ties to even (never via binary32, which
+/// would round twice). Same exception contract as
+/// `ieee754_convert_f64_to_f32_array`.
+IEEE754ConversionSummary ieee754_convert_f64_to_f16_array(const double* src, uint16_t* dst, size_t n);
+
+// =============================================================================
+// MARK: - Storage Format Conversions
+// =============================================================================
+
+/// Widen an array of bfloat16 values to binary32
+///
+/// Exact: a bfloat16 encoding is the upper half of a binary32 encoding, so
+/// each element is a 16-bit shift and NaN payloads come back unchanged.
+/// The loop is vectorized and signals no exceptions.
+///
+/// - Parameters:
+///   - src: `n` bfloat16 encodings, `2 * n` bytes, no alignment required
+///   - dst: Storage for `n` binary32 values
+///   - n: Number of elements
+///   - swap: Nonzero to byte-swap each encoding first (non-host byte order)
+void ieee754_bfloat16_widen_array(const void* src, float* dst, size_t n, int swap);
+
+/// Convert an array of binary32 values to bfloat16 encodings
+///
+/// Rounds to nearest, ties to even, independently of the current rounding
+/// mode. NaNs keep their sign and leading payload bits and are quieted.
+/// Out-of-range finite values become ±infinity, or with `saturate`
+/// nonzero the largest finite magnitude; saturation also maps infinities
+/// to it and counts them as overflow.
+///
+/// Same exception contract as `ieee754_convert_f64_to_f32_array`.
+IEEE754ConversionSummary ieee754_convert_f32_to_bf16_array(const float* src, uint16_t* dst, size_t n, int saturate);
+
+/// Widen an array of OCP FP8 E5M2 values to binary32
+///
+/// Exact; NaN payloads come back unchanged. Signals no exceptions.
+void ieee754_fp8_e5m2_widen_array(const uint8_t* src, float* dst, size_t n);
+
+/// Convert an array of binary32 values to OCP FP8 E5M2 encodings
+///
+/// E5M2 follows the IEEE 754 layout (bias 15, infinities, NaNs) with a
+/// 2-bit trailing significand; the largest finite magnitude is 57344.
+/// Same rounding, NaN and saturation rules as
+/// `ieee754_convert_f32_to_bf16_array`.
+IEEE754ConversionSummary ieee754_convert_f32_to_fp8_e5m2_array(
+    const float* src, uint8_t* dst, size_t n, int saturate
+);
+
+/// Widen an array of OCP FP8 E4M3 values to binary32
+///
+/// Exact. E4M3 has no infinities; its NaN encodings S.1111.111 widen to
+/// the default quiet NaN with the same sign. Signals no exceptions.
+void ieee754_fp8_e4m3_widen_array(const uint8_t* src, float* dst, size_t n);
+
+/// Convert an array of binary32 values to OCP FP8 E4M3 encodings
+///
+/// Rounds to nearest, ties to even. E4M3 (bias 7) has no infinities and
+/// one NaN per sign, so its largest finite magnitude is 448. Finite values
+/// that round beyond it become NaN and count as overflow, or with
+/// `saturate` nonzero become ±448. Infinite inputs become NaN and signal
+/// invalid, or with `saturate` become ±448 and count as overflow.
+///
+/// Same exception contract as `ieee754_convert_f64_to_f32_array`.
+IEEE754ConversionSummary ieee754_convert_f32_to_fp8_e4m3_array(
+    const float* src, uint8_t* dst, size_t n, int saturate
+);
+
+// =============================================================================
+// MARK: - Decimal Character Sequences
+// =============================================================================
+
+/// Longest text `ieee754_format_f64` writes ("-0.00000" and 17 digits)
+#define IEEE754_DECIMAL_F64_MAX 25
+
+/// Longest text `ieee754_format_f32` writes (a sign and 21 integer digits)
+#define IEEE754_DECIMAL_F32_MAX 22
+
+/// Longest text `ieee754_format_f16` writes (`-0.00006104`)
+#define IEEE754_DECIMAL_F16_MAX 11
+
+/// Write the shortest decimal that converts back to `value`
+///
+/// IEEE 754-2019 Section 5.12.2: of the decimals with the fewest
+/// significant digits that round to `value`, the one closest to it (ties
+/// to an even last digit). Laid out as ECMAScript's `Number::toString`:
+/// `123`, `0.001`, `1.5e+300`, `-0`, `inf`, `-inf`, `nan`, `snan`; NaN
+/// payloads are not written. No terminator is written, and the buffer
+/// needs `IEEE754_DECIMAL_F64_MAX` bytes. Signals no exceptions.
+///
+/// - Returns: Number of bytes written
+size_t ieee754_format_f64(double value, void* buffer);
+
+/// Write the shortest round-trip decimal for a binary32 value
+///
+/// Same contract as `ieee754_format_f64`, with `IEEE754_DECIMAL_F32_MAX`.
+size_t ieee754_format_f32(float value, void* buffer);
+
+/// Write the shortest round-trip decimal for a binary16 bit pattern
+///
+/// Same contract as `ieee754_format_f64`, with `IEEE754_DECIMAL_F16_MAX`.
+size_t ieee754_format_f16(uint16_t bits, void* buffer);
+
+/// Format an array of binary64 values as separated decimal fields
+///
+/// Fields are written as by `ieee754_format_f64`, with `separator` between
+/// them and none after the last. `dst` needs room for
+/// `n * (IEEE754_DECIMAL_F64_MAX + 1)` bytes.
+///
+/// - Returns: Number of bytes written
+size_t ieee754_format_f64_array(const double* src, size_t n, uint8_t separator, void* dst);
+
+/// Format an array of binary32 values as separated decimal fields
+size_t ieee754_format_f32_array(const float* src, size_t n, uint8_t separator, void* dst);
+
+/// Format an array of binary16 bit patterns as separated decimal fields
+size_t ieee754_format_f16_array(const uint16_t* src, size_t n, uint8_t separator, void* dst);
+
+/// Parse a decimal character sequence into binary64
+///
+/// IEEE 754-2019 Section 5.12.2: correctly rounded to nearest, ties to
+/// even, whatever the number of digits and independently of the current
+/// rounding mode. Accepts an optional sign followed by digits with an
+/// optional point and exponent (`1`, `-.5`, `2.5E-3`), or
+/// case-insensitively `inf`, `infinity`, `nan` or `snan`. The whole
+/// `length` bytes must match; no whitespace is skipped. Overflow gives
+/// ±infinity and underflow a subnormal or ±0, without signaling.
+///
+/// - Returns: 1 on success with `*result` set, 0 if the text is malformed
+int ieee754_parse_f64(const void* text, size_t length, double* result);
+
+/// Parse a decimal character sequence into binary32
+///
+/// Rounded once, directly to binary32. Same contract as `ieee754_parse_f64`.
+int ieee754_parse_f32(const void* text, size_t length, float* result);
+
+/// Parse a decimal character sequence into a binary16 bit pattern
+///
+/// Rounded once, directly to binary16. Same contract as `ieee754_parse_f64`.
+int ieee754_parse_f16(const void* text, size_t length, uint16_t* result);
+
+/// Number of `separator`-separated fields in `text`
+///
+/// 0 for empty text; a single trailing separator does not start a field.
+size_t ieee754_decimal_field_count(const void* text, size_t length, uint8_t separator);
+
+/// Parse `separator`-separated decimal fields into binary64
+///
+/// `dst` needs room for `ieee754_decimal_field_count` values. Each field is
+/// parsed as by `ieee754_parse_f64`; a single trailing separator is
+/// allowed.
+///
+/// - Returns: 1 if every field parsed, 0 at the first malformed field
+int ieee754_parse_f64_array(const void* text, size_t length, uint8_t separator, double* dst);
+
+/// Parse `separator`-separated decimal fields into binary32
+int ieee754_parse_f32_array(const void* text, size_t length, uint8_t separator, float* dst);
+
+/// Parse `separator`-separated decimal fields into binary16 bit patterns
+int ieee754_parse_f16_array(const void* text, size_t length, uint8_t separator, uint16_t* dst);
+
+// =============================================================================
+// MARK: - Binary16 Arithmetic
+// =============================================================================
+
+/// Whether binary16 arithmetic runs natively on this CPU
+///
+/// 1 with AVX512-FP16 (checked at runtime) or ARMv8.2 FP16 vector
+/// arithmetic; 0 when the kernels compute in binary32 or in software.
+int ieee754_binary16_native_arithmetic(void);
+
+/// Widen an array of binary16 bit patterns to binary32 (exact)
+///
+/// Signaling NaNs become quiet and signal invalid. Uses F16C on x86 and
+/// NEON `fcvtl` on arm64, with a software tail.
+///
+/// Each batch runs in roundTiesToEven with the caller's rounding mode and
+/// flags restored afterwards; every exception that occurred is raised once
+/// (hardware and thread-local).
+///
+/// - Returns: `IEEE754_EXCEPTION_MASK_*` bits of the exceptions signaled
+uint8_t ieee754_binary16_widen_array(const uint16_t* src, float* dst, size_t n);
+
+/// Element-wise `dst[i] = a[i] + b[i]` on binary16 bit patterns
+///
+/// Each result is correctly rounded, to nearest with ties to even. `dst`
+/// may be `a` or `b`. Same exception contract as
+/// `ieee754_binary16_widen_array`.
+uint8_t ieee754_binary16_add_array(const uint16_t* a, const uint16_t* b, uint16_t* dst, size_t n);
+
+/// Element-wise `dst[i] = a[i] * b[i]` on binary16 bit patterns
+///
+/// Same contract as `ieee754_binary16_add_array`.
+uint8_t ieee754_binary16_mul_array(const uint16_t* a, const uint16_t* b, uint16_t* dst, size_t n);
+
+/// Element-wise `dst[i] = a[i] * b[i] + c[i]` with a single rounding
+///
+/// Native FMA where binary16 arithmetic is native; elsewhere computed
+/// exactly in software (a binary32 FMA could round twice). Same contract
+/// as `ieee754_binary16_add_array`.
+///
+/// IEEE 754-2019 Section 5.4.1: fusedMultiplyAdd
+uint8_t ieee754_binary16_fma_array(
+    const uint16_t* a, const uint16_t* b, const uint16_t* c, uint16_t* dst, size_t n);
+
+// =============================================================================
+// MARK: - Binary128 Arithmetic
+// =============================================================================
+
+/// Whether the compiler provides a binary128 type for this target
+///
+/// 1 with `__float128` (x86) or a 113-bit `long double` (AArch64 Linux), 0
+/// otherwise. The `ieee754_binary128_*` functions below must only be called
+/// when this is 1; elsewhere they return zero.
+///
+/// They round to nearest even whatever the current rounding mode, and leave
+/// the hardware exception flags as they found them.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SIZEOF_FLOAT128__)
+#define IEEE754_BINARY128_NATIVE 1
+#elif defined(__aarch64__) && defined(__LDBL_MANT_DIG__) && __LDBL_MANT_DIG__ == 113
+#define IEEE754_BINARY128_NATIVE 1
+#else
+#define IEEE754_BINARY128_NATIVE 0
+#endif
+
+/// Binary128 encoding as two 64-bit halves
+///
+/// `high` holds the sign, exponent and top 48 fraction bits.
+typedef struct {
+    uint64_t low;
+    uint64_t high;
+} IEEE754Binary128;
+
+/// Binary128 addition, rounded to nearest even
+IEEE754Binary128 ieee754_binary128_add(IEEE754Binary128 a, IEEE754Binary128 b);
+
+/// Binary128 subtraction, rounded to nearest even
+IEEE754Binary128 ieee754_binary128_sub(IEEE754Binary128 a, IEEE754Binary128 b);
+
+/// Binary128 multiplication, rounded to nearest even
+IEEE754Binary128 ieee754_binary128_mul(IEEE754Binary128 a, IEEE754Binary128 b);
+
+/// Binary128 division, rounded to nearest even
+IEEE754Binary128 ieee754_binary128_div(IEEE754Binary128 a, IEEE754Binary128 b);
+
+/// Widen binary64 to binary128 (exact)
+IEEE754Binary128 ieee754_binary128_from_double(double value);
+
+/// Narrow binary128 to binary64, rounded to nearest even
+double ieee754_binary128_to_double(IEEE754Binary128 value);
+
+/// Sum of `n` binary128 values, accumulated left to right in binary128
+IEEE754Binary128 ieee754_binary128_sum(const IEEE754Binary128* values, size_t n);
+
+/// Sum of `n` binary64 values, accumulated left to right in binary128
+IEEE754Binary128 ieee754_binary128_sum_f64(const double* values, size_t n);
+
+/// Sum of `x[i] * y[i]` over binary64 inputs, accumulated in binary128
+///
+/// Each product of two binary64 values is exact in binary128, so only the
+/// additions round.
+IEEE754Binary128 ieee754_binary128_dot_f64(const double* x, const double* y, size_t n);
+
+/// Element-wise `dst[i] = a[i] + b[i]` in binary128
+void ieee754_binary128_add_array(
+    const IEEE754Binary128* a, const IEEE754Binary128* b, IEEE754Binary128* dst, size_t n);
+
+/// Element-wise `dst[i] = a[i] * b[i]` in binary128
+void ieee754_binary128_mul_array(
+    const IEEE754Binary128* a, const IEEE754Binary128* b, IEEE754Binary128* dst, size_t n);
+
+// =============================================================================
+// MARK: - System Information
+// =============================================================================
+
+/// Number of online processors
+///
+/// Queried once and cached. Used to size the chunking of parallel bulk
+/// operations; always returns at least 1.
+int ieee754_processor_count(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -6,6 +6,7 @@
 #include "include/ieee754_fpu.h"
 #include <fenv.h>
 #include <math.h>
+#include <string.h>
 
 // =============================================================================
 // MARK: - Double (binary64) Signaling Comparisons
@@ -135,3 +136,67 @@ int ieee754_signaling_not_equal_f(float x, float y) {
 
     return x != y;
 }
+
+// =============================================================================
+// MARK: - Batch Signaling Comparisons
+// =============================================================================
+
+// Portable vector types (GCC/Clang vector extensions). These lower to SSE2/AVX
+// on x86 and NEON on arm64; comparisons yield all-ones lanes for true.
+typedef double signaling_v4f64 __attribute__((vector_size(32)));
+typedef float signaling_v8f32 __attribute__((vector_size(32)));
+
+static inline void signaling_raise_batch_invalid(size_t unordered) {
+    if (unordered != 0) {
+        feraiseexcept(FE_INVALID);
+        ieee754_raise_exception(IEEE754_EXCEPTION_INVALID);
+    }
+}
+
+// Each batch function evaluates the predicate and the unordered (NaN) mask a
+// vector at a time, finishes the tail with scalar code, and raises invalid
+// at most once for the whole batch. Unordered lanes produce the same result
+// as the scalar predicates: 1 for not-equal, 0 for everything else.
+#define IEEE754_SIGNALING_ARRAY(name, type, vector, lanes, op)                      \
+    size_t name(const type* x, const type* y, uint8_t* out, size_t n) {             \
+        size_t unordered = 0;                                                       \
+        size_t i = 0;                                                               \
+                                                                                    \
+        for (; i + (lanes) <= n; i += (lanes)) {                                    \
+            vector a, b;                                                            \
+            memcpy(&a, x + i, sizeof a);                                            \
+            memcpy(&b, y + i, sizeof b);                                            \
+                                                                                    \
+            __typeof__(a != b) nan = (a != a) | (b != b);                           \
+            __typeof__(a != b) result = (a op b);                                   \
+                                                                                    \
+            for (size_t lane = 0; lane < (lanes); lane++) {                         \
+                out[i + lane] = (uint8_t)(result[lane] & 1);                        \
+                unordered += (size_t)(nan[lane] & 1);                               \
+            }                                                                       \
+        }                                                                           \
+                                                                                    \
+        for (; i < n; i++) {                                                        \
+            unordered += (size_t)(isnan(x[i]) || isnan(y[i]));                      \
+            out[i] = (uint8_t)(x[i] op y[i]);                                       \
+        }                                                                           \
+                                                                                    \
+        signaling_raise_batch_invalid(unordered);                                   \
+        return unordered;                                                           \
+    }
+
+IEEE754_SIGNALING_ARRAY(ieee754_signaling_equal_array, double, signaling_v4f64, 4, ==)
+IEEE754_SIGNALING_ARRAY(ieee754_signaling_less_array, double, signaling_v4f64, 4, <)
+IEEE754_SIGNALING_ARRAY(ieee754_signaling_less_equal_array, double, signaling_v4f64, 4, <=)
+IEEE754_SIGNALING_ARRAY(ieee754_signaling_greater_array, double, signaling_v4f64, 4, >)
+IEEE754_SIGNALING_ARRAY(ieee754_signaling_greater_equal_array, double, signaling_v4f64, 4, >=)
+IEEE754_SIGNALING_ARRAY(ieee754_signaling_not_equal_array, double, signaling_v4f64, 4, !=)
+
+IEEE754_SIGNALING_ARRAY(ieee754_signaling_equal_array_f, float, signaling_v8f32, 8, ==)
+IEEE754_SIGNALING_ARRAY(ieee754_signaling_less_array_f, float, signaling_v8f32, 8, <)
+IEEE754_SIGNALING_ARRAY(ieee754_signaling_less_equal_array_f, float, signaling_v8f32, 8, <=)
+IEEE754_SIGNALING_ARRAY(ieee754_signaling_greater_array_f, float, signaling_v8f32, 8, >)
+IEEE754_SIGNALING_ARRAY(ieee754_signaling_greater_equal_array_f, float, signaling_v8f32, 8, >=)
+IEEE754_SIGNALING_ARRAY(ieee754_signaling_not_equal_array_f, float, signaling_v8f32, 8, !=)
+
+#undef IEEE754_SIGNALING_ARRAY
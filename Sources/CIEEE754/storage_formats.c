@@ -0,0 +1,273 @@
+// storage_formats.c
+// CIEEE754
+//
+// Bulk conversions between binary32 and the bfloat16 and OCP FP8 storage formats
+
+#include "include/ieee754_fpu.h"
+#include <fenv.h>
+#include <string.h>
+
+// Every kernel below is a branch-free loop over one element at a time, so
+// the compiler vectorizes the conversion and the exception counts together
+// (AVX2/AVX-512 on x86, NEON on arm64). Rounding is done on the integer
+// encodings, independently of the current rounding mode and without
+// touching the hardware flags until the batch is summarized. Counts are
+// kept in 32-bit lanes per block of COUNT_BLOCK elements, which keeps the
+// vector loops free of 64-bit accumulators.
+
+#define COUNT_BLOCK ((size_t)1 << 20)
+
+// Raise each exception that occurred anywhere in the batch exactly once
+static void summary_raise(const IEEE754ConversionSummary* summary) {
+    uint8_t mask = 0;
+    int fe = 0;
+
+    if (summary->invalid) {
+        mask |= IEEE754_EXCEPTION_MASK_INVALID;
+        fe |= FE_INVALID;
+    }
+    if (summary->overflow) {
+        mask |= IEEE754_EXCEPTION_MASK_OVERFLOW;
+        fe |= FE_OVERFLOW;
+    }
+    if (summary->underflow) {
+        mask |= IEEE754_EXCEPTION_MASK_UNDERFLOW;
+        fe |= FE_UNDERFLOW;
+    }
+    if (summary->inexact) {
+        mask |= IEEE754_EXCEPTION_MASK_INEXACT;
+        fe |= FE_INEXACT;
+    }
+
+    if (mask) {
+        feraiseexcept(fe);
+        ieee754_raise_exceptions_mask(mask);
+    }
+}
+
+static inline uint32_t float_bits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+static inline float bits_float(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+// =============================================================================
+// MARK: - Rounding
+// =============================================================================
+
+// Rounds the finite binary32 magnitude `magnitude` to a format with
+// `fraction_bits` trailing significand bits and exponent bias `bias`, to
+// nearest with ties to even, and returns the target's magnitude encoding.
+// The encoding is not clamped: values beyond the target's range come back
+// as codes past its largest finite one. `*inexact` reports whether any
+// bits were discarded.
+static inline uint32_t round_magnitude(uint32_t magnitude, int fraction_bits, int bias, uint32_t* inexact) {
+    int exponent = (int)(magnitude >> 23);
+    uint32_t significand = (magnitude & 0x7FFFFF) | (exponent ? 0x800000u : 0);
+    int effective = exponent ? exponent : 1;
+
+    // Below the target's normal range the quantum stays fixed at 2^(1-bias-t)
+    int denormal = (1 - bias + 127) - effective;
+    denormal = denormal > 0 ? denormal : 0;
+    int shift = 23 - fraction_bits + denormal;
+    shift = shift < 31 ? shift : 31;
+
+    uint32_t quotient = significand >> shift;
+    uint32_t remainder = significand & ((1u << shift) - 1);
+    uint32_t half = 1u << (shift - 1);
+    quotient += (remainder > half) | ((remainder == half) & quotient);
+
+    *inexact = remainder != 0;
+
+    // A carry out of the significand bumps the exponent field by itself
+    uint32_t normal = ((uint32_t)(effective - 127 + bias) << fraction_bits) + quotient - (1u << fraction_bits);
+    return denormal > 0 ? quotient : normal;
+}
+
+// =============================================================================
+// MARK: - bfloat16
+// =============================================================================
+
+void ieee754_bfloat16_widen_array(const void* src, float* dst, size_t n, int swap) {
+    const uint8_t* bytes = src;
+    for (size_t i = 0; i < n; i++) {
+        uint16_t bits;
+        memcpy(&bits, bytes + 2 * i, sizeof bits);
+        bits = swap ? (uint16_t)((bits << 8) | (bits >> 8)) : bits;
+        dst[i] = bits_float((uint32_t)bits << 16);
+    }
+}
+
+IEEE754ConversionSummary ieee754_convert_f32_to_bf16_array(const float* src, uint16_t* dst, size_t n, int saturate) {
+    IEEE754ConversionSummary summary = {0, 0, 0, 0};
+    const uint32_t largest = saturate ? 0x7F7F : 0x7F80;
+
+    for (size_t start = 0; start < n; start += COUNT_BLOCK) {
+        size_t end = n - start < COUNT_BLOCK ? n : start + COUNT_BLOCK;
+        uint32_t invalid = 0, overflow = 0, underflow = 0, inexact = 0;
+
+        for (size_t i = start; i < end; i++) {
+            uint32_t bits = float_bits(src[i]);
+            uint32_t sign = (bits >> 16) & 0x8000;
+            uint32_t magnitude = bits & 0x7FFFFFFF;
+            uint32_t is_nan = magnitude > 0x7F800000;
+            uint32_t is_infinite = magnitude == 0x7F800000;
+
+            // bfloat16 shares binary32's exponent, so rounding is one add on the encoding
+            uint32_t rounded = (magnitude + 0x7FFF + ((magnitude >> 16) & 1)) >> 16;
+            uint32_t lost = (magnitude & 0xFFFF) != 0;
+            uint32_t finite = !is_nan & !is_infinite;
+            uint32_t overflowed = (finite & (rounded >= 0x7F80)) | (is_infinite & (saturate != 0));
+            uint32_t code = overflowed ? largest : rounded;
+            code = is_nan ? (magnitude >> 16) | 0x0040 : code;
+
+            dst[i] = (uint16_t)(sign | code);
+            invalid += is_nan & !(magnitude & 0x00400000);
+            overflow += overflowed;
+            inexact += (finite & lost) | overflowed;
+            underflow += finite & lost & (magnitude < 0x00800000);
+        }
+
+        summary.invalid += invalid;
+        summary.overflow += overflow;
+        summary.underflow += underflow;
+        summary.inexact += inexact;
+    }
+    summary_raise(&summary);
+    return summary;
+}
+
+// =============================================================================
+// MARK: - FP8 E5M2
+// =============================================================================
+
+void ieee754_fp8_e5m2_widen_array(const uint8_t* src, float* dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        uint32_t bits = src[i];
+        uint32_t sign = (bits & 0x80) << 24;
+        uint32_t exponent = (bits >> 2) & 0x1F;
+        uint32_t fraction = bits & 0x3;
+
+        // Subnormals are fraction × 2^-16: normalize on the integer encoding
+        uint32_t lead = fraction >= 2;
+        uint32_t subnormal = fraction ? ((111 + lead) << 23) | ((fraction - (1u << lead)) << (23 - lead)) : 0;
+        uint32_t biased = exponent == 0x1F ? 0xFF : exponent + 112;
+        uint32_t magnitude = exponent == 0 ? subnormal : (biased << 23) | (fraction << 21);
+
+        dst[i] = bits_float(sign | magnitude);
+    }
+}
+
+IEEE754ConversionSummary ieee754_convert_f32_to_fp8_e5m2_array(
+    const float* src, uint8_t* dst, size_t n, int saturate
+) {
+    IEEE754ConversionSummary summary = {0, 0, 0, 0};
+    const uint32_t largest = saturate ? 0x7B : 0x7C;
+
+    for (size_t start = 0; start < n; start += COUNT_BLOCK) {
+        size_t end = n - start < COUNT_BLOCK ? n : start + COUNT_BLOCK;
+        uint32_t invalid = 0, overflow = 0, underflow = 0, inexact = 0;
+
+        for (size_t i = start; i < end; i++) {
+            uint32_t bits = float_bits(src[i]);
+            uint32_t sign = (bits >> 24) & 0x80;
+            uint32_t magnitude = bits & 0x7FFFFFFF;
+            uint32_t is_nan = magnitude > 0x7F800000;
+            uint32_t is_infinite = magnitude == 0x7F800000;
+
+            uint32_t lost;
+            uint32_t rounded = round_magnitude(magnitude, 2, 15, &lost);
+            uint32_t tiny = magnitude < 0x38800000;
+            uint32_t finite = !is_nan & !is_infinite;
+            uint32_t overflowed = (finite & (rounded > 0x7B)) | (is_infinite & (saturate != 0));
+            uint32_t code = overflowed ? largest : rounded;
+            code = is_nan ? 0x7E | ((magnitude >> 21) & 1) : code;
+            code = is_infinite & !saturate ? 0x7C : code;
+
+            dst[i] = (uint8_t)(sign | code);
+            invalid += is_nan & !(magnitude & 0x00400000);
+            overflow += overflowed;
+            inexact += (finite & lost) | overflowed;
+            underflow += finite & lost & tiny;
+        }
+
+        summary.invalid += invalid;
+        summary.overflow += overflow;
+        summary.underflow += underflow;
+        summary.inexact += inexact;
+    }
+    summary_raise(&summary);
+    return summary;
+}
+
+// =============================================================================
+// MARK: - FP8 E4M3
+// =============================================================================
+
+void ieee754_fp8_e4m3_widen_array(const uint8_t* src, float* dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        uint32_t bits = src[i];
+        uint32_t sign = (bits & 0x80) << 24;
+        uint32_t exponent = (bits >> 3) & 0xF;
+        uint32_t fraction = bits & 0x7;
+
+        // Subnormals are fraction × 2^-9; S.1111.111 is the only NaN
+        uint32_t lead = (fraction >= 2) + (fraction >= 4);
+        uint32_t subnormal = fraction ? ((118 + lead) << 23) | ((fraction - (1u << lead)) << (23 - lead)) : 0;
+        uint32_t normal = ((exponent + 120) << 23) | (fraction << 20);
+        uint32_t magnitude = exponent == 0 ? subnormal : normal;
+        magnitude = (bits & 0x7F) == 0x7F ? 0x7FC00000 : magnitude;
+
+        dst[i] = bits_float(sign | magnitude);
+    }
+}
+
+IEEE754ConversionSummary ieee754_convert_f32_to_fp8_e4m3_array(
+    const float* src, uint8_t* dst, size_t n, int saturate
+) {
+    IEEE754ConversionSummary summary = {0, 0, 0, 0};
+
+    for (size_t start = 0; start < n; start += COUNT_BLOCK) {
+        size_t end = n - start < COUNT_BLOCK ? n : start + COUNT_BLOCK;
+        uint32_t invalid = 0, overflow = 0, underflow = 0, inexact = 0;
+
+        for (size_t i = start; i < end; i++) {
+            uint32_t bits = float_bits(src[i]);
+            uint32_t sign = (bits >> 24) & 0x80;
+            uint32_t magnitude = bits & 0x7FFFFFFF;
+            uint32_t is_nan = magnitude > 0x7F800000;
+            uint32_t is_infinite = magnitude == 0x7F800000;
+
+            uint32_t lost;
+            uint32_t rounded = round_magnitude(magnitude, 3, 7, &lost);
+            uint32_t tiny = magnitude < 0x3C800000;
+            uint32_t finite = !is_nan & !is_infinite;
+
+            // There is no infinity: out-of-range values saturate to ±448 or become NaN
+            uint32_t overflowed = finite & (rounded > 0x7E);
+            uint32_t clamped = (overflowed | is_infinite) & (saturate != 0);
+            uint32_t code = rounded;
+            code = clamped ? 0x7E : code;
+            code = (is_nan | ((overflowed | is_infinite) & !saturate)) ? 0x7F : code;
+
+            dst[i] = (uint8_t)(sign | code);
+            invalid += (is_nan & !(magnitude & 0x00400000)) | (is_infinite & !saturate);
+            overflow += overflowed | (is_infinite & (saturate != 0));
+            inexact += (finite & lost) | overflowed | (is_infinite & (saturate != 0));
+            underflow += finite & lost & tiny;
+        }
+
+        summary.invalid += invalid;
+        summary.overflow += overflow;
+        summary.underflow += underflow;
+        summary.inexact += inexact;
+    }
+    summary_raise(&summary);
+    return summary;
+}
@@ -0,0 +1,23 @@
+// system_info.c
+// CIEEE754
+//
+// Host information used to size parallel bulk operations
+
+#include "include/ieee754_fpu.h"
+#include <stdatomic.h>
+#include <unistd.h>
+
+static _Atomic int processor_count = 0;
+
+int ieee754_processor_count(void) {
+    int count = atomic_load_explicit(&processor_count, memory_order_relaxed);
+    if (count > 0) {
+        return count;
+    }
+
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    count = online > 0 ? (int)online : 1;
+
+    atomic_store_explicit(&processor_count, count, memory_order_relaxed);
+    return count;
+}
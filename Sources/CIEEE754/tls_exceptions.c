@@ -5,122 +5,410 @@
 
 #include "include/ieee754_fpu.h"
 #include <pthread.h>
+#include <stdatomic.h>
 #include <stdlib.h>
 #include <string.h>
 
-// Thread-local exception state
-typedef struct {
-    uint8_t invalid;
-    uint8_t divByZero;
-    uint8_t overflow;
-    uint8_t underflow;
-    uint8_t inexact;
-} ThreadExceptionState;
+// =============================================================================
+// MARK: - Thread Slots
+// =============================================================================
+
+// Each thread owns one slot holding its five flags as a packed atomic byte,
+// one bit per IEEE754ExceptionFlag. Only the owning thread raises flags in its
+// slot, so raising is a relaxed load plus, at most, a relaxed OR on a cache
+// line no other thread writes. Slots are linked into a push-only registry so
+// the aggregate view can merge every thread's flags on read. Slots released at
+// thread exit are folded into `retired_mask` and reused by later threads.
+//
+// A slot may also carry exception counters for accounting scopes (see
+// Exception Accounting below). They are allocated on the thread's first
+// scope entry and stay with the slot, so counts from exited threads remain
+// visible and later owners keep adding to them. Only the owner writes them:
+// a reset records each counter's current value as a baseline that readers
+// subtract, so it never races with an increment.
+
+#define IEEE754_CACHE_LINE 64
+
+typedef struct ThreadExceptionSlot {
+    _Atomic uint8_t mask;
+    _Atomic int in_use;
+    struct ThreadExceptionSlot* next;
+    int scope; // Accounting scope + 1, or 0 outside any scope; owner only
+    _Atomic(_Atomic uint64_t*) counters; // [scope][flag] then baselines, or NULL
+} ThreadExceptionSlot;
+
+// Pad each slot to its own cache line to avoid false sharing between threads
+typedef union {
+    ThreadExceptionSlot slot;
+    char padding[IEEE754_CACHE_LINE];
+} PaddedThreadExceptionSlot;
+
+static _Atomic(ThreadExceptionSlot*) slot_registry = NULL;
+static _Atomic uint8_t retired_mask = 0;
+
+// Flags are only ever set from the owning thread; used when allocation fails
+static ThreadExceptionSlot fallback_slot = { 0, 1, NULL, 0, NULL };
+
+// =============================================================================
+// MARK: - Slot Lifetime
+// =============================================================================
+
+// The pthread key releases a thread's slot at exit. When the compiler provides
+// native thread-local storage it is only consulted on a thread's first access;
+// otherwise it is also how the slot is found. Define IEEE754_USE_PTHREAD_TLS
+// to force the pthread-key lookup.
+
+#if !defined(IEEE754_USE_PTHREAD_TLS)
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define IEEE754_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+#define IEEE754_THREAD_LOCAL __thread
+#endif
+#endif
+
+#if defined(IEEE754_THREAD_LOCAL)
+static IEEE754_THREAD_LOCAL ThreadExceptionSlot* thread_slot;
+#endif
 
-// pthread key for thread-local storage
 static pthread_key_t exception_key;
 static pthread_once_t key_once = PTHREAD_ONCE_INIT;
 
-// Cleanup function for thread exit
-static void cleanup_thread_exceptions(void* state) {
-    free(state);
+// Return a thread's slot to the registry, keeping its flags in the aggregate
+static void release_thread_slot(void* state) {
+    ThreadExceptionSlot* slot = state;
+
+    uint8_t flags = atomic_exchange_explicit(&slot->mask, 0, memory_order_relaxed);
+    atomic_fetch_or_explicit(&retired_mask, flags, memory_order_relaxed);
+    slot->scope = 0;
+    atomic_store_explicit(&slot->in_use, 0, memory_order_release);
+
+#if defined(IEEE754_THREAD_LOCAL)
+    thread_slot = NULL;
+#endif
 }
 
 // Initialize the pthread key (called once)
 static void make_exception_key(void) {
-    pthread_key_create(&exception_key, cleanup_thread_exceptions);
+    pthread_key_create(&exception_key, release_thread_slot);
 }
 
-// Get or create thread-local exception state
-static ThreadExceptionState* get_thread_state(void) {
+// Claim a released slot, or allocate and register a new one
+static ThreadExceptionSlot* acquire_thread_slot(void) {
+    for (ThreadExceptionSlot* slot = atomic_load_explicit(&slot_registry, memory_order_acquire);
+         slot != NULL;
+         slot = slot->next)
+    {
+        int expected = 0;
+        if (atomic_compare_exchange_strong_explicit(
+                &slot->in_use, &expected, 1, memory_order_acquire, memory_order_relaxed))
+        {
+            return slot;
+        }
+    }
+
+    void* storage = NULL;
+    if (posix_memalign(&storage, IEEE754_CACHE_LINE, sizeof(PaddedThreadExceptionSlot)) != 0) {
+        return NULL;
+    }
+
+    ThreadExceptionSlot* slot = &((PaddedThreadExceptionSlot*)storage)->slot;
+    atomic_init(&slot->mask, 0);
+    atomic_init(&slot->in_use, 1);
+    slot->scope = 0;
+    atomic_init(&slot->counters, NULL);
+
+    ThreadExceptionSlot* head = atomic_load_explicit(&slot_registry, memory_order_relaxed);
+    do {
+        slot->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(
+        &slot_registry, &head, slot, memory_order_release, memory_order_relaxed));
+
+    return slot;
+}
+
+// Slow path: first access from this thread
+static ThreadExceptionSlot* register_thread_slot(void) {
     pthread_once(&key_once, make_exception_key);
 
-    ThreadExceptionState* state = pthread_getspecific(exception_key);
-    if (!state) {
-        state = calloc(1, sizeof(ThreadExceptionState));
-        pthread_setspecific(exception_key, state);
+    ThreadExceptionSlot* slot = pthread_getspecific(exception_key);
+    if (!slot) {
+        slot = acquire_thread_slot();
+        if (!slot) {
+            return &fallback_slot;
+        }
+        pthread_setspecific(exception_key, slot);
     }
 
-    return state;
+#if defined(IEEE754_THREAD_LOCAL)
+    thread_slot = slot;
+#endif
+    return slot;
 }
 
-void ieee754_raise_exception(IEEE754ExceptionFlag flag) {
-    ThreadExceptionState* state = get_thread_state();
+static inline ThreadExceptionSlot* get_thread_slot(void) {
+#if defined(IEEE754_THREAD_LOCAL)
+    ThreadExceptionSlot* slot = thread_slot;
+    if (__builtin_expect(slot != NULL, 1)) {
+        return slot;
+    }
+#endif
+    return register_thread_slot();
+}
 
-    switch (flag) {
-        case IEEE754_EXCEPTION_INVALID:
-            state->invalid = 1;
-            break;
-        case IEEE754_EXCEPTION_DIVBYZERO:
-            state->divByZero = 1;
-            break;
-        case IEEE754_EXCEPTION_OVERFLOW:
-            state->overflow = 1;
-            break;
-        case IEEE754_EXCEPTION_UNDERFLOW:
-            state->underflow = 1;
-            break;
-        case IEEE754_EXCEPTION_INEXACT:
-            state->inexact = 1;
-            break;
+// Bit for a single flag, or 0 for values outside IEEE754ExceptionFlag
+static inline uint8_t exception_bit(IEEE754ExceptionFlag flag) {
+    unsigned index = (unsigned)flag;
+    return index <= IEEE754_EXCEPTION_INEXACT ? (uint8_t)(1u << index) : 0;
+}
+
+static void count_in_slot(ThreadExceptionSlot* slot, uint8_t bits);
+
+static inline void raise_in_slot(ThreadExceptionSlot* slot, uint8_t bits) {
+    if (__builtin_expect(slot->scope != 0, 0)) {
+        count_in_slot(slot, bits);
     }
+    // Flags are sticky: skip the read-modify-write when already raised
+    if ((atomic_load_explicit(&slot->mask, memory_order_relaxed) & bits) != bits) {
+        atomic_fetch_or_explicit(&slot->mask, bits, memory_order_relaxed);
+    }
+}
+
+// =============================================================================
+// MARK: - Single Flag Operations
+// =============================================================================
+
+void ieee754_raise_exception(IEEE754ExceptionFlag flag) {
+    raise_in_slot(get_thread_slot(), exception_bit(flag));
 }
 
 int ieee754_test_exception(IEEE754ExceptionFlag flag) {
-    ThreadExceptionState* state = get_thread_state();
+    return (atomic_load_explicit(&get_thread_slot()->mask, memory_order_relaxed) & exception_bit(flag)) != 0;
+}
+
+void ieee754_clear_exception(IEEE754ExceptionFlag flag) {
+    atomic_fetch_and_explicit(&get_thread_slot()->mask, (uint8_t)~exception_bit(flag), memory_order_relaxed);
+}
+
+// =============================================================================
+// MARK: - Mask Operations
+// =============================================================================
+
+void ieee754_raise_exceptions_mask(uint8_t mask) {
+    raise_in_slot(get_thread_slot(), (uint8_t)(mask & IEEE754_EXCEPTION_MASK_ALL));
+}
+
+uint8_t ieee754_get_exceptions_mask(void) {
+    return atomic_load_explicit(&get_thread_slot()->mask, memory_order_relaxed);
+}
+
+void ieee754_clear_exceptions_mask(uint8_t mask) {
+    atomic_fetch_and_explicit(&get_thread_slot()->mask, (uint8_t)~mask, memory_order_relaxed);
+}
+
+uint8_t ieee754_swap_exceptions_mask(uint8_t mask) {
+    return atomic_exchange_explicit(
+        &get_thread_slot()->mask, (uint8_t)(mask & IEEE754_EXCEPTION_MASK_ALL), memory_order_relaxed);
+}
 
-    switch (flag) {
-        case IEEE754_EXCEPTION_INVALID:
-            return state->invalid;
-        case IEEE754_EXCEPTION_DIVBYZERO:
-            return state->divByZero;
-        case IEEE754_EXCEPTION_OVERFLOW:
-            return state->overflow;
-        case IEEE754_EXCEPTION_UNDERFLOW:
-            return state->underflow;
-        case IEEE754_EXCEPTION_INEXACT:
-            return state->inexact;
-        default:
-            return 0;
+IEEE754Exceptions ieee754_get_exceptions(void) {
+    uint8_t mask = ieee754_get_exceptions_mask();
+
+    IEEE754Exceptions ex;
+    ex.invalid = (mask & IEEE754_EXCEPTION_MASK_INVALID) != 0;
+    ex.divByZero = (mask & IEEE754_EXCEPTION_MASK_DIVBYZERO) != 0;
+    ex.overflow = (mask & IEEE754_EXCEPTION_MASK_OVERFLOW) != 0;
+    ex.underflow = (mask & IEEE754_EXCEPTION_MASK_UNDERFLOW) != 0;
+    ex.inexact = (mask & IEEE754_EXCEPTION_MASK_INEXACT) != 0;
+
+    return ex;
+}
+
+void ieee754_clear_all_exceptions(void) {
+    atomic_store_explicit(&get_thread_slot()->mask, 0, memory_order_relaxed);
+}
+
+// =============================================================================
+// MARK: - Aggregate View
+// =============================================================================
+
+uint8_t ieee754_get_aggregate_exceptions_mask(void) {
+    uint8_t mask = atomic_load_explicit(&retired_mask, memory_order_relaxed);
+
+    for (ThreadExceptionSlot* slot = atomic_load_explicit(&slot_registry, memory_order_acquire);
+         slot != NULL;
+         slot = slot->next)
+    {
+        mask |= atomic_load_explicit(&slot->mask, memory_order_relaxed);
     }
+
+    return (uint8_t)(mask | atomic_load_explicit(&fallback_slot.mask, memory_order_relaxed));
 }
 
-void ieee754_clear_exception(IEEE754ExceptionFlag flag) {
-    ThreadExceptionState* state = get_thread_state();
+void ieee754_clear_aggregate_exceptions(void) {
+    atomic_store_explicit(&retired_mask, 0, memory_order_relaxed);
 
-    switch (flag) {
-        case IEEE754_EXCEPTION_INVALID:
-            state->invalid = 0;
-            break;
-        case IEEE754_EXCEPTION_DIVBYZERO:
-            state->divByZero = 0;
-            break;
-        case IEEE754_EXCEPTION_OVERFLOW:
-            state->overflow = 0;
+    for (ThreadExceptionSlot* slot = atomic_load_explicit(&slot_registry, memory_order_acquire);
+         slot != NULL;
+         slot = slot->next)
+    {
+        atomic_store_explicit(&slot->mask, 0, memory_order_relaxed);
+    }
+
+    atomic_store_explicit(&fallback_slot.mask, 0, memory_order_relaxed);
+}
+
+// =============================================================================
+// MARK: - Exception Accounting
+// =============================================================================
+
+#define IEEE754_ACCOUNTING_FLAGS 5
+#define IEEE754_ACCOUNTING_OTHER (IEEE754_ACCOUNTING_MAX_SCOPES - 1)
+#define IEEE754_ACCOUNTING_COUNTERS ((size_t)IEEE754_ACCOUNTING_MAX_SCOPES * IEEE754_ACCOUNTING_FLAGS)
+
+// Registered labels; entries are written once, under `label_lock`
+static _Atomic(const char*) scope_labels[IEEE754_ACCOUNTING_MAX_SCOPES];
+static pthread_mutex_t label_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Counters are written only by the slot's owner (reset moves the baselines
+// instead), so a relaxed load and store is enough and no read-modify-write
+// is needed
+static void count_in_slot(ThreadExceptionSlot* slot, uint8_t bits) {
+    _Atomic uint64_t* counters = atomic_load_explicit(&slot->counters, memory_order_relaxed);
+    if (!counters) {
+        return;
+    }
+    _Atomic uint64_t* row = counters + (size_t)(slot->scope - 1) * IEEE754_ACCOUNTING_FLAGS;
+    for (unsigned flag = 0; flag < IEEE754_ACCOUNTING_FLAGS; flag++) {
+        if (bits & (1u << flag)) {
+            uint64_t count = atomic_load_explicit(&row[flag], memory_order_relaxed);
+            atomic_store_explicit(&row[flag], count + 1, memory_order_relaxed);
+        }
+    }
+}
+
+int ieee754_accounting_scope(const char* label) {
+    if (!label || !*label) {
+        return 0;
+    }
+
+    // Fast path: labels are never removed, so a lock-free scan finds any
+    // label registered before this call
+    for (int scope = 1; scope < IEEE754_ACCOUNTING_MAX_SCOPES; scope++) {
+        const char* existing = atomic_load_explicit(&scope_labels[scope], memory_order_acquire);
+        if (!existing) {
             break;
-        case IEEE754_EXCEPTION_UNDERFLOW:
-            state->underflow = 0;
+        }
+        if (strcmp(existing, label) == 0) {
+            return scope;
+        }
+    }
+
+    pthread_mutex_lock(&label_lock);
+    int found = IEEE754_ACCOUNTING_OTHER;
+    for (int scope = 1; scope < IEEE754_ACCOUNTING_OTHER; scope++) {
+        const char* existing = atomic_load_explicit(&scope_labels[scope], memory_order_relaxed);
+        if (!existing) {
+            char* copy = strdup(label);
+            if (copy) {
+                atomic_store_explicit(&scope_labels[scope], copy, memory_order_release);
+                found = scope;
+            }
             break;
-        case IEEE754_EXCEPTION_INEXACT:
-            state->inexact = 0;
+        }
+        if (strcmp(existing, label) == 0) {
+            found = scope;
             break;
+        }
+    }
+    if (found == IEEE754_ACCOUNTING_OTHER && !atomic_load_explicit(&scope_labels[found], memory_order_relaxed)) {
+        atomic_store_explicit(&scope_labels[found], "other", memory_order_release);
     }
+    pthread_mutex_unlock(&label_lock);
+    return found;
 }
 
-IEEE754Exceptions ieee754_get_exceptions(void) {
-    ThreadExceptionState* state = get_thread_state();
+const char* ieee754_accounting_scope_label(int scope) {
+    if (scope == 0) {
+        return "";
+    }
+    if (scope < 0 || scope >= IEEE754_ACCOUNTING_MAX_SCOPES) {
+        return NULL;
+    }
+    return atomic_load_explicit(&scope_labels[scope], memory_order_acquire);
+}
 
-    IEEE754Exceptions ex;
-    ex.invalid = state->invalid;
-    ex.divByZero = state->divByZero;
-    ex.overflow = state->overflow;
-    ex.underflow = state->underflow;
-    ex.inexact = state->inexact;
+int ieee754_accounting_enter(int scope) {
+    ThreadExceptionSlot* slot = get_thread_slot();
+    int previous = slot->scope - 1;
+    if (slot == &fallback_slot || scope < 0 || scope >= IEEE754_ACCOUNTING_MAX_SCOPES) {
+        return previous;
+    }
 
-    return ex;
+    if (!atomic_load_explicit(&slot->counters, memory_order_relaxed)) {
+        // Counters followed by the baselines `ieee754_accounting_reset` records
+        _Atomic uint64_t* counters = calloc(2 * IEEE754_ACCOUNTING_COUNTERS, sizeof(_Atomic uint64_t));
+        if (!counters) {
+            return previous;
+        }
+        atomic_store_explicit(&slot->counters, counters, memory_order_release);
+    }
+    slot->scope = scope + 1;
+    return previous;
 }
 
-void ieee754_clear_all_exceptions(void) {
-    ThreadExceptionState* state = get_thread_state();
-    memset(state, 0, sizeof(ThreadExceptionState));
+void ieee754_accounting_exit(int previous) {
+    ThreadExceptionSlot* slot = get_thread_slot();
+    if (slot != &fallback_slot) {
+        slot->scope = previous >= 0 && previous < IEEE754_ACCOUNTING_MAX_SCOPES ? previous + 1 : 0;
+    }
+}
+
+IEEE754ExceptionCounts ieee754_accounting_counts(int scope) {
+    uint64_t totals[IEEE754_ACCOUNTING_FLAGS] = { 0 };
+
+    if (scope >= 0 && scope < IEEE754_ACCOUNTING_MAX_SCOPES) {
+        for (ThreadExceptionSlot* slot = atomic_load_explicit(&slot_registry, memory_order_acquire);
+             slot != NULL;
+             slot = slot->next)
+        {
+            _Atomic uint64_t* counters = atomic_load_explicit(&slot->counters, memory_order_acquire);
+            if (!counters) {
+                continue;
+            }
+            _Atomic uint64_t* row = counters + (size_t)scope * IEEE754_ACCOUNTING_FLAGS;
+            _Atomic uint64_t* baseline = row + IEEE754_ACCOUNTING_COUNTERS;
+            for (unsigned flag = 0; flag < IEEE754_ACCOUNTING_FLAGS; flag++) {
+                // Acquire pairs with the reset's release, so the counter read
+                // next is no older than the value the baseline was taken from
+                uint64_t base = atomic_load_explicit(&baseline[flag], memory_order_acquire);
+                uint64_t count = atomic_load_explicit(&row[flag], memory_order_relaxed);
+                totals[flag] += count > base ? count - base : 0;
+            }
+        }
+    }
+
+    IEEE754ExceptionCounts counts;
+    counts.invalid = totals[IEEE754_EXCEPTION_INVALID];
+    counts.divByZero = totals[IEEE754_EXCEPTION_DIVBYZERO];
+    counts.overflow = totals[IEEE754_EXCEPTION_OVERFLOW];
+    counts.underflow = totals[IEEE754_EXCEPTION_UNDERFLOW];
+    counts.inexact = totals[IEEE754_EXCEPTION_INEXACT];
+    return counts;
+}
+
+void ieee754_accounting_reset(void) {
+    for (ThreadExceptionSlot* slot = atomic_load_explicit(&slot_registry, memory_order_acquire);
+         slot != NULL;
+         slot = slot->next)
+    {
+        _Atomic uint64_t* counters = atomic_load_explicit(&slot->counters, memory_order_acquire);
+        if (!counters) {
+            continue;
+        }
+        _Atomic uint64_t* baselines = counters + IEEE754_ACCOUNTING_COUNTERS;
+        for (size_t index = 0; index < IEEE754_ACCOUNTING_COUNTERS; index++) {
+            uint64_t count = atomic_load_explicit(&counters[index], memory_order_relaxed);
+            atomic_store_explicit(&baselines[index], count, memory_order_release);
+        }
+    }
 }
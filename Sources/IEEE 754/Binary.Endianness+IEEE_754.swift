@@ -0,0 +1,30 @@
+// Binary.Endianness+IEEE_754.swift
+// swift-ieee-754
+//
+// Host byte order helpers for bulk IEEE 754 serialization
+
+public import Binary
+
+extension Binary.Endianness {
+    /// Whether this byte order matches the host's in-memory layout
+    ///
+    /// Bulk codecs use this to decide whether bytes can be copied verbatim or
+    /// must be byte-swapped after the copy. Resolved at compile time.
+    @inlinable
+    internal var isHostOrder: Bool {
+        switch self {
+        case .little:
+            #if _endian(little)
+                return true
+            #else
+                return false
+            #endif
+        case .big:
+            #if _endian(big)
+                return true
+            #else
+                return false
+            #endif
+        }
+    }
+}
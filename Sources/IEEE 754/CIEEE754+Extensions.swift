@@ -37,10 +37,9 @@
         _ mode: IEEE754RoundingMode,
         _ body: () throws -> T
     ) rethrows -> T {
-        let originalMode = ieee754_get_rounding_mode()
-        defer { ieee754_set_rounding_mode(originalMode) }
+        let saved = ieee754_swap_rounding_mode(mode)
+        defer { ieee754_restore_rounding_mode(saved) }
 
-        ieee754_set_rounding_mode(mode)
         return try body()
     }
 
@@ -48,6 +47,8 @@
     ///
     /// Executes a closure with cleared exception state, then automatically
     /// restores the original exception flags - even if the closure throws.
+    /// Both the thread-local and the hardware FPU flags are isolated, and
+    /// anything the closure raises is discarded.
     ///
     /// ## Usage
     ///
@@ -63,29 +64,7 @@
     /// - Returns: The value returned by the closure
     /// - Throws: Rethrows any error thrown by the closure
     func withClearedExceptions<T>(_ body: () throws -> T) rethrows -> T {
-        let originalExceptions = ieee754_get_exceptions()
-        defer {
-            // Restore original exception state
-            ieee754_clear_all_exceptions()
-            if originalExceptions.invalid != 0 {
-                ieee754_raise_exception(IEEE754_EXCEPTION_INVALID)
-            }
-            if originalExceptions.divByZero != 0 {
-                ieee754_raise_exception(IEEE754_EXCEPTION_DIVBYZERO)
-            }
-            if originalExceptions.overflow != 0 {
-                ieee754_raise_exception(IEEE754_EXCEPTION_OVERFLOW)
-            }
-            if originalExceptions.underflow != 0 {
-                ieee754_raise_exception(IEEE754_EXCEPTION_UNDERFLOW)
-            }
-            if originalExceptions.inexact != 0 {
-                ieee754_raise_exception(IEEE754_EXCEPTION_INEXACT)
-            }
-        }
-
-        ieee754_clear_all_exceptions()
-        return try body()
+        try IEEE_754.Exceptions.capturing(merging: false, body).result
     }
 
     /// Scoped rounding mode and exception state execution
@@ -0,0 +1,1005 @@
+// IEEE_754.Arithmetic.Reproducible.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 11: Binned sum, dot and norm reductions independent of order and chunking
+
+// MARK: - Binned Accumulator
+
+extension IEEE_754.Arithmetic {
+    /// A binary64 sum whose result does not depend on the order or grouping of its terms
+    ///
+    /// Implements the binned accumulator of Demmel and Nguyen, as used by
+    /// ReproBLAS. The exponent range is divided into bins of 40 bits on a
+    /// fixed grid, and every term is split exactly into its parts on that
+    /// grid. The accumulator keeps the three bins below the largest term seen
+    /// so far and sums each one exactly, so its state is a function of the
+    /// terms alone: adding them in any order, in any number of pieces, and
+    /// merging the pieces in any order gives the same bits.
+    ///
+    /// The three bins span 80 to 120 bits below the largest term, depending
+    /// on where it falls in its bin; parts of terms below that are
+    /// discarded, and the result is otherwise within an ulp of the exact
+    /// sum. Float terms are accumulated exactly in binary64.
+    ///
+    /// Use it directly to reduce data that arrives in pieces, such as one
+    /// partial per shard; ``reproducibleSum(_:)``, ``reproducibleDot(_:_:)``
+    /// and ``reproducibleNorm(_:)`` wrap it for whole collections.
+    ///
+    /// Example:
+    /// ```swift
+    /// var total = IEEE_754.Arithmetic.BinnedSum()
+    /// for shard in shards {
+    ///     total.merge(shard.partial)   // each built with add(contentsOf:)
+    /// }
+    /// total.value                      // same bits for any sharding
+    /// ```
+    public struct BinnedSum: Sendable {
+        /// Bin number of the highest bin kept, counted from the least subnormal
+        @usableFromInline
+        internal var index: Int
+
+        /// Part of each bin below its carry unit, in `[0, unit)`; lane 3 is unused
+        @usableFromInline
+        internal var offsets: SIMD4<Double>
+
+        /// Multiples of each bin's carry unit
+        @usableFromInline
+        internal var carries: SIMD4<Int>
+
+        /// Non-finite terms and lost bits seen, as ``BinnedSum`` state bits
+        @usableFromInline
+        internal var state: UInt8
+
+        /// An empty sum, whose value is +0
+        @inlinable
+        public init() {
+            self.init(index: IEEE_754.Arithmetic.binnedFolds - 1)
+        }
+
+        @inlinable
+        internal init(index: Int) {
+            self.index = index
+            self.offsets = .zero
+            self.carries = .zero
+            self.state = 0
+        }
+    }
+}
+
+extension IEEE_754.Arithmetic.BinnedSum {
+    @usableFromInline
+    internal static let quietNaN: UInt8 = 1 << 0
+
+    @usableFromInline
+    internal static let signalingNaN: UInt8 = 1 << 1
+
+    @usableFromInline
+    internal static let positiveInfinity: UInt8 = 1 << 2
+
+    @usableFromInline
+    internal static let negativeInfinity: UInt8 = 1 << 3
+
+    /// A term was invalid itself, such as 0 × ∞ in a dot product
+    @usableFromInline
+    internal static let invalidTerm: UInt8 = 1 << 4
+
+    /// A term overflowed from finite operands
+    @usableFromInline
+    internal static let overflowTerm: UInt8 = 1 << 5
+
+    /// Nonzero bits fell below the lowest bin kept
+    @usableFromInline
+    internal static let truncated: UInt8 = 1 << 6
+
+    /// Adds `offset`, a multiple of the bin's grid, and `carry` units to bin `fold`
+    ///
+    /// Keeps the offset in `[0, unit)` by moving whole units into the carry;
+    /// rounding down rather than to nearest makes the split of a bin's value
+    /// unique, whatever sequence of additions produced it.
+    @inlinable
+    internal mutating func accumulate(fold: Int, offset: Double, carry: Int) {
+        let unit = IEEE_754.Arithmetic.binnedUnit(index, fold)
+        let total = offsets[fold] + offset
+        let units = (total / unit).rounded(.down)
+        offsets[fold] = total - units * unit
+        carries[fold] += Int(units) + carry
+    }
+
+    /// Moves the sum to a higher bin number, dropping the bins that fall off the bottom
+    @inlinable
+    internal mutating func raise(to newIndex: Int) {
+        guard newIndex > index else { return }
+        var raised = Self(index: newIndex)
+        raised.state = state
+        let shift = newIndex - index
+        let scale = IEEE_754.Arithmetic.binnedScaleExponent(index)
+            - IEEE_754.Arithmetic.binnedScaleExponent(newIndex)
+        let rescale = Double(sign: .plus, exponent: scale, significand: 1)
+        for fold in 0..<IEEE_754.Arithmetic.binnedFolds {
+            if fold + shift < IEEE_754.Arithmetic.binnedFolds {
+                // Same grid, so the carry unit is unchanged
+                raised.accumulate(fold: fold + shift, offset: offsets[fold] * rescale, carry: carries[fold])
+            } else if offsets[fold] != 0 || carries[fold] != 0 {
+                raised.state |= Self.truncated
+            }
+        }
+        self = raised
+    }
+
+    /// Adds the terms of `other`; exact for every bin both sums keep
+    ///
+    /// - Parameter other: Another binned sum
+    @inlinable
+    public mutating func merge(_ other: Self) {
+        var other = other
+        if other.index > index {
+            raise(to: other.index)
+        } else {
+            other.raise(to: index)
+        }
+        for fold in 0..<IEEE_754.Arithmetic.binnedFolds {
+            accumulate(fold: fold, offset: other.offsets[fold], carry: other.carries[fold])
+        }
+        state |= other.state
+    }
+
+    /// The sum of the terms of both sums
+    ///
+    /// - Parameter other: Another binned sum
+    /// - Returns: A sum holding the terms of `self` and `other`
+    @inlinable
+    public func merging(_ other: Self) -> Self {
+        var result = self
+        result.merge(other)
+        return result
+    }
+
+    /// Adds one term
+    ///
+    /// - Parameter value: The term
+    @inlinable
+    public mutating func add(_ value: Double) {
+        withUnsafePointer(to: value) { pointer in
+            merge(IEEE_754.Arithmetic.binnedSum(UnsafeBufferPointer(start: pointer, count: 1)))
+        }
+    }
+
+    /// Adds every element of `values`
+    ///
+    /// - Parameter values: The terms
+    @inlinable
+    public mutating func add<C: Collection<Double>>(contentsOf values: C) {
+        merge(IEEE_754.Arithmetic.contiguous(values) { IEEE_754.Arithmetic.binnedSum($0) })
+    }
+
+    /// Adds every element of `values`, widened exactly to binary64
+    ///
+    /// - Parameter values: The terms
+    @inlinable
+    public mutating func add<C: Collection<Float>>(contentsOf values: C) {
+        merge(IEEE_754.Arithmetic.contiguous(values) { IEEE_754.Arithmetic.binnedSum($0) })
+    }
+
+    /// Adds `x[i] × y[i]` for every `i`, each product split exactly (TwoProd)
+    ///
+    /// - Parameters:
+    ///   - x: First factors
+    ///   - y: Second factors, same count as `x`
+    @inlinable
+    public mutating func addProducts<X: Collection<Double>, Y: Collection<Double>>(_ x: X, _ y: Y) {
+        let products = IEEE_754.Arithmetic.contiguous(x) { x in
+            IEEE_754.Arithmetic.contiguous(y) { y in IEEE_754.Arithmetic.binnedDot(x, y) }
+        }
+        merge(products)
+    }
+
+    /// Adds `x[i] × y[i]` for every `i`; Float products are exact in binary64
+    ///
+    /// - Parameters:
+    ///   - x: First factors
+    ///   - y: Second factors, same count as `x`
+    @inlinable
+    public mutating func addProducts<X: Collection<Float>, Y: Collection<Float>>(_ x: X, _ y: Y) {
+        let products = IEEE_754.Arithmetic.contiguous(x) { x in
+            IEEE_754.Arithmetic.contiguous(y) { y in IEEE_754.Arithmetic.binnedDot(x, y) }
+        }
+        merge(products)
+    }
+
+    /// The sum, rounded to binary64
+    ///
+    /// Follows ordinary IEEE 754 addition for non-finite terms, except that
+    /// every NaN result is the default quiet NaN, so that it too is
+    /// reproducible.
+    @inlinable
+    public var value: Double {
+        resolved().value
+    }
+
+    /// The exceptions the sum signals
+    ///
+    /// `invalid` for a signaling NaN term, for both infinities, or for an
+    /// invalid product; `overflow` and `inexact` when a finite sum or
+    /// product overflows; `inexact` when bits were discarded or the result
+    /// was rounded.
+    @inlinable
+    public var exceptions: IEEE_754.Exceptions.FlagSet {
+        resolved().flags
+    }
+
+    @inlinable
+    internal func resolved() -> (value: Double, flags: IEEE_754.Exceptions.FlagSet) {
+        var flags = IEEE_754.Exceptions.FlagSet()
+        if state & (Self.signalingNaN | Self.invalidTerm) != 0 {
+            flags = flags.union(.invalid)
+        }
+        if state & Self.overflowTerm != 0 {
+            flags = flags.union([.overflow, .inexact])
+        }
+
+        let infinities = state & (Self.positiveInfinity | Self.negativeInfinity)
+        if infinities == Self.positiveInfinity | Self.negativeInfinity {
+            return (.nan, flags.union(.invalid))
+        }
+        if state & (Self.quietNaN | Self.signalingNaN | Self.invalidTerm) != 0 {
+            return (.nan, flags)
+        }
+        if infinities != 0 {
+            return (infinities == Self.positiveInfinity ? .infinity : -.infinity, flags)
+        }
+
+        let (sum, exact) = expansion()
+        let scale = Double(sign: .plus, exponent: IEEE_754.Arithmetic.binnedScaleExponent(index), significand: 1)
+        let value = sum * scale
+        if !value.isFinite {
+            flags = flags.union([.overflow, .inexact])
+        } else if !exact || state & Self.truncated != 0 {
+            flags = flags.union(.inexact)
+        }
+        return (value, flags)
+    }
+
+    /// Rounds the bins, lowest first, through an exact expansion (Grow-Expansion)
+    ///
+    /// - Returns: The rounded sum in the scaled representation, and whether
+    ///   it is exact
+    @inlinable
+    internal func expansion() -> (sum: Double, exact: Bool) {
+        var storage = (0.0, 0.0, 0.0, 0.0, 0.0, 0.0)
+        return withUnsafeMutableBytes(of: &storage) { raw in
+            let components = raw.bindMemory(to: Double.self)
+            var count = 0
+            func accumulate(_ term: Double) {
+                guard term != 0 else { return }
+                var carry = term
+                for component in 0..<count {
+                    (carry, components[component]) = IEEE_754.Arithmetic.twoSum(carry, components[component])
+                }
+                components[count] = carry
+                count &+= 1
+            }
+            var fold = IEEE_754.Arithmetic.binnedFolds
+            while fold > 0 {
+                fold &-= 1
+                accumulate(offsets[fold])
+                accumulate(Double(carries[fold]) * IEEE_754.Arithmetic.binnedUnit(index, fold))
+            }
+
+            var sum = 0.0
+            var nonzero = 0
+            for component in 0..<count where components[component] != 0 {
+                sum += components[component]
+                nonzero &+= 1
+            }
+            return (sum, nonzero <= 1)
+        }
+    }
+}
+
+// MARK: - Bin Layout
+
+extension IEEE_754.Arithmetic {
+    /// Bins kept by a ``BinnedSum``
+    @usableFromInline
+    internal static let binnedFolds = 3
+
+    /// Bits per bin; `p - W - 2` bits of headroom absorb 2¹¹ deposits per bin
+    @usableFromInline
+    internal static let binnedWidth = 40
+
+    /// Grid exponent of bin 0, the least subnormal, so that bin 0 is exact
+    @usableFromInline
+    internal static let binnedBase = -1074
+
+    /// Highest bin number whose anchor `1.5 × 2^(grid + 52)` stays below 2^emax
+    ///
+    /// Bin 52, which holds terms up to the largest finite value, is kept
+    /// scaled by 2⁻⁴⁰; merging rescales exactly.
+    @usableFromInline
+    internal static let binnedSafeIndex = 51
+
+    @inlinable
+    internal static func binnedScaleExponent(_ index: Int) -> Int {
+        index > binnedSafeIndex ? binnedWidth : 0
+    }
+
+    /// Exponent of the ulp of bin `index - fold`, in the scaled representation
+    @inlinable
+    internal static func binnedGrid(_ index: Int, _ fold: Int) -> Int {
+        binnedBase + (index - fold) * binnedWidth - binnedScaleExponent(index)
+    }
+
+    /// Starting value of a bin's accumulator: its ulp is the grid, with room above and below
+    @inlinable
+    internal static func binnedAnchor(_ index: Int, _ fold: Int) -> Double {
+        Double(sign: .plus, exponent: binnedGrid(index, fold) + Double.significandBitCount, significand: 1.5)
+    }
+
+    /// Carry unit of a bin, a quarter of its anchor's binade
+    @inlinable
+    internal static func binnedUnit(_ index: Int, _ fold: Int) -> Double {
+        Double(sign: .plus, exponent: binnedGrid(index, fold) + Double.significandBitCount - 2, significand: 1)
+    }
+
+    /// Lowest bin number whose top bin can hold a term with magnitude bits `bits`
+    ///
+    /// A term fits when it is below half of one ulp of the next bin up, so
+    /// every bin above splits it into zero.
+    @inlinable
+    internal static func binnedIndex(_ bits: UInt64) -> Int {
+        guard bits != 0 else { return binnedFolds - 1 }
+        let offset = Int(Double(bitPattern: bits).exponent) - binnedBase - binnedWidth + 2
+        let index = offset <= 0 ? 0 : (offset + binnedWidth - 1) / binnedWidth
+        return Swift.max(binnedFolds - 1, index)
+    }
+
+    @usableFromInline
+    internal static let binnedInfinityBits: UInt64 = 0x7FF0_0000_0000_0000
+
+    @inlinable
+    @inline(__always)
+    internal static func magnitudeBits(_ lanes: SIMD8<Double>) -> SIMD8<UInt64> {
+        unsafeBitCast(lanes, to: SIMD8<UInt64>.self) & 0x7FFF_FFFF_FFFF_FFFF
+    }
+}
+
+// MARK: - Deposit Kernel
+
+extension IEEE_754.Arithmetic {
+    /// Eight lanes of bin accumulators for one bin number
+    ///
+    /// Each deposit splits a term across the bins with the extraction
+    /// `s' = s + x; x -= s' - s`, exact because `s` has the bin's grid as its
+    /// ulp. Setting the last bit of `x` first breaks rounding ties away from
+    /// zero, so each part depends only on the term and the grid, never on
+    /// what the accumulator already holds. Bin 0 has the least subnormal as
+    /// its grid and receives every part exactly, without the tie bit.
+    ///
+    /// A lane absorbs 1024 deposits before it must be flushed, which a
+    /// 4096-element block never exceeds, even at two deposits per element.
+    @usableFromInline
+    internal struct BinnedLanes {
+        @usableFromInline
+        internal let index: Int
+
+        @usableFromInline
+        internal var fold0: SIMD8<Double>
+
+        @usableFromInline
+        internal var fold1: SIMD8<Double>
+
+        @usableFromInline
+        internal var fold2: SIMD8<Double>
+
+        @usableFromInline
+        internal let anchor0: Double
+
+        @usableFromInline
+        internal let anchor1: Double
+
+        @usableFromInline
+        internal let anchor2: Double
+
+        @usableFromInline
+        internal let tie0: UInt64
+
+        @usableFromInline
+        internal let tie1: UInt64
+
+        @usableFromInline
+        internal let tie2: UInt64
+
+        /// Factor applied to terms before they are deposited (2⁻⁴⁰ in the top bin)
+        @usableFromInline
+        internal let scale: Double
+
+        /// Bits of what is left after the lowest bin, or-ed together
+        @usableFromInline
+        internal var lost: SIMD8<UInt64>
+
+        @inlinable
+        internal init(index: Int) {
+            self.index = index
+            anchor0 = IEEE_754.Arithmetic.binnedAnchor(index, 0)
+            anchor1 = IEEE_754.Arithmetic.binnedAnchor(index, 1)
+            anchor2 = IEEE_754.Arithmetic.binnedAnchor(index, 2)
+            fold0 = SIMD8(repeating: anchor0)
+            fold1 = SIMD8(repeating: anchor1)
+            fold2 = SIMD8(repeating: anchor2)
+            tie0 = index > 0 ? 1 : 0
+            tie1 = index > 1 ? 1 : 0
+            tie2 = index > 2 ? 1 : 0
+            scale = Double(sign: .plus, exponent: -IEEE_754.Arithmetic.binnedScaleExponent(index), significand: 1)
+            lost = .zero
+        }
+
+        @inlinable
+        @inline(__always)
+        internal static func extract(
+            _ x: inout SIMD8<Double>,
+            into fold: inout SIMD8<Double>,
+            tie: UInt64
+        ) {
+            let previous = fold
+            fold += unsafeBitCast(unsafeBitCast(x, to: SIMD8<UInt64>.self) | tie, to: SIMD8<Double>.self)
+            x += previous - fold
+        }
+
+        /// Deposits eight terms that the bin number can hold, already multiplied by `scale`
+        @inlinable
+        @inline(__always)
+        internal mutating func deposit(_ terms: SIMD8<Double>) {
+            var x = terms
+            Self.extract(&x, into: &fold0, tie: tie0)
+            Self.extract(&x, into: &fold1, tie: tie1)
+            Self.extract(&x, into: &fold2, tie: tie2)
+            lost |= IEEE_754.Arithmetic.magnitudeBits(x)
+        }
+
+        /// Folds the lanes into a ``BinnedSum``
+        @inlinable
+        internal func total() -> BinnedSum {
+            var sum = BinnedSum(index: index)
+            for lane in 0..<8 {
+                sum.accumulate(fold: 0, offset: fold0[lane] - anchor0, carry: 0)
+                sum.accumulate(fold: 1, offset: fold1[lane] - anchor1, carry: 0)
+                sum.accumulate(fold: 2, offset: fold2[lane] - anchor2, carry: 0)
+            }
+            if lost.max() != 0 {
+                sum.state |= BinnedSum.truncated
+            }
+            return sum
+        }
+    }
+
+    /// Eight elements starting at `index`, widened to binary64, zero past `end`
+    @inlinable
+    @inline(__always)
+    internal static func binnedLoad<E: BinaryFloatingPoint & SIMDScalar>(
+        _ base: UnsafePointer<E>,
+        _ index: Int,
+        _ end: Int
+    ) -> SIMD8<Double> {
+        guard index &+ 8 > end else { return SIMD8<Double>(load(base, index)) }
+        var lanes = SIMD8<Double>(repeating: 0)
+        for lane in 0..<(end &- index) {
+            lanes[lane] = Double(base[index &+ lane])
+        }
+        return lanes
+    }
+
+    /// State bits of a non-finite term
+    @inlinable
+    internal static func binnedState<E: BinaryFloatingPoint>(_ value: E) -> UInt8 {
+        if value.isSignalingNaN { return BinnedSum.signalingNaN }
+        if value.isNaN { return BinnedSum.quietNaN }
+        return value.sign == .minus ? BinnedSum.negativeInfinity : BinnedSum.positiveInfinity
+    }
+
+    /// Binned sum of one block: a pass for the largest magnitude, then a deposit pass
+    @inlinable
+    internal static func binnedSumBlock<E: BinaryFloatingPoint & SIMDScalar>(
+        _ base: UnsafePointer<E>,
+        _ range: Range<Int>
+    ) -> BinnedSum {
+        var top = SIMD8<UInt64>(repeating: 0)
+        var index = range.lowerBound
+        while index < range.upperBound {
+            top = pointwiseMax(top, magnitudeBits(binnedLoad(base, index, range.upperBound)))
+            index &+= 8
+        }
+
+        var state: UInt8 = 0
+        var largest = top.max()
+        if largest >= binnedInfinityBits {
+            // Rare: find the largest finite term and record the others
+            largest = 0
+            for element in range {
+                let value = base[element]
+                if value.isFinite {
+                    largest = Swift.max(largest, Double(value).magnitude.bitPattern)
+                } else {
+                    state |= binnedState(value)
+                }
+            }
+        }
+
+        var lanes = BinnedLanes(index: binnedIndex(largest))
+        index = range.lowerBound
+        while index < range.upperBound {
+            var terms = binnedLoad(base, index, range.upperBound)
+            if state != 0 {
+                terms.replace(with: 0, where: magnitudeBits(terms) .>= binnedInfinityBits)
+            }
+            lanes.deposit(terms * lanes.scale)
+            index &+= 8
+        }
+        var sum = lanes.total()
+        sum.state |= state
+        return sum
+    }
+
+    /// Binned sum of the products `(x[i] × factor) × (y[i] × factor)` of one block
+    ///
+    /// Each product is deposited with its TwoProd error, so the bins see the
+    /// exact product; Float products are exact in binary64 and skip the
+    /// error term. `factor` is a power of two chosen by the norm to keep
+    /// squares in range, and 1 for dot products.
+    @inlinable
+    internal static func binnedDotBlock<E: BinaryFloatingPoint & SIMDScalar>(
+        _ x: UnsafePointer<E>,
+        _ y: UnsafePointer<E>,
+        _ range: Range<Int>,
+        factor: Double
+    ) -> BinnedSum {
+        let exactProducts = 2 * (E.significandBitCount + 1) <= Double.significandBitCount + 1
+
+        var top = SIMD8<UInt64>(repeating: 0)
+        var index = range.lowerBound
+        while index < range.upperBound {
+            let a = binnedLoad(x, index, range.upperBound) * factor
+            let b = binnedLoad(y, index, range.upperBound) * factor
+            top = pointwiseMax(top, magnitudeBits(a * b))
+            index &+= 8
+        }
+
+        var state: UInt8 = 0
+        var largest = top.max()
+        if largest >= binnedInfinityBits {
+            largest = 0
+            for element in range {
+                let a = Double(x[element]) * factor
+                let b = Double(y[element]) * factor
+                let product = a * b
+                if product.isFinite {
+                    largest = Swift.max(largest, product.magnitude.bitPattern)
+                } else if product.isNaN {
+                    if x[element].isSignalingNaN || y[element].isSignalingNaN {
+                        state |= BinnedSum.signalingNaN
+                    } else if x[element].isNaN || y[element].isNaN {
+                        state |= BinnedSum.quietNaN
+                    } else {
+                        state |= BinnedSum.invalidTerm
+                    }
+                } else {
+                    state |= product.sign == .minus ? BinnedSum.negativeInfinity : BinnedSum.positiveInfinity
+                    if a.isFinite && b.isFinite {
+                        state |= BinnedSum.overflowTerm
+                    }
+                }
+            }
+        }
+
+        var lanes = BinnedLanes(index: binnedIndex(largest))
+        index = range.lowerBound
+        while index < range.upperBound {
+            let a = binnedLoad(x, index, range.upperBound) * factor
+            let b = binnedLoad(y, index, range.upperBound) * factor
+            var product = a * b
+            var error = exactProducts ? SIMD8<Double>(repeating: 0) : (-product).addingProduct(a, b)
+            if state != 0 {
+                let skipped = magnitudeBits(product) .>= binnedInfinityBits
+                product.replace(with: 0, where: skipped)
+                error.replace(with: 0, where: skipped)
+            }
+            lanes.deposit(product * lanes.scale)
+            if !exactProducts {
+                lanes.deposit(error * lanes.scale)
+            }
+            index &+= 8
+        }
+        var sum = lanes.total()
+        sum.state |= state
+        return sum
+    }
+}
+
+// MARK: - Binned Drivers
+
+extension IEEE_754.Arithmetic {
+    @inlinable
+    internal static func binnedSum<E: BinaryFloatingPoint & SIMDScalar>(
+        _ values: UnsafeBufferPointer<E>,
+        blocks: Range<Int>
+    ) -> BinnedSum {
+        var total = BinnedSum()
+        guard let base = values.baseAddress else { return total }
+        for block in blocks {
+            let start = block * summationBlockSize
+            total.merge(binnedSumBlock(base, start..<min(start + summationBlockSize, values.count)))
+        }
+        return total
+    }
+
+    @inlinable
+    internal static func binnedSum<E: BinaryFloatingPoint & SIMDScalar>(_ values: UnsafeBufferPointer<E>) -> BinnedSum {
+        binnedSum(values, blocks: 0..<blockCount(values.count))
+    }
+
+    @inlinable
+    internal static func binnedDot<E: BinaryFloatingPoint & SIMDScalar>(
+        _ x: UnsafeBufferPointer<E>,
+        _ y: UnsafeBufferPointer<E>,
+        blocks: Range<Int>,
+        factor: Double = 1
+    ) -> BinnedSum {
+        var total = BinnedSum()
+        guard let xs = x.baseAddress, let ys = y.baseAddress else { return total }
+        for block in blocks {
+            let start = block * summationBlockSize
+            total.merge(binnedDotBlock(xs, ys, start..<min(start + summationBlockSize, x.count), factor: factor))
+        }
+        return total
+    }
+
+    @inlinable
+    internal static func binnedDot<E: BinaryFloatingPoint & SIMDScalar>(
+        _ x: UnsafeBufferPointer<E>,
+        _ y: UnsafeBufferPointer<E>,
+        factor: Double = 1
+    ) -> BinnedSum {
+        precondition(x.count == y.count, "Operand buffers differ in length")
+        return binnedDot(x, y, blocks: 0..<blockCount(x.count), factor: factor)
+    }
+
+    /// Reduces the blocks of `count` elements concurrently, one partial per chunk
+    ///
+    /// Chunk boundaries follow the processor count, which is harmless: the
+    /// partials are binned sums, so any split gives the same result.
+    @inlinable
+    internal static func binnedConcurrently(
+        count: Int,
+        _ reduce: @escaping @Sendable (_ blocks: Range<Int>) -> BinnedSum
+    ) async -> BinnedSum {
+        let blocks = blockCount(count)
+        let chunks = IEEE_754.Parallel.chunks(count: blocks, minimumChunk: summationMinimumChunk)
+        guard count >= summationConcurrencyThreshold, chunks.count > 1 else {
+            return reduce(0..<blocks)
+        }
+
+        let partials = UnsafeMutableBufferPointer<BinnedSum>.allocate(capacity: chunks.count)
+        partials.initialize(repeating: BinnedSum())
+        defer { partials.deallocate() }
+
+        let shared = IEEE_754.Parallel.Buffer(partials)
+        await IEEE_754.Parallel.forEach(chunks) { chunk, range in
+            shared[chunk] = reduce(range)
+        }
+        var total = BinnedSum()
+        for partial in partials {
+            total.merge(partial)
+        }
+        return total
+    }
+
+    @inlinable
+    internal static func binnedSum<E: BinaryFloatingPoint & SIMDScalar & Sendable>(_ values: [E]) async -> BinnedSum {
+        await binnedConcurrently(count: values.count) { blocks in
+            values.withUnsafeBufferPointer { binnedSum($0, blocks: blocks) }
+        }
+    }
+
+    @inlinable
+    internal static func binnedDot<E: BinaryFloatingPoint & SIMDScalar & Sendable>(
+        _ x: [E],
+        _ y: [E],
+        factor: Double = 1
+    ) async -> BinnedSum {
+        precondition(x.count == y.count, "Operand arrays differ in length")
+        return await binnedConcurrently(count: x.count) { blocks in
+            x.withUnsafeBufferPointer { x in
+                y.withUnsafeBufferPointer { y in binnedDot(x, y, blocks: blocks, factor: factor) }
+            }
+        }
+    }
+
+    /// Largest magnitude bit pattern among `values`, widened to binary64
+    @inlinable
+    internal static func largestMagnitude<E: BinaryFloatingPoint & SIMDScalar>(
+        _ values: UnsafeBufferPointer<E>
+    ) -> UInt64 {
+        guard let base = values.baseAddress else { return 0 }
+        var top = SIMD8<UInt64>(repeating: 0)
+        var index = 0
+        while index < values.count {
+            top = pointwiseMax(top, magnitudeBits(binnedLoad(base, index, values.count)))
+            index &+= 8
+        }
+        return top.max()
+    }
+
+    /// Power of two that brings the largest magnitude into [1, 2), for sums of squares
+    @inlinable
+    internal static func normFactor(_ largest: UInt64) -> (factor: Double, exponent: Int) {
+        let exponent = Swift.min(Swift.max(Int(Double(bitPattern: largest).exponent), -1023), 1023)
+        return (Double(sign: .plus, exponent: -exponent, significand: 1), exponent)
+    }
+
+    /// Euclidean norm from the binned sum of squares scaled by `2^(-2 × exponent)`
+    ///
+    /// Any infinite element makes the norm +∞, even alongside a NaN, as for
+    /// `hypot`; only signaling NaNs signal invalid.
+    @inlinable
+    internal static func norm<E: BinaryFloatingPoint>(
+        _ values: UnsafeBufferPointer<E>,
+        largest: UInt64,
+        squares: (_ factor: Double) -> BinnedSum
+    ) -> (value: Double, flags: IEEE_754.Exceptions.FlagSet) {
+        guard largest != 0 else { return (0, []) }
+        guard largest < binnedInfinityBits else {
+            var flags = IEEE_754.Exceptions.FlagSet()
+            if values.contains(where: \.isSignalingNaN) {
+                flags = flags.union(.invalid)
+            }
+            return (values.contains(where: \.isInfinite) ? .infinity : .nan, flags)
+        }
+        let (factor, exponent) = normFactor(largest)
+        let (sum, flags) = squares(factor).resolved()
+        let root = sum.squareRoot()
+        let value = root * Double(sign: .plus, exponent: exponent, significand: 1)
+        if !value.isFinite {
+            return (value, flags.union([.overflow, .inexact]))
+        }
+        return (value, (-sum).addingProduct(root, root) == 0 ? flags : flags.union(.inexact))
+    }
+
+    /// Signals `flags` on the current thread, once
+    @inlinable
+    internal static func signal(_ flags: IEEE_754.Exceptions.FlagSet) {
+        if !flags.isEmpty {
+            IEEE_754.Exceptions.raise(flags)
+        }
+    }
+
+    /// Rounds a binary64 result to Float, adding the exceptions the rounding signals
+    @inlinable
+    internal static func narrowed(
+        _ result: (value: Double, flags: IEEE_754.Exceptions.FlagSet)
+    ) -> (value: Float, flags: IEEE_754.Exceptions.FlagSet) {
+        guard result.value.isFinite else { return (result.value.isNaN ? .nan : Float(result.value), result.flags) }
+        let value = Float(result.value)
+        if value.isInfinite {
+            return (value, result.flags.union([.overflow, .inexact]))
+        }
+        return (value, Double(value) == result.value ? result.flags : result.flags.union(.inexact))
+    }
+}
+
+// MARK: - Double Reproducible Reductions
+
+extension IEEE_754.Arithmetic {
+    /// Sum of Double values, bit-identical for any order, chunking or core count
+    ///
+    /// Uses a ``BinnedSum``: the result depends only on the multiset of
+    /// values, so permuting them, or summing pieces separately and merging
+    /// ``BinnedSum`` partials, gives the same bits. ``sum(_:using:)`` is
+    /// reproducible only for the same sequence of values.
+    ///
+    /// Each block of 4096 elements takes two passes through SIMD lanes: one
+    /// for the largest magnitude, one splitting every value across three
+    /// 40-bit bins. Accurate to within an ulp unless terms more than 80 bits
+    /// below the largest one matter to the result.
+    ///
+    /// Signals its exceptions once on the current thread, after the
+    /// reduction: `invalid` for a signaling NaN or for both infinities,
+    /// `overflow` when the finite sum is out of range, and `inexact` when the
+    /// result is rounded. Flags already raised are left as they are.
+    ///
+    /// - Parameter values: The addends
+    /// - Returns: The sum; `+0` for an empty collection
+    ///
+    /// Example:
+    /// ```swift
+    /// let values: [Double] = [1e16, 1.0, -1e16, 0.5]
+    /// values.reduce(0, +)                                     // 0.5
+    /// IEEE_754.Arithmetic.reproducibleSum(values)             // 1.5
+    /// IEEE_754.Arithmetic.reproducibleSum(values.reversed())  // 1.5, same bits
+    /// ```
+    @inlinable
+    public static func reproducibleSum<C: Collection<Double>>(_ values: C) -> Double {
+        let (value, flags) = contiguous(values) { binnedSum($0) }.resolved()
+        signal(flags)
+        return value
+    }
+
+    /// Sum of Double values using all cores for large inputs, bit-identical for any order
+    ///
+    /// - Parameter values: The addends
+    /// - Returns: The sum, bit-identical to the synchronous overload
+    @inlinable
+    public static func reproducibleSum(_ values: [Double]) async -> Double {
+        let (value, flags) = await binnedSum(values).resolved()
+        signal(flags)
+        return value
+    }
+
+    /// Dot product of Double values, bit-identical for any order, chunking or core count
+    ///
+    /// Every product is split exactly with a fused multiply-add and both
+    /// parts are binned, so the result rounds the exact dot product, within
+    /// the limits of ``reproducibleSum(_:)``. A product that overflows
+    /// signals `overflow`, and 0 × ∞ signals `invalid`.
+    ///
+    /// - Parameters:
+    ///   - x: First factors
+    ///   - y: Second factors, same count as `x`
+    /// - Returns: `Σ x[i] × y[i]`
+    @inlinable
+    public static func reproducibleDot<X: Collection<Double>, Y: Collection<Double>>(_ x: X, _ y: Y) -> Double {
+        let (value, flags) = contiguous(x) { x in
+            contiguous(y) { y in binnedDot(x, y) }
+        }.resolved()
+        signal(flags)
+        return value
+    }
+
+    /// Dot product of Double values using all cores for large inputs
+    ///
+    /// - Parameters:
+    ///   - x: First factors
+    ///   - y: Second factors, same count as `x`
+    /// - Returns: `Σ x[i] × y[i]`, bit-identical to the synchronous overload
+    @inlinable
+    public static func reproducibleDot(_ x: [Double], _ y: [Double]) async -> Double {
+        let (value, flags) = await binnedDot(x, y).resolved()
+        signal(flags)
+        return value
+    }
+
+    /// Euclidean norm of Double values, bit-identical for any order, chunking or core count
+    ///
+    /// Squares are scaled by a power of two taken from the largest magnitude,
+    /// so no square overflows or vanishes, and binned like
+    /// ``reproducibleDot(_:_:)``. An infinite element gives +∞ even with a
+    /// NaN present, as `hypot` does.
+    ///
+    /// - Parameter values: The vector
+    /// - Returns: `√(Σ x[i]²)`
+    ///
+    /// Example:
+    /// ```swift
+    /// IEEE_754.Arithmetic.reproducibleNorm([3e200, 4e200])  // 5e200 (naive: inf)
+    /// ```
+    @inlinable
+    public static func reproducibleNorm<C: Collection<Double>>(_ values: C) -> Double {
+        let (value, flags) = contiguous(values) { values in
+            norm(values, largest: largestMagnitude(values)) { factor in
+                binnedDot(values, values, factor: factor)
+            }
+        }
+        signal(flags)
+        return value
+    }
+
+    /// Euclidean norm of Double values using all cores for large inputs
+    ///
+    /// - Parameter values: The vector
+    /// - Returns: `√(Σ x[i]²)`, bit-identical to the synchronous overload
+    @inlinable
+    public static func reproducibleNorm(_ values: [Double]) async -> Double {
+        let largest = values.withUnsafeBufferPointer { largestMagnitude($0) }
+        let factor = normFactor(largest).factor
+        let squares = await binnedDot(values, values, factor: factor)
+        let (value, flags) = values.withUnsafeBufferPointer { values in
+            norm(values, largest: largest) { _ in squares }
+        }
+        signal(flags)
+        return value
+    }
+}
+
+// MARK: - Float Reproducible Reductions
+
+extension IEEE_754.Arithmetic {
+    /// Sum of Float values, bit-identical for any order, chunking or core count
+    ///
+    /// Values are binned exactly in binary64 and the result is rounded to
+    /// Float. See the Double overload of ``reproducibleSum(_:)``.
+    ///
+    /// - Parameter values: The addends
+    /// - Returns: The sum; `+0` for an empty collection
+    @inlinable
+    public static func reproducibleSum<C: Collection<Float>>(_ values: C) -> Float {
+        let (value, flags) = narrowed(contiguous(values) { binnedSum($0) }.resolved())
+        signal(flags)
+        return value
+    }
+
+    /// Sum of Float values using all cores for large inputs
+    ///
+    /// - Parameter values: The addends
+    /// - Returns: The sum, bit-identical to the synchronous overload
+    @inlinable
+    public static func reproducibleSum(_ values: [Float]) async -> Float {
+        let (value, flags) = narrowed(await binnedSum(values).resolved())
+        signal(flags)
+        return value
+    }
+
+    /// Dot product of Float values, bit-identical for any order, chunking or core count
+    ///
+    /// Products are exact in binary64, so only the final rounding is inexact.
+    ///
+    /// - Parameters:
+    ///   - x: First factors
+    ///   - y: Second factors, same count as `x`
+    /// - Returns: `Σ x[i] × y[i]`
+    @inlinable
+    public static func reproducibleDot<X: Collection<Float>, Y: Collection<Float>>(_ x: X, _ y: Y) -> Float {
+        let (value, flags) = narrowed(
+            contiguous(x) { x in
+                contiguous(y) { y in binnedDot(x, y) }
+            }.resolved()
+        )
+        signal(flags)
+        return value
+    }
+
+    /// Dot product of Float values using all cores for large inputs
+    ///
+    /// - Parameters:
+    ///   - x: First factors
+    ///   - y: Second factors, same count as `x`
+    /// - Returns: `Σ x[i] × y[i]`, bit-identical to the synchronous overload
+    @inlinable
+    public static func reproducibleDot(_ x: [Float], _ y: [Float]) async -> Float {
+        let (value, flags) = narrowed(await binnedDot(x, y).resolved())
+        signal(flags)
+        return value
+    }
+
+    /// Euclidean norm of Float values, bit-identical for any order, chunking or core count
+    ///
+    /// - Parameter values: The vector
+    /// - Returns: `√(Σ x[i]²)`
+    @inlinable
+    public static func reproducibleNorm<C: Collection<Float>>(_ values: C) -> Float {
+        let (value, flags) = narrowed(
+            contiguous(values) { values in
+                norm(values, largest: largestMagnitude(values)) { factor in
+                    binnedDot(values, values, factor: factor)
+                }
+            }
+        )
+        signal(flags)
+        return value
+    }
+
+    /// Euclidean norm of Float values using all cores for large inputs
+    ///
+    /// - Parameter values: The vector
+    /// - Returns: `√(Σ x[i]²)`, bit-identical to the synchronous overload
+    @inlinable
+    public static func reproducibleNorm(_ values: [Float]) async -> Float {
+        let largest = values.withUnsafeBufferPointer { largestMagnitude($0) }
+        let factor = normFactor(largest).factor
+        let squares = await binnedDot(values, values, factor: factor)
+        let (value, flags) = narrowed(
+            values.withUnsafeBufferPointer { values in
+                norm(values, largest: largest) { _ in squares }
+            }
+        )
+        signal(flags)
+        return value
+    }
+}
@@ -0,0 +1,971 @@
+// IEEE_754.Arithmetic.Rounded.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 4.3: Arithmetic with an explicit rounding direction
+
+// MARK: - Error-Free Transformations
+
+extension IEEE_754.Arithmetic {
+    /// Sign of a value as -1, 0 or 1
+    @inlinable
+    @inline(__always)
+    internal static func signum<T: BinaryFloatingPoint>(_ value: T) -> Int {
+        value > 0 ? 1 : (value < 0 ? -1 : 0)
+    }
+
+    /// Knuth's TwoSum: `sum + error == lhs + rhs` exactly, barring overflow
+    @inlinable
+    @inline(__always)
+    internal static func twoSum<T: BinaryFloatingPoint>(_ lhs: T, _ rhs: T) -> (sum: T, error: T) {
+        let sum = lhs + rhs
+        let virtual = sum - lhs
+        return (sum, (lhs - (sum - virtual)) + (rhs - virtual))
+    }
+
+    /// TwoProd via FMA: `product + error == lhs × rhs` exactly, barring underflow and overflow
+    @inlinable
+    @inline(__always)
+    internal static func twoProduct<T: BinaryFloatingPoint>(_ lhs: T, _ rhs: T) -> (product: T, error: T) {
+        let product = lhs * rhs
+        return (product, (-product).addingProduct(lhs, rhs))
+    }
+
+    /// `value × 2^exponent`, exact whenever the result is normal
+    @inlinable
+    @inline(__always)
+    internal static func scaled<T: BinaryFloatingPoint>(_ value: T, by exponent: Int) -> T {
+        T(sign: .plus, exponent: T.Exponent(exponent), significand: value)
+    }
+
+    /// The neighbor of `value` in the direction of `sign`
+    @inlinable
+    @inline(__always)
+    internal static func step<T: BinaryFloatingPoint>(_ value: T, toward sign: Int) -> T {
+        sign > 0 ? value.nextUp : value.nextDown
+    }
+
+    /// Products at least this large have an exactly representable TwoProd error
+    @inlinable
+    internal static func exactProductBound<T: BinaryFloatingPoint>(_: T.Type) -> T {
+        scaled(T.leastNormalMagnitude, by: 2 &* (T.significandBitCount &+ 1))
+    }
+
+    /// Terms at most this large can be doubled and summed without overflow
+    @inlinable
+    internal static func exactSumBound<T: BinaryFloatingPoint>(_: T.Type) -> T {
+        T.greatestFiniteMagnitude / 16
+    }
+
+    /// Exact sign of `t0 + t1 + ... + t5`
+    ///
+    /// Accumulates the terms into a nonoverlapping expansion (Shewchuk's
+    /// Grow-Expansion); the sign of the sum is the sign of its largest nonzero
+    /// component. Terms must be small enough that no TwoSum overflows.
+    @inlinable
+    internal static func exactSign<T: BinaryFloatingPoint>(
+        _ t0: T,
+        _ t1: T,
+        _ t2: T,
+        _ t3: T = 0,
+        _ t4: T = 0,
+        _ t5: T = 0
+    ) -> Int {
+        var expansion = (T(0), T(0), T(0), T(0), T(0), T(0))
+        return withUnsafeMutableBytes(of: &expansion) { raw in
+            let expansion = raw.bindMemory(to: T.self)
+            var count = 0
+            func accumulate(_ term: T) {
+                guard term != 0 else { return }
+                var carry = term
+                for index in 0..<count {
+                    (carry, expansion[index]) = twoSum(carry, expansion[index])
+                }
+                expansion[count] = carry
+                count &+= 1
+            }
+            accumulate(t0)
+            accumulate(t1)
+            accumulate(t2)
+            accumulate(t3)
+            accumulate(t4)
+            accumulate(t5)
+
+            var index = count
+            while index > 0 {
+                index &-= 1
+                if expansion[index] != 0 { return signum(expansion[index]) }
+            }
+            return 0
+        }
+    }
+
+    /// Rounds an exact result given its round-to-nearest-even value
+    ///
+    /// - Parameters:
+    ///   - nearest: The exact result rounded to nearest, ties to even
+    ///     (±∞ when a finite result overflowed)
+    ///   - residual: Sign of `exact - nearest`
+    ///   - tie: Whether the exact result lies halfway between `nearest` and
+    ///     its neighbor
+    ///   - direction: The rounding direction to apply
+    @inlinable
+    @inline(__always)
+    internal static func round<T: BinaryFloatingPoint>(
+        _ nearest: T,
+        residual: Int,
+        tie: Bool,
+        direction: IEEE_754.Rounding.Direction
+    ) -> T {
+        guard residual != 0 else { return nearest }
+        switch direction {
+        case .toNearest(.toEven):
+            return nearest
+        case .toNearest(.awayFromZero):
+            guard tie else { return nearest }
+            let fartherFromZero = nearest == 0 || (residual > 0) == (nearest > 0)
+            return fartherFromZero ? step(nearest, toward: residual) : nearest
+        case .towardInfinity(.positive):
+            return residual > 0 ? nearest.nextUp : nearest
+        case .towardInfinity(.negative):
+            return residual < 0 ? nearest.nextDown : nearest
+        case .towardZero:
+            if nearest > 0 && residual < 0 { return nearest.nextDown }
+            if nearest < 0 && residual > 0 { return nearest.nextUp }
+            return nearest
+        }
+    }
+
+    /// Result for finite operands whose rounded-to-nearest result overflowed
+    @inlinable
+    internal static func overflowed<T: BinaryFloatingPoint>(_ nearest: T, direction: IEEE_754.Rounding.Direction) -> T {
+        round(nearest, residual: nearest > 0 ? -1 : 1, tie: false, direction: direction)
+    }
+
+    /// Exact zero sum: -0 under roundTowardNegative unless both operands are +0
+    @inlinable
+    internal static func exactZero<T: BinaryFloatingPoint>(
+        _ nearest: T,
+        _ lhs: T,
+        _ rhs: T,
+        direction: IEEE_754.Rounding.Direction
+    ) -> T {
+        guard direction == .towardInfinity(.negative) else { return nearest }
+        return lhs.sign == .minus || rhs.sign == .minus ? -0.0 : nearest
+    }
+}
+
+// MARK: - Directed Rounding Operations
+
+extension IEEE_754.Arithmetic {
+    /// Addition with an explicit rounding direction - IEEE 754 `addition`
+    ///
+    /// Computes `lhs + rhs` rounded in `direction` without touching the
+    /// floating-point environment. The round-to-nearest sum and its exact error
+    /// (FastTwoSum) determine whether the result moves to a neighbor, so the
+    /// cost is a handful of additions and no rounding-mode switch.
+    ///
+    /// - Parameters:
+    ///   - lhs: Left operand
+    ///   - rhs: Right operand
+    ///   - direction: Rounding direction for the result
+    /// - Returns: `lhs + rhs`, rounded in `direction`
+    ///
+    /// Example:
+    /// ```swift
+    /// let lower = IEEE_754.Arithmetic.addition(0.1, 0.2, rounding: .towardInfinity(.negative))
+    /// let upper = IEEE_754.Arithmetic.addition(0.1, 0.2, rounding: .towardInfinity(.positive))
+    /// // lower < 0.1 + 0.2 (exact) < upper, upper == lower.nextUp
+    /// ```
+    @inlinable
+    public static func addition<T: BinaryFloatingPoint>(
+        _ lhs: T,
+        _ rhs: T,
+        rounding direction: IEEE_754.Rounding.Direction
+    ) -> T {
+        let sum = lhs + rhs
+        guard sum.isFinite else {
+            return lhs.isFinite && rhs.isFinite ? overflowed(sum, direction: direction) : sum
+        }
+
+        let (large, small) = lhs.magnitude < rhs.magnitude ? (rhs, lhs) : (lhs, rhs)
+        let error = small - (sum - large)
+        guard error != 0 else {
+            return sum == 0 ? exactZero(sum, lhs, rhs, direction: direction) : sum
+        }
+
+        let residual = signum(error)
+        let tie = error + error == step(sum, toward: residual) - sum
+        return round(sum, residual: residual, tie: tie, direction: direction)
+    }
+
+    /// Subtraction with an explicit rounding direction - IEEE 754 `subtraction`
+    ///
+    /// - Parameters:
+    ///   - lhs: Left operand (minuend)
+    ///   - rhs: Right operand (subtrahend)
+    ///   - direction: Rounding direction for the result
+    /// - Returns: `lhs - rhs`, rounded in `direction`
+    @inlinable
+    public static func subtraction<T: BinaryFloatingPoint>(
+        _ lhs: T,
+        _ rhs: T,
+        rounding direction: IEEE_754.Rounding.Direction
+    ) -> T {
+        addition(lhs, -rhs, rounding: direction)
+    }
+
+    /// Multiplication with an explicit rounding direction - IEEE 754 `multiplication`
+    ///
+    /// The exact product error comes from one FMA (TwoProd). Products close
+    /// to the underflow threshold, where that error is not representable,
+    /// are re-evaluated on normalized significands.
+    ///
+    /// - Parameters:
+    ///   - lhs: Left operand
+    ///   - rhs: Right operand
+    ///   - direction: Rounding direction for the result
+    /// - Returns: `lhs × rhs`, rounded in `direction`
+    @inlinable
+    public static func multiplication<T: BinaryFloatingPoint>(
+        _ lhs: T,
+        _ rhs: T,
+        rounding direction: IEEE_754.Rounding.Direction
+    ) -> T {
+        let product = lhs * rhs
+        guard product.isFinite else {
+            return lhs.isFinite && rhs.isFinite ? overflowed(product, direction: direction) : product
+        }
+        guard lhs != 0 && rhs != 0 else { return product }
+
+        if product.magnitude >= exactProductBound(T.self) {
+            let error = (-product).addingProduct(lhs, rhs)
+            guard error != 0 else { return product }
+            let residual = signum(error)
+            let tie = error + error == step(product, toward: residual) - product
+            return round(product, residual: residual, tie: tie, direction: direction)
+        }
+
+        // |lhs × rhs| = (high + low) × 2^exponent with significands in [1, 2)
+        let exponent = Int(lhs.exponent) &+ Int(rhs.exponent)
+        let (high, low) = twoProduct(lhs.significand, rhs.significand)
+        let magnitude = product.magnitude
+        let nearest = scaled(magnitude, by: -exponent)
+
+        let residual = exactSign(high, low, -nearest)
+        guard residual != 0 else { return product }
+        let gap = scaled(step(magnitude, toward: residual), by: -exponent) - nearest
+        let tie = exactSign(high + high, low + low, -(nearest + nearest), -gap) == 0
+
+        let negative = lhs.sign != rhs.sign
+        return round(product, residual: negative ? -residual : residual, tie: tie, direction: direction)
+    }
+
+    /// Division with an explicit rounding direction - IEEE 754 `division`
+    ///
+    /// The remainder `lhs - quotient × rhs` (one FMA) gives the sign of the
+    /// quotient's error. Operands near the underflow threshold are
+    /// re-evaluated on normalized significands.
+    ///
+    /// - Parameters:
+    ///   - lhs: Dividend
+    ///   - rhs: Divisor
+    ///   - direction: Rounding direction for the result
+    /// - Returns: `lhs / rhs`, rounded in `direction`
+    @inlinable
+    public static func division<T: BinaryFloatingPoint>(
+        _ lhs: T,
+        _ rhs: T,
+        rounding direction: IEEE_754.Rounding.Direction
+    ) -> T {
+        let quotient = lhs / rhs
+        guard quotient.isFinite else {
+            return lhs.isFinite && rhs.isFinite && rhs != 0 ? overflowed(quotient, direction: direction) : quotient
+        }
+        guard lhs != 0 && !rhs.isInfinite else { return quotient }
+
+        if lhs.magnitude >= exactProductBound(T.self) && quotient.magnitude >= T.leastNormalMagnitude {
+            let remainder = lhs.addingProduct(-quotient, rhs)
+            guard remainder != 0 else { return quotient }
+            // A quotient in the normal range is never a midpoint
+            let residual = (remainder > 0) == (rhs > 0) ? 1 : -1
+            return round(quotient, residual: residual, tie: false, direction: direction)
+        }
+
+        // |lhs / rhs| = (approximation + remainder / divisor) × 2^exponent
+        let exponent = Int(lhs.exponent) &- Int(rhs.exponent)
+        let dividend = lhs.significand
+        let divisor = rhs.significand
+        let approximation = dividend / divisor
+        let remainder = dividend.addingProduct(-approximation, divisor)
+
+        let magnitude = quotient.magnitude
+        let nearest = scaled(magnitude, by: -exponent)
+        let (high, low) = twoProduct(approximation - nearest, divisor)
+
+        let residual = exactSign(high, low, remainder)
+        guard residual != 0 else { return quotient }
+        let gap = scaled(step(magnitude, toward: residual), by: -exponent) - nearest
+        let (gapHigh, gapLow) = twoProduct(gap, divisor)
+        let tie = exactSign(high + high, low + low, remainder + remainder, -gapHigh, -gapLow) == 0
+
+        let negative = lhs.sign != rhs.sign
+        return round(quotient, residual: negative ? -residual : residual, tie: tie, direction: direction)
+    }
+
+    /// Square root with an explicit rounding direction - IEEE 754 `squareRoot`
+    ///
+    /// The residual `value - root²` (one FMA) gives the sign of the root's
+    /// error; a square root is never a midpoint.
+    ///
+    /// - Parameters:
+    ///   - value: The value
+    ///   - direction: Rounding direction for the result
+    /// - Returns: `√value`, rounded in `direction`
+    @inlinable
+    public static func squareRoot<T: BinaryFloatingPoint>(
+        _ value: T,
+        rounding direction: IEEE_754.Rounding.Direction
+    ) -> T {
+        let root = value.squareRoot()
+        guard value > 0 && value.isFinite else { return root }
+
+        let residual: T
+        if value >= exactProductBound(T.self) {
+            residual = value.addingProduct(-root, root)
+        } else {
+            // Scale by an even power of two so the residual is representable
+            let shift = 2 &* (T.significandBitCount &+ 1)
+            let scaledRoot = scaled(root, by: shift)
+            residual = scaled(value, by: 2 &* shift).addingProduct(-scaledRoot, scaledRoot)
+        }
+        return round(root, residual: signum(residual), tie: false, direction: direction)
+    }
+
+    /// Fused multiply-add with an explicit rounding direction - IEEE 754 `fusedMultiplyAdd`
+    ///
+    /// Computes `(a × b) + c` with a single rounding in `direction`. The
+    /// exact error of the fused result is the sum of the TwoProd product,
+    /// its error, `c` and the negated result, whose sign is evaluated exactly.
+    ///
+    /// - Parameters:
+    ///   - a: First multiplicand
+    ///   - b: Second multiplicand
+    ///   - c: Addend
+    ///   - direction: Rounding direction for the result
+    /// - Returns: `(a × b) + c`, rounded once in `direction`
+    @inlinable
+    public static func fusedMultiplyAdd<T: BinaryFloatingPoint>(
+        a: T,
+        b: T,
+        c: T,
+        rounding direction: IEEE_754.Rounding.Direction
+    ) -> T {
+        let result = c.addingProduct(a, b)
+        guard a.isFinite && b.isFinite && c.isFinite else { return result }
+        guard result.isFinite else { return overflowed(result, direction: direction) }
+        guard a != 0 && b != 0 else { return addition(a * b, c, rounding: direction) }
+
+        let product = a * b
+        let bound = exactSumBound(T.self)
+        if product.isFinite && product.magnitude >= exactProductBound(T.self)
+            && product.magnitude <= bound && c.magnitude <= bound && result.magnitude <= bound
+        {
+            let (high, low) = twoProduct(a, b)
+            let residual = exactSign(high, low, c, -result)
+            guard residual != 0 else {
+                return result == 0 ? exactZero(result, product, c, direction: direction) : result
+            }
+            let gap = step(result, toward: residual) - result
+            let tie = exactSign(high + high, low + low, c + c, -(result + result), -gap) == 0
+            return round(result, residual: residual, tie: tie, direction: direction)
+        }
+
+        guard c != 0 else { return multiplication(a, b, rounding: direction) }
+
+        // a × b = (high + low) × 2^exponent with signed significands in (-4, 4)
+        let exponent = Int(a.exponent) &+ Int(b.exponent)
+        let (high, low) = twoProduct(
+            a.sign == .minus ? -a.significand : a.significand,
+            b.sign == .minus ? -b.significand : b.significand
+        )
+
+        let precision = T.significandBitCount &+ 1
+        let shift = Int(c.exponent) &- exponent
+        if shift > 2 &* precision &+ 4 {
+            // The product is below a quarter ulp of c: result is c and the product is sticky
+            return round(result, residual: signum(high), tie: false, direction: direction)
+        }
+
+        // c below the product's resolution only contributes its sign
+        let addend =
+            shift < -(2 &* precision &+ 4)
+            ? scaled(c.sign == .minus ? -1 : 1, by: -3 &* precision)
+            : scaled(c, by: -exponent)
+        let nearest = scaled(result, by: -exponent)
+
+        let residual = exactSign(high, low, addend, -nearest)
+        guard residual != 0 else {
+            return result == 0 ? exactZero(result, product, c, direction: direction) : result
+        }
+
+        let neighbor = step(result, toward: residual)
+        var tie = false
+        if neighbor.isFinite {
+            let gap = scaled(neighbor, by: -exponent) - nearest
+            tie = exactSign(high + high, low + low, addend + addend, -(nearest + nearest), -gap) == 0
+        }
+        return round(result, residual: residual, tie: tie, direction: direction)
+    }
+}
+
+// MARK: - Batch Kernel
+
+extension IEEE_754.Arithmetic {
+    /// One 8-lane block of round-to-nearest results and the sign of their errors
+    @usableFromInline
+    internal struct RoundedBlock<T: BinaryFloatingPoint & SIMDScalar> {
+        @usableFromInline
+        internal typealias Mask = SIMDMask<SIMD8<T.SIMDMaskScalar>>
+
+        /// Results rounded to nearest, ties to even
+        @usableFromInline
+        internal var nearest: SIMD8<T>
+
+        /// Lanes whose exact result is above `nearest`
+        @usableFromInline
+        internal var above: Mask
+
+        /// Lanes whose exact result is below `nearest`
+        @usableFromInline
+        internal var below: Mask
+
+        /// Lanes on which `above`/`below` are exact; others take the scalar path
+        @usableFromInline
+        internal var exact: Mask
+
+        @inlinable
+        internal init(nearest: SIMD8<T>, above: Mask, below: Mask, exact: Mask) {
+            self.nearest = nearest
+            self.above = above
+            self.below = below
+            self.exact = exact
+        }
+    }
+
+    @inlinable
+    @inline(__always)
+    internal static func load<T: SIMDScalar>(_ base: UnsafePointer<T>, _ index: Int) -> SIMD8<T> {
+        let p = base + index
+        return SIMD8<T>(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7])
+    }
+
+    /// Lane-wise `nextUp` of finite values on their bit patterns
+    @inlinable
+    @inline(__always)
+    internal static func nextUp<T, Key>(
+        _ values: SIMD8<T>,
+        as _: Key.Type
+    ) -> SIMD8<T> where T: BinaryFloatingPoint & SIMDScalar, Key: FixedWidthInteger & UnsignedInteger & SIMDScalar {
+        let bits = unsafeBitCast(values, to: SIMD8<Key>.self)
+        let signBit = (Key.max &>> 1) &+ 1
+        var next = (bits &+ 1).replacing(with: bits &- 1, where: bits .> Key.max &>> 1)
+        next.replace(with: 1, where: bits .== signBit)
+        return unsafeBitCast(next, to: SIMD8<T>.self)
+    }
+
+    @inlinable
+    @inline(__always)
+    internal static func directed<T, Key>(
+        _ block: RoundedBlock<T>,
+        direction: IEEE_754.Rounding.Direction,
+        as key: Key.Type
+    ) -> SIMD8<T> where T: BinaryFloatingPoint & SIMDScalar, Key: FixedWidthInteger & UnsignedInteger & SIMDScalar {
+        let nearest = block.nearest
+        switch direction {
+        case .towardInfinity(.positive):
+            return nearest.replacing(with: nextUp(nearest, as: key), where: block.above)
+        case .towardInfinity(.negative):
+            return nearest.replacing(with: -nextUp(-nearest, as: key), where: block.below)
+        case .towardZero:
+            var result = nearest.replacing(with: -nextUp(-nearest, as: key), where: block.below .& (nearest .> 0))
+            result.replace(with: nextUp(nearest, as: key), where: block.above .& (nearest .< 0))
+            return result
+        case .toNearest:
+            return nearest
+        }
+    }
+
+    /// Fills `result` eight lanes at a time
+    ///
+    /// Round-to-nearest-even stores `nearest` directly. Directed modes move
+    /// each lane to its neighbor on the bit pattern; a block with any lane
+    /// outside the exact fast path (underflow, overflow, zero, non-finite)
+    /// and ties-away rounding fall back to the scalar operation.
+    @inlinable
+    internal static func rounded<T: BinaryFloatingPoint & SIMDScalar>(
+        into result: UnsafeMutableBufferPointer<T>,
+        count: Int,
+        direction: IEEE_754.Rounding.Direction,
+        block: (Int) -> RoundedBlock<T>,
+        scalar: (Int) -> T
+    ) {
+        precondition(result.count >= count, "Result buffer is too small")
+        switch MemoryLayout<T>.size {
+        case 8: rounded(into: result, count: count, direction: direction, as: UInt64.self, block: block, scalar: scalar)
+        case 4: rounded(into: result, count: count, direction: direction, as: UInt32.self, block: block, scalar: scalar)
+        case 2: rounded(into: result, count: count, direction: direction, as: UInt16.self, block: block, scalar: scalar)
+        default:
+            for index in 0..<count {
+                result[index] = scalar(index)
+            }
+        }
+    }
+
+    @inlinable
+    internal static func rounded<T, Key>(
+        into result: UnsafeMutableBufferPointer<T>,
+        count: Int,
+        direction: IEEE_754.Rounding.Direction,
+        as key: Key.Type,
+        block: (Int) -> RoundedBlock<T>,
+        scalar: (Int) -> T
+    ) where T: BinaryFloatingPoint & SIMDScalar, Key: FixedWidthInteger & UnsignedInteger & SIMDScalar {
+        var index = 0
+        if direction != .toNearest(.awayFromZero) {
+            while index &+ 8 <= count {
+                let lanes = block(index)
+                if direction == .toNearest(.toEven) || all(lanes.exact) {
+                    let values = directed(lanes, direction: direction, as: key)
+                    for lane in 0..<8 {
+                        result[index &+ lane] = values[lane]
+                    }
+                } else {
+                    for lane in index..<index &+ 8 {
+                        result[lane] = scalar(lane)
+                    }
+                }
+                index &+= 8
+            }
+        }
+        while index < count {
+            result[index] = scalar(index)
+            index &+= 1
+        }
+    }
+
+    @inlinable
+    internal static func additionBlock<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lhs: SIMD8<T>,
+        _ rhs: SIMD8<T>
+    ) -> RoundedBlock<T> {
+        let sum = lhs + rhs
+        let virtual = sum - lhs
+        let error = (lhs - (sum - virtual)) + (rhs - virtual)
+        let bound = exactSumBound(T.self)
+        let zero = SIMD8<T>(repeating: 0)
+        let exact =
+            (lhs.replacing(with: -lhs, where: lhs .< 0) .<= bound)
+            .& (rhs.replacing(with: -rhs, where: rhs .< 0) .<= bound) .& (sum .!= zero)
+        return RoundedBlock(nearest: sum, above: error .> zero, below: error .< zero, exact: exact)
+    }
+
+    @inlinable
+    internal static func multiplicationBlock<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lhs: SIMD8<T>,
+        _ rhs: SIMD8<T>
+    ) -> RoundedBlock<T> {
+        let product = lhs * rhs
+        let error = (-product).addingProduct(lhs, rhs)
+        let magnitude = product.replacing(with: -product, where: product .< 0)
+        let zero = SIMD8<T>(repeating: 0)
+        let exact = (magnitude .>= exactProductBound(T.self)) .& (magnitude .<= T.greatestFiniteMagnitude)
+        return RoundedBlock(nearest: product, above: error .> zero, below: error .< zero, exact: exact)
+    }
+
+    @inlinable
+    internal static func divisionBlock<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lhs: SIMD8<T>,
+        _ rhs: SIMD8<T>
+    ) -> RoundedBlock<T> {
+        let quotient = lhs / rhs
+        let remainder = lhs.addingProduct(-quotient, rhs)
+        let zero = SIMD8<T>(repeating: 0)
+        let positive = (remainder .> zero) .& (rhs .> zero) .| (remainder .< zero) .& (rhs .< zero)
+        let negative = (remainder .> zero) .& (rhs .< zero) .| (remainder .< zero) .& (rhs .> zero)
+        let dividend = lhs.replacing(with: -lhs, where: lhs .< 0)
+        let magnitude = quotient.replacing(with: -quotient, where: quotient .< 0)
+        let exact =
+            (dividend .>= exactProductBound(T.self)) .& (dividend .<= T.greatestFiniteMagnitude)
+            .& (magnitude .>= T.leastNormalMagnitude) .& (magnitude .<= T.greatestFiniteMagnitude)
+        return RoundedBlock(nearest: quotient, above: positive, below: negative, exact: exact)
+    }
+
+    @inlinable
+    internal static func squareRootBlock<T: BinaryFloatingPoint & SIMDScalar>(
+        _ values: SIMD8<T>
+    ) -> RoundedBlock<T> {
+        let root = values.squareRoot()
+        let residual = values.addingProduct(-root, root)
+        let zero = SIMD8<T>(repeating: 0)
+        let exact = (values .>= exactProductBound(T.self)) .& (values .<= T.greatestFiniteMagnitude)
+        return RoundedBlock(nearest: root, above: residual .> zero, below: residual .< zero, exact: exact)
+    }
+
+    @inlinable
+    internal static func fusedMultiplyAddBlock<T: BinaryFloatingPoint & SIMDScalar>(
+        _ a: SIMD8<T>,
+        _ b: SIMD8<T>,
+        _ c: SIMD8<T>
+    ) -> RoundedBlock<T> {
+        let result = c.addingProduct(a, b)
+        let product = a * b
+        let low = (-product).addingProduct(a, b)
+
+        // Grow-Expansion of [product, low, c, -result], lane-wise
+        @inline(__always)
+        func twoSum(_ x: SIMD8<T>, _ y: SIMD8<T>) -> (SIMD8<T>, SIMD8<T>) {
+            let sum = x + y
+            let virtual = sum - x
+            return (sum, (x - (sum - virtual)) + (y - virtual))
+        }
+        var (e1, e0) = twoSum(low, product)
+        var carry: SIMD8<T>
+        (carry, e0) = twoSum(c, e0)
+        (carry, e1) = twoSum(carry, e1)
+        var e2 = carry
+        (carry, e0) = twoSum(-result, e0)
+        (carry, e1) = twoSum(carry, e1)
+        (carry, e2) = twoSum(carry, e2)
+        let e3 = carry
+
+        let zero = SIMD8<T>(repeating: 0)
+        var sign = e0
+        sign.replace(with: e1, where: e1 .!= zero)
+        sign.replace(with: e2, where: e2 .!= zero)
+        sign.replace(with: e3, where: e3 .!= zero)
+
+        let bound = exactSumBound(T.self)
+        let magnitude = product.replacing(with: -product, where: product .< 0)
+        let exact =
+            (magnitude .>= exactProductBound(T.self)) .& (magnitude .<= bound)
+            .& (c.replacing(with: -c, where: c .< 0) .<= bound)
+            .& (result.replacing(with: -result, where: result .< 0) .<= bound) .& (result .!= zero)
+        return RoundedBlock(nearest: result, above: sign .> zero, below: sign .< zero, exact: exact)
+    }
+}
+
+// MARK: - Batch Operations
+
+extension IEEE_754.Arithmetic {
+    /// Element-wise addition with an explicit rounding direction
+    ///
+    /// Computes `lhs[i] + rhs[i]` rounded in `direction` into `result[i]`.
+    /// Blocks of eight lanes are evaluated with SIMD TwoSum and stepped to
+    /// their neighbor on the bit pattern, so directed rounding costs a few
+    /// extra vector operations and never changes the floating-point
+    /// environment.
+    ///
+    /// - Parameters:
+    ///   - lhs: Left operands
+    ///   - rhs: Right operands, at least `lhs.count` of them
+    ///   - result: Storage for at least `lhs.count` results
+    ///   - direction: Rounding direction for every result
+    ///
+    /// Example:
+    /// ```swift
+    /// lower.withUnsafeMutableBufferPointer { lower in
+    ///     IEEE_754.Arithmetic.addition(a, b, into: lower, rounding: .towardInfinity(.negative))
+    /// }
+    /// ```
+    @inlinable
+    public static func addition<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lhs: UnsafeBufferPointer<T>,
+        _ rhs: UnsafeBufferPointer<T>,
+        into result: UnsafeMutableBufferPointer<T>,
+        rounding direction: IEEE_754.Rounding.Direction
+    ) {
+        precondition(rhs.count >= lhs.count, "Operand buffers differ in length")
+        guard let x = lhs.baseAddress, let y = rhs.baseAddress else { return }
+        rounded(
+            into: result,
+            count: lhs.count,
+            direction: direction,
+            block: { additionBlock(load(x, $0), load(y, $0)) },
+            scalar: { addition(x[$0], y[$0], rounding: direction) }
+        )
+    }
+
+    /// Element-wise subtraction with an explicit rounding direction
+    ///
+    /// - Parameters:
+    ///   - lhs: Minuends
+    ///   - rhs: Subtrahends, at least `lhs.count` of them
+    ///   - result: Storage for at least `lhs.count` results
+    ///   - direction: Rounding direction for every result
+    @inlinable
+    public static func subtraction<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lhs: UnsafeBufferPointer<T>,
+        _ rhs: UnsafeBufferPointer<T>,
+        into result: UnsafeMutableBufferPointer<T>,
+        rounding direction: IEEE_754.Rounding.Direction
+    ) {
+        precondition(rhs.count >= lhs.count, "Operand buffers differ in length")
+        guard let x = lhs.baseAddress, let y = rhs.baseAddress else { return }
+        rounded(
+            into: result,
+            count: lhs.count,
+            direction: direction,
+            block: { additionBlock(load(x, $0), -load(y, $0)) },
+            scalar: { subtraction(x[$0], y[$0], rounding: direction) }
+        )
+    }
+
+    /// Element-wise multiplication with an explicit rounding direction
+    ///
+    /// - Parameters:
+    ///   - lhs: Left operands
+    ///   - rhs: Right operands, at least `lhs.count` of them
+    ///   - result: Storage for at least `lhs.count` results
+    ///   - direction: Rounding direction for every result
+    @inlinable
+    public static func multiplication<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lhs: UnsafeBufferPointer<T>,
+        _ rhs: UnsafeBufferPointer<T>,
+        into result: UnsafeMutableBufferPointer<T>,
+        rounding direction: IEEE_754.Rounding.Direction
+    ) {
+        precondition(rhs.count >= lhs.count, "Operand buffers differ in length")
+        guard let x = lhs.baseAddress, let y = rhs.baseAddress else { return }
+        rounded(
+            into: result,
+            count: lhs.count,
+            direction: direction,
+            block: { multiplicationBlock(load(x, $0), load(y, $0)) },
+            scalar: { multiplication(x[$0], y[$0], rounding: direction) }
+        )
+    }
+
+    /// Element-wise division with an explicit rounding direction
+    ///
+    /// - Parameters:
+    ///   - lhs: Dividends
+    ///   - rhs: Divisors, at least `lhs.count` of them
+    ///   - result: Storage for at least `lhs.count` results
+    ///   - direction: Rounding direction for every result
+    @inlinable
+    public static func division<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lhs: UnsafeBufferPointer<T>,
+        _ rhs: UnsafeBufferPointer<T>,
+        into result: UnsafeMutableBufferPointer<T>,
+        rounding direction: IEEE_754.Rounding.Direction
+    ) {
+        precondition(rhs.count >= lhs.count, "Operand buffers differ in length")
+        guard let x = lhs.baseAddress, let y = rhs.baseAddress else { return }
+        rounded(
+            into: result,
+            count: lhs.count,
+            direction: direction,
+            block: { divisionBlock(load(x, $0), load(y, $0)) },
+            scalar: { division(x[$0], y[$0], rounding: direction) }
+        )
+    }
+
+    /// Element-wise square root with an explicit rounding direction
+    ///
+    /// - Parameters:
+    ///   - values: The values
+    ///   - result: Storage for at least `values.count` results
+    ///   - direction: Rounding direction for every result
+    @inlinable
+    public static func squareRoot<T: BinaryFloatingPoint & SIMDScalar>(
+        _ values: UnsafeBufferPointer<T>,
+        into result: UnsafeMutableBufferPointer<T>,
+        rounding direction: IEEE_754.Rounding.Direction
+    ) {
+        guard let x = values.baseAddress else { return }
+        rounded(
+            into: result,
+            count: values.count,
+            direction: direction,
+            block: { squareRootBlock(load(x, $0)) },
+            scalar: { squareRoot(x[$0], rounding: direction) }
+        )
+    }
+
+    /// Element-wise fused multiply-add with an explicit rounding direction
+    ///
+    /// - Parameters:
+    ///   - a: First multiplicands
+    ///   - b: Second multiplicands, at least `a.count` of them
+    ///   - c: Addends, at least `a.count` of them
+    ///   - result: Storage for at least `a.count` results
+    ///   - direction: Rounding direction for every result
+    @inlinable
+    public static func fusedMultiplyAdd<T: BinaryFloatingPoint & SIMDScalar>(
+        a: UnsafeBufferPointer<T>,
+        b: UnsafeBufferPointer<T>,
+        c: UnsafeBufferPointer<T>,
+        into result: UnsafeMutableBufferPointer<T>,
+        rounding direction: IEEE_754.Rounding.Direction
+    ) {
+        precondition(b.count >= a.count && c.count >= a.count, "Operand buffers differ in length")
+        guard let x = a.baseAddress, let y = b.baseAddress, let z = c.baseAddress else { return }
+        rounded(
+            into: result,
+            count: a.count,
+            direction: direction,
+            block: { fusedMultiplyAddBlock(load(x, $0), load(y, $0), load(z, $0)) },
+            scalar: { fusedMultiplyAdd(a: x[$0], b: y[$0], c: z[$0], rounding: direction) }
+        )
+    }
+}
+
+// MARK: - Array Convenience
+
+extension IEEE_754.Arithmetic {
+    @inlinable
+    internal static func rounded<T: BinaryFloatingPoint & SIMDScalar>(
+        count: Int,
+        _ body: (UnsafeMutableBufferPointer<T>) -> Void
+    ) -> [T] {
+        [T](unsafeUninitializedCapacity: count) { buffer, initialized in
+            buffer.initialize(repeating: 0)
+            body(buffer)
+            initialized = count
+        }
+    }
+
+    /// Element-wise addition with an explicit rounding direction
+    ///
+    /// - Parameters:
+    ///   - lhs: Left operands
+    ///   - rhs: Right operands, same count as `lhs`
+    ///   - direction: Rounding direction for every result
+    /// - Returns: `lhs[i] + rhs[i]`, each rounded in `direction`
+    ///
+    /// Example:
+    /// ```swift
+    /// let lower = IEEE_754.Arithmetic.addition(a, b, rounding: .towardInfinity(.negative))
+    /// let upper = IEEE_754.Arithmetic.addition(a, b, rounding: .towardInfinity(.positive))
+    /// // lower[i] ≤ a[i] + b[i] ≤ upper[i], exactly
+    /// ```
+    @inlinable
+    public static func addition<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lhs: [T],
+        _ rhs: [T],
+        rounding direction: IEEE_754.Rounding.Direction
+    ) -> [T] {
+        precondition(lhs.count == rhs.count, "Operand arrays differ in length")
+        return rounded(count: lhs.count) { result in
+            lhs.withUnsafeBufferPointer { x in
+                rhs.withUnsafeBufferPointer { y in addition(x, y, into: result, rounding: direction) }
+            }
+        }
+    }
+
+    /// Element-wise subtraction with an explicit rounding direction
+    ///
+    /// - Parameters:
+    ///   - lhs: Minuends
+    ///   - rhs: Subtrahends, same count as `lhs`
+    ///   - direction: Rounding direction for every result
+    /// - Returns: `lhs[i] - rhs[i]`, each rounded in `direction`
+    @inlinable
+    public static func subtraction<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lhs: [T],
+        _ rhs: [T],
+        rounding direction: IEEE_754.Rounding.Direction
+    ) -> [T] {
+        precondition(lhs.count == rhs.count, "Operand arrays differ in length")
+        return rounded(count: lhs.count) { result in
+            lhs.withUnsafeBufferPointer { x in
+                rhs.withUnsafeBufferPointer { y in subtraction(x, y, into: result, rounding: direction) }
+            }
+        }
+    }
+
+    /// Element-wise multiplication with an explicit rounding direction
+    ///
+    /// - Parameters:
+    ///   - lhs: Left operands
+    ///   - rhs: Right operands, same count as `lhs`
+    ///   - direction: Rounding direction for every result
+    /// - Returns: `lhs[i] × rhs[i]`, each rounded in `direction`
+    @inlinable
+    public static func multiplication<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lhs: [T],
+        _ rhs: [T],
+        rounding direction: IEEE_754.Rounding.Direction
+    ) -> [T] {
+        precondition(lhs.count == rhs.count, "Operand arrays differ in length")
+        return rounded(count: lhs.count) { result in
+            lhs.withUnsafeBufferPointer { x in
+                rhs.withUnsafeBufferPointer { y in multiplication(x, y, into: result, rounding: direction) }
+            }
+        }
+    }
+
+    /// Element-wise division with an explicit rounding direction
+    ///
+    /// - Parameters:
+    ///   - lhs: Dividends
+    ///   - rhs: Divisors, same count as `lhs`
+    ///   - direction: Rounding direction for every result
+    /// - Returns: `lhs[i] / rhs[i]`, each rounded in `direction`
+    @inlinable
+    public static func division<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lhs: [T],
+        _ rhs: [T],
+        rounding direction: IEEE_754.Rounding.Direction
+    ) -> [T] {
+        precondition(lhs.count == rhs.count, "Operand arrays differ in length")
+        return rounded(count: lhs.count) { result in
+            lhs.withUnsafeBufferPointer { x in
+                rhs.withUnsafeBufferPointer { y in division(x, y, into: result, rounding: direction) }
+            }
+        }
+    }
+
+    /// Element-wise square root with an explicit rounding direction
+    ///
+    /// - Parameters:
+    ///   - values: The values
+    ///   - direction: Rounding direction for every result
+    /// - Returns: `√values[i]`, each rounded in `direction`
+    @inlinable
+    public static func squareRoot<T: BinaryFloatingPoint & SIMDScalar>(
+        _ values: [T],
+        rounding direction: IEEE_754.Rounding.Direction
+    ) -> [T] {
+        rounded(count: values.count) { result in
+            values.withUnsafeBufferPointer { x in squareRoot(x, into: result, rounding: direction) }
+        }
+    }
+
+    /// Element-wise fused multiply-add with an explicit rounding direction
+    ///
+    /// - Parameters:
+    ///   - a: First multiplicands
+    ///   - b: Second multiplicands, same count as `a`
+    ///   - c: Addends, same count as `a`
+    ///   - direction: Rounding direction for every result
+    /// - Returns: `(a[i] × b[i]) + c[i]`, each rounded once in `direction`
+    @inlinable
+    public static func fusedMultiplyAdd<T: BinaryFloatingPoint & SIMDScalar>(
+        a: [T],
+        b: [T],
+        c: [T],
+        rounding direction: IEEE_754.Rounding.Direction
+    ) -> [T] {
+        precondition(a.count == b.count && a.count == c.count, "Operand arrays differ in length")
+        return rounded(count: a.count) { result in
+            a.withUnsafeBufferPointer { x in
+                b.withUnsafeBufferPointer { y in
+                    c.withUnsafeBufferPointer { z in
+                        fusedMultiplyAdd(a: x, b: y, c: z, into: result, rounding: direction)
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,515 @@
+// IEEE_754.Arithmetic.Summation.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 9.4: Compensated sum and dot reductions
+
+// MARK: - Summation Algorithms
+
+extension IEEE_754.Arithmetic {
+    /// Summation algorithm for ``sum(_:using:)``
+    ///
+    /// All algorithms split the input into fixed blocks of 4096 elements,
+    /// reduce each block in SIMD lanes, and combine the block results along a
+    /// fixed binary tree. The tree depends only on the element count, so a
+    /// sum is reproducible bit-for-bit whether it runs on one core or many.
+    public enum Summation: Sendable, Equatable {
+        /// Kahan's compensated summation
+        ///
+        /// Carries the rounding error of each addition into the next one.
+        /// Loses the correction when an addend is larger in magnitude than
+        /// the running sum.
+        case kahan
+
+        /// Kahan–Babuška–Neumaier summation
+        ///
+        /// Accumulates the exact error of every addition (TwoSum), so the
+        /// result is as accurate as if summed in twice the working precision
+        /// and then rounded: `|error| ≤ u·|Σx| + O(n·u²)·Σ|x|`.
+        case neumaier
+
+        /// Pairwise (cascade) summation without compensation
+        ///
+        /// Error grows as `O(log n · u)·Σ|x|` instead of `O(n · u)`, at the
+        /// cost of a plain sum.
+        case pairwise
+    }
+}
+
+// MARK: - Partial Sums
+
+extension IEEE_754.Arithmetic {
+    /// Elements reduced per block; block boundaries never depend on the thread count
+    @usableFromInline
+    internal static let summationBlockSize = 1 << 12
+
+    /// Inputs at least this long are reduced concurrently by the async entry points
+    @usableFromInline
+    internal static let summationConcurrencyThreshold = 1 << 17
+
+    /// Smallest number of blocks handed to one task
+    @usableFromInline
+    internal static let summationMinimumChunk = 16
+
+    /// A double-word partial sum `head + tail`
+    ///
+    /// Non-finite heads carry no tail: once a partial overflows or meets an
+    /// infinity or NaN, it follows ordinary IEEE 754 addition.
+    @usableFromInline
+    internal struct Compensated<T: BinaryFloatingPoint> {
+        @usableFromInline
+        internal var head: T
+
+        @usableFromInline
+        internal var tail: T
+
+        @inlinable
+        internal init(head: T, tail: T) {
+            self.head = head
+            self.tail = tail
+        }
+
+        @inlinable
+        internal static var zero: Self { Self(head: 0, tail: 0) }
+
+        /// The partial rounded to working precision
+        @inlinable
+        internal var value: T { head + tail }
+
+        /// Double-word addition, renormalized so `|tail| ≤ ulp(head) / 2`
+        @inlinable
+        @inline(__always)
+        internal static func + (lhs: Self, rhs: Self) -> Self {
+            let (sum, error) = IEEE_754.Arithmetic.twoSum(lhs.head, rhs.head)
+            guard sum.isFinite else { return Self(head: sum, tail: 0) }
+            let (head, tail) = IEEE_754.Arithmetic.twoSum(sum, error + (lhs.tail + rhs.tail))
+            return Self(head: head, tail: tail)
+        }
+    }
+
+    /// Lane-wise TwoSum
+    @inlinable
+    @inline(__always)
+    internal static func twoSum<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lhs: SIMD8<T>,
+        _ rhs: SIMD8<T>
+    ) -> (sum: SIMD8<T>, error: SIMD8<T>) {
+        let sum = lhs + rhs
+        let virtual = sum - lhs
+        return (sum, (lhs - (sum - virtual)) + (rhs - virtual))
+    }
+
+    /// Folds eight lane partials, lane 0 first
+    @inlinable
+    internal static func lanes<T: BinaryFloatingPoint & SIMDScalar>(
+        _ sums: SIMD8<T>,
+        _ errors: SIMD8<T>
+    ) -> Compensated<T> {
+        var total = Compensated<T>.zero
+        for lane in 0..<8 {
+            total = total + Compensated(head: sums[lane], tail: errors[lane])
+        }
+        return total
+    }
+
+    /// Combines block partials along a fixed binary tree
+    ///
+    /// Splits at `count / 2` at every level, so the shape — and therefore
+    /// the rounding — depends only on the number of blocks.
+    @inlinable
+    internal static func combine<T: BinaryFloatingPoint>(
+        _ partials: UnsafeBufferPointer<Compensated<T>>,
+        compensated: Bool
+    ) -> Compensated<T> {
+        switch partials.count {
+        case 0:
+            return .zero
+        case 1:
+            return partials[0]
+        default:
+            let middle = partials.count / 2
+            let left = combine(UnsafeBufferPointer(rebasing: partials[..<middle]), compensated: compensated)
+            let right = combine(UnsafeBufferPointer(rebasing: partials[middle...]), compensated: compensated)
+            return compensated ? left + right : Compensated(head: left.head + right.head, tail: 0)
+        }
+    }
+
+    @inlinable
+    internal static func blockCount(_ count: Int) -> Int {
+        (count + summationBlockSize - 1) / summationBlockSize
+    }
+}
+
+// MARK: - Block Kernels
+
+extension IEEE_754.Arithmetic {
+    /// Reduces block `block` of `values` with `algorithm`
+    @inlinable
+    internal static func summationBlock<T: BinaryFloatingPoint & SIMDScalar>(
+        _ values: UnsafeBufferPointer<T>,
+        block: Int,
+        algorithm: Summation
+    ) -> Compensated<T> {
+        let start = block * summationBlockSize
+        let end = min(start + summationBlockSize, values.count)
+        let base = values.baseAddress!
+        switch algorithm {
+        case .kahan:
+            return kahanBlock(base, start..<end)
+        case .neumaier:
+            return neumaierBlock(base, start..<end)
+        case .pairwise:
+            return Compensated(head: pairwiseBlock(base, start..<end), tail: 0)
+        }
+    }
+
+    @inlinable
+    internal static func kahanBlock<T: BinaryFloatingPoint & SIMDScalar>(
+        _ base: UnsafePointer<T>,
+        _ range: Range<Int>
+    ) -> Compensated<T> {
+        var sum = SIMD8<T>(repeating: 0)
+        var correction = SIMD8<T>(repeating: 0)
+        var index = range.lowerBound
+        while index &+ 8 <= range.upperBound {
+            let addend = load(base, index) - correction
+            let total = sum + addend
+            correction = (total - sum) - addend
+            sum = total
+            index &+= 8
+        }
+        // The correction is the negated lost low part
+        var total = lanes(sum, -correction)
+        while index < range.upperBound {
+            total = total + Compensated(head: base[index], tail: 0)
+            index &+= 1
+        }
+        // An infinite addend turns the correction into NaN; the plain sum
+        // of the block has the IEEE 754 result instead
+        guard total.head.isFinite else {
+            return Compensated(head: pairwiseBlock(base, range), tail: 0)
+        }
+        return total
+    }
+
+    @inlinable
+    internal static func neumaierBlock<T: BinaryFloatingPoint & SIMDScalar>(
+        _ base: UnsafePointer<T>,
+        _ range: Range<Int>
+    ) -> Compensated<T> {
+        var sum = SIMD8<T>(repeating: 0)
+        var error = SIMD8<T>(repeating: 0)
+        var index = range.lowerBound
+        while index &+ 8 <= range.upperBound {
+            // Branch-free TwoSum yields the same error term as Neumaier's
+            // magnitude test, without a lane-wise select
+            let (total, lost) = twoSum(sum, load(base, index))
+            sum = total
+            error += lost
+            index &+= 8
+        }
+        var total = lanes(sum, error)
+        while index < range.upperBound {
+            total = total + Compensated(head: base[index], tail: 0)
+            index &+= 1
+        }
+        return total
+    }
+
+    /// Recursive halving down to 128-element leaves summed in SIMD lanes
+    @inlinable
+    internal static func pairwiseBlock<T: BinaryFloatingPoint & SIMDScalar>(
+        _ base: UnsafePointer<T>,
+        _ range: Range<Int>
+    ) -> T {
+        guard range.count <= 128 else {
+            // Keep the left half a multiple of the vector width
+            let middle = range.lowerBound + ((range.count / 2) & ~7)
+            return pairwiseBlock(base, range.lowerBound..<middle) + pairwiseBlock(base, middle..<range.upperBound)
+        }
+        var sum = SIMD8<T>(repeating: 0)
+        var index = range.lowerBound
+        while index &+ 8 <= range.upperBound {
+            sum += load(base, index)
+            index &+= 8
+        }
+        let quad = sum.lowHalf + sum.highHalf
+        let pair = quad.lowHalf + quad.highHalf
+        var total = pair[0] + pair[1]
+        while index < range.upperBound {
+            total += base[index]
+            index &+= 1
+        }
+        return total
+    }
+
+    /// Dot2 (Ogita, Rump and Oishi): TwoProd and TwoSum per lane
+    @inlinable
+    internal static func dotBlock<T: BinaryFloatingPoint & SIMDScalar>(
+        _ x: UnsafeBufferPointer<T>,
+        _ y: UnsafeBufferPointer<T>,
+        block: Int
+    ) -> Compensated<T> {
+        let start = block * summationBlockSize
+        let end = min(start + summationBlockSize, x.count)
+        let xs = x.baseAddress!
+        let ys = y.baseAddress!
+        var sum = SIMD8<T>(repeating: 0)
+        var error = SIMD8<T>(repeating: 0)
+        var index = start
+        while index &+ 8 <= end {
+            let a = load(xs, index)
+            let b = load(ys, index)
+            let product = a * b
+            let residual = (-product).addingProduct(a, b)
+            let (total, lost) = twoSum(sum, product)
+            sum = total
+            error += lost + residual
+            index &+= 8
+        }
+        var total = lanes(sum, error)
+        while index < end {
+            let product = xs[index] * ys[index]
+            let residual = fusedMultiplyAdd(a: xs[index], b: ys[index], c: -product)
+            total = total + Compensated(head: product, tail: residual)
+            index &+= 1
+        }
+        return total
+    }
+}
+
+// MARK: - Reduction Drivers
+
+extension IEEE_754.Arithmetic {
+    @inlinable
+    internal static func summation<T: BinaryFloatingPoint & SIMDScalar>(
+        _ values: UnsafeBufferPointer<T>,
+        algorithm: Summation
+    ) -> T {
+        let blocks = blockCount(values.count)
+        guard blocks > 1 else {
+            return blocks == 0 ? 0 : summationBlock(values, block: 0, algorithm: algorithm).value
+        }
+        return withUnsafeTemporaryAllocation(of: Compensated<T>.self, capacity: blocks) { partials in
+            for block in 0..<blocks {
+                partials.initializeElement(at: block, to: summationBlock(values, block: block, algorithm: algorithm))
+            }
+            return combine(UnsafeBufferPointer(partials), compensated: algorithm != .pairwise).value
+        }
+    }
+
+    @inlinable
+    internal static func summation<T: BinaryFloatingPoint & SIMDScalar & Sendable>(
+        _ values: [T],
+        algorithm: Summation
+    ) async -> T {
+        let blocks = blockCount(values.count)
+        let chunks = IEEE_754.Parallel.chunks(count: blocks, minimumChunk: summationMinimumChunk)
+        guard values.count >= summationConcurrencyThreshold, chunks.count > 1 else {
+            return values.withUnsafeBufferPointer { summation($0, algorithm: algorithm) }
+        }
+
+        let partials = UnsafeMutableBufferPointer<Compensated<T>>.allocate(capacity: blocks)
+        partials.initialize(repeating: .zero)
+        defer { partials.deallocate() }
+
+        let shared = IEEE_754.Parallel.Buffer(partials)
+        await IEEE_754.Parallel.forEach(chunks) { _, range in
+            values.withUnsafeBufferPointer { values in
+                for block in range {
+                    shared[block] = summationBlock(values, block: block, algorithm: algorithm)
+                }
+            }
+        }
+        return combine(UnsafeBufferPointer(partials), compensated: algorithm != .pairwise).value
+    }
+
+    @inlinable
+    internal static func dotProduct<T: BinaryFloatingPoint & SIMDScalar>(
+        _ x: UnsafeBufferPointer<T>,
+        _ y: UnsafeBufferPointer<T>
+    ) -> T {
+        precondition(x.count == y.count, "Operand buffers differ in length")
+        let blocks = blockCount(x.count)
+        guard blocks > 1 else {
+            return blocks == 0 ? 0 : dotBlock(x, y, block: 0).value
+        }
+        return withUnsafeTemporaryAllocation(of: Compensated<T>.self, capacity: blocks) { partials in
+            for block in 0..<blocks {
+                partials.initializeElement(at: block, to: dotBlock(x, y, block: block))
+            }
+            return combine(UnsafeBufferPointer(partials), compensated: true).value
+        }
+    }
+
+    @inlinable
+    internal static func dotProduct<T: BinaryFloatingPoint & SIMDScalar & Sendable>(_ x: [T], _ y: [T]) async -> T {
+        precondition(x.count == y.count, "Operand arrays differ in length")
+        let blocks = blockCount(x.count)
+        let chunks = IEEE_754.Parallel.chunks(count: blocks, minimumChunk: summationMinimumChunk)
+        guard x.count >= summationConcurrencyThreshold, chunks.count > 1 else {
+            return x.withUnsafeBufferPointer { x in
+                y.withUnsafeBufferPointer { y in dotProduct(x, y) }
+            }
+        }
+
+        let partials = UnsafeMutableBufferPointer<Compensated<T>>.allocate(capacity: blocks)
+        partials.initialize(repeating: .zero)
+        defer { partials.deallocate() }
+
+        let shared = IEEE_754.Parallel.Buffer(partials)
+        await IEEE_754.Parallel.forEach(chunks) { _, range in
+            x.withUnsafeBufferPointer { x in
+                y.withUnsafeBufferPointer { y in
+                    for block in range {
+                        shared[block] = dotBlock(x, y, block: block)
+                    }
+                }
+            }
+        }
+        return combine(UnsafeBufferPointer(partials), compensated: true).value
+    }
+
+    @inlinable
+    internal static func contiguous<C: Collection, R>(
+        _ values: C,
+        _ body: (UnsafeBufferPointer<C.Element>) -> R
+    ) -> R {
+        if let result = values.withContiguousStorageIfAvailable(body) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer(body)
+    }
+}
+
+// MARK: - Double Reductions
+
+extension IEEE_754.Arithmetic {
+    /// Compensated sum of Double values
+    ///
+    /// Reproducible: the same input always gives the same bits, on any
+    /// machine with IEEE 754 binary64 arithmetic and whatever the core count
+    /// of the `async` overload. Contiguous collections are read in place.
+    ///
+    /// An infinity or NaN among the addends, or an overflowing partial,
+    /// makes the result follow ordinary IEEE 754 addition. An empty
+    /// collection sums to `+0`.
+    ///
+    /// - Parameters:
+    ///   - values: The addends
+    ///   - algorithm: The summation algorithm (default `.neumaier`)
+    /// - Returns: The sum
+    ///
+    /// Example:
+    /// ```swift
+    /// let values: [Double] = [1e100, 1.0, -1e100]
+    /// values.reduce(0, +)                                       // 0.0
+    /// IEEE_754.Arithmetic.sum(values)                           // 1.0
+    /// IEEE_754.Arithmetic.sum(values, using: .pairwise)         // 0.0
+    /// ```
+    @inlinable
+    public static func sum<C: Collection<Double>>(_ values: C, using algorithm: Summation = .neumaier) -> Double {
+        contiguous(values) { summation($0, algorithm: algorithm) }
+    }
+
+    /// Compensated sum of Double values, using all cores for large inputs
+    ///
+    /// Bit-identical to the synchronous overload: blocks are reduced
+    /// concurrently but combined in the same fixed order.
+    ///
+    /// - Parameters:
+    ///   - values: The addends
+    ///   - algorithm: The summation algorithm (default `.neumaier`)
+    /// - Returns: The sum
+    @inlinable
+    public static func sum(_ values: [Double], using algorithm: Summation = .neumaier) async -> Double {
+        await summation(values, algorithm: algorithm)
+    }
+
+    /// Double-word dot product of Double values
+    ///
+    /// Each product is split exactly with a fused multiply-add (TwoProd)
+    /// and accumulated with TwoSum (Ogita–Rump–Oishi Dot2), so the result is
+    /// as accurate as a dot product computed in twice the precision and
+    /// rounded once. Reproducible like ``sum(_:using:)``.
+    ///
+    /// - Parameters:
+    ///   - x: First factors
+    ///   - y: Second factors, same count as `x`
+    /// - Returns: `Σ x[i] × y[i]`
+    ///
+    /// Example:
+    /// ```swift
+    /// IEEE_754.Arithmetic.dot([1e8 + 1, -1e16], [1e8 - 1, 1])  // -1.0 (naive: 0.0)
+    /// ```
+    @inlinable
+    public static func dot<X: Collection<Double>, Y: Collection<Double>>(_ x: X, _ y: Y) -> Double {
+        contiguous(x) { x in
+            contiguous(y) { y in dotProduct(x, y) }
+        }
+    }
+
+    /// Double-word dot product of Double values, using all cores for large inputs
+    ///
+    /// Bit-identical to the synchronous overload.
+    ///
+    /// - Parameters:
+    ///   - x: First factors
+    ///   - y: Second factors, same count as `x`
+    /// - Returns: `Σ x[i] × y[i]`
+    @inlinable
+    public static func dot(_ x: [Double], _ y: [Double]) async -> Double {
+        await dotProduct(x, y)
+    }
+}
+
+// MARK: - Float Reductions
+
+extension IEEE_754.Arithmetic {
+    /// Compensated sum of Float values
+    ///
+    /// See the Double overload of ``sum(_:using:)``.
+    ///
+    /// - Parameters:
+    ///   - values: The addends
+    ///   - algorithm: The summation algorithm (default `.neumaier`)
+    /// - Returns: The sum
+    @inlinable
+    public static func sum<C: Collection<Float>>(_ values: C, using algorithm: Summation = .neumaier) -> Float {
+        contiguous(values) { summation($0, algorithm: algorithm) }
+    }
+
+    /// Compensated sum of Float values, using all cores for large inputs
+    ///
+    /// - Parameters:
+    ///   - values: The addends
+    ///   - algorithm: The summation algorithm (default `.neumaier`)
+    /// - Returns: The sum, bit-identical to the synchronous overload
+    @inlinable
+    public static func sum(_ values: [Float], using algorithm: Summation = .neumaier) async -> Float {
+        await summation(values, algorithm: algorithm)
+    }
+
+    /// Double-word dot product of Float values
+    ///
+    /// - Parameters:
+    ///   - x: First factors
+    ///   - y: Second factors, same count as `x`
+    /// - Returns: `Σ x[i] × y[i]`
+    @inlinable
+    public static func dot<X: Collection<Float>, Y: Collection<Float>>(_ x: X, _ y: Y) -> Float {
+        contiguous(x) { x in
+            contiguous(y) { y in dotProduct(x, y) }
+        }
+    }
+
+    /// Double-word dot product of Float values, using all cores for large inputs
+    ///
+    /// - Parameters:
+    ///   - x: First factors
+    ///   - y: Second factors, same count as `x`
+    /// - Returns: `Σ x[i] × y[i]`, bit-identical to the synchronous overload
+    @inlinable
+    public static func dot(_ x: [Float], _ y: [Float]) async -> Float {
+        await dotProduct(x, y)
+    }
+}
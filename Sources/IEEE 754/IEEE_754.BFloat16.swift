@@ -0,0 +1,210 @@
+// IEEE_754.BFloat16.swift
+// swift-ieee-754
+//
+// bfloat16: the upper half of binary32, used for machine learning storage
+
+public import Binary
+
+#if canImport(CIEEE754)
+    import CIEEE754
+#endif
+
+extension IEEE_754 {
+    /// bfloat16 (brain floating point) storage format
+    ///
+    /// Not an IEEE 754 interchange format, but laid out like one: binary32
+    /// with the low 16 bits of the significand dropped. It keeps binary32's
+    /// exponent range with 8 bits of precision.
+    ///
+    /// ## Format Specification
+    ///
+    /// Total: 16 bits (2 bytes)
+    /// - Sign: 1 bit
+    /// - Exponent: 8 bits (biased by 127)
+    /// - Significand: 7 bits (plus implicit leading 1)
+    ///
+    /// ## Encoding
+    ///
+    /// ```
+    /// seee eeee efff ffff
+    /// │└───┬───┘└──┬───┘
+    /// │ exponent  significand
+    /// sign (8 bits) (7 bits)
+    /// ```
+    ///
+    /// ## Overview
+    ///
+    /// Widening to Float is exact and is a 16-bit shift of the encoding.
+    /// Narrowing rounds to nearest with ties to even, optionally saturating
+    /// at the largest finite magnitude instead of overflowing to infinity.
+    /// Encodings are plain `UInt16` bit patterns; the layout constants,
+    /// classification and next-up/down come from ``IEEE_754/BinaryFormat``.
+    ///
+    /// Example:
+    /// ```swift
+    /// let weights = checkpoint.withUnsafeBytes {
+    ///     IEEE_754.BFloat16.values(from: $0, endianness: .little)
+    /// }
+    /// ```
+    public enum BFloat16: IEEE_754.BinaryFormat {
+        public typealias BitPattern = UInt16
+
+        /// Exponent bits: 8 bits, as in binary32
+        @inlinable
+        public static var exponentBits: Int { 8 }
+
+        /// Significand bits: 7 bits (plus implicit leading 1)
+        @inlinable
+        public static var significandBits: Int { 7 }
+
+        /// Largest finite value: (2 − 2⁻⁷) × 2¹²⁷
+        public static let maxNormal: Float = Float(bitPattern: 0x7F7F_0000)
+
+        /// Smallest positive normal value: 2⁻¹²⁶
+        public static let minNormal: Float = Float.leastNormalMagnitude
+
+        /// Smallest positive subnormal value: 2⁻¹³³
+        public static let minSubnormal: Float = Float(bitPattern: 0x0001_0000)
+    }
+}
+
+// MARK: - Scalar Conversion
+
+extension IEEE_754.BFloat16 {
+    /// Widens a bfloat16 encoding to Float
+    ///
+    /// Exact. NaN payloads are kept unchanged.
+    @inlinable
+    public static func value(bitPattern: UInt16) -> Float {
+        Float(bitPattern: UInt32(bitPattern) << 16)
+    }
+
+    /// Narrows a Float to a bfloat16 encoding
+    ///
+    /// Rounds to nearest, ties to even, independently of the rounding mode.
+    /// NaNs are quieted, keeping their sign and leading payload bits.
+    /// Raises no exceptions; use the bulk ``narrow(_:into:saturating:)``
+    /// for exception counts.
+    ///
+    /// - Parameters:
+    ///   - value: The value to narrow
+    ///   - saturating: When true, values beyond ``maxNormal`` (including
+    ///     infinities) become ±``maxNormal`` instead of ±infinity
+    /// - Returns: The bfloat16 encoding
+    @inlinable
+    public static func bitPattern(from value: Float, saturating: Bool = false) -> UInt16 {
+        let bits = value.bitPattern
+        let sign = UInt16(truncatingIfNeeded: bits >> 16) & 0x8000
+        let magnitude = bits & 0x7FFF_FFFF
+
+        if magnitude > 0x7F80_0000 {
+            return sign | UInt16(truncatingIfNeeded: magnitude >> 16) | 0x0040
+        }
+        let rounded = UInt16(truncatingIfNeeded: (magnitude &+ 0x7FFF &+ ((magnitude >> 16) & 1)) >> 16)
+        if saturating && rounded >= 0x7F80 {
+            return sign | 0x7F7F
+        }
+        return sign | rounded
+    }
+}
+
+// MARK: - Bulk Conversion
+
+#if canImport(CIEEE754)
+    extension IEEE_754.BFloat16 {
+        /// Widens bfloat16 encodings to Float in bulk
+        ///
+        /// Exact and vectorized; signals no exceptions.
+        ///
+        /// - Parameters:
+        ///   - source: bfloat16 encodings
+        ///   - destination: Storage for at least `source.count` results
+        public static func widen(
+            _ source: UnsafeBufferPointer<UInt16>,
+            into destination: UnsafeMutableBufferPointer<Float>
+        ) {
+            precondition(destination.count >= source.count, "Result buffer is too small")
+            guard let input = source.baseAddress, let output = destination.baseAddress else { return }
+            ieee754_bfloat16_widen_array(input, output, source.count, 0)
+        }
+
+        /// Narrows Floats to bfloat16 encodings in bulk
+        ///
+        /// Same rounding as ``bitPattern(from:saturating:)``, vectorized. The
+        /// counts are gathered in the same pass, and each exception that
+        /// occurs is raised once for the batch. Saturated infinities count
+        /// as overflow.
+        ///
+        /// - Parameters:
+        ///   - source: The values to narrow
+        ///   - destination: Storage for at least `source.count` encodings
+        ///   - saturating: Clamp out-of-range values to ±``maxNormal``
+        /// - Returns: Exception counts for the batch
+        @discardableResult
+        public static func narrow(
+            _ source: UnsafeBufferPointer<Float>,
+            into destination: UnsafeMutableBufferPointer<UInt16>,
+            saturating: Bool = false
+        ) -> IEEE_754.Conversions.Summary {
+            precondition(destination.count >= source.count, "Destination buffer is too small")
+            guard let input = source.baseAddress, let output = destination.baseAddress else {
+                return IEEE_754.Conversions.Summary()
+            }
+            let summary = ieee754_convert_f32_to_bf16_array(input, output, source.count, saturating ? 1 : 0)
+            return IEEE_754.Conversions.Summary(summary)
+        }
+
+        /// Decodes a run of stored bfloat16 values to Floats
+        ///
+        /// Reads the bytes, byte-swaps when `endianness` differs from the
+        /// host's, and widens, all in one vectorized pass with no
+        /// intermediate copy. The buffer does not need to be aligned.
+        ///
+        /// - Parameters:
+        ///   - bytes: Raw bytes holding consecutive bfloat16 values
+        ///   - endianness: Byte order of the stored values (defaults to little-endian)
+        /// - Returns: The widened values, or nil if `bytes.count` is odd
+        public static func values(
+            from bytes: UnsafeRawBufferPointer,
+            endianness: Binary.Endianness = .little
+        ) -> [Float]? {
+            guard bytes.count % byteSize == 0 else { return nil }
+            let count = bytes.count / byteSize
+            guard let input = bytes.baseAddress, count > 0 else { return [] }
+
+            return [Float](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+                ieee754_bfloat16_widen_array(input, buffer.baseAddress!, count, endianness.isHostOrder ? 0 : 1)
+                initializedCount = count
+            }
+        }
+
+        /// Encodes Floats as stored bfloat16 values
+        ///
+        /// Narrows with ``narrow(_:into:saturating:)`` and lays the encodings
+        /// out in `endianness` byte order.
+        ///
+        /// - Parameters:
+        ///   - values: The values to store
+        ///   - endianness: Byte order of the result (defaults to little-endian)
+        ///   - saturating: Clamp out-of-range values to ±``maxNormal``
+        /// - Returns: `2 × values.count` bytes
+        public static func bytes(
+            from values: UnsafeBufferPointer<Float>,
+            endianness: Binary.Endianness = .little,
+            saturating: Bool = false
+        ) -> [UInt8] {
+            let count = values.count
+            return [UInt8](unsafeUninitializedCapacity: count * byteSize) { buffer, initializedCount in
+                guard let base = buffer.baseAddress, count > 0 else { return }
+                base.withMemoryRebound(to: UInt16.self, capacity: count) { encodings in
+                    let storage = UnsafeMutableBufferPointer(start: encodings, count: count)
+                    narrow(values, into: storage, saturating: saturating)
+                }
+                if !endianness.isHostOrder {
+                    IEEE_754.ByteOrder.swap16(count, from: base, to: base)
+                }
+                initializedCount = count * byteSize
+            }
+        }
+    }
+#endif
@@ -0,0 +1,587 @@
+// IEEE_754.Binary128.Arithmetic.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 5.4: Binary128 arithmetic, comparison and conversion
+
+#if canImport(CIEEE754)
+    import CIEEE754
+#endif
+
+// MARK: - Software Implementation
+
+extension IEEE_754.Binary128 {
+    /// Correctly rounded binary128 arithmetic on integer significands
+    ///
+    /// Finite operands are unpacked to a 113-bit significand and the exponent
+    /// of its leading bit, combined exactly in up to 256 bits (or with a
+    /// sticky bit for what falls off the end), and rounded once to nearest
+    /// even by ``pack(negative:exponent:significand:sticky:)``.
+    internal enum Software {
+        static let bias = IEEE_754.Binary128.exponentBias
+        static let emin = IEEE_754.Binary128.emin
+        static let emax = IEEE_754.Binary128.emax
+        static let signMask = IEEE_754.Binary128.signMask
+        static let exponentMask = IEEE_754.Binary128.exponentMask
+        static let fractionMask = IEEE_754.Binary128.fractionMask
+        static let defaultNaN = IEEE_754.Binary128.exponentMask | IEEE_754.Binary128.quietBit
+
+        // MARK: Encoding
+
+        static func isNaN(_ bits: UInt128) -> Bool { bits & ~signMask > exponentMask }
+        static func isInfinite(_ bits: UInt128) -> Bool { bits & ~signMask == exponentMask }
+        static func isZero(_ bits: UInt128) -> Bool { bits & ~signMask == 0 }
+        static func isNegative(_ bits: UInt128) -> Bool { bits & signMask != 0 }
+        static func quieted(_ bits: UInt128) -> UInt128 { bits | IEEE_754.Binary128.quietBit }
+
+        /// Significand with its leading bit at 112, and that bit's exponent
+        static func unpack(_ bits: UInt128) -> (exponent: Int, significand: UInt128) {
+            let biased = Int(truncatingIfNeeded: bits >> 112) & 0x7FFF
+            let fraction = bits & fractionMask
+            guard biased == 0 else { return (biased - bias, fraction | 1 << 112) }
+            let shift = fraction.leadingZeroBitCount - 15
+            return (emin - shift, fraction << shift)
+        }
+
+        /// `value >> count` with every shifted-out bit ORed into bit 0
+        static func jammed(_ value: UInt128, _ count: Int) -> UInt128 {
+            guard count > 0 else { return value }
+            guard count < 128 else { return value == 0 ? 0 : 1 }
+            return value >> count | (value << (128 - count) == 0 ? 0 : 1)
+        }
+
+        /// Rounds `significand × 2^(exponent - 127)` to nearest even and encodes it
+        ///
+        /// - Parameters:
+        ///   - negative: Sign of the result
+        ///   - exponent: Exponent of the leading significand bit
+        ///   - significand: Bit 127 set
+        ///   - sticky: Whether nonzero bits lie below the significand
+        static func pack(negative: Bool, exponent: Int, significand: UInt128, sticky: Bool) -> UInt128 {
+            var exponent = exponent
+            var significand = significand | (sticky ? 1 : 0)
+            if exponent < emin {
+                significand = jammed(significand, emin - exponent)
+                exponent = emin
+            }
+
+            // 113 kept bits and 15 rounding bits
+            let dropped = significand & 0x7FFF
+            var kept = significand >> 15
+            if dropped > 0x4000 || (dropped == 0x4000 && kept & 1 == 1) {
+                kept += 1
+            }
+            if kept >> 113 != 0 {
+                kept >>= 1
+                exponent += 1
+            }
+
+            let sign = negative ? signMask : 0
+            guard exponent <= emax else { return sign | exponentMask }
+            let biased: UInt128 = kept >> 112 == 0 ? 0 : UInt128(exponent + bias)
+            return sign | biased << 112 | kept & fractionMask
+        }
+
+        // MARK: 256-bit Intermediates
+
+        /// Unsigned 256-bit integer
+        struct Wide {
+            var high: UInt128
+            var low: UInt128
+
+            var isZero: Bool { high == 0 && low == 0 }
+
+            var leadingZeroBitCount: Int {
+                high != 0 ? high.leadingZeroBitCount : 128 + low.leadingZeroBitCount
+            }
+
+            func shiftedLeft(_ count: Int) -> Wide {
+                guard count > 0 else { return self }
+                guard count < 128 else { return Wide(high: low << (count - 128), low: 0) }
+                return Wide(high: high << count | low >> (128 - count), low: low << count)
+            }
+
+            /// `self >> count` with every shifted-out bit ORed into bit 0
+            func jammed(_ count: Int) -> Wide {
+                guard count > 0 else { return self }
+                guard count < 256 else { return Wide(high: 0, low: isZero ? 0 : 1) }
+                if count >= 128 {
+                    let lost = low != 0 || (count > 128 && high << (256 - count) != 0)
+                    return Wide(high: 0, low: high >> (count - 128) | (lost ? 1 : 0))
+                }
+                let lost = low << (128 - count) != 0
+                return Wide(high: high >> count, low: low >> count | high << (128 - count) | (lost ? 1 : 0))
+            }
+
+            static func + (lhs: Wide, rhs: Wide) -> Wide {
+                let (low, carry) = lhs.low.addingReportingOverflow(rhs.low)
+                return Wide(high: lhs.high &+ rhs.high &+ (carry ? 1 : 0), low: low)
+            }
+
+            static func - (lhs: Wide, rhs: Wide) -> Wide {
+                let (low, borrow) = lhs.low.subtractingReportingOverflow(rhs.low)
+                return Wide(high: lhs.high &- rhs.high &- (borrow ? 1 : 0), low: low)
+            }
+
+            static func < (lhs: Wide, rhs: Wide) -> Bool {
+                lhs.high < rhs.high || (lhs.high == rhs.high && lhs.low < rhs.low)
+            }
+        }
+
+        /// Rounds `±lhs × 2^lhsExponent ± rhs × 2^rhsExponent`
+        ///
+        /// Both significands must have their leading bit at 252 or 253, so the
+        /// aligned sum cannot overflow 256 bits. An exact zero is +0.
+        static func sum(
+            _ lhsNegative: Bool,
+            _ lhsExponent: Int,
+            _ lhs: Wide,
+            _ rhsNegative: Bool,
+            _ rhsExponent: Int,
+            _ rhs: Wide
+        ) -> UInt128 {
+            var (xNegative, xExponent, x) = (lhsNegative, lhsExponent, lhs)
+            var (yNegative, yExponent, y) = (rhsNegative, rhsExponent, rhs)
+            if xExponent < yExponent {
+                swap(&xNegative, &yNegative)
+                swap(&xExponent, &yExponent)
+                swap(&x, &y)
+            }
+            y = y.jammed(xExponent - yExponent)
+
+            let total: Wide
+            let negative: Bool
+            if xNegative == yNegative {
+                total = x + y
+                negative = xNegative
+            } else if x < y {
+                total = y - x
+                negative = yNegative
+            } else {
+                total = x - y
+                negative = xNegative
+            }
+            guard !total.isZero else { return 0 }
+
+            let shift = total.leadingZeroBitCount
+            let normalized = total.shiftedLeft(shift)
+            return pack(
+                negative: negative,
+                exponent: xExponent + 255 - shift,
+                significand: normalized.high,
+                sticky: normalized.low != 0
+            )
+        }
+
+        // MARK: Operations
+
+        static func add(_ a: UInt128, _ b: UInt128) -> UInt128 {
+            if isNaN(a) { return quieted(a) }
+            if isNaN(b) { return quieted(b) }
+            if isInfinite(a) {
+                return isInfinite(b) && isNegative(a) != isNegative(b) ? defaultNaN : a
+            }
+            if isInfinite(b) { return b }
+            if isZero(a) { return isZero(b) ? a & b : b }
+            if isZero(b) { return a }
+
+            let (ea, ma) = unpack(a)
+            let (eb, mb) = unpack(b)
+            return sum(
+                isNegative(a), ea - 253, Wide(high: ma << 13, low: 0),
+                isNegative(b), eb - 253, Wide(high: mb << 13, low: 0)
+            )
+        }
+
+        static func subtract(_ a: UInt128, _ b: UInt128) -> UInt128 {
+            add(a, isNaN(b) ? b : b ^ signMask)
+        }
+
+        static func multiply(_ a: UInt128, _ b: UInt128) -> UInt128 {
+            let negative = isNegative(a) != isNegative(b)
+            let sign = negative ? signMask : 0
+            if isNaN(a) { return quieted(a) }
+            if isNaN(b) { return quieted(b) }
+            if isInfinite(a) || isInfinite(b) {
+                return isZero(a) || isZero(b) ? defaultNaN : sign | exponentMask
+            }
+            if isZero(a) || isZero(b) { return sign }
+
+            let (ea, ma) = unpack(a)
+            let (eb, mb) = unpack(b)
+            let (high, low) = ma.multipliedFullWidth(by: mb)
+            let product = Wide(high: high, low: low)
+            let shift = product.leadingZeroBitCount
+            let normalized = product.shiftedLeft(shift)
+            return pack(
+                negative: negative,
+                exponent: ea + eb + 31 - shift,
+                significand: normalized.high,
+                sticky: normalized.low != 0
+            )
+        }
+
+        static func divide(_ a: UInt128, _ b: UInt128) -> UInt128 {
+            let negative = isNegative(a) != isNegative(b)
+            let sign = negative ? signMask : 0
+            if isNaN(a) { return quieted(a) }
+            if isNaN(b) { return quieted(b) }
+            if isInfinite(a) { return isInfinite(b) ? defaultNaN : sign | exponentMask }
+            if isInfinite(b) { return sign }
+            if isZero(b) { return isZero(a) ? defaultNaN : sign | exponentMask }
+            if isZero(a) { return sign }
+
+            // ma × 2^127 / mb lies in (2^126, 2^128)
+            let (ea, ma) = unpack(a)
+            let (eb, mb) = unpack(b)
+            let (quotient, remainder) = mb.dividingFullWidth((high: ma >> 1, low: ma << 127))
+            let shift = quotient.leadingZeroBitCount
+            return pack(
+                negative: negative,
+                exponent: ea - eb - shift,
+                significand: quotient << shift,
+                sticky: remainder != 0
+            )
+        }
+
+        static func squareRoot(_ a: UInt128) -> UInt128 {
+            if isNaN(a) { return quieted(a) }
+            if isZero(a) { return a }
+            if isNegative(a) { return defaultNaN }
+            if isInfinite(a) { return a }
+
+            // a = m × 2^scale; widen m by an exponent of matching parity so the
+            // root has 118 or 119 bits and the remainder stays within 128 bits
+            let (exponent, significand) = unpack(a)
+            let scale = exponent - 112
+            let widen = (scale - 124) & 1 == 0 ? 124 : 125
+            let radicand = Wide(high: 0, low: significand).shiftedLeft(widen)
+
+            var root: UInt128 = 0
+            var remainder: UInt128 = 0
+            for pair in stride(from: 127, through: 0, by: -1) {
+                let bits =
+                    pair >= 64
+                    ? radicand.high >> (2 * (pair - 64)) & 3
+                    : radicand.low >> (2 * pair) & 3
+                remainder = remainder << 2 | bits
+                let trial = root << 2 | 1
+                if remainder >= trial {
+                    remainder -= trial
+                    root = root << 1 | 1
+                } else {
+                    root <<= 1
+                }
+            }
+
+            let shift = root.leadingZeroBitCount
+            return pack(
+                negative: false,
+                exponent: (scale - widen) / 2 + 127 - shift,
+                significand: root << shift,
+                sticky: remainder != 0
+            )
+        }
+
+        static func fusedMultiplyAdd(_ a: UInt128, _ b: UInt128, _ c: UInt128) -> UInt128 {
+            if isNaN(a) { return quieted(a) }
+            if isNaN(b) { return quieted(b) }
+            if isNaN(c) { return quieted(c) }
+            let productNegative = isNegative(a) != isNegative(b)
+            if isInfinite(a) || isInfinite(b) {
+                if isZero(a) || isZero(b) { return defaultNaN }
+                if isInfinite(c) && isNegative(c) != productNegative { return defaultNaN }
+                return (productNegative ? signMask : 0) | exponentMask
+            }
+            if isInfinite(c) { return c }
+            if isZero(a) || isZero(b) { return add(productNegative ? signMask : 0, c) }
+            if isZero(c) { return multiply(a, b) }
+
+            // The exact 226-bit product against the addend, both near bit 253
+            let (ea, ma) = unpack(a)
+            let (eb, mb) = unpack(b)
+            let (ec, mc) = unpack(c)
+            let (high, low) = ma.multipliedFullWidth(by: mb)
+            return sum(
+                productNegative, ea + eb - 252, Wide(high: high, low: low).shiftedLeft(28),
+                isNegative(c), ec - 253, Wide(high: mc << 13, low: 0)
+            )
+        }
+
+        // MARK: Conversions
+
+        static func fromDouble(_ value: Double) -> UInt128 {
+            let bits = value.bitPattern
+            let sign: UInt128 = bits >> 63 == 0 ? 0 : signMask
+            let biased = Int(bits >> 52) & 0x7FF
+            let fraction = bits & (1 << 52 - 1)
+
+            if biased == 0x7FF {
+                // NaN payloads keep their position, quiet bit included
+                return sign | exponentMask | UInt128(fraction) << 60
+            }
+            if biased == 0 && fraction == 0 { return sign }
+
+            var exponent = biased - 1023
+            var significand = fraction
+            if biased == 0 {
+                let shift = fraction.leadingZeroBitCount - 11
+                significand = fraction << shift & (1 << 52 - 1)
+                exponent = -1022 - shift
+            }
+            return sign | UInt128(exponent + bias) << 112 | UInt128(significand) << 60
+        }
+
+        static func toDouble(_ bits: UInt128) -> Double {
+            let negative = isNegative(bits)
+            let sign: UInt64 = negative ? 1 << 63 : 0
+            if isNaN(bits) {
+                let payload = UInt64(truncatingIfNeeded: (bits & fractionMask) >> 60)
+                return Double(bitPattern: sign | 0x7FF << 52 | 1 << 51 | payload)
+            }
+            if isInfinite(bits) { return negative ? -.infinity : .infinity }
+            if isZero(bits) { return negative ? -0.0 : 0.0 }
+
+            let (exponent, significand) = unpack(bits)
+            if exponent > 1023 { return negative ? -.infinity : .infinity }
+
+            // Keep 53 bits (fewer below the binary64 normal range) plus a round bit and a sticky bit
+            let shift = 60 + max(0, -1022 - exponent)
+            let rounding = jammed(significand, shift - 2)
+            var kept = rounding >> 2
+            let dropped = rounding & 3
+            if dropped > 2 || (dropped == 2 && kept & 1 == 1) {
+                kept += 1
+            }
+            return Double(
+                sign: negative ? .minus : .plus,
+                exponent: exponent - 112 + shift,
+                significand: Double(UInt64(truncatingIfNeeded: kept))
+            )
+        }
+
+        static func fromInteger(_ value: Int) -> UInt128 {
+            guard value != 0 else { return 0 }
+            let sign: UInt128 = value < 0 ? signMask : 0
+            let magnitude = value.magnitude
+            let exponent = UInt.bitWidth - 1 - magnitude.leadingZeroBitCount
+            let significand = UInt128(magnitude) << (112 - exponent)
+            return sign | UInt128(exponent + bias) << 112 | significand & fractionMask
+        }
+
+        // MARK: Comparison
+
+        /// Key whose unsigned order is the numeric order of non-NaN encodings
+        static func orderKey(_ bits: UInt128) -> UInt128 {
+            isNegative(bits) ? ~bits : bits | signMask
+        }
+
+        /// Whether `a < b`; false when either is NaN, and -0 equals +0
+        static func isLess(_ a: UInt128, _ b: UInt128) -> Bool {
+            if isNaN(a) || isNaN(b) { return false }
+            if isZero(a) && isZero(b) { return false }
+            return orderKey(a) < orderKey(b)
+        }
+
+        static func isEqual(_ a: UInt128, _ b: UInt128) -> Bool {
+            if isNaN(a) || isNaN(b) { return false }
+            return a == b || (isZero(a) && isZero(b))
+        }
+    }
+}
+
+// MARK: - Native Fast Path
+
+#if canImport(CIEEE754)
+    extension IEEE_754.Binary128 {
+        /// Whether arithmetic uses the compiler's quad type through CIEEE754
+        ///
+        /// Either way results are rounded to nearest even regardless of the
+        /// rounding mode, and no exception flags are raised.
+        internal static var isNative: Bool { IEEE754_BINARY128_NATIVE != 0 }
+
+        internal init(_ value: IEEE754Binary128) {
+            self.init(high: value.high, low: value.low)
+        }
+
+        internal var native: IEEE754Binary128 {
+            IEEE754Binary128(low: low, high: high)
+        }
+    }
+#endif
+
+// MARK: - Conversions
+
+extension IEEE_754.Binary128 {
+    /// Creates the binary128 value equal to a Double - IEEE 754 `convertFormat`
+    ///
+    /// Exact: every binary64 value (NaN payloads included) is representable.
+    ///
+    /// - Parameter value: The value to widen
+    public init(_ value: Double) {
+        self.init(bitPattern: Software.fromDouble(value))
+    }
+
+    /// Creates the binary128 value equal to a Float - IEEE 754 `convertFormat`
+    ///
+    /// - Parameter value: The value to widen (exact)
+    public init(_ value: Float) {
+        self.init(Double(value))
+    }
+
+    /// Creates the binary128 value equal to an integer - IEEE 754 `convertFromInt`
+    ///
+    /// Exact for every `Int`: 64 bits fit in binary128's 113-bit significand.
+    ///
+    /// - Parameter value: The integer to convert
+    public init(_ value: Int) {
+        self.init(bitPattern: Software.fromInteger(value))
+    }
+}
+
+extension IEEE_754.Binary128: ExpressibleByIntegerLiteral {
+    public init(integerLiteral value: Int) {
+        self.init(value)
+    }
+}
+
+extension Double {
+    /// Narrows a binary128 value to Double - IEEE 754 `convertFormat`
+    ///
+    /// Rounds to nearest, ties to even. Signaling NaNs become quiet NaNs.
+    ///
+    /// - Parameter value: The value to narrow
+    public init(_ value: IEEE_754.Binary128) {
+        self = IEEE_754.Binary128.Software.toDouble(value.bitPattern)
+    }
+}
+
+// MARK: - Arithmetic
+
+extension IEEE_754.Binary128 {
+    /// Addition - IEEE 754 `addition`, rounded to nearest even
+    public static func + (lhs: Self, rhs: Self) -> Self {
+        #if canImport(CIEEE754)
+            if isNative { return Self(ieee754_binary128_add(lhs.native, rhs.native)) }
+        #endif
+        return Self(bitPattern: Software.add(lhs.bitPattern, rhs.bitPattern))
+    }
+
+    /// Subtraction - IEEE 754 `subtraction`, rounded to nearest even
+    public static func - (lhs: Self, rhs: Self) -> Self {
+        #if canImport(CIEEE754)
+            if isNative { return Self(ieee754_binary128_sub(lhs.native, rhs.native)) }
+        #endif
+        return Self(bitPattern: Software.subtract(lhs.bitPattern, rhs.bitPattern))
+    }
+
+    /// Multiplication - IEEE 754 `multiplication`, rounded to nearest even
+    public static func * (lhs: Self, rhs: Self) -> Self {
+        #if canImport(CIEEE754)
+            if isNative { return Self(ieee754_binary128_mul(lhs.native, rhs.native)) }
+        #endif
+        return Self(bitPattern: Software.multiply(lhs.bitPattern, rhs.bitPattern))
+    }
+
+    /// Division - IEEE 754 `division`, rounded to nearest even
+    public static func / (lhs: Self, rhs: Self) -> Self {
+        #if canImport(CIEEE754)
+            if isNative { return Self(ieee754_binary128_div(lhs.native, rhs.native)) }
+        #endif
+        return Self(bitPattern: Software.divide(lhs.bitPattern, rhs.bitPattern))
+    }
+
+    /// Negation - IEEE 754 `negate` (flips the sign bit, NaNs included)
+    @inlinable
+    public static prefix func - (operand: Self) -> Self {
+        Self(bitPattern: operand.bitPattern ^ signMask)
+    }
+
+    public static func += (lhs: inout Self, rhs: Self) { lhs = lhs + rhs }
+    public static func -= (lhs: inout Self, rhs: Self) { lhs = lhs - rhs }
+    public static func *= (lhs: inout Self, rhs: Self) { lhs = lhs * rhs }
+    public static func /= (lhs: inout Self, rhs: Self) { lhs = lhs / rhs }
+
+    /// Square root - IEEE 754 `squareRoot`, rounded to nearest even
+    ///
+    /// Always computed in software: the quad-precision libm routines are not
+    /// correctly rounded on every platform.
+    public func squareRoot() -> Self {
+        Self(bitPattern: Software.squareRoot(bitPattern))
+    }
+
+    /// Fused multiply-add - IEEE 754 `fusedMultiplyAdd`
+    ///
+    /// Computes `self + lhs × rhs` with a single rounding to nearest even.
+    ///
+    /// - Parameters:
+    ///   - lhs: First multiplicand
+    ///   - rhs: Second multiplicand
+    /// - Returns: `self + lhs × rhs`, rounded once
+    public func addingProduct(_ lhs: Self, _ rhs: Self) -> Self {
+        Self(bitPattern: Software.fusedMultiplyAdd(lhs.bitPattern, rhs.bitPattern, bitPattern))
+    }
+}
+
+extension IEEE_754.Arithmetic {
+    /// Addition - IEEE 754 addition operation on binary128
+    public static func addition(_ lhs: IEEE_754.Binary128, _ rhs: IEEE_754.Binary128) -> IEEE_754.Binary128 {
+        lhs + rhs
+    }
+
+    /// Subtraction - IEEE 754 subtraction operation on binary128
+    public static func subtraction(_ lhs: IEEE_754.Binary128, _ rhs: IEEE_754.Binary128) -> IEEE_754.Binary128 {
+        lhs - rhs
+    }
+
+    /// Multiplication - IEEE 754 multiplication operation on binary128
+    public static func multiplication(_ lhs: IEEE_754.Binary128, _ rhs: IEEE_754.Binary128) -> IEEE_754.Binary128 {
+        lhs * rhs
+    }
+
+    /// Division - IEEE 754 division operation on binary128
+    public static func division(_ lhs: IEEE_754.Binary128, _ rhs: IEEE_754.Binary128) -> IEEE_754.Binary128 {
+        lhs / rhs
+    }
+
+    /// Square root - IEEE 754 squareRoot operation on binary128
+    public static func squareRoot(_ value: IEEE_754.Binary128) -> IEEE_754.Binary128 {
+        value.squareRoot()
+    }
+
+    /// Fused multiply-add - IEEE 754 fusedMultiplyAdd operation on binary128
+    ///
+    /// - Returns: `(a × b) + c` with a single rounding
+    public static func fusedMultiplyAdd(
+        a: IEEE_754.Binary128,
+        b: IEEE_754.Binary128,
+        c: IEEE_754.Binary128
+    ) -> IEEE_754.Binary128 {
+        c.addingProduct(a, b)
+    }
+}
+
+// MARK: - Comparison
+
+extension IEEE_754.Binary128: Equatable, Comparable {
+    /// IEEE 754 `compareQuietEqual`: NaN is unequal to everything, and -0 == +0
+    public static func == (lhs: Self, rhs: Self) -> Bool {
+        Software.isEqual(lhs.bitPattern, rhs.bitPattern)
+    }
+
+    /// IEEE 754 `compareQuietLess`: false when either operand is NaN
+    public static func < (lhs: Self, rhs: Self) -> Bool {
+        Software.isLess(lhs.bitPattern, rhs.bitPattern)
+    }
+
+    public static func <= (lhs: Self, rhs: Self) -> Bool {
+        lhs < rhs || lhs == rhs
+    }
+
+    public static func > (lhs: Self, rhs: Self) -> Bool {
+        rhs < lhs
+    }
+
+    public static func >= (lhs: Self, rhs: Self) -> Bool {
+        rhs < lhs || lhs == rhs
+    }
+}
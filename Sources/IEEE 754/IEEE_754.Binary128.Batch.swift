@@ -0,0 +1,180 @@
+// IEEE_754.Binary128.Batch.swift
+// swift-ieee-754
+//
+// Bulk binary128 accumulation and element-wise arithmetic
+
+#if canImport(CIEEE754)
+    import CIEEE754
+#endif
+
+// MARK: - Accumulation
+
+extension IEEE_754.Binary128 {
+    /// Sums Doubles in binary128
+    ///
+    /// Accumulates left to right with each addition rounded to binary128.
+    /// With 113 bits of significand, sums of many binary64 values keep
+    /// roughly 60 more bits than a Double accumulator, so ledgers balance
+    /// to the cent long after a Double total has drifted. The loop runs in
+    /// one C call where the compiler provides a quad type.
+    ///
+    /// - Parameter values: The values to add
+    /// - Returns: The binary128 sum (`+0` for an empty buffer)
+    ///
+    /// Example:
+    /// ```swift
+    /// let total = IEEE_754.Binary128.sum(amounts)
+    /// let rounded = Double(total)
+    /// ```
+    public static func sum(_ values: UnsafeBufferPointer<Double>) -> Self {
+        guard let base = values.baseAddress else { return .zero }
+        #if canImport(CIEEE754)
+            if isNative { return Self(ieee754_binary128_sum_f64(base, values.count)) }
+        #endif
+        var total: UInt128 = 0
+        for index in 0..<values.count {
+            total = Software.add(total, Software.fromDouble(base[index]))
+        }
+        return Self(bitPattern: total)
+    }
+
+    /// Sums binary128 values, left to right
+    ///
+    /// - Parameter values: The values to add
+    /// - Returns: The binary128 sum (`+0` for an empty buffer)
+    public static func sum(_ values: UnsafeBufferPointer<Self>) -> Self {
+        guard let base = values.baseAddress else { return .zero }
+        #if canImport(CIEEE754)
+            if isNative {
+                return base.withMemoryRebound(to: IEEE754Binary128.self, capacity: values.count) {
+                    Self(ieee754_binary128_sum($0, values.count))
+                }
+            }
+        #endif
+        var total: UInt128 = 0
+        for index in 0..<values.count {
+            total = Software.add(total, base[index].bitPattern)
+        }
+        return Self(bitPattern: total)
+    }
+
+    /// Dot product of Doubles, accumulated in binary128
+    ///
+    /// A product of two binary64 values has at most 106 significant bits
+    /// and is exact in binary128, so only the accumulation rounds: price ×
+    /// quantity ledgers come out as if summed with 113-bit precision.
+    ///
+    /// - Parameters:
+    ///   - x: First factors
+    ///   - y: Second factors, same count as `x`
+    /// - Returns: `Σ x[i] × y[i]` in binary128
+    public static func dot(_ x: UnsafeBufferPointer<Double>, _ y: UnsafeBufferPointer<Double>) -> Self {
+        precondition(x.count == y.count, "Operand buffers differ in length")
+        guard let xs = x.baseAddress, let ys = y.baseAddress else { return .zero }
+        #if canImport(CIEEE754)
+            if isNative { return Self(ieee754_binary128_dot_f64(xs, ys, x.count)) }
+        #endif
+        var total: UInt128 = 0
+        for index in 0..<x.count {
+            let product = Software.multiply(Software.fromDouble(xs[index]), Software.fromDouble(ys[index]))
+            total = Software.add(total, product)
+        }
+        return Self(bitPattern: total)
+    }
+
+    /// Sums Doubles in binary128
+    ///
+    /// - Parameter values: The values to add
+    /// - Returns: The binary128 sum
+    public static func sum(_ values: [Double]) -> Self {
+        values.withUnsafeBufferPointer { sum($0) }
+    }
+
+    /// Sums binary128 values, left to right
+    ///
+    /// - Parameter values: The values to add
+    /// - Returns: The binary128 sum
+    public static func sum(_ values: [Self]) -> Self {
+        values.withUnsafeBufferPointer { sum($0) }
+    }
+
+    /// Dot product of Doubles, accumulated in binary128
+    ///
+    /// - Parameters:
+    ///   - x: First factors
+    ///   - y: Second factors, same count as `x`
+    /// - Returns: `Σ x[i] × y[i]` in binary128
+    public static func dot(_ x: [Double], _ y: [Double]) -> Self {
+        x.withUnsafeBufferPointer { x in
+            y.withUnsafeBufferPointer { y in dot(x, y) }
+        }
+    }
+}
+
+// MARK: - Element-wise Operations
+
+extension IEEE_754.Binary128 {
+    /// Element-wise `result[i] = lhs[i] + rhs[i]`
+    ///
+    /// - Parameters:
+    ///   - lhs: Left operands
+    ///   - rhs: Right operands, at least `lhs.count` of them
+    ///   - result: Storage for at least `lhs.count` results
+    public static func addition(
+        _ lhs: UnsafeBufferPointer<Self>,
+        _ rhs: UnsafeBufferPointer<Self>,
+        into result: UnsafeMutableBufferPointer<Self>
+    ) {
+        precondition(rhs.count >= lhs.count, "Operand buffers differ in length")
+        precondition(result.count >= lhs.count, "Result buffer is too small")
+        guard let x = lhs.baseAddress, let y = rhs.baseAddress, let z = result.baseAddress else { return }
+        #if canImport(CIEEE754)
+            if isNative {
+                let count = lhs.count
+                x.withMemoryRebound(to: IEEE754Binary128.self, capacity: count) { x in
+                    y.withMemoryRebound(to: IEEE754Binary128.self, capacity: count) { y in
+                        z.withMemoryRebound(to: IEEE754Binary128.self, capacity: count) { z in
+                            ieee754_binary128_add_array(x, y, z, count)
+                        }
+                    }
+                }
+                return
+            }
+        #endif
+        for index in 0..<lhs.count {
+            z[index] = Self(bitPattern: Software.add(x[index].bitPattern, y[index].bitPattern))
+        }
+    }
+
+    /// Element-wise `result[i] = lhs[i] × rhs[i]`
+    ///
+    /// - Parameters:
+    ///   - lhs: Left operands
+    ///   - rhs: Right operands, at least `lhs.count` of them
+    ///   - result: Storage for at least `lhs.count` results
+    public static func multiplication(
+        _ lhs: UnsafeBufferPointer<Self>,
+        _ rhs: UnsafeBufferPointer<Self>,
+        into result: UnsafeMutableBufferPointer<Self>
+    ) {
+        precondition(rhs.count >= lhs.count, "Operand buffers differ in length")
+        precondition(result.count >= lhs.count, "Result buffer is too small")
+        guard let x = lhs.baseAddress, let y = rhs.baseAddress, let z = result.baseAddress else { return }
+        #if canImport(CIEEE754)
+            if isNative {
+                let count = lhs.count
+                x.withMemoryRebound(to: IEEE754Binary128.self, capacity: count) { x in
+                    y.withMemoryRebound(to: IEEE754Binary128.self, capacity: count) { y in
+                        z.withMemoryRebound(to: IEEE754Binary128.self, capacity: count) { z in
+                            ieee754_binary128_mul_array(x, y, z, count)
+                        }
+                    }
+                }
+                return
+            }
+        #endif
+        for index in 0..<lhs.count {
+            z[index] = Self(bitPattern: Software.multiply(x[index].bitPattern, y[index].bitPattern))
+        }
+    }
+}
@@ -2,7 +2,7 @@
 // swift-ieee-754
 //
 // IEEE 754-2019: Binary128 (Quadruple Precision) Format
-// Format specification and constants (no native Swift type available)
+// Storage type, format specification and constants
 
 import Standards
 
@@ -40,13 +40,36 @@ extension IEEE_754 {
     /// approximately 34 decimal digits of precision. This is the largest
     /// standard binary interchange format defined by IEEE 754-2019.
     ///
-    /// **Note**: Swift does not currently provide a native binary128 type.
-    /// This namespace documents the format specification for reference and
-    /// future compatibility.
+    /// Swift has no native binary128 type, so `Binary128` stores the encoding
+    /// as two `UInt64` halves. Arithmetic rounds to nearest, ties to even, and
+    /// uses the compiler's quad type through CIEEE754 where the target has
+    /// one, with a software implementation everywhere else.
+    ///
+    /// Example:
+    /// ```swift
+    /// var balance = IEEE_754.Binary128(0)
+    /// for entry in ledger {
+    ///     balance += IEEE_754.Binary128(entry)
+    /// }
+    /// let rounded = Double(balance)
+    /// ```
     ///
     /// ## See Also
     /// - IEEE 754-2019 Section 3.6, Table 3.5
-    public enum Binary128 {
+    public struct Binary128: Sendable {
+        /// Low 64 bits of the encoding (fraction bits 0...63)
+        public let low: UInt64
+
+        /// High 64 bits of the encoding (sign, exponent, fraction bits 64...111)
+        public let high: UInt64
+
+        /// Creates a value from the two halves of its encoding
+        @inlinable
+        public init(high: UInt64, low: UInt64) {
+            self.high = high
+            self.low = low
+        }
+
         /// Number of bytes in binary128 format (16)
         public static let byteSize: Int = 16
 
@@ -57,10 +80,12 @@ extension IEEE_754 {
         public static let signBits: Int = 1
 
         /// Exponent bits: 15 bits
-        public static let exponentBits: Int = 15
+        @inlinable
+        public static var exponentBits: Int { 15 }
 
         /// Significand bits: 112 bits (plus implicit leading 1)
-        public static let significandBits: Int = 112
+        @inlinable
+        public static var significandBits: Int { 112 }
 
         /// Exponent bias: 16383
         public static let exponentBias: Int = 16383
@@ -112,9 +137,139 @@ extension IEEE_754.Binary128 {
     /// - Quiet NaN: exponent = 32767, fraction ≠ 0, MSB of fraction = 1
     /// - Signaling NaN: exponent = 32767, fraction ≠ 0, MSB of fraction = 0
     ///
-    /// **Note**: No Swift type is currently available for binary128.
+    /// Each is available as a constant on ``IEEE_754/Binary128``, such as
+    /// ``IEEE_754/Binary128/infinity`` and ``IEEE_754/Binary128/signalingNaN``.
     ///
     /// ## See Also
     /// - IEEE 754-2019 Section 6.2: Special values
     public enum SpecialValuesDocumentation {}
 }
+
+// MARK: - Encoding
+
+extension IEEE_754.Binary128 {
+    /// The 128-bit encoding
+    @inlinable
+    public var bitPattern: UInt128 {
+        UInt128(high) << 64 | UInt128(low)
+    }
+
+    /// Creates a value from its 128-bit encoding
+    @inlinable
+    public init(bitPattern: UInt128) {
+        self.init(high: UInt64(truncatingIfNeeded: bitPattern >> 64), low: UInt64(truncatingIfNeeded: bitPattern))
+    }
+
+    @usableFromInline
+    internal static let signMask: UInt128 = 1 << 127
+
+    @usableFromInline
+    internal static let exponentMask: UInt128 = 0x7FFF << 112
+
+    @usableFromInline
+    internal static let fractionMask: UInt128 = (1 << 112) - 1
+
+    @usableFromInline
+    internal static let quietBit: UInt128 = 1 << 111
+
+    /// The biased exponent field
+    @inlinable
+    public var exponentBitPattern: UInt {
+        UInt(truncatingIfNeeded: high >> 48) & 0x7FFF
+    }
+
+    /// The 112-bit fraction field
+    @inlinable
+    public var significandBitPattern: UInt128 {
+        bitPattern & Self.fractionMask
+    }
+}
+
+// MARK: - Constants
+
+extension IEEE_754.Binary128 {
+    /// Positive zero
+    public static let zero = Self(bitPattern: 0)
+
+    /// One
+    public static let one = Self(bitPattern: UInt128(exponentBias) << 112)
+
+    /// Positive infinity
+    public static let infinity = Self(bitPattern: exponentMask)
+
+    /// The default quiet NaN
+    public static let nan = Self(bitPattern: exponentMask | quietBit)
+
+    /// A signaling NaN (payload 1)
+    public static let signalingNaN = Self(bitPattern: exponentMask | 1)
+
+    /// Largest finite value: (2 − 2⁻¹¹²) × 2¹⁶³⁸³
+    public static let greatestFiniteMagnitude = Self(bitPattern: (exponentMask - (1 << 112)) | fractionMask)
+
+    /// Smallest positive normal value: 2⁻¹⁶³⁸²
+    public static let leastNormalMagnitude = Self(bitPattern: 1 << 112)
+
+    /// Smallest positive subnormal value: 2⁻¹⁶⁴⁹⁴
+    public static let leastNonzeroMagnitude = Self(bitPattern: 1)
+
+    /// Distance from one to the next larger value: 2⁻¹¹²
+    public static let ulpOfOne = Self(bitPattern: UInt128(exponentBias - significandBits) << 112)
+}
+
+// MARK: - Classification
+
+extension IEEE_754.Binary128 {
+    /// The sign of the value, including for zeros and NaNs
+    @inlinable
+    public var sign: FloatingPointSign {
+        high >> 63 == 0 ? .plus : .minus
+    }
+
+    /// Whether the value is NaN
+    @inlinable
+    public var isNaN: Bool {
+        bitPattern & ~Self.signMask > Self.exponentMask
+    }
+
+    /// Whether the value is a signaling NaN
+    @inlinable
+    public var isSignalingNaN: Bool {
+        isNaN && bitPattern & Self.quietBit == 0
+    }
+
+    /// Whether the value is ±∞
+    @inlinable
+    public var isInfinite: Bool {
+        bitPattern & ~Self.signMask == Self.exponentMask
+    }
+
+    /// Whether the value is zero, subnormal or normal
+    @inlinable
+    public var isFinite: Bool {
+        bitPattern & Self.exponentMask != Self.exponentMask
+    }
+
+    /// Whether the value is ±0
+    @inlinable
+    public var isZero: Bool {
+        bitPattern & ~Self.signMask == 0
+    }
+
+    /// Whether the value is subnormal
+    @inlinable
+    public var isSubnormal: Bool {
+        exponentBitPattern == 0 && !isZero
+    }
+
+    /// Whether the value is normal
+    @inlinable
+    public var isNormal: Bool {
+        exponentBitPattern != 0 && isFinite
+    }
+
+    /// The absolute value
+    @inlinable
+    public var magnitude: Self {
+        Self(bitPattern: bitPattern & ~Self.signMask)
+    }
+}
@@ -0,0 +1,227 @@
+// IEEE_754.Binary16.Batch.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 5.4: Element-wise binary16 arithmetic and conversions over buffers
+
+#if canImport(CIEEE754)
+    import CIEEE754
+
+    // MARK: - Conversions
+
+    extension IEEE_754.Binary16 {
+        /// Whether the batch arithmetic runs in native binary16 instructions
+        ///
+        /// True with AVX512-FP16 (checked at runtime) or ARMv8.2 FP16 vector
+        /// arithmetic. Otherwise the kernels widen to binary32 with F16C or
+        /// NEON, or compute in software. Results are the same on every path.
+        public static var hasNativeArithmetic: Bool {
+            ieee754_binary16_native_arithmetic() != 0
+        }
+
+        /// Widens binary16 bit patterns to Float in bulk - IEEE 754 `convertFormat`
+        ///
+        /// Exact. Signaling NaNs become quiet NaNs and signal invalid.
+        ///
+        /// Flags are reported once per batch: the returned set lists every
+        /// exception that occurred, and each is raised once (hardware and
+        /// thread-local) however many elements signaled it.
+        ///
+        /// - Parameters:
+        ///   - source: binary16 encodings
+        ///   - destination: Storage for at least `source.count` results
+        /// - Returns: The exceptions signaled by the batch
+        @discardableResult
+        public static func widen(
+            _ source: UnsafeBufferPointer<UInt16>,
+            into destination: UnsafeMutableBufferPointer<Float>
+        ) -> IEEE_754.Exceptions.FlagSet {
+            precondition(destination.count >= source.count, "Result buffer is too small")
+            guard let input = source.baseAddress, let output = destination.baseAddress else { return [] }
+            return IEEE_754.Exceptions.FlagSet(rawValue: ieee754_binary16_widen_array(input, output, source.count))
+        }
+
+        /// Narrows Floats to binary16 bit patterns in bulk - IEEE 754 `convertFormat`
+        ///
+        /// Rounds to nearest, ties to even. Same kernel as
+        /// `IEEE_754.Conversions.floatToBinary16(_:into:)`, which also reports
+        /// per-exception element counts.
+        ///
+        /// - Parameters:
+        ///   - source: The values to narrow
+        ///   - destination: Storage for at least `source.count` encodings
+        /// - Returns: The exceptions signaled by the batch
+        @discardableResult
+        public static func narrow(
+            _ source: UnsafeBufferPointer<Float>,
+            into destination: UnsafeMutableBufferPointer<UInt16>
+        ) -> IEEE_754.Exceptions.FlagSet {
+            IEEE_754.Conversions.floatToBinary16(source, into: destination).flags
+        }
+    }
+
+    // MARK: - Arithmetic
+
+    extension IEEE_754.Binary16 {
+        /// Element-wise addition of binary16 bit patterns - IEEE 754 `addition`
+        ///
+        /// `result[i] = lhs[i] + rhs[i]`, each correctly rounded to nearest
+        /// with ties to even, whatever the current rounding mode. The batch
+        /// reads and writes binary16 directly, so no Float copy of the
+        /// operands is made. `result` may be one of the operand buffers.
+        ///
+        /// A NaN operand propagates, quieted; invalid operations without a
+        /// NaN operand produce the default quiet NaN, whose sign is
+        /// unspecified.
+        ///
+        /// - Parameters:
+        ///   - lhs: First operands
+        ///   - rhs: Second operands, same count as `lhs`
+        ///   - result: Storage for at least `lhs.count` results
+        /// - Returns: The exceptions signaled by the batch
+        ///
+        /// Example:
+        /// ```swift
+        /// let flags = IEEE_754.Binary16.addition(logits, bias, into: output)
+        /// if flags.contains(.overflow) {
+        ///     // Some sums exceeded 65504
+        /// }
+        /// ```
+        @discardableResult
+        public static func addition(
+            _ lhs: UnsafeBufferPointer<UInt16>,
+            _ rhs: UnsafeBufferPointer<UInt16>,
+            into result: UnsafeMutableBufferPointer<UInt16>
+        ) -> IEEE_754.Exceptions.FlagSet {
+            precondition(lhs.count == rhs.count, "Operand buffers differ in length")
+            precondition(result.count >= lhs.count, "Result buffer is too small")
+            guard let a = lhs.baseAddress, let b = rhs.baseAddress, let output = result.baseAddress else { return [] }
+            return IEEE_754.Exceptions.FlagSet(rawValue: ieee754_binary16_add_array(a, b, output, lhs.count))
+        }
+
+        /// Element-wise multiplication of binary16 bit patterns - IEEE 754 `multiplication`
+        ///
+        /// Same contract as ``addition(_:_:into:)``.
+        @discardableResult
+        public static func multiplication(
+            _ lhs: UnsafeBufferPointer<UInt16>,
+            _ rhs: UnsafeBufferPointer<UInt16>,
+            into result: UnsafeMutableBufferPointer<UInt16>
+        ) -> IEEE_754.Exceptions.FlagSet {
+            precondition(lhs.count == rhs.count, "Operand buffers differ in length")
+            precondition(result.count >= lhs.count, "Result buffer is too small")
+            guard let a = lhs.baseAddress, let b = rhs.baseAddress, let output = result.baseAddress else { return [] }
+            return IEEE_754.Exceptions.FlagSet(rawValue: ieee754_binary16_mul_array(a, b, output, lhs.count))
+        }
+
+        /// Element-wise fused multiply-add - IEEE 754 `fusedMultiplyAdd`
+        ///
+        /// `result[i] = x[i] × y[i] + z[i]` with a single rounding. Without
+        /// native binary16 FMA the result is computed exactly in software,
+        /// since a binary32 FMA followed by narrowing can round twice.
+        /// Otherwise the same contract as ``addition(_:_:into:)``.
+        ///
+        /// - Parameters:
+        ///   - x: First factors
+        ///   - y: Second factors
+        ///   - z: Addends
+        ///   - result: Storage for at least `x.count` results
+        /// - Returns: The exceptions signaled by the batch
+        @discardableResult
+        public static func fusedMultiplyAdd(
+            _ x: UnsafeBufferPointer<UInt16>,
+            _ y: UnsafeBufferPointer<UInt16>,
+            _ z: UnsafeBufferPointer<UInt16>,
+            into result: UnsafeMutableBufferPointer<UInt16>
+        ) -> IEEE_754.Exceptions.FlagSet {
+            precondition(x.count == y.count && x.count == z.count, "Operand buffers differ in length")
+            precondition(result.count >= x.count, "Result buffer is too small")
+            guard let a = x.baseAddress, let b = y.baseAddress, let c = z.baseAddress, let output = result.baseAddress
+            else { return [] }
+            return IEEE_754.Exceptions.FlagSet(rawValue: ieee754_binary16_fma_array(a, b, c, output, x.count))
+        }
+    }
+
+    // MARK: - Float16 Storage
+
+    #if !((os(macOS) || targetEnvironment(macCatalyst)) && arch(x86_64))
+        extension IEEE_754.Binary16 {
+            /// Widens Float16 values to Float in bulk
+            ///
+            /// Same as ``widen(_:into:)`` with typed input.
+            @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+            @discardableResult
+            public static func widen(
+                _ source: UnsafeBufferPointer<Float16>,
+                into destination: UnsafeMutableBufferPointer<Float>
+            ) -> IEEE_754.Exceptions.FlagSet {
+                source.withMemoryRebound(to: UInt16.self) { widen($0, into: destination) }
+            }
+
+            /// Narrows Floats to Float16 in bulk
+            ///
+            /// Same as ``narrow(_:into:)`` with typed output.
+            @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+            @discardableResult
+            public static func narrow(
+                _ source: UnsafeBufferPointer<Float>,
+                into destination: UnsafeMutableBufferPointer<Float16>
+            ) -> IEEE_754.Exceptions.FlagSet {
+                destination.withMemoryRebound(to: UInt16.self) { narrow(source, into: $0) }
+            }
+
+            /// Element-wise addition of Float16 values
+            ///
+            /// Same as ``addition(_:_:into:)`` with typed storage.
+            @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+            @discardableResult
+            public static func addition(
+                _ lhs: UnsafeBufferPointer<Float16>,
+                _ rhs: UnsafeBufferPointer<Float16>,
+                into result: UnsafeMutableBufferPointer<Float16>
+            ) -> IEEE_754.Exceptions.FlagSet {
+                lhs.withMemoryRebound(to: UInt16.self) { a in
+                    rhs.withMemoryRebound(to: UInt16.self) { b in
+                        result.withMemoryRebound(to: UInt16.self) { addition(a, b, into: $0) }
+                    }
+                }
+            }
+
+            /// Element-wise multiplication of Float16 values
+            ///
+            /// Same as ``multiplication(_:_:into:)`` with typed storage.
+            @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+            @discardableResult
+            public static func multiplication(
+                _ lhs: UnsafeBufferPointer<Float16>,
+                _ rhs: UnsafeBufferPointer<Float16>,
+                into result: UnsafeMutableBufferPointer<Float16>
+            ) -> IEEE_754.Exceptions.FlagSet {
+                lhs.withMemoryRebound(to: UInt16.self) { a in
+                    rhs.withMemoryRebound(to: UInt16.self) { b in
+                        result.withMemoryRebound(to: UInt16.self) { multiplication(a, b, into: $0) }
+                    }
+                }
+            }
+
+            /// Element-wise fused multiply-add of Float16 values
+            ///
+            /// Same as ``fusedMultiplyAdd(_:_:_:into:)`` with typed storage.
+            @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+            @discardableResult
+            public static func fusedMultiplyAdd(
+                _ x: UnsafeBufferPointer<Float16>,
+                _ y: UnsafeBufferPointer<Float16>,
+                _ z: UnsafeBufferPointer<Float16>,
+                into result: UnsafeMutableBufferPointer<Float16>
+            ) -> IEEE_754.Exceptions.FlagSet {
+                x.withMemoryRebound(to: UInt16.self) { a in
+                    y.withMemoryRebound(to: UInt16.self) { b in
+                        z.withMemoryRebound(to: UInt16.self) { c in
+                            result.withMemoryRebound(to: UInt16.self) { fusedMultiplyAdd(a, b, c, into: $0) }
+                        }
+                    }
+                }
+            }
+        }
+    #endif
+#endif
@@ -54,10 +54,12 @@ extension IEEE_754 {
         public static let signBits: Int = 1
 
         /// Exponent bits: 5 bits
-        public static let exponentBits: Int = 5
+        @inlinable
+        public static var exponentBits: Int { 5 }
 
         /// Significand bits: 10 bits (plus implicit leading 1)
-        public static let significandBits: Int = 10
+        @inlinable
+        public static var significandBits: Int { 10 }
 
         /// Exponent bias: 15
         public static let exponentBias: Int = 15
@@ -222,8 +224,9 @@ extension IEEE_754 {
             from value: Float16,
             endianness: Binary.Endianness = .little
         ) -> [UInt8] {
-            let bitPattern = value.bitPattern
-            return [UInt8](bitPattern, endianness: endianness)
+            [UInt8](unsafeUninitializedCapacity: byteSize) { buffer, initializedCount in
+                initializedCount = write(value, into: UnsafeMutableRawBufferPointer(buffer), endianness: endianness)
+            }
         }
 
         /// Deserializes IEEE 754 binary16 bytes to Float16
@@ -264,3 +267,278 @@ extension IEEE_754 {
         }
     }
 #endif
+
+#if !((os(macOS) || targetEnvironment(macCatalyst)) && arch(x86_64))
+    // MARK: - Batch Serialization
+
+    extension IEEE_754.Binary16 {
+        /// Serializes an array of Float16s to IEEE 754 binary16 bytes
+        ///
+        /// Batch counterpart to ``bytes(from:endianness:)``. Produces
+        /// `values.count * 2` bytes in one allocation, byte-swapping with SIMD
+        /// kernels when `endianness` differs from the host byte order.
+        ///
+        /// - Parameters:
+        ///   - values: Float16s to serialize
+        ///   - endianness: Byte order (defaults to little-endian)
+        /// - Returns: Concatenated binary16 encodings of `values`
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        public static func bytes(
+            from values: [Float16],
+            endianness: Binary.Endianness = .little
+        ) -> [UInt8] {
+            values.withUnsafeBytes { source in
+                [UInt8](unsafeUninitializedCapacity: source.count) { buffer, initializedCount in
+                    if source.count > 0 {
+                        let destination = UnsafeMutableRawPointer(buffer.baseAddress!)
+                        if endianness.isHostOrder {
+                            destination.copyMemory(from: source.baseAddress!, byteCount: source.count)
+                        } else {
+                            IEEE_754.ByteOrder.swap16(values.count, from: source.baseAddress!, to: destination)
+                        }
+                    }
+                    initializedCount = source.count
+                }
+            }
+        }
+
+        /// Deserializes a contiguous run of IEEE 754 binary16 values
+        ///
+        /// Bulk counterpart to ``value(from:endianness:)``. The buffer does not
+        /// need to be aligned.
+        ///
+        /// - Parameters:
+        ///   - bytes: Raw bytes holding consecutive binary16 values
+        ///   - endianness: Byte order of input bytes (defaults to little-endian)
+        /// - Returns: Array of Float16s, or nil if bytes.count is not a multiple of 2
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        public static func values(
+            from bytes: UnsafeRawBufferPointer,
+            endianness: Binary.Endianness = .little
+        ) -> [Float16]? {
+            guard bytes.count % byteSize == 0 else { return nil }
+            let count = bytes.count / byteSize
+
+            return [Float16](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+                guard count > 0 else {
+                    initializedCount = 0
+                    return
+                }
+
+                let destination = UnsafeMutableRawPointer(buffer.baseAddress!)
+                if endianness.isHostOrder {
+                    destination.copyMemory(from: bytes.baseAddress!, byteCount: bytes.count)
+                } else {
+                    IEEE_754.ByteOrder.swap16(count, from: bytes.baseAddress!, to: destination)
+                }
+
+                initializedCount = count
+            }
+        }
+
+        /// Deserializes a byte array holding consecutive IEEE 754 binary16 values
+        ///
+        /// - Parameters:
+        ///   - bytes: Concatenated binary16 encodings
+        ///   - endianness: Byte order of input bytes (defaults to little-endian)
+        /// - Returns: Array of Float16s, or nil if bytes.count is not a multiple of 2
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        public static func values(
+            from bytes: [UInt8],
+            endianness: Binary.Endianness = .little
+        ) -> [Float16]? {
+            bytes.withUnsafeBytes { buffer in
+                values(from: buffer, endianness: endianness)
+            }
+        }
+    }
+
+    // MARK: - Buffer Serialization
+
+    extension IEEE_754.Binary16 {
+        /// Serializes a Float16 directly into caller-owned memory
+        ///
+        /// Allocation-free counterpart to ``bytes(from:endianness:)``. Stores the
+        /// 2-byte binary16 encoding of `value` at `offset` without creating an
+        /// intermediate array. The destination does not need to be aligned.
+        ///
+        /// - Parameters:
+        ///   - value: Float16 to serialize
+        ///   - buffer: Destination buffer
+        ///   - offset: Byte offset within `buffer` (defaults to 0)
+        ///   - endianness: Byte order (defaults to little-endian)
+        /// - Returns: Number of bytes written (always 2)
+        ///
+        /// - Precondition: `offset + 2 <= buffer.count`
+        ///
+        /// Example:
+        /// ```swift
+        /// var position = 0
+        /// position += IEEE_754.Binary16.write(x, into: frame, at: position, endianness: .big)
+        /// position += IEEE_754.Binary16.write(y, into: frame, at: position, endianness: .big)
+        /// ```
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        @discardableResult
+        public static func write(
+            _ value: Float16,
+            into buffer: UnsafeMutableRawBufferPointer,
+            at offset: Int = 0,
+            endianness: Binary.Endianness = .little
+        ) -> Int {
+            precondition(
+                offset >= 0 && offset <= buffer.count - byteSize,
+                "Buffer too small for binary16 value"
+            )
+
+            let bitPattern: UInt16
+            switch endianness {
+            case .little:
+                bitPattern = value.bitPattern.littleEndian
+            case .big:
+                bitPattern = value.bitPattern.bigEndian
+            }
+
+            buffer.storeBytes(of: bitPattern, toByteOffset: offset, as: UInt16.self)
+            return byteSize
+        }
+
+        /// Appends the serialized form of a Float16 to a byte array
+        ///
+        /// Grows `bytes` in place instead of returning a fresh array per value.
+        ///
+        /// - Parameters:
+        ///   - value: Float16 to serialize
+        ///   - bytes: Byte array to append to
+        ///   - endianness: Byte order (defaults to little-endian)
+        /// - Returns: Number of bytes appended (always 2)
+        ///
+        /// Example:
+        /// ```swift
+        /// var frame: [UInt8] = header
+        /// IEEE_754.Binary16.append(value, to: &frame, endianness: .big)
+        /// ```
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        @discardableResult
+        public static func append(
+            _ value: Float16,
+            to bytes: inout [UInt8],
+            endianness: Binary.Endianness = .little
+        ) -> Int {
+            let bitPattern: UInt16
+            switch endianness {
+            case .little:
+                bitPattern = value.bitPattern.littleEndian
+            case .big:
+                bitPattern = value.bitPattern.bigEndian
+            }
+
+            withUnsafeBytes(of: bitPattern) { bytes.append(contentsOf: $0) }
+            return byteSize
+        }
+
+        /// Serializes a sequence of Float16s directly into caller-owned memory
+        ///
+        /// Contiguous sequences (arrays, slices) are encoded with a single copy,
+        /// or a single vectorized byte swap when `endianness` differs from the
+        /// host byte order. Other sequences are written value by value.
+        ///
+        /// - Parameters:
+        ///   - values: Float16s to serialize
+        ///   - buffer: Destination buffer
+        ///   - offset: Byte offset within `buffer` (defaults to 0)
+        ///   - endianness: Byte order (defaults to little-endian)
+        /// - Returns: Number of bytes written
+        ///
+        /// - Precondition: `buffer` has room for every value starting at `offset`
+        ///
+        /// Example:
+        /// ```swift
+        /// let written = IEEE_754.Binary16.write(contentsOf: samples, into: frame, at: headerSize, endianness: .big)
+        /// ```
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        @discardableResult
+        public static func write<S: Sequence>(
+            contentsOf values: S,
+            into buffer: UnsafeMutableRawBufferPointer,
+            at offset: Int = 0,
+            endianness: Binary.Endianness = .little
+        ) -> Int where S.Element == Float16 {
+            let contiguous = values.withContiguousStorageIfAvailable { source -> Int in
+                let byteCount = source.count * byteSize
+                precondition(
+                    offset >= 0 && offset <= buffer.count - byteCount,
+                    "Buffer too small for binary16 values"
+                )
+                guard byteCount > 0 else { return 0 }
+
+                let destination = buffer.baseAddress! + offset
+                if endianness.isHostOrder {
+                    destination.copyMemory(from: source.baseAddress!, byteCount: byteCount)
+                } else {
+                    IEEE_754.ByteOrder.swap16(source.count, from: source.baseAddress!, to: destination)
+                }
+                return byteCount
+            }
+
+            if let contiguous { return contiguous }
+
+            var position = offset
+            for value in values {
+                position += write(value, into: buffer, at: position, endianness: endianness)
+            }
+            return position - offset
+        }
+
+        /// Appends the serialized form of a sequence of Float16s to a byte array
+        ///
+        /// Reserves capacity up front and, for contiguous sequences, copies the
+        /// whole run at once before byte-swapping it in place if needed.
+        ///
+        /// - Parameters:
+        ///   - values: Float16s to serialize
+        ///   - bytes: Byte array to append to
+        ///   - endianness: Byte order (defaults to little-endian)
+        /// - Returns: Number of bytes appended
+        ///
+        /// Example:
+        /// ```swift
+        /// var frame: [UInt8] = header
+        /// IEEE_754.Binary16.append(contentsOf: samples, to: &frame, endianness: .big)
+        /// ```
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        @discardableResult
+        public static func append<S: Sequence>(
+            contentsOf values: S,
+            to bytes: inout [UInt8],
+            endianness: Binary.Endianness = .little
+        ) -> Int where S.Element == Float16 {
+            let start = bytes.count
+
+            let contiguous = values.withContiguousStorageIfAvailable { source -> Int in
+                bytes.append(contentsOf: UnsafeRawBufferPointer(source))
+                if !endianness.isHostOrder && !source.isEmpty {
+                    bytes.withUnsafeMutableBytes { buffer in
+                        let run = buffer.baseAddress! + start
+                        IEEE_754.ByteOrder.swap16(source.count, from: run, to: run)
+                    }
+                }
+                return source.count * byteSize
+            }
+
+            if let contiguous { return contiguous }
+
+            bytes.reserveCapacity(start + values.underestimatedCount * byteSize)
+            for value in values {
+                append(value, to: &bytes, endianness: endianness)
+            }
+            return bytes.count - start
+        }
+    }
+#endif
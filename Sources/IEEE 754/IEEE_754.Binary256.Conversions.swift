@@ -0,0 +1,166 @@
+// IEEE_754.Binary256.Conversions.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 5.4.2: Conversions between binary256 and narrower formats
+
+// MARK: - Software Implementation
+
+extension IEEE_754.Binary256 {
+    /// Exact widening and correctly rounded narrowing on integer fields
+    ///
+    /// Narrower formats are described by their exponent and fraction widths
+    /// and carried as a `UInt128` encoding, which covers binary32 through
+    /// binary128. Narrowing rounds once to nearest, ties to even, including
+    /// into the target's subnormal range.
+    internal enum Conversion {
+        typealias Wide = IEEE_754.Binary128.Software.Wide
+
+        static let bias = IEEE_754.Binary256.exponentBias
+        static let signMask = IEEE_754.Binary256.signMask
+        static let fractionMask = IEEE_754.Binary256.fractionMask
+        static let maxExponent = IEEE_754.Binary256.maxExponent
+
+        /// Fraction bits of binary256
+        static let fractionBits = 236
+
+        /// Widens an encoding with the given field widths; always exact
+        static func widen(_ bits: UInt128, exponentBits: Int, fractionBits: Int) -> IEEE_754.Binary256 {
+            let maxBiased = (1 << exponentBits) - 1
+            let bias = maxBiased >> 1
+            let sign: UInt128 = bits >> (exponentBits + fractionBits) & 1 == 0 ? 0 : Self.signMask
+            let biased = Int(truncatingIfNeeded: bits >> fractionBits) & maxBiased
+            var fraction = bits & (1 << fractionBits - 1)
+
+            let exponent: Int
+            if biased == maxBiased {
+                // NaN payloads keep their position, quiet bit included
+                exponent = Self.maxExponent
+            } else if biased == 0 {
+                guard fraction != 0 else { return IEEE_754.Binary256(high: sign, low: 0) }
+                let shift = fraction.leadingZeroBitCount - (127 - fractionBits)
+                fraction = fraction << shift & (1 << fractionBits - 1)
+                exponent = 1 - bias - shift + Self.bias
+            } else {
+                exponent = biased - bias + Self.bias
+            }
+
+            let field = Wide(high: 0, low: fraction).shiftedLeft(Self.fractionBits - fractionBits)
+            return IEEE_754.Binary256(high: sign | UInt128(exponent) << 108 | field.high, low: field.low)
+        }
+
+        /// Rounds to an encoding with the given field widths
+        static func narrow(_ value: IEEE_754.Binary256, exponentBits: Int, fractionBits: Int) -> UInt128 {
+            let maxBiased = (1 << exponentBits) - 1
+            let bias = maxBiased >> 1
+            let sign: UInt128 = value.sign == .minus ? 1 << (exponentBits + fractionBits) : 0
+            let infinity = UInt128(maxBiased) << fractionBits
+            let fraction = Wide(high: value.high & Self.fractionMask, low: value.low)
+            let dropped = Self.fractionBits - fractionBits
+
+            if value.isNaN {
+                // The top of the payload survives; setting the quiet bit keeps it a NaN
+                let payload =
+                    dropped >= 128
+                    ? fraction.high >> (dropped - 128)
+                    : fraction.high << (128 - dropped) | fraction.low >> dropped
+                return sign | infinity | 1 << (fractionBits - 1) | payload
+            }
+            if value.isInfinite { return sign | infinity }
+
+            // Binary256 subnormals lie far below every narrower format's range
+            let biased = Int(value.exponentBitPattern)
+            guard biased != 0 else { return sign }
+
+            let exponent = biased - Self.bias
+            if exponent > bias { return sign | infinity }
+
+            // Keep fractionBits + 1 bits (fewer below the normal range) plus a round bit and a sticky bit
+            let target = max(exponent, 1 - bias)
+            let significand = Wide(high: fraction.high | 1 << 108, low: fraction.low)
+            let rounding = significand.jammed(dropped + (target - exponent) - 2).low
+            var kept = rounding >> 2
+            let remainder = rounding & 3
+            if remainder > 2 || (remainder == 2 && kept & 1 == 1) {
+                kept += 1
+            }
+
+            var encoded = target + bias
+            if kept >> (fractionBits + 1) != 0 {
+                kept >>= 1
+                encoded += 1
+            }
+            if kept >> fractionBits == 0 { encoded = 0 }
+            guard encoded < maxBiased else { return sign | infinity }
+            return sign | UInt128(encoded) << fractionBits | kept & (1 << fractionBits - 1)
+        }
+    }
+}
+
+// MARK: - Widening
+
+extension IEEE_754.Binary256 {
+    /// Creates the binary256 value equal to a Double - IEEE 754 `convertFormat`
+    ///
+    /// Exact for every input. NaN payloads are preserved.
+    ///
+    /// - Parameter value: The value to widen
+    public init(_ value: Double) {
+        self = Conversion.widen(UInt128(value.bitPattern), exponentBits: 11, fractionBits: 52)
+    }
+
+    /// Creates the binary256 value equal to a Float - IEEE 754 `convertFormat`
+    ///
+    /// - Parameter value: The value to widen (exact)
+    public init(_ value: Float) {
+        self = Conversion.widen(UInt128(value.bitPattern), exponentBits: 8, fractionBits: 23)
+    }
+
+    /// Creates the binary256 value equal to a binary128 value - IEEE 754 `convertFormat`
+    ///
+    /// - Parameter value: The value to widen (exact)
+    public init(_ value: IEEE_754.Binary128) {
+        self = Conversion.widen(value.bitPattern, exponentBits: 15, fractionBits: 112)
+    }
+
+    /// Creates the binary256 value equal to an integer - IEEE 754 `convertFromInt`
+    ///
+    /// - Parameter value: The integer to convert (exact)
+    public init(_ value: Int) {
+        self.init(IEEE_754.Binary128(value))
+    }
+}
+
+// MARK: - Narrowing
+
+extension Double {
+    /// Rounds a binary256 value to the nearest Double - IEEE 754 `convertFormat`
+    ///
+    /// Rounds once to nearest, ties to even, so the result is never off by
+    /// more than half an ulp (no double rounding through binary128).
+    /// Overflows to ±∞; NaNs stay NaN and are quieted.
+    ///
+    /// - Parameter value: The value to narrow
+    public init(_ value: IEEE_754.Binary256) {
+        let bits = IEEE_754.Binary256.Conversion.narrow(value, exponentBits: 11, fractionBits: 52)
+        self.init(bitPattern: UInt64(truncatingIfNeeded: bits))
+    }
+}
+
+extension Float {
+    /// Rounds a binary256 value to the nearest Float - IEEE 754 `convertFormat`
+    ///
+    /// - Parameter value: The value to narrow, rounded once to nearest even
+    public init(_ value: IEEE_754.Binary256) {
+        let bits = IEEE_754.Binary256.Conversion.narrow(value, exponentBits: 8, fractionBits: 23)
+        self.init(bitPattern: UInt32(truncatingIfNeeded: bits))
+    }
+}
+
+extension IEEE_754.Binary128 {
+    /// Rounds a binary256 value to the nearest binary128 value - IEEE 754 `convertFormat`
+    ///
+    /// - Parameter value: The value to narrow, rounded once to nearest even
+    public init(_ value: IEEE_754.Binary256) {
+        self.init(bitPattern: IEEE_754.Binary256.Conversion.narrow(value, exponentBits: 15, fractionBits: 112))
+    }
+}
@@ -2,8 +2,9 @@
 // swift-ieee-754
 //
 // IEEE 754-2019: Binary256 (Octuple Precision) Format
-// Format specification and constants (no native Swift type available)
+// Storage type, format specification, constants and serialization
 
+public import Binary
 import Standards
 
 extension IEEE_754 {
@@ -40,13 +41,33 @@ extension IEEE_754 {
     /// approximately 71 decimal digits of precision. This is the largest
     /// extended binary format commonly referenced in IEEE 754-2019.
     ///
-    /// **Note**: Swift does not currently provide a native binary256 type.
-    /// This namespace documents the format specification for reference and
-    /// future compatibility.
+    /// Swift has no native binary256 type, so `Binary256` stores the encoding
+    /// as two `UInt128` halves. It converts to and from `Double` and
+    /// ``Binary128`` with correct rounding, and serializes like ``Binary64``,
+    /// one value or a whole run at a time, into caller-owned buffers.
+    ///
+    /// Example:
+    /// ```swift
+    /// let state = IEEE_754.Binary256(IEEE_754.Binary128(energy))
+    /// position += IEEE_754.Binary256.write(state, into: checkpoint, at: position)
+    /// ```
     ///
     /// ## See Also
     /// - IEEE 754-2019 Section 3.6, Table 3.5
-    public enum Binary256 {
+    public struct Binary256: Sendable {
+        /// Low 128 bits of the encoding (fraction bits 0...127)
+        public let low: UInt128
+
+        /// High 128 bits of the encoding (sign, exponent, fraction bits 128...235)
+        public let high: UInt128
+
+        /// Creates a value from the two halves of its encoding
+        @inlinable
+        public init(high: UInt128, low: UInt128) {
+            self.high = high
+            self.low = low
+        }
+
         /// Number of bytes in binary256 format (32)
         public static let byteSize: Int = 32
 
@@ -112,9 +133,459 @@ extension IEEE_754.Binary256 {
     /// - Quiet NaN: exponent = 524287, fraction ≠ 0, MSB of fraction = 1
     /// - Signaling NaN: exponent = 524287, fraction ≠ 0, MSB of fraction = 0
     ///
-    /// **Note**: No Swift type is currently available for binary256.
-    ///
     /// ## See Also
     /// - IEEE 754-2019 Section 6.2: Special values
     public enum SpecialValuesDocumentation {}
 }
+
+// MARK: - Encoding
+
+extension IEEE_754.Binary256 {
+    @usableFromInline
+    internal static let signMask: UInt128 = 1 << 127
+
+    /// Exponent field within ``high``
+    @usableFromInline
+    internal static let exponentMask: UInt128 = 0x7FFFF << 108
+
+    /// Fraction bits held in ``high``
+    @usableFromInline
+    internal static let fractionMask: UInt128 = (1 << 108) - 1
+
+    @usableFromInline
+    internal static let quietBit: UInt128 = 1 << 107
+
+    /// The biased exponent field
+    @inlinable
+    public var exponentBitPattern: UInt {
+        UInt(truncatingIfNeeded: high >> 108) & 0x7FFFF
+    }
+}
+
+// MARK: - Constants
+
+extension IEEE_754.Binary256 {
+    /// Positive zero
+    public static let zero = Self(high: 0, low: 0)
+
+    /// One
+    public static let one = Self(high: UInt128(exponentBias) << 108, low: 0)
+
+    /// Positive infinity
+    public static let infinity = Self(high: exponentMask, low: 0)
+
+    /// The default quiet NaN
+    public static let nan = Self(high: exponentMask | quietBit, low: 0)
+
+    /// A signaling NaN (payload 1)
+    public static let signalingNaN = Self(high: exponentMask, low: 1)
+
+    /// Largest finite value: (2 − 2⁻²³⁶) × 2²⁶²¹⁴³
+    public static let greatestFiniteMagnitude = Self(high: (exponentMask - (1 << 108)) | fractionMask, low: .max)
+
+    /// Smallest positive normal value: 2⁻²⁶²¹⁴²
+    public static let leastNormalMagnitude = Self(high: 1 << 108, low: 0)
+
+    /// Smallest positive subnormal value: 2⁻²⁶²³⁷⁸
+    public static let leastNonzeroMagnitude = Self(high: 0, low: 1)
+
+    /// Distance from one to the next larger value: 2⁻²³⁶
+    public static let ulpOfOne = Self(high: UInt128(exponentBias - significandBits) << 108, low: 0)
+}
+
+// MARK: - Classification
+
+extension IEEE_754.Binary256 {
+    /// The sign of the value, including for zeros and NaNs
+    @inlinable
+    public var sign: FloatingPointSign {
+        high >> 127 == 0 ? .plus : .minus
+    }
+
+    /// Whether the value is NaN
+    @inlinable
+    public var isNaN: Bool {
+        high & Self.exponentMask == Self.exponentMask && (high & Self.fractionMask != 0 || low != 0)
+    }
+
+    /// Whether the value is a signaling NaN
+    @inlinable
+    public var isSignalingNaN: Bool {
+        isNaN && high & Self.quietBit == 0
+    }
+
+    /// Whether the value is ±∞
+    @inlinable
+    public var isInfinite: Bool {
+        high & ~Self.signMask == Self.exponentMask && low == 0
+    }
+
+    /// Whether the value is zero, subnormal or normal
+    @inlinable
+    public var isFinite: Bool {
+        high & Self.exponentMask != Self.exponentMask
+    }
+
+    /// Whether the value is ±0
+    @inlinable
+    public var isZero: Bool {
+        high & ~Self.signMask == 0 && low == 0
+    }
+
+    /// Whether the value is subnormal
+    @inlinable
+    public var isSubnormal: Bool {
+        exponentBitPattern == 0 && !isZero
+    }
+
+    /// Whether the value is normal
+    @inlinable
+    public var isNormal: Bool {
+        exponentBitPattern != 0 && isFinite
+    }
+
+    /// The absolute value
+    @inlinable
+    public var magnitude: Self {
+        Self(high: high & ~Self.signMask, low: low)
+    }
+
+    /// The value with its sign bit flipped - IEEE 754 `negate`
+    @inlinable
+    public static prefix func - (operand: Self) -> Self {
+        Self(high: operand.high ^ signMask, low: operand.low)
+    }
+
+    /// Whether two values have the same encoding
+    ///
+    /// Distinguishes `-0` from `+0` and compares NaNs by payload, unlike
+    /// IEEE 754 equality.
+    @inlinable
+    public func isBitwiseEqual(to other: Self) -> Bool {
+        high == other.high && low == other.low
+    }
+}
+
+// MARK: - Serialization
+
+extension IEEE_754.Binary256 {
+    /// Serializes a value to IEEE 754 binary256 bytes
+    ///
+    /// Lossless: every bit of the encoding is preserved.
+    ///
+    /// - Parameters:
+    ///   - value: Value to serialize
+    ///   - endianness: Byte order (defaults to little-endian)
+    /// - Returns: 32-byte array in IEEE 754 binary256 format
+    ///
+    /// Example:
+    /// ```swift
+    /// let bytes = IEEE_754.Binary256.bytes(from: .one, endianness: .big)
+    /// ```
+    @inlinable
+    public static func bytes(
+        from value: Self,
+        endianness: Binary.Endianness = .little
+    ) -> [UInt8] {
+        [UInt8](unsafeUninitializedCapacity: byteSize) { buffer, initializedCount in
+            initializedCount = write(value, into: UnsafeMutableRawBufferPointer(buffer), endianness: endianness)
+        }
+    }
+
+    /// Deserializes IEEE 754 binary256 bytes
+    ///
+    /// Inverse of ``bytes(from:endianness:)``.
+    ///
+    /// - Parameters:
+    ///   - bytes: 32-byte array in IEEE 754 binary256 format
+    ///   - endianness: Byte order of input bytes (defaults to little-endian)
+    /// - Returns: The decoded value, or nil if bytes.count ≠ 32
+    ///
+    /// Example:
+    /// ```swift
+    /// let value = IEEE_754.Binary256.value(from: bytes, endianness: .big)
+    /// ```
+    @inlinable
+    public static func value(
+        from bytes: [UInt8],
+        endianness: Binary.Endianness = .little
+    ) -> Self? {
+        guard bytes.count == byteSize else { return nil }
+        return bytes.withUnsafeBytes { load(from: $0.baseAddress!, endianness: endianness) }
+    }
+
+    /// Reads one encoding from possibly unaligned memory
+    @inlinable
+    @inline(__always)
+    internal static func load(from source: UnsafeRawPointer, endianness: Binary.Endianness) -> Self {
+        let first = source.loadUnaligned(as: UInt128.self)
+        let second = source.loadUnaligned(fromByteOffset: 16, as: UInt128.self)
+        switch endianness {
+        case .little:
+            return Self(high: UInt128(littleEndian: second), low: UInt128(littleEndian: first))
+        case .big:
+            return Self(high: UInt128(bigEndian: first), low: UInt128(bigEndian: second))
+        }
+    }
+
+    /// Deserializes a contiguous run of IEEE 754 binary256 values
+    ///
+    /// Bulk counterpart to ``value(from:endianness:)``. Little-endian input
+    /// on a little-endian host is a single copy into the result's storage;
+    /// big-endian input is byte-swapped in the same pass. The buffer does
+    /// not need to be aligned.
+    ///
+    /// - Parameters:
+    ///   - bytes: Raw bytes holding consecutive binary256 values
+    ///   - endianness: Byte order of input bytes (defaults to little-endian)
+    /// - Returns: The decoded values, or nil if bytes.count is not a multiple of 32
+    @inlinable
+    public static func values(
+        from bytes: UnsafeRawBufferPointer,
+        endianness: Binary.Endianness = .little
+    ) -> [Self]? {
+        guard bytes.count % byteSize == 0 else { return nil }
+        let count = bytes.count / byteSize
+
+        return [Self](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+            guard count > 0 else {
+                initializedCount = 0
+                return
+            }
+
+            let source = bytes.baseAddress!
+            #if _endian(little)
+                let destination = UnsafeMutableRawPointer(buffer.baseAddress!)
+                if endianness == .little {
+                    destination.copyMemory(from: source, byteCount: bytes.count)
+                } else {
+                    IEEE_754.ByteOrder.swap256(count, from: source, to: destination)
+                }
+            #else
+                for index in 0..<count {
+                    (buffer.baseAddress! + index).initialize(
+                        to: load(from: source + index * byteSize, endianness: endianness)
+                    )
+                }
+            #endif
+
+            initializedCount = count
+        }
+    }
+
+    /// Serializes an array of values to IEEE 754 binary256 bytes
+    ///
+    /// Batch counterpart to ``bytes(from:endianness:)``.
+    ///
+    /// - Parameters:
+    ///   - values: Values to serialize
+    ///   - endianness: Byte order (defaults to little-endian)
+    /// - Returns: Concatenated binary256 encodings of `values`
+    @inlinable
+    public static func bytes(
+        from values: [Self],
+        endianness: Binary.Endianness = .little
+    ) -> [UInt8] {
+        [UInt8](unsafeUninitializedCapacity: values.count * byteSize) { buffer, initializedCount in
+            initializedCount = write(
+                contentsOf: values,
+                into: UnsafeMutableRawBufferPointer(buffer),
+                endianness: endianness
+            )
+        }
+    }
+
+    /// Deserializes a byte array holding consecutive IEEE 754 binary256 values
+    ///
+    /// - Parameters:
+    ///   - bytes: Concatenated binary256 encodings
+    ///   - endianness: Byte order of input bytes (defaults to little-endian)
+    /// - Returns: The decoded values, or nil if bytes.count is not a multiple of 32
+    @inlinable
+    public static func values(
+        from bytes: [UInt8],
+        endianness: Binary.Endianness = .little
+    ) -> [Self]? {
+        bytes.withUnsafeBytes { buffer in
+            values(from: buffer, endianness: endianness)
+        }
+    }
+}
+
+// MARK: - Buffer Serialization
+
+extension IEEE_754.Binary256 {
+    /// Serializes a value directly into caller-owned memory
+    ///
+    /// Allocation-free counterpart to ``bytes(from:endianness:)``. The
+    /// destination does not need to be aligned.
+    ///
+    /// - Parameters:
+    ///   - value: Value to serialize
+    ///   - buffer: Destination buffer
+    ///   - offset: Byte offset within `buffer` (defaults to 0)
+    ///   - endianness: Byte order (defaults to little-endian)
+    /// - Returns: Number of bytes written (always 32)
+    ///
+    /// - Precondition: `offset + 32 <= buffer.count`
+    @inlinable
+    @discardableResult
+    public static func write(
+        _ value: Self,
+        into buffer: UnsafeMutableRawBufferPointer,
+        at offset: Int = 0,
+        endianness: Binary.Endianness = .little
+    ) -> Int {
+        precondition(
+            offset >= 0 && offset <= buffer.count - byteSize,
+            "Buffer too small for binary256 value"
+        )
+        store(value, to: buffer.baseAddress! + offset, endianness: endianness)
+        return byteSize
+    }
+
+    /// Writes one encoding to possibly unaligned memory
+    @inlinable
+    @inline(__always)
+    internal static func store(_ value: Self, to destination: UnsafeMutableRawPointer, endianness: Binary.Endianness) {
+        switch endianness {
+        case .little:
+            destination.storeBytes(of: value.low.littleEndian, as: UInt128.self)
+            destination.storeBytes(of: value.high.littleEndian, toByteOffset: 16, as: UInt128.self)
+        case .big:
+            destination.storeBytes(of: value.high.bigEndian, as: UInt128.self)
+            destination.storeBytes(of: value.low.bigEndian, toByteOffset: 16, as: UInt128.self)
+        }
+    }
+
+    /// Appends the serialized form of a value to a byte array
+    ///
+    /// - Parameters:
+    ///   - value: Value to serialize
+    ///   - bytes: Byte array to append to
+    ///   - endianness: Byte order (defaults to little-endian)
+    /// - Returns: Number of bytes appended (always 32)
+    @inlinable
+    @discardableResult
+    public static func append(
+        _ value: Self,
+        to bytes: inout [UInt8],
+        endianness: Binary.Endianness = .little
+    ) -> Int {
+        withUnsafeTemporaryAllocation(byteCount: byteSize, alignment: 16) { scratch in
+            store(value, to: scratch.baseAddress!, endianness: endianness)
+            bytes.append(contentsOf: UnsafeRawBufferPointer(scratch))
+        }
+        return byteSize
+    }
+
+    /// Serializes a sequence of values directly into caller-owned memory
+    ///
+    /// Contiguous sequences are encoded with a single copy (little-endian
+    /// output on a little-endian host) or a single byte-swapping pass, so a
+    /// multi-gigabyte checkpoint can be streamed chunk by chunk into a
+    /// mapped file or socket buffer without per-value arrays. Other
+    /// sequences are written value by value.
+    ///
+    /// - Parameters:
+    ///   - values: Values to serialize
+    ///   - buffer: Destination buffer
+    ///   - offset: Byte offset within `buffer` (defaults to 0)
+    ///   - endianness: Byte order (defaults to little-endian)
+    /// - Returns: Number of bytes written
+    ///
+    /// - Precondition: `buffer` has room for every value starting at `offset`
+    ///
+    /// Example:
+    /// ```swift
+    /// var position = headerSize
+    /// for chunk in state.chunks(ofCount: 1 << 20) {
+    ///     position += IEEE_754.Binary256.write(contentsOf: chunk, into: mapped, at: position)
+    /// }
+    /// ```
+    @inlinable
+    @discardableResult
+    public static func write<S: Sequence>(
+        contentsOf values: S,
+        into buffer: UnsafeMutableRawBufferPointer,
+        at offset: Int = 0,
+        endianness: Binary.Endianness = .little
+    ) -> Int where S.Element == Self {
+        let contiguous = values.withContiguousStorageIfAvailable { source -> Int in
+            let byteCount = source.count * byteSize
+            precondition(
+                offset >= 0 && offset <= buffer.count - byteCount,
+                "Buffer too small for binary256 values"
+            )
+            guard byteCount > 0 else { return 0 }
+
+            let destination = buffer.baseAddress! + offset
+            #if _endian(little)
+                if endianness == .little {
+                    destination.copyMemory(from: source.baseAddress!, byteCount: byteCount)
+                } else {
+                    IEEE_754.ByteOrder.swap256(source.count, from: source.baseAddress!, to: destination)
+                }
+            #else
+                for index in 0..<source.count {
+                    store(source[index], to: destination + index * byteSize, endianness: endianness)
+                }
+            #endif
+            return byteCount
+        }
+
+        if let contiguous { return contiguous }
+
+        var position = offset
+        for value in values {
+            position += write(value, into: buffer, at: position, endianness: endianness)
+        }
+        return position - offset
+    }
+
+    /// Appends the serialized form of a sequence of values to a byte array
+    ///
+    /// Contiguous sequences are copied in one run and byte-swapped in place
+    /// if needed.
+    ///
+    /// - Parameters:
+    ///   - values: Values to serialize
+    ///   - bytes: Byte array to append to
+    ///   - endianness: Byte order (defaults to little-endian)
+    /// - Returns: Number of bytes appended
+    @inlinable
+    @discardableResult
+    public static func append<S: Sequence>(
+        contentsOf values: S,
+        to bytes: inout [UInt8],
+        endianness: Binary.Endianness = .little
+    ) -> Int where S.Element == Self {
+        let start = bytes.count
+
+        let contiguous = values.withContiguousStorageIfAvailable { source -> Int in
+            #if _endian(little)
+                bytes.append(contentsOf: UnsafeRawBufferPointer(source))
+                if endianness == .big && !source.isEmpty {
+                    bytes.withUnsafeMutableBytes { buffer in
+                        let run = buffer.baseAddress! + start
+                        IEEE_754.ByteOrder.swap256(source.count, from: run, to: run)
+                    }
+                }
+            #else
+                bytes.append(contentsOf: repeatElement(0, count: source.count * byteSize))
+                bytes.withUnsafeMutableBytes { buffer in
+                    _ = write(contentsOf: source, into: buffer, at: start, endianness: endianness)
+                }
+            #endif
+            return source.count * byteSize
+        }
+
+        if let contiguous { return contiguous }
+
+        bytes.reserveCapacity(start + values.underestimatedCount * byteSize)
+        for value in values {
+            append(value, to: &bytes, endianness: endianness)
+        }
+        return bytes.count - start
+    }
+}
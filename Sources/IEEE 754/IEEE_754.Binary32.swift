@@ -51,10 +51,12 @@ extension IEEE_754 {
         public static let signBits: Int = 1
 
         /// Exponent bits: 8 bits
-        public static let exponentBits: Int = 8
+        @inlinable
+        public static var exponentBits: Int { 8 }
 
         /// Significand bits: 23 bits (plus implicit leading 1)
-        public static let significandBits: Int = 23
+        @inlinable
+        public static var significandBits: Int { 23 }
 
         /// Exponent bias: 127
         public static let exponentBias: Int = 127
@@ -224,8 +226,9 @@ extension IEEE_754.Binary32 {
         from value: Float,
         endianness: Binary.Endianness = .little
     ) -> [UInt8] {
-        let bitPattern = value.bitPattern
-        return [UInt8](bitPattern, endianness: endianness)
+        [UInt8](unsafeUninitializedCapacity: byteSize) { buffer, initializedCount in
+            initializedCount = write(value, into: UnsafeMutableRawBufferPointer(buffer), endianness: endianness)
+        }
     }
 
     /// Deserializes IEEE 754 binary32 bytes to Float
@@ -263,4 +266,410 @@ extension IEEE_754.Binary32 {
 
         return Float(bitPattern: bitPattern)
     }
+
+    /// Deserializes a contiguous run of IEEE 754 binary32 values
+    ///
+    /// Bulk counterpart to ``value(from:endianness:)``. The bytes are moved
+    /// into the result's storage in a single pass: a plain copy when
+    /// `endianness` matches the host byte order, otherwise a vectorized
+    /// byte swap. No per-element arrays are created. The buffer does not
+    /// need to be aligned.
+    ///
+    /// - Parameters:
+    ///   - bytes: Raw bytes holding consecutive binary32 values
+    ///   - endianness: Byte order of input bytes (defaults to little-endian)
+    /// - Returns: Array of Floats, or nil if bytes.count is not a multiple of 4
+    ///
+    /// Example:
+    /// ```swift
+    /// let values = bytes.withUnsafeBytes {
+    ///     IEEE_754.Binary32.values(from: $0, endianness: .big)
+    /// }
+    /// ```
+    @inlinable
+    public static func values(
+        from bytes: UnsafeRawBufferPointer,
+        endianness: Binary.Endianness = .little
+    ) -> [Float]? {
+        guard bytes.count % byteSize == 0 else { return nil }
+        let count = bytes.count / byteSize
+
+        return [Float](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+            guard count > 0 else {
+                initializedCount = 0
+                return
+            }
+
+            let destination = UnsafeMutableRawPointer(buffer.baseAddress!)
+            if endianness.isHostOrder {
+                destination.copyMemory(from: bytes.baseAddress!, byteCount: bytes.count)
+            } else {
+                IEEE_754.ByteOrder.swap32(count, from: bytes.baseAddress!, to: destination)
+            }
+
+            initializedCount = count
+        }
+    }
+
+    /// Serializes an array of Floats to IEEE 754 binary32 bytes
+    ///
+    /// Batch counterpart to ``bytes(from:endianness:)``. Produces
+    /// `values.count * 4` bytes in one allocation, byte-swapping with SIMD
+    /// kernels when `endianness` differs from the host byte order.
+    ///
+    /// - Parameters:
+    ///   - values: Floats to serialize
+    ///   - endianness: Byte order (defaults to little-endian)
+    /// - Returns: Concatenated binary32 encodings of `values`
+    ///
+    /// Example:
+    /// ```swift
+    /// let frame = IEEE_754.Binary32.bytes(from: samples, endianness: .big)
+    /// ```
+    @inlinable
+    public static func bytes(
+        from values: [Float],
+        endianness: Binary.Endianness = .little
+    ) -> [UInt8] {
+        values.withUnsafeBytes { source in
+            [UInt8](unsafeUninitializedCapacity: source.count) { buffer, initializedCount in
+                if source.count > 0 {
+                    let destination = UnsafeMutableRawPointer(buffer.baseAddress!)
+                    if endianness.isHostOrder {
+                        destination.copyMemory(from: source.baseAddress!, byteCount: source.count)
+                    } else {
+                        IEEE_754.ByteOrder.swap32(values.count, from: source.baseAddress!, to: destination)
+                    }
+                }
+                initializedCount = source.count
+            }
+        }
+    }
+
+    /// Deserializes a byte array holding consecutive IEEE 754 binary32 values
+    ///
+    /// Batch counterpart to ``value(from:endianness:)``.
+    ///
+    /// - Parameters:
+    ///   - bytes: Concatenated binary32 encodings
+    ///   - endianness: Byte order of input bytes (defaults to little-endian)
+    /// - Returns: Array of Floats, or nil if bytes.count is not a multiple of 4
+    ///
+    /// Example:
+    /// ```swift
+    /// let samples = IEEE_754.Binary32.values(from: frame, endianness: .big)
+    /// ```
+    @inlinable
+    public static func values(
+        from bytes: [UInt8],
+        endianness: Binary.Endianness = .little
+    ) -> [Float]? {
+        bytes.withUnsafeBytes { buffer in
+            values(from: buffer, endianness: endianness)
+        }
+    }
+}
+
+// MARK: - Buffer Serialization
+
+extension IEEE_754.Binary32 {
+    /// Serializes a Float directly into caller-owned memory
+    ///
+    /// Allocation-free counterpart to ``bytes(from:endianness:)``. Stores the
+    /// 4-byte binary32 encoding of `value` at `offset` without creating an
+    /// intermediate array. The destination does not need to be aligned.
+    ///
+    /// - Parameters:
+    ///   - value: Float to serialize
+    ///   - buffer: Destination buffer
+    ///   - offset: Byte offset within `buffer` (defaults to 0)
+    ///   - endianness: Byte order (defaults to little-endian)
+    /// - Returns: Number of bytes written (always 4)
+    ///
+    /// - Precondition: `offset + 4 <= buffer.count`
+    ///
+    /// Example:
+    /// ```swift
+    /// var position = 0
+    /// position += IEEE_754.Binary32.write(x, into: frame, at: position, endianness: .big)
+    /// position += IEEE_754.Binary32.write(y, into: frame, at: position, endianness: .big)
+    /// ```
+    @inlinable
+    @discardableResult
+    public static func write(
+        _ value: Float,
+        into buffer: UnsafeMutableRawBufferPointer,
+        at offset: Int = 0,
+        endianness: Binary.Endianness = .little
+    ) -> Int {
+        precondition(
+            offset >= 0 && offset <= buffer.count - byteSize,
+            "Buffer too small for binary32 value"
+        )
+
+        let bitPattern: UInt32
+        switch endianness {
+        case .little:
+            bitPattern = value.bitPattern.littleEndian
+        case .big:
+            bitPattern = value.bitPattern.bigEndian
+        }
+
+        buffer.storeBytes(of: bitPattern, toByteOffset: offset, as: UInt32.self)
+        return byteSize
+    }
+
+    /// Appends the serialized form of a Float to a byte array
+    ///
+    /// Grows `bytes` in place instead of returning a fresh array per value.
+    ///
+    /// - Parameters:
+    ///   - value: Float to serialize
+    ///   - bytes: Byte array to append to
+    ///   - endianness: Byte order (defaults to little-endian)
+    /// - Returns: Number of bytes appended (always 4)
+    ///
+    /// Example:
+    /// ```swift
+    /// var frame: [UInt8] = header
+    /// IEEE_754.Binary32.append(value, to: &frame, endianness: .big)
+    /// ```
+    @inlinable
+    @discardableResult
+    public static func append(
+        _ value: Float,
+        to bytes: inout [UInt8],
+        endianness: Binary.Endianness = .little
+    ) -> Int {
+        let bitPattern: UInt32
+        switch endianness {
+        case .little:
+            bitPattern = value.bitPattern.littleEndian
+        case .big:
+            bitPattern = value.bitPattern.bigEndian
+        }
+
+        withUnsafeBytes(of: bitPattern) { bytes.append(contentsOf: $0) }
+        return byteSize
+    }
+
+    /// Serializes a sequence of Floats directly into caller-owned memory
+    ///
+    /// Contiguous sequences (arrays, slices) are encoded with a single copy,
+    /// or a single vectorized byte swap when `endianness` differs from the
+    /// host byte order. Other sequences are written value by value.
+    ///
+    /// - Parameters:
+    ///   - values: Floats to serialize
+    ///   - buffer: Destination buffer
+    ///   - offset: Byte offset within `buffer` (defaults to 0)
+    ///   - endianness: Byte order (defaults to little-endian)
+    /// - Returns: Number of bytes written
+    ///
+    /// - Precondition: `buffer` has room for every value starting at `offset`
+    ///
+    /// Example:
+    /// ```swift
+    /// let written = IEEE_754.Binary32.write(contentsOf: samples, into: frame, at: headerSize, endianness: .big)
+    /// ```
+    @inlinable
+    @discardableResult
+    public static func write<S: Sequence>(
+        contentsOf values: S,
+        into buffer: UnsafeMutableRawBufferPointer,
+        at offset: Int = 0,
+        endianness: Binary.Endianness = .little
+    ) -> Int where S.Element == Float {
+        let contiguous = values.withContiguousStorageIfAvailable { source -> Int in
+            let byteCount = source.count * byteSize
+            precondition(
+                offset >= 0 && offset <= buffer.count - byteCount,
+                "Buffer too small for binary32 values"
+            )
+            guard byteCount > 0 else { return 0 }
+
+            let destination = buffer.baseAddress! + offset
+            if endianness.isHostOrder {
+                destination.copyMemory(from: source.baseAddress!, byteCount: byteCount)
+            } else {
+                IEEE_754.ByteOrder.swap32(source.count, from: source.baseAddress!, to: destination)
+            }
+            return byteCount
+        }
+
+        if let contiguous { return contiguous }
+
+        var position = offset
+        for value in values {
+            position += write(value, into: buffer, at: position, endianness: endianness)
+        }
+        return position - offset
+    }
+
+    /// Appends the serialized form of a sequence of Floats to a byte array
+    ///
+    /// Reserves capacity up front and, for contiguous sequences, copies the
+    /// whole run at once before byte-swapping it in place if needed.
+    ///
+    /// - Parameters:
+    ///   - values: Floats to serialize
+    ///   - bytes: Byte array to append to
+    ///   - endianness: Byte order (defaults to little-endian)
+    /// - Returns: Number of bytes appended
+    ///
+    /// Example:
+    /// ```swift
+    /// var frame: [UInt8] = header
+    /// IEEE_754.Binary32.append(contentsOf: samples, to: &frame, endianness: .big)
+    /// ```
+    @inlinable
+    @discardableResult
+    public static func append<S: Sequence>(
+        contentsOf values: S,
+        to bytes: inout [UInt8],
+        endianness: Binary.Endianness = .little
+    ) -> Int where S.Element == Float {
+        let start = bytes.count
+
+        let contiguous = values.withContiguousStorageIfAvailable { source -> Int in
+            bytes.append(contentsOf: UnsafeRawBufferPointer(source))
+            if !endianness.isHostOrder && !source.isEmpty {
+                bytes.withUnsafeMutableBytes { buffer in
+                    let run = buffer.baseAddress! + start
+                    IEEE_754.ByteOrder.swap32(source.count, from: run, to: run)
+                }
+            }
+            return source.count * byteSize
+        }
+
+        if let contiguous { return contiguous }
+
+        bytes.reserveCapacity(start + values.underestimatedCount * byteSize)
+        for value in values {
+            append(value, to: &bytes, endianness: endianness)
+        }
+        return bytes.count - start
+    }
+}
+
+// MARK: - Parallel Serialization
+
+extension IEEE_754.Binary32 {
+    /// Deserializes a large run of binary32 values using several cores
+    ///
+    /// Same result as ``values(from:endianness:)``. Inputs of at least
+    /// `parallel.threshold` bytes are decoded chunk by chunk on all cores,
+    /// straight into the result's storage; smaller inputs stay on the
+    /// calling thread.
+    ///
+    /// - Parameters:
+    ///   - bytes: Raw bytes holding consecutive binary32 values
+    ///   - endianness: Byte order of input bytes (defaults to little-endian)
+    ///   - parallel: When and how to split the work
+    /// - Returns: Array of Floats, or nil if bytes.count is not a multiple of 4
+    ///
+    /// Example:
+    /// ```swift
+    /// let samples = mapped.withUnsafeBytes {
+    ///     IEEE_754.Binary32.values(from: $0, endianness: .big, parallel: .automatic)
+    /// }
+    /// ```
+    @inlinable
+    public static func values(
+        from bytes: UnsafeRawBufferPointer,
+        endianness: Binary.Endianness = .little,
+        parallel: IEEE_754.Parallelism
+    ) -> [Float]? {
+        guard bytes.count % byteSize == 0 else { return nil }
+        let count = bytes.count / byteSize
+
+        return [Float](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+            if count > 0 {
+                IEEE_754.Parallel.transcode(
+                    count,
+                    size: byteSize,
+                    from: bytes.baseAddress!,
+                    to: UnsafeMutableRawPointer(buffer.baseAddress!),
+                    swapping: !endianness.isHostOrder,
+                    parallelism: parallel
+                )
+            }
+            initializedCount = count
+        }
+    }
+
+    /// Serializes a large array of Floats using several cores
+    ///
+    /// Same result as ``bytes(from:endianness:)``, encoded chunk by chunk
+    /// on all cores when the input reaches `parallel.threshold` bytes.
+    ///
+    /// - Parameters:
+    ///   - values: Floats to serialize
+    ///   - endianness: Byte order (defaults to little-endian)
+    ///   - parallel: When and how to split the work
+    /// - Returns: Concatenated binary32 encodings of `values`
+    @inlinable
+    public static func bytes(
+        from values: [Float],
+        endianness: Binary.Endianness = .little,
+        parallel: IEEE_754.Parallelism
+    ) -> [UInt8] {
+        values.withUnsafeBytes { source in
+            [UInt8](unsafeUninitializedCapacity: source.count) { buffer, initializedCount in
+                if source.count > 0 {
+                    IEEE_754.Parallel.transcode(
+                        values.count,
+                        size: byteSize,
+                        from: source.baseAddress!,
+                        to: UnsafeMutableRawPointer(buffer.baseAddress!),
+                        swapping: !endianness.isHostOrder,
+                        parallelism: parallel
+                    )
+                }
+                initializedCount = source.count
+            }
+        }
+    }
+
+    /// Serializes Floats into caller-owned memory using several cores
+    ///
+    /// Parallel counterpart to ``write(contentsOf:into:at:endianness:)``
+    /// for contiguous input, such as filling a preallocated or memory-mapped
+    /// output file.
+    ///
+    /// - Parameters:
+    ///   - values: Floats to serialize
+    ///   - buffer: Destination buffer
+    ///   - offset: Byte offset within `buffer` (defaults to 0)
+    ///   - endianness: Byte order (defaults to little-endian)
+    ///   - parallel: When and how to split the work
+    /// - Returns: Number of bytes written
+    ///
+    /// - Precondition: `buffer` has room for every value starting at `offset`
+    @inlinable
+    @discardableResult
+    public static func write(
+        contentsOf values: UnsafeBufferPointer<Float>,
+        into buffer: UnsafeMutableRawBufferPointer,
+        at offset: Int = 0,
+        endianness: Binary.Endianness = .little,
+        parallel: IEEE_754.Parallelism
+    ) -> Int {
+        let byteCount = values.count * byteSize
+        precondition(
+            offset >= 0 && offset <= buffer.count - byteCount,
+            "Buffer too small for binary32 values"
+        )
+        guard byteCount > 0 else { return 0 }
+
+        IEEE_754.Parallel.transcode(
+            values.count,
+            size: byteSize,
+            from: UnsafeRawPointer(values.baseAddress!),
+            to: buffer.baseAddress! + offset,
+            swapping: !endianness.isHostOrder,
+            parallelism: parallel
+        )
+        return byteCount
+    }
 }
@@ -0,0 +1,307 @@
+// IEEE_754.BinaryFormat.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 3.4: Binary interchange format encodings, written once for every width
+
+public import Binary
+
+extension IEEE_754 {
+    /// A binary interchange format described by its field widths
+    ///
+    /// IEEE 754-2019 Section 3.4 lays out every binary format the same way:
+    /// a sign bit, a `w`-bit biased exponent and a `t`-bit trailing
+    /// significand. A conforming type supplies those two widths and the
+    /// unsigned integer that holds an encoding; the field masks, the
+    /// parameters of Table 3.5, classification, `nextUp`/`nextDown` and the
+    /// byte codecs are derived here once.
+    ///
+    /// Conformers should declare the widths as `@inlinable` computed
+    /// properties returning literals. Generic code is then specialized per
+    /// format with every mask and shift folded to a constant.
+    ///
+    /// Formats narrower than their storage integer keep the unused high
+    /// bits zero; operations here expect and preserve that.
+    ///
+    /// Example:
+    /// ```swift
+    /// func isUnordered<F: IEEE_754.BinaryFormat>(_ bits: [F.BitPattern], as format: F.Type) -> Bool {
+    ///     bits.contains { F.isNaN($0) }
+    /// }
+    ///
+    /// IEEE_754.Binary32.numberClass(0xFF80_0000)  // .negative(.infinity)
+    /// IEEE_754.Binary16.nextUp(0x3C00)            // 0x3C01
+    /// ```
+    public protocol BinaryFormat {
+        /// Unsigned integer holding one encoding
+        associatedtype BitPattern: FixedWidthInteger & UnsignedInteger & Sendable
+
+        /// Width `w` of the biased exponent field
+        static var exponentBits: Int { get }
+
+        /// Width `t` of the trailing significand field
+        static var significandBits: Int { get }
+    }
+}
+
+// MARK: - Conformances
+
+extension IEEE_754.Binary16: IEEE_754.BinaryFormat {
+    public typealias BitPattern = UInt16
+}
+
+extension IEEE_754.Binary32: IEEE_754.BinaryFormat {
+    public typealias BitPattern = UInt32
+}
+
+extension IEEE_754.Binary64: IEEE_754.BinaryFormat {
+    public typealias BitPattern = UInt64
+}
+
+extension IEEE_754.Binary128: IEEE_754.BinaryFormat {
+    public typealias BitPattern = UInt128
+}
+
+// MARK: - Format Parameters
+
+extension IEEE_754.BinaryFormat {
+    /// Number of bits in the format: 1 + w + t
+    @inlinable
+    public static var bitSize: Int { 1 + exponentBits + significandBits }
+
+    /// Number of bytes in one stored encoding
+    @inlinable
+    public static var byteSize: Int { MemoryLayout<BitPattern>.size }
+
+    /// Exponent bias: 2^(w-1) - 1
+    @inlinable
+    public static var exponentBias: Int { (1 << (exponentBits - 1)) - 1 }
+
+    /// Largest biased exponent field, reserved for infinities and NaNs
+    @inlinable
+    public static var maxExponent: Int { (1 << exponentBits) - 1 }
+
+    /// Precision p, including the implicit leading bit - IEEE 754-2019 Table 3.5
+    @inlinable
+    public static var precision: Int { significandBits + 1 }
+
+    /// Minimum exponent of a normal number - IEEE 754-2019 Table 3.5
+    @inlinable
+    public static var emin: Int { 1 - exponentBias }
+
+    /// Maximum exponent of a finite number - IEEE 754-2019 Table 3.5
+    @inlinable
+    public static var emax: Int { exponentBias }
+}
+
+// MARK: - Field Masks
+
+extension IEEE_754.BinaryFormat {
+    /// The sign bit
+    @inlinable
+    public static var signMask: BitPattern { 1 &<< (exponentBits + significandBits) }
+
+    /// The biased exponent field
+    @inlinable
+    public static var exponentMask: BitPattern { BitPattern(maxExponent) &<< significandBits }
+
+    /// The trailing significand field
+    @inlinable
+    public static var fractionMask: BitPattern { (1 &<< significandBits) &- 1 }
+
+    /// The most significant trailing significand bit, set in quiet NaNs
+    @inlinable
+    public static var quietBit: BitPattern { 1 &<< (significandBits - 1) }
+}
+
+// MARK: - Encoding
+
+extension IEEE_754.BinaryFormat {
+    /// Assembles an encoding from its three fields
+    ///
+    /// - Parameters:
+    ///   - sign: The sign bit
+    ///   - exponentBitPattern: Biased exponent, at most ``maxExponent``
+    ///   - significandBitPattern: Trailing significand, within ``fractionMask``
+    /// - Returns: The encoding
+    @inlinable
+    public static func bitPattern(
+        sign: FloatingPointSign,
+        exponentBitPattern: BitPattern,
+        significandBitPattern: BitPattern
+    ) -> BitPattern {
+        (sign == .minus ? signMask : 0)
+            | (exponentBitPattern &<< significandBits) & exponentMask
+            | significandBitPattern & fractionMask
+    }
+
+    /// The sign of an encoding, including for zeros and NaNs
+    @inlinable
+    public static func sign(_ bitPattern: BitPattern) -> FloatingPointSign {
+        bitPattern & signMask == 0 ? .plus : .minus
+    }
+
+    /// The biased exponent field of an encoding
+    @inlinable
+    public static func exponentBitPattern(_ bitPattern: BitPattern) -> BitPattern {
+        (bitPattern & exponentMask) &>> significandBits
+    }
+
+    /// The trailing significand field of an encoding
+    @inlinable
+    public static func significandBitPattern(_ bitPattern: BitPattern) -> BitPattern {
+        bitPattern & fractionMask
+    }
+
+    /// The encoding of the absolute value - IEEE 754 `abs`
+    @inlinable
+    public static func magnitude(_ bitPattern: BitPattern) -> BitPattern {
+        bitPattern & ~signMask
+    }
+}
+
+// MARK: - Classification
+
+extension IEEE_754.BinaryFormat {
+    /// Whether an encoding is NaN - IEEE 754 `isNaN`
+    @inlinable
+    public static func isNaN(_ bitPattern: BitPattern) -> Bool {
+        magnitude(bitPattern) > exponentMask
+    }
+
+    /// Whether an encoding is a signaling NaN - IEEE 754 `isSignaling`
+    @inlinable
+    public static func isSignalingNaN(_ bitPattern: BitPattern) -> Bool {
+        magnitude(bitPattern) &- (exponentMask &+ 1) < quietBit &- 1
+    }
+
+    /// Whether an encoding is ±∞ - IEEE 754 `isInfinite`
+    @inlinable
+    public static func isInfinite(_ bitPattern: BitPattern) -> Bool {
+        magnitude(bitPattern) == exponentMask
+    }
+
+    /// Whether an encoding is zero, subnormal or normal - IEEE 754 `isFinite`
+    @inlinable
+    public static func isFinite(_ bitPattern: BitPattern) -> Bool {
+        magnitude(bitPattern) < exponentMask
+    }
+
+    /// Whether an encoding is ±0 - IEEE 754 `isZero`
+    @inlinable
+    public static func isZero(_ bitPattern: BitPattern) -> Bool {
+        magnitude(bitPattern) == 0
+    }
+
+    /// Whether an encoding is subnormal - IEEE 754 `isSubnormal`
+    @inlinable
+    public static func isSubnormal(_ bitPattern: BitPattern) -> Bool {
+        magnitude(bitPattern) &- 1 < fractionMask
+    }
+
+    /// Whether an encoding is normal - IEEE 754 `isNormal`
+    @inlinable
+    public static func isNormal(_ bitPattern: BitPattern) -> Bool {
+        magnitude(bitPattern) &- (fractionMask &+ 1) < exponentMask &- (fractionMask &+ 1)
+    }
+
+    /// The class of an encoding - IEEE 754 `class`
+    ///
+    /// - Parameter bitPattern: The encoding to classify
+    /// - Returns: One of the ten IEEE 754 number classes
+    @inlinable
+    public static func numberClass(_ bitPattern: BitPattern) -> IEEE_754.Classification.NumberClass {
+        let absolute = magnitude(bitPattern)
+        if absolute > exponentMask {
+            return .nan(absolute & quietBit == 0 ? .signaling : .quiet)
+        }
+
+        let kind: IEEE_754.Classification.NumberClass.Finite
+        if absolute == exponentMask {
+            kind = .infinity
+        } else if absolute > fractionMask {
+            kind = .normal
+        } else if absolute != 0 {
+            kind = .subnormal
+        } else {
+            kind = .zero
+        }
+        return bitPattern & signMask == 0 ? .positive(kind) : .negative(kind)
+    }
+}
+
+// MARK: - Next Operations
+
+extension IEEE_754.BinaryFormat {
+    /// The least encoding that compares greater - IEEE 754 `nextUp`
+    ///
+    /// Encodings of like sign are ordered as integers, so away from zero,
+    /// infinity and NaN this is one integer step: up for positive values,
+    /// down for negative ones.
+    ///
+    /// - Parameter bitPattern: The starting encoding
+    /// - Returns: The next encoding toward +∞; `+∞` for `+∞`, the quieted
+    ///   NaN for a NaN, and the least positive subnormal for ±0
+    @inlinable
+    public static func nextUp(_ bitPattern: BitPattern) -> BitPattern {
+        let absolute = magnitude(bitPattern)
+        if absolute > exponentMask { return bitPattern | quietBit }
+        if absolute == 0 { return 1 }
+        if bitPattern == exponentMask { return bitPattern }
+
+        // +1 for a clear sign bit, -1 for a set one
+        let negative = bitPattern &>> (exponentBits + significandBits)
+        return bitPattern &+ 1 &- (negative &<< 1)
+    }
+
+    /// The greatest encoding that compares less - IEEE 754 `nextDown`
+    ///
+    /// Equal to `-nextUp(-x)`.
+    @inlinable
+    public static func nextDown(_ bitPattern: BitPattern) -> BitPattern {
+        if isNaN(bitPattern) { return bitPattern | quietBit }
+        return nextUp(bitPattern ^ signMask) ^ signMask
+    }
+}
+
+// MARK: - Byte Codecs
+
+extension IEEE_754.BinaryFormat {
+    /// Serializes an encoding to ``byteSize`` bytes
+    ///
+    /// - Parameters:
+    ///   - bitPattern: The encoding
+    ///   - endianness: Byte order (defaults to little-endian)
+    /// - Returns: The stored bytes
+    @inlinable
+    public static func bytes(
+        bitPattern: BitPattern,
+        endianness: Binary.Endianness = .little
+    ) -> [UInt8] {
+        let ordered: BitPattern
+        switch endianness {
+        case .little: ordered = bitPattern.littleEndian
+        case .big: ordered = bitPattern.bigEndian
+        }
+        return withUnsafeBytes(of: ordered) { Array($0) }
+    }
+
+    /// Deserializes an encoding from ``byteSize`` bytes
+    ///
+    /// - Parameters:
+    ///   - bytes: Exactly ``byteSize`` bytes
+    ///   - endianness: Byte order of the bytes (defaults to little-endian)
+    /// - Returns: The encoding, or nil if `bytes.count` ≠ ``byteSize``
+    @inlinable
+    public static func bitPattern(
+        from bytes: [UInt8],
+        endianness: Binary.Endianness = .little
+    ) -> BitPattern? {
+        guard bytes.count == byteSize else { return nil }
+
+        let loaded = bytes.withUnsafeBytes { $0.loadUnaligned(fromByteOffset: 0, as: BitPattern.self) }
+        switch endianness {
+        case .little: return BitPattern(littleEndian: loaded)
+        case .big: return BitPattern(bigEndian: loaded)
+        }
+    }
+}
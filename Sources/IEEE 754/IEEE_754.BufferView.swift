@@ -0,0 +1,180 @@
+// IEEE_754.BufferView.swift
+// swift-ieee-754
+//
+// Lazily decoded, read-only collection view over binary16/32/64 bytes
+
+public import Binary
+
+// MARK: - Buffer View
+
+extension IEEE_754 {
+    /// A read-only collection of IEEE 754 values stored in raw memory
+    ///
+    /// Wraps any `UnsafeRawBufferPointer`, such as a memory-mapped file, and
+    /// decodes elements on access with `loadUnaligned`, byte-swapping them
+    /// when `endianness` differs from the host byte order. Nothing is copied
+    /// up front, so a view over a multi-gigabyte file costs no memory beyond
+    /// the pages actually touched.
+    ///
+    /// The view does not own its bytes; they must stay valid and unchanged
+    /// while the view or any of its slices is in use.
+    ///
+    /// `Element` must be a 2, 4 or 8-byte IEEE 754 type: `Float16`, `Float`
+    /// or `Double`.
+    ///
+    /// Example:
+    /// ```swift
+    /// let mapped = UnsafeRawBufferPointer(start: mmap(...), count: length)
+    /// guard let samples = IEEE_754.BufferView(mapped, of: Double.self) else { return }
+    /// let peak = samples.max()
+    /// let total = IEEE_754.Arithmetic.sum(samples)
+    /// ```
+    public struct BufferView<Element: BinaryFloatingPoint & BitwiseCopyable> {
+        /// The underlying bytes
+        public let bytes: UnsafeRawBufferPointer
+
+        /// Byte order of the stored values
+        public let endianness: Binary.Endianness
+
+        /// Creates a view of the values stored in `bytes`
+        ///
+        /// - Parameters:
+        ///   - bytes: Raw bytes holding consecutive encodings; need not be aligned
+        ///   - type: The element type (`Float16`, `Float` or `Double`)
+        ///   - endianness: Byte order of the stored values (defaults to little-endian)
+        /// - Returns: The view, or nil if bytes.count is not a multiple of the element size
+        @inlinable
+        public init?(
+            _ bytes: UnsafeRawBufferPointer,
+            of type: Element.Type = Element.self,
+            endianness: Binary.Endianness = .little
+        ) {
+            precondition(
+                [2, 4, 8].contains(MemoryLayout<Element>.size),
+                "BufferView supports binary16, binary32 and binary64 elements"
+            )
+            guard bytes.count % MemoryLayout<Element>.size == 0 else { return nil }
+            self.bytes = bytes
+            self.endianness = endianness
+        }
+    }
+}
+
+// MARK: - RandomAccessCollection
+
+extension IEEE_754.BufferView: RandomAccessCollection {
+    public typealias Index = Int
+
+    @inlinable
+    public var startIndex: Int { 0 }
+
+    @inlinable
+    public var endIndex: Int { bytes.count / MemoryLayout<Element>.size }
+
+    /// Decodes the element at `position`
+    @inlinable
+    public subscript(position: Int) -> Element {
+        precondition(position >= 0 && position < endIndex, "Index out of range")
+        return Self.load(bytes.baseAddress!, at: position &* MemoryLayout<Element>.size, endianness: endianness)
+    }
+
+    /// Calls `body` with typed storage when the bytes can be read in place
+    ///
+    /// Available when the values are in host byte order and the buffer is
+    /// aligned for `Element`; generic algorithms such as
+    /// `IEEE_754.Arithmetic.sum(_:using:)` and the min/max reductions then
+    /// run their vectorized kernels directly on the mapped memory.
+    @inlinable
+    public func withContiguousStorageIfAvailable<R>(
+        _ body: (UnsafeBufferPointer<Element>) throws -> R
+    ) rethrows -> R? {
+        guard endianness.isHostOrder else { return nil }
+        guard let base = bytes.baseAddress else { return try body(UnsafeBufferPointer(start: nil, count: 0)) }
+        guard Int(bitPattern: base) % MemoryLayout<Element>.alignment == 0 else { return nil }
+        return try bytes.withMemoryRebound(to: Element.self) { try body(UnsafeBufferPointer($0)) }
+    }
+
+    @inlinable
+    @inline(__always)
+    internal static func load(_ base: UnsafeRawPointer, at offset: Int, endianness: Binary.Endianness) -> Element {
+        if endianness.isHostOrder {
+            return base.loadUnaligned(fromByteOffset: offset, as: Element.self)
+        }
+        switch MemoryLayout<Element>.size {
+        case 2:
+            let bits = base.loadUnaligned(fromByteOffset: offset, as: UInt16.self)
+            return unsafeBitCast(bits.byteSwapped, to: Element.self)
+        case 4:
+            let bits = base.loadUnaligned(fromByteOffset: offset, as: UInt32.self)
+            return unsafeBitCast(bits.byteSwapped, to: Element.self)
+        default:
+            let bits = base.loadUnaligned(fromByteOffset: offset, as: UInt64.self)
+            return unsafeBitCast(bits.byteSwapped, to: Element.self)
+        }
+    }
+}
+
+// MARK: - SIMD Iteration
+
+extension IEEE_754.BufferView where Element: SIMDScalar {
+    /// Decodes eight consecutive elements starting at `index`
+    ///
+    /// Host-order values are read with a single unaligned vector load.
+    ///
+    /// - Precondition: `index + 8 <= count`
+    @inlinable
+    public func vector(at index: Int) -> SIMD8<Element> {
+        precondition(index >= 0 && index <= count - 8, "Index out of range")
+        let base = bytes.baseAddress!
+        let offset = index &* MemoryLayout<Element>.size
+        if endianness.isHostOrder {
+            return base.loadUnaligned(fromByteOffset: offset, as: SIMD8<Element>.self)
+        }
+        var lanes = SIMD8<Element>()
+        for lane in 0..<8 {
+            lanes[lane] = Self.load(base, at: offset &+ lane &* MemoryLayout<Element>.size, endianness: endianness)
+        }
+        return lanes
+    }
+
+    /// The elements as consecutive `SIMD8` vectors
+    ///
+    /// Covers the first `count / 8 * 8` elements; the rest are in
+    /// ``remainder``.
+    ///
+    /// Example:
+    /// ```swift
+    /// var peak = SIMD8<Double>(repeating: -.infinity)
+    /// for lanes in view.vectors { peak = pointwiseMax(peak, lanes) }
+    /// var result = peak.max()
+    /// for value in view.remainder { result = max(result, value) }
+    /// ```
+    @inlinable
+    public var vectors: Vectors { Vectors(view: self) }
+
+    /// Elements after the last full vector
+    @inlinable
+    public var remainder: SubSequence { self[(count / 8 * 8)...] }
+
+    /// The elements of a ``BufferView`` as `SIMD8` vectors
+    public struct Vectors: RandomAccessCollection {
+        @usableFromInline
+        internal let view: IEEE_754.BufferView<Element>
+
+        @inlinable
+        internal init(view: IEEE_754.BufferView<Element>) {
+            self.view = view
+        }
+
+        @inlinable
+        public var startIndex: Int { 0 }
+
+        @inlinable
+        public var endIndex: Int { view.count / 8 }
+
+        @inlinable
+        public subscript(position: Int) -> SIMD8<Element> {
+            view.vector(at: position &* 8)
+        }
+    }
+}
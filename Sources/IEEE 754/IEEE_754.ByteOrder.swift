@@ -0,0 +1,99 @@
+// IEEE_754.ByteOrder.swift
+// swift-ieee-754
+//
+// Bulk byte-order kernels shared by the binary16/32/64/256 array codecs
+
+#if canImport(CIEEE754)
+    import CIEEE754
+#endif
+
+extension IEEE_754 {
+    /// Bulk byte-order conversion for binary interchange formats
+    ///
+    /// Reverses the byte order of whole runs of 2, 4 or 8-byte elements.
+    /// When the CIEEE754 target is available the work is done by SIMD
+    /// kernels (SSSE3/AVX2 `pshufb` on x86, NEON `vrev` on arm64) selected
+    /// at runtime; otherwise a portable scalar loop is used. 32-byte
+    /// binary256 elements are reversed as two swapped 128-bit halves.
+    ///
+    /// Neither pointer needs to be aligned. `destination` may equal `source`
+    /// for an in-place swap.
+    @usableFromInline
+    internal enum ByteOrder {}
+}
+
+extension IEEE_754.ByteOrder {
+    /// Byte-swaps `count` consecutive 2-byte elements
+    @usableFromInline
+    internal static func swap16(
+        _ count: Int,
+        from source: UnsafeRawPointer,
+        to destination: UnsafeMutableRawPointer
+    ) {
+        #if canImport(CIEEE754)
+            ieee754_byteswap16(destination, source, count)
+        #else
+            swapScalar(UInt16.self, count, from: source, to: destination)
+        #endif
+    }
+
+    /// Byte-swaps `count` consecutive 4-byte elements
+    @usableFromInline
+    internal static func swap32(
+        _ count: Int,
+        from source: UnsafeRawPointer,
+        to destination: UnsafeMutableRawPointer
+    ) {
+        #if canImport(CIEEE754)
+            ieee754_byteswap32(destination, source, count)
+        #else
+            swapScalar(UInt32.self, count, from: source, to: destination)
+        #endif
+    }
+
+    /// Byte-swaps `count` consecutive 8-byte elements
+    @usableFromInline
+    internal static func swap64(
+        _ count: Int,
+        from source: UnsafeRawPointer,
+        to destination: UnsafeMutableRawPointer
+    ) {
+        #if canImport(CIEEE754)
+            ieee754_byteswap64(destination, source, count)
+        #else
+            swapScalar(UInt64.self, count, from: source, to: destination)
+        #endif
+    }
+
+    /// Byte-swaps `count` consecutive 32-byte elements
+    @usableFromInline
+    internal static func swap256(
+        _ count: Int,
+        from source: UnsafeRawPointer,
+        to destination: UnsafeMutableRawPointer
+    ) {
+        for index in 0..<count {
+            let offset = index &* 32
+            // Both halves are loaded before either store, so in place is safe
+            let low = source.loadUnaligned(fromByteOffset: offset, as: UInt128.self)
+            let high = source.loadUnaligned(fromByteOffset: offset &+ 16, as: UInt128.self)
+            destination.storeBytes(of: high.byteSwapped, toByteOffset: offset, as: UInt128.self)
+            destination.storeBytes(of: low.byteSwapped, toByteOffset: offset &+ 16, as: UInt128.self)
+        }
+    }
+
+    /// Portable fallback used when the C kernels are unavailable
+    @inline(__always)
+    internal static func swapScalar<T: FixedWidthInteger & BitwiseCopyable>(
+        _: T.Type,
+        _ count: Int,
+        from source: UnsafeRawPointer,
+        to destination: UnsafeMutableRawPointer
+    ) {
+        let stride = MemoryLayout<T>.size
+        for index in 0..<count {
+            let value = source.loadUnaligned(fromByteOffset: index * stride, as: T.self)
+            destination.storeBytes(of: value.byteSwapped, toByteOffset: index * stride, as: T.self)
+        }
+    }
+}
@@ -0,0 +1,552 @@
+// IEEE_754.Classification.Batch.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 5.7: Classification of whole buffers in a single pass
+
+// MARK: - Predicates and Results
+
+extension IEEE_754.Classification {
+    /// Classification predicates that can be evaluated in batch mode
+    ///
+    /// Raw values give the lane of each predicate in the batch kernel and
+    /// follow the order of IEEE 754-2019 Section 5.7.2.
+    public enum Predicate: Int, Sendable, Hashable, CaseIterable {
+        /// `isSignMinus`
+        case signMinus
+        /// `isNormal`
+        case normal
+        /// `isFinite`
+        case finite
+        /// `isZero`
+        case zero
+        /// `isSubnormal`
+        case subnormal
+        /// `isInfinite`
+        case infinite
+        /// `isNaN`
+        case nan
+        /// `isSignaling`
+        case signaling
+    }
+
+    /// Per-class element counts - IEEE 754 `class` over a buffer
+    ///
+    /// Holds one count for each of the 10 classes of
+    /// ``IEEE_754/Classification/NumberClass``.
+    ///
+    /// Example:
+    /// ```swift
+    /// let histogram = IEEE_754.Classification.histogram(column)
+    /// guard histogram.nan == 0, histogram[.negative(.infinity)] == 0 else {
+    ///     // Reject batch
+    /// }
+    /// ```
+    public struct Histogram: Sendable, Equatable {
+        /// Counts for one sign
+        public struct Counts: Sendable, Equatable {
+            public var infinity: Int
+            public var normal: Int
+            public var subnormal: Int
+            public var zero: Int
+
+            @inlinable
+            public init(infinity: Int = 0, normal: Int = 0, subnormal: Int = 0, zero: Int = 0) {
+                self.infinity = infinity
+                self.normal = normal
+                self.subnormal = subnormal
+                self.zero = zero
+            }
+
+            /// Sum of all four counts
+            @inlinable
+            public var total: Int {
+                infinity + normal + subnormal + zero
+            }
+
+            @inlinable
+            public subscript(_ kind: NumberClass.Finite) -> Int {
+                switch kind {
+                case .infinity: infinity
+                case .normal: normal
+                case .subnormal: subnormal
+                case .zero: zero
+                }
+            }
+        }
+
+        public var signalingNaN: Int
+        public var quietNaN: Int
+        public var positive: Counts
+        public var negative: Counts
+
+        @inlinable
+        public init(signalingNaN: Int = 0, quietNaN: Int = 0, positive: Counts = Counts(), negative: Counts = Counts()) {
+            self.signalingNaN = signalingNaN
+            self.quietNaN = quietNaN
+            self.positive = positive
+            self.negative = negative
+        }
+
+        /// Number of elements in the class
+        @inlinable
+        public subscript(_ numberClass: NumberClass) -> Int {
+            switch numberClass {
+            case .nan(.signaling): signalingNaN
+            case .nan(.quiet): quietNaN
+            case .positive(let kind): positive[kind]
+            case .negative(let kind): negative[kind]
+            }
+        }
+
+        /// Total number of elements classified
+        @inlinable
+        public var count: Int {
+            nan + positive.total + negative.total
+        }
+
+        /// Number of NaN elements (`isNaN`)
+        @inlinable
+        public var nan: Int {
+            signalingNaN + quietNaN
+        }
+
+        /// Number of finite elements (`isFinite`)
+        @inlinable
+        public var finite: Int {
+            count - nan - positive.infinity - negative.infinity
+        }
+    }
+
+    /// One bit per element: whether a predicate holds
+    ///
+    /// Bit `i % 64` of `words[i / 64]` is the predicate for element `i`.
+    /// Bits past `count` in the last word are zero.
+    public struct Bitmask: Sendable, Equatable, RandomAccessCollection {
+        /// Packed predicate bits, least significant bit first
+        public let words: [UInt64]
+
+        /// Number of elements covered by the mask
+        public let count: Int
+
+        @inlinable
+        public init(words: [UInt64], count: Int) {
+            precondition(words.count == (count + 63) / 64, "Word count does not match element count")
+            self.words = words
+            self.count = count
+        }
+
+        @inlinable
+        public var startIndex: Int { 0 }
+
+        @inlinable
+        public var endIndex: Int { count }
+
+        @inlinable
+        public subscript(position: Int) -> Bool {
+            precondition(position >= 0 && position < count, "Index out of range")
+            return words[position &>> 6] &>> UInt64(position & 63) & 1 == 1
+        }
+
+        /// Number of elements for which the predicate holds
+        @inlinable
+        public var trueCount: Int {
+            words.reduce(0) { $0 &+ $1.nonzeroBitCount }
+        }
+    }
+
+    /// Result of a batch classification
+    public struct Census: Sendable, Equatable {
+        /// Per-class counts
+        public let histogram: Histogram
+
+        /// Bitmasks for the requested predicates
+        public let masks: [Predicate: Bitmask]
+
+        @inlinable
+        public init(histogram: Histogram, masks: [Predicate: Bitmask]) {
+            self.histogram = histogram
+            self.masks = masks
+        }
+    }
+}
+
+// MARK: - Batch Kernel
+
+extension IEEE_754.Classification {
+    /// Class counters for eight lanes; positive and normal counts are derived
+    @usableFromInline
+    internal struct Tally<Counter> {
+        @usableFromInline var zero: Counter
+        @usableFromInline var subnormal: Counter
+        @usableFromInline var infinite: Counter
+        @usableFromInline var nan: Counter
+        @usableFromInline var signaling: Counter
+        @usableFromInline var negative: Counter
+        @usableFromInline var negativeZero: Counter
+        @usableFromInline var negativeSubnormal: Counter
+        @usableFromInline var negativeInfinite: Counter
+        @usableFromInline var negativeNaN: Counter
+
+        @inlinable
+        internal init(_ initial: Counter) {
+            zero = initial
+            subnormal = initial
+            infinite = initial
+            nan = initial
+            signaling = initial
+            negative = initial
+            negativeZero = initial
+            negativeSubnormal = initial
+            negativeInfinite = initial
+            negativeNaN = initial
+        }
+    }
+
+    /// Words between flushes of the SIMD counters, so 32-bit lanes cannot overflow
+    @usableFromInline
+    internal static let flushInterval = 1 << 16
+
+    @inlinable
+    @inline(__always)
+    internal static func ones<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar>(
+        _ mask: SIMDMask<SIMD8<Key.SIMDMaskScalar>>,
+        as _: Key.Type
+    ) -> SIMD8<Key> {
+        SIMD8<Key>(repeating: 0).replacing(with: 1, where: mask)
+    }
+
+    @inlinable
+    @inline(__always)
+    internal static func byte<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar>(
+        _ mask: SIMDMask<SIMD8<Key.SIMDMaskScalar>>,
+        as _: Key.Type
+    ) -> UInt64 {
+        let weights = SIMD8<Key>(1, 2, 4, 8, 16, 32, 64, 128)
+        return UInt64(truncatingIfNeeded: SIMD8<Key>(repeating: 0).replacing(with: weights, where: mask).wrappedSum())
+    }
+
+    /// Classifies 64 consecutive bit patterns
+    ///
+    /// - Returns: One 64-bit mask per ``Predicate`` (lane = raw value);
+    ///   lanes not in `wanted` are zero
+    @inlinable
+    @inline(__always)
+    internal static func classifyWord<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar>(
+        _ base: UnsafePointer<Key>,
+        infinity: Key,
+        leastNormal: Key,
+        quietBit: Key,
+        wanted: UInt8,
+        tally: inout Tally<SIMD8<Key>>
+    ) -> SIMD8<UInt64> {
+        let magnitudeMask = Key.max &>> 1
+        var words = SIMD8<UInt64>(repeating: 0)
+
+        for block in 0..<8 {
+            let p = base + block &* 8
+            let lanes = SIMD8<Key>(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7])
+            let magnitude = lanes & magnitudeMask
+
+            let isNegative = lanes .> magnitudeMask
+            let isZero = magnitude .== 0
+            let isSubnormal = .!isZero .& (magnitude .< leastNormal)
+            let isInfinite = magnitude .== infinity
+            let isNaN = magnitude .> infinity
+            let isSignaling = isNaN .& ((lanes & quietBit) .== 0)
+
+            tally.zero &+= ones(isZero, as: Key.self)
+            tally.subnormal &+= ones(isSubnormal, as: Key.self)
+            tally.infinite &+= ones(isInfinite, as: Key.self)
+            tally.nan &+= ones(isNaN, as: Key.self)
+            tally.signaling &+= ones(isSignaling, as: Key.self)
+            tally.negative &+= ones(isNegative, as: Key.self)
+            tally.negativeZero &+= ones(isNegative .& isZero, as: Key.self)
+            tally.negativeSubnormal &+= ones(isNegative .& isSubnormal, as: Key.self)
+            tally.negativeInfinite &+= ones(isNegative .& isInfinite, as: Key.self)
+            tally.negativeNaN &+= ones(isNegative .& isNaN, as: Key.self)
+
+            guard wanted != 0 else { continue }
+            let shift = UInt64(block &* 8)
+            if wanted & 1 << Predicate.signMinus.rawValue != 0 {
+                words[Predicate.signMinus.rawValue] |= byte(isNegative, as: Key.self) &<< shift
+            }
+            if wanted & 1 << Predicate.normal.rawValue != 0 {
+                let isNormal = (magnitude .>= leastNormal) .& (magnitude .< infinity)
+                words[Predicate.normal.rawValue] |= byte(isNormal, as: Key.self) &<< shift
+            }
+            if wanted & 1 << Predicate.finite.rawValue != 0 {
+                words[Predicate.finite.rawValue] |= byte(magnitude .< infinity, as: Key.self) &<< shift
+            }
+            if wanted & 1 << Predicate.zero.rawValue != 0 {
+                words[Predicate.zero.rawValue] |= byte(isZero, as: Key.self) &<< shift
+            }
+            if wanted & 1 << Predicate.subnormal.rawValue != 0 {
+                words[Predicate.subnormal.rawValue] |= byte(isSubnormal, as: Key.self) &<< shift
+            }
+            if wanted & 1 << Predicate.infinite.rawValue != 0 {
+                words[Predicate.infinite.rawValue] |= byte(isInfinite, as: Key.self) &<< shift
+            }
+            if wanted & 1 << Predicate.nan.rawValue != 0 {
+                words[Predicate.nan.rawValue] |= byte(isNaN, as: Key.self) &<< shift
+            }
+            if wanted & 1 << Predicate.signaling.rawValue != 0 {
+                words[Predicate.signaling.rawValue] |= byte(isSignaling, as: Key.self) &<< shift
+            }
+        }
+        return words
+    }
+
+    @inlinable
+    @inline(__always)
+    internal static func flush<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar>(
+        _ tally: Tally<SIMD8<Key>>,
+        into totals: inout Tally<Int>
+    ) {
+        func sum(_ lanes: SIMD8<Key>) -> Int {
+            (0..<8).reduce(0) { $0 &+ Int(lanes[$1]) }
+        }
+        totals.zero &+= sum(tally.zero)
+        totals.subnormal &+= sum(tally.subnormal)
+        totals.infinite &+= sum(tally.infinite)
+        totals.nan &+= sum(tally.nan)
+        totals.signaling &+= sum(tally.signaling)
+        totals.negative &+= sum(tally.negative)
+        totals.negativeZero &+= sum(tally.negativeZero)
+        totals.negativeSubnormal &+= sum(tally.negativeSubnormal)
+        totals.negativeInfinite &+= sum(tally.negativeInfinite)
+        totals.negativeNaN &+= sum(tally.negativeNaN)
+    }
+
+    /// Single pass over `bits`, 64 elements per step
+    ///
+    /// Works on bit patterns only: the magnitude is compared against the
+    /// encodings of the least normal and of +∞, so no element is converted
+    /// to a floating-point value. The final partial word is classified from a
+    /// zero-padded copy and the padding is subtracted from the `+0` count.
+    ///
+    /// - Parameters:
+    ///   - bits: Bit patterns of the values
+    ///   - infinity: Bit pattern of +∞
+    ///   - leastNormal: Bit pattern of the least positive normal
+    ///   - quietBit: Most significant trailing significand bit
+    ///   - predicates: Predicates to produce bitmasks for
+    @inlinable
+    internal static func census<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar>(
+        _ bits: UnsafeBufferPointer<Key>,
+        infinity: Key,
+        leastNormal: Key,
+        quietBit: Key,
+        masks predicates: Set<Predicate>
+    ) -> Census {
+        let count = bits.count
+        let wordCount = (count &+ 63) &>> 6
+        let fullWords = count &>> 6
+        let remainder = count & 63
+
+        var wanted: UInt8 = 0
+        var slots = SIMD8<Int>(repeating: 0)
+        for (slot, predicate) in Predicate.allCases.filter(predicates.contains).enumerated() {
+            wanted |= 1 << predicate.rawValue
+            slots[predicate.rawValue] = slot &* wordCount
+        }
+
+        var totals = Tally<Int>(0)
+        var planes = [UInt64](repeating: 0, count: predicates.count &* wordCount)
+
+        if let base = bits.baseAddress {
+            planes.withUnsafeMutableBufferPointer { planes in
+                func store(_ words: SIMD8<UInt64>, at word: Int) {
+                    guard wanted != 0 else { return }
+                    for lane in 0..<8 where wanted & 1 << lane != 0 {
+                        planes[slots[lane] &+ word] = words[lane]
+                    }
+                }
+
+                var word = 0
+                while word < fullWords {
+                    let end = Swift.min(fullWords, word &+ flushInterval)
+                    var tally = Tally(SIMD8<Key>(repeating: 0))
+                    while word < end {
+                        let words = classifyWord(
+                            base + word &* 64,
+                            infinity: infinity,
+                            leastNormal: leastNormal,
+                            quietBit: quietBit,
+                            wanted: wanted,
+                            tally: &tally
+                        )
+                        store(words, at: word)
+                        word &+= 1
+                    }
+                    flush(tally, into: &totals)
+                }
+
+                guard remainder > 0 else { return }
+                withUnsafeTemporaryAllocation(of: Key.self, capacity: 64) { tail in
+                    tail.initialize(repeating: 0)
+                    for index in 0..<remainder {
+                        tail[index] = base[fullWords &* 64 &+ index]
+                    }
+                    var tally = Tally(SIMD8<Key>(repeating: 0))
+                    let words = classifyWord(
+                        UnsafePointer(tail.baseAddress!),
+                        infinity: infinity,
+                        leastNormal: leastNormal,
+                        quietBit: quietBit,
+                        wanted: wanted,
+                        tally: &tally
+                    )
+                    store(words & SIMD8(repeating: (1 &<< UInt64(remainder)) &- 1), at: fullWords)
+                    flush(tally, into: &totals)
+                    totals.zero &-= 64 &- remainder
+                }
+            }
+        }
+
+        let negativeNormal =
+            totals.negative &- totals.negativeZero &- totals.negativeSubnormal
+            &- totals.negativeInfinite &- totals.negativeNaN
+        let normal = count &- totals.zero &- totals.subnormal &- totals.infinite &- totals.nan
+
+        let histogram = Histogram(
+            signalingNaN: totals.signaling,
+            quietNaN: totals.nan &- totals.signaling,
+            positive: .init(
+                infinity: totals.infinite &- totals.negativeInfinite,
+                normal: normal &- negativeNormal,
+                subnormal: totals.subnormal &- totals.negativeSubnormal,
+                zero: totals.zero &- totals.negativeZero
+            ),
+            negative: .init(
+                infinity: totals.negativeInfinite,
+                normal: negativeNormal,
+                subnormal: totals.negativeSubnormal,
+                zero: totals.negativeZero
+            )
+        )
+
+        var masks: [Predicate: Bitmask] = [:]
+        for predicate in predicates {
+            let start = slots[predicate.rawValue]
+            masks[predicate] = Bitmask(words: Array(planes[start..<start &+ wordCount]), count: count)
+        }
+        return Census(histogram: histogram, masks: masks)
+    }
+}
+
+// MARK: - Double Batch Classification
+
+extension IEEE_754.Classification {
+    /// Classifies Double values in a single pass - IEEE 754 `class`
+    ///
+    /// Counts every element by class and, for each requested predicate,
+    /// builds a packed bitmask, all in one sweep over the raw bit patterns.
+    /// Contiguous collections (arrays, slices, buffers) are read in place.
+    ///
+    /// - Parameters:
+    ///   - values: The values to classify
+    ///   - predicates: Predicates to produce bitmasks for
+    /// - Returns: Per-class counts and the requested bitmasks
+    ///
+    /// Example:
+    /// ```swift
+    /// let census = IEEE_754.Classification.classify(column, masks: [.nan])
+    /// census.histogram.nan     // number of NaNs
+    /// census.masks[.nan]?[17]  // whether element 17 is NaN
+    /// ```
+    @inlinable
+    public static func classify<C: Collection<Double>>(_ values: C, masks predicates: Set<Predicate> = []) -> Census {
+        if let census = values.withContiguousStorageIfAvailable({ classify($0, masks: predicates) }) {
+            return census
+        }
+        return Array(values).withUnsafeBufferPointer { classify($0, masks: predicates) }
+    }
+
+    @inlinable
+    internal static func classify(_ values: UnsafeBufferPointer<Double>, masks predicates: Set<Predicate>) -> Census {
+        values.withMemoryRebound(to: UInt64.self) { bits in
+            census(
+                bits,
+                infinity: 0x7FF0_0000_0000_0000,
+                leastNormal: 0x0010_0000_0000_0000,
+                quietBit: 0x0008_0000_0000_0000,
+                masks: predicates
+            )
+        }
+    }
+
+    /// Per-class counts of Double values in a single pass
+    ///
+    /// - Parameter values: The values to classify
+    /// - Returns: Per-class counts
+    @inlinable
+    public static func histogram<C: Collection<Double>>(_ values: C) -> Histogram {
+        classify(values).histogram
+    }
+
+    /// Packed bitmask of one predicate over Double values
+    ///
+    /// - Parameters:
+    ///   - values: The values to test
+    ///   - predicate: The predicate to evaluate
+    /// - Returns: A bitmask with one bit per element
+    @inlinable
+    public static func mask<C: Collection<Double>>(_ values: C, _ predicate: Predicate) -> Bitmask {
+        classify(values, masks: [predicate]).masks[predicate]!
+    }
+}
+
+// MARK: - Float Batch Classification
+
+extension IEEE_754.Classification {
+    /// Classifies Float values in a single pass - IEEE 754 `class`
+    ///
+    /// Counts every element by class and, for each requested predicate,
+    /// builds a packed bitmask, all in one sweep over the raw bit patterns.
+    /// Contiguous collections (arrays, slices, buffers) are read in place.
+    ///
+    /// - Parameters:
+    ///   - values: The values to classify
+    ///   - predicates: Predicates to produce bitmasks for
+    /// - Returns: Per-class counts and the requested bitmasks
+    @inlinable
+    public static func classify<C: Collection<Float>>(_ values: C, masks predicates: Set<Predicate> = []) -> Census {
+        if let census = values.withContiguousStorageIfAvailable({ classify($0, masks: predicates) }) {
+            return census
+        }
+        return Array(values).withUnsafeBufferPointer { classify($0, masks: predicates) }
+    }
+
+    @inlinable
+    internal static func classify(_ values: UnsafeBufferPointer<Float>, masks predicates: Set<Predicate>) -> Census {
+        values.withMemoryRebound(to: UInt32.self) { bits in
+            census(
+                bits,
+                infinity: 0x7F80_0000,
+                leastNormal: 0x0080_0000,
+                quietBit: 0x0040_0000,
+                masks: predicates
+            )
+        }
+    }
+
+    /// Per-class counts of Float values in a single pass
+    ///
+    /// - Parameter values: The values to classify
+    /// - Returns: Per-class counts
+    @inlinable
+    public static func histogram<C: Collection<Float>>(_ values: C) -> Histogram {
+        classify(values).histogram
+    }
+
+    /// Packed bitmask of one predicate over Float values
+    ///
+    /// - Parameters:
+    ///   - values: The values to test
+    ///   - predicate: The predicate to evaluate
+    /// - Returns: A bitmask with one bit per element
+    @inlinable
+    public static func mask<C: Collection<Float>>(_ values: C, _ predicate: Predicate) -> Bitmask {
+        classify(values, masks: [predicate]).masks[predicate]!
+    }
+}
@@ -0,0 +1,677 @@
+// IEEE_754.Comparison.Batch.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Sections 5.6.1 and 5.10: Comparison predicates and total order over whole columns
+
+// MARK: - Relations
+
+extension IEEE_754.Comparison {
+    /// A relation that can be evaluated over whole columns
+    ///
+    /// Covers the six quiet comparison predicates of ``Predicate`` and the
+    /// two total orders of Section 5.10.
+    ///
+    /// Example:
+    /// ```swift
+    /// let cheap = IEEE_754.Comparison.mask(prices, 10, using: .compare(.ordering(.less(orEqual: false))))
+    /// let sorted = IEEE_754.Comparison.mask(column.dropLast(), column.dropFirst(), using: .totalOrder)
+    /// ```
+    public enum Relation: Sendable, Equatable {
+        /// A quiet comparison predicate
+        case compare(Predicate)
+        /// `totalOrder(lhs, rhs)`
+        case totalOrder
+        /// `totalOrderMag(lhs, rhs)`
+        case totalOrderMag
+    }
+
+    /// Elements per block when filtering, so the selection words stay on the stack
+    @usableFromInline
+    internal static let filterBlockSize = 4096
+}
+
+// MARK: - Lane Kernels
+
+extension IEEE_754.Comparison {
+    /// Unsigned keys whose integer order is `totalOrder`, as ``IEEE_754/RadixSort``
+    @inlinable
+    @inline(__always)
+    internal static func totalOrderKeys<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar>(
+        _ lanes: SIMD8<Key>
+    ) -> SIMD8<Key> {
+        let signBit: Key = 1 &<< (Key.bitWidth &- 1)
+        // All ones for negative lanes, zero for positive
+        let negative = SIMD8<Key>(repeating: 0) &- (lanes &>> Key(Key.bitWidth &- 1))
+        return lanes ^ (negative | signBit)
+    }
+
+    /// Keys whose integer order is the numeric order of non-NaN lanes
+    ///
+    /// −0 is mapped to +0 first, so the two zeros get the same key.
+    @inlinable
+    @inline(__always)
+    internal static func numericKeys<F: IEEE_754.BinaryFormat>(
+        _ lanes: SIMD8<F.BitPattern>,
+        as _: F.Type
+    ) -> SIMD8<F.BitPattern> where F.BitPattern: SIMDScalar {
+        totalOrderKeys(lanes.replacing(with: 0, where: lanes .== F.signMask))
+    }
+
+    /// Lanes where neither operand is NaN
+    @inlinable
+    @inline(__always)
+    internal static func ordered<F: IEEE_754.BinaryFormat>(
+        _ lhs: SIMD8<F.BitPattern>,
+        _ rhs: SIMD8<F.BitPattern>,
+        as _: F.Type
+    ) -> SIMDMask<SIMD8<F.BitPattern.SIMDMaskScalar>> where F.BitPattern: SIMDScalar {
+        ((lhs & ~F.signMask) .<= F.exponentMask) .& ((rhs & ~F.signMask) .<= F.exponentMask)
+    }
+
+    /// Eight elements starting at `start`, zero-padded past `count`
+    @inlinable
+    @inline(__always)
+    internal static func lanes<Element: FixedWidthInteger & SIMDScalar>(
+        _ base: UnsafePointer<Element>,
+        _ start: Int,
+        _ count: Int
+    ) -> SIMD8<Element> {
+        guard count &- start < 8 else { return IEEE_754.NextOperations.load(base + start) }
+        var lanes = SIMD8<Element>(repeating: 0)
+        for lane in 0..<(count &- start) {
+            lanes[lane] = base[start &+ lane]
+        }
+        return lanes
+    }
+
+    /// Packs the 8-bit masks of consecutive groups of eight elements into words
+    ///
+    /// - Parameters:
+    ///   - count: Number of elements
+    ///   - words: Receives `(count + 63) / 64` words; bits past `count` are zero
+    ///   - group: Mask of the eight elements starting at an index
+    @inlinable
+    @inline(__always)
+    internal static func pack(count: Int, into words: UnsafeMutablePointer<UInt64>, _ group: (Int) -> UInt64) {
+        let wordCount = (count &+ 63) &>> 6
+        var word = 0
+        while word < wordCount {
+            let first = word &* 64
+            let groups = Swift.min(8, (count &- first &+ 7) &>> 3)
+            var bits: UInt64 = 0
+            for block in 0..<groups {
+                bits |= group(first &+ block &* 8) &<< UInt64(block &* 8)
+            }
+            words[word] = bits
+            word &+= 1
+        }
+        let remainder = count & 63
+        if remainder != 0 {
+            words[wordCount &- 1] &= (1 &<< UInt64(remainder)) &- 1
+        }
+    }
+
+    /// Evaluates `relation` over `count` element pairs into packed words
+    ///
+    /// The relation is resolved once, and each case runs its own loop over
+    /// an integer lane kernel, so no per-element branch remains. Quiet
+    /// predicates compare ``numericKeys(_:as:)`` of the ordered lanes;
+    /// `totalOrder` compares ``totalOrderKeys(_:)`` and `totalOrderMag` the
+    /// magnitudes, exactly as the scalar predicates order bit patterns.
+    ///
+    /// - Parameters:
+    ///   - relation: The relation to evaluate
+    ///   - format: The binary format of the bit patterns
+    ///   - count: Number of elements
+    ///   - words: Receives `(count + 63) / 64` words; bits past `count` are zero
+    ///   - operands: Bit patterns of the eight element pairs starting at an index
+    @inlinable
+    @inline(__always)
+    internal static func select<F: IEEE_754.BinaryFormat>(
+        _ relation: Relation,
+        as format: F.Type,
+        count: Int,
+        into words: UnsafeMutablePointer<UInt64>,
+        _ operands: (Int) -> (SIMD8<F.BitPattern>, SIMD8<F.BitPattern>)
+    ) where F.BitPattern: SIMDScalar {
+        typealias Lanes = SIMD8<F.BitPattern>
+        func run(_ kernel: (Lanes, Lanes) -> SIMDMask<SIMD8<F.BitPattern.SIMDMaskScalar>>) {
+            pack(count: count, into: words) { start in
+                let (lhs, rhs) = operands(start)
+                return IEEE_754.Classification.byte(kernel(lhs, rhs), as: F.BitPattern.self)
+            }
+        }
+
+        switch relation {
+        case .compare(.equality(.equal)):
+            run { ordered($0, $1, as: format) .& (numericKeys($0, as: format) .== numericKeys($1, as: format)) }
+        case .compare(.equality(.notEqual)):
+            run { .!(ordered($0, $1, as: format) .& (numericKeys($0, as: format) .== numericKeys($1, as: format))) }
+        case .compare(.ordering(.less(orEqual: false))):
+            run { ordered($0, $1, as: format) .& (numericKeys($0, as: format) .< numericKeys($1, as: format)) }
+        case .compare(.ordering(.less(orEqual: true))):
+            run { ordered($0, $1, as: format) .& (numericKeys($0, as: format) .<= numericKeys($1, as: format)) }
+        case .compare(.ordering(.greater(orEqual: false))):
+            run { ordered($0, $1, as: format) .& (numericKeys($0, as: format) .> numericKeys($1, as: format)) }
+        case .compare(.ordering(.greater(orEqual: true))):
+            run { ordered($0, $1, as: format) .& (numericKeys($0, as: format) .>= numericKeys($1, as: format)) }
+        case .totalOrder:
+            run { totalOrderKeys($0) .<= totalOrderKeys($1) }
+        case .totalOrderMag:
+            run { ($0 & ~F.signMask) .<= ($1 & ~F.signMask) }
+        }
+    }
+}
+
+// MARK: - Column Kernels
+
+extension IEEE_754.Comparison {
+    /// Packed `relation(lhs[i], rhs[i])` over two columns of bit patterns
+    @inlinable
+    internal static func evaluate<F: IEEE_754.BinaryFormat>(
+        _ lhs: UnsafeBufferPointer<F.BitPattern>,
+        _ rhs: UnsafeBufferPointer<F.BitPattern>,
+        using relation: Relation,
+        as format: F.Type,
+        into words: UnsafeMutablePointer<UInt64>
+    ) where F.BitPattern: SIMDScalar {
+        guard let a = lhs.baseAddress, let b = rhs.baseAddress else { return }
+        let count = lhs.count
+        select(relation, as: format, count: count, into: words) { start in
+            (lanes(a, start, count), lanes(b, start, count))
+        }
+    }
+
+    /// Packed `relation(lhs[i], rhs)` over a column of bit patterns and one scalar
+    @inlinable
+    internal static func evaluate<F: IEEE_754.BinaryFormat>(
+        _ lhs: UnsafeBufferPointer<F.BitPattern>,
+        _ rhs: F.BitPattern,
+        using relation: Relation,
+        as format: F.Type,
+        into words: UnsafeMutablePointer<UInt64>
+    ) where F.BitPattern: SIMDScalar {
+        guard let a = lhs.baseAddress else { return }
+        let count = lhs.count
+        let scalar = SIMD8<F.BitPattern>(repeating: rhs)
+        select(relation, as: format, count: count, into: words) { start in
+            (lanes(a, start, count), scalar)
+        }
+    }
+
+    /// A bitmask over `count` elements whose words are written by `fill`
+    @inlinable
+    internal static func bitmask(
+        count: Int,
+        _ fill: (UnsafeMutablePointer<UInt64>) -> Void
+    ) -> IEEE_754.Classification.Bitmask {
+        let wordCount = (count &+ 63) &>> 6
+        let words = [UInt64](unsafeUninitializedCapacity: wordCount) { buffer, initialized in
+            if let base = buffer.baseAddress {
+                fill(base)
+            }
+            initialized = wordCount
+        }
+        return IEEE_754.Classification.Bitmask(words: words, count: count)
+    }
+
+    @inlinable
+    internal static func mask<T, F: IEEE_754.BinaryFormat>(
+        _ lhs: UnsafeBufferPointer<T>,
+        _ rhs: UnsafeBufferPointer<T>,
+        using relation: Relation,
+        as format: F.Type
+    ) -> IEEE_754.Classification.Bitmask where F.BitPattern: SIMDScalar {
+        precondition(lhs.count == rhs.count, "Operand buffers must have the same count")
+        return lhs.withMemoryRebound(to: F.BitPattern.self) { lhs in
+            rhs.withMemoryRebound(to: F.BitPattern.self) { rhs in
+                bitmask(count: lhs.count) { evaluate(lhs, rhs, using: relation, as: format, into: $0) }
+            }
+        }
+    }
+
+    @inlinable
+    internal static func mask<T, F: IEEE_754.BinaryFormat>(
+        _ lhs: UnsafeBufferPointer<T>,
+        _ rhs: F.BitPattern,
+        using relation: Relation,
+        as format: F.Type
+    ) -> IEEE_754.Classification.Bitmask where F.BitPattern: SIMDScalar {
+        lhs.withMemoryRebound(to: F.BitPattern.self) { lhs in
+            bitmask(count: lhs.count) { evaluate(lhs, rhs, using: relation, as: format, into: $0) }
+        }
+    }
+
+    /// Positions of the set bits of `mask`, ascending
+    @inlinable
+    internal static func indices(_ mask: IEEE_754.Classification.Bitmask) -> [Int] {
+        let total = mask.trueCount
+        return [Int](unsafeUninitializedCapacity: total) { buffer, initialized in
+            var written = 0
+            for (word, value) in mask.words.enumerated() {
+                var bits = value
+                while bits != 0 {
+                    buffer.initializeElement(at: written, to: word &* 64 &+ bits.trailingZeroBitCount)
+                    written &+= 1
+                    bits &= bits &- 1
+                }
+            }
+            initialized = total
+        }
+    }
+
+    /// Copies the elements of `values` selected by `block`, one block of words at a time
+    ///
+    /// Selection words for ``filterBlockSize`` elements are built on the
+    /// stack and consumed at once, so no full mask is materialized.
+    ///
+    /// - Parameters:
+    ///   - values: Bit patterns to select from
+    ///   - result: Receives the selected bit patterns, in order
+    ///   - block: Writes the selection words of a range of `values`
+    /// - Returns: Number of elements written
+    @inlinable
+    internal static func compact<Key>(
+        _ values: UnsafeBufferPointer<Key>,
+        into result: UnsafeMutableBufferPointer<Key>,
+        _ block: (Range<Int>, UnsafeMutablePointer<UInt64>) -> Void
+    ) -> Int {
+        var written = 0
+        withUnsafeTemporaryAllocation(of: UInt64.self, capacity: filterBlockSize &>> 6) { words in
+            guard let selection = words.baseAddress else { return }
+            var start = 0
+            while start < values.count {
+                let end = Swift.min(values.count, start &+ filterBlockSize)
+                block(start..<end, selection)
+                for word in 0..<((end &- start &+ 63) &>> 6) {
+                    var bits = selection[word]
+                    precondition(written &+ bits.nonzeroBitCount <= result.count, "Result buffer is too small")
+                    let first = start &+ word &* 64
+                    while bits != 0 {
+                        result.initializeElement(at: written, to: values[first &+ bits.trailingZeroBitCount])
+                        written &+= 1
+                        bits &= bits &- 1
+                    }
+                }
+                start = end
+            }
+        }
+        return written
+    }
+
+    @inlinable
+    internal static func filter<T, F: IEEE_754.BinaryFormat>(
+        _ lhs: UnsafeBufferPointer<T>,
+        _ rhs: UnsafeBufferPointer<T>,
+        using relation: Relation,
+        as format: F.Type,
+        into result: UnsafeMutableBufferPointer<T>
+    ) -> Int where F.BitPattern: SIMDScalar {
+        precondition(lhs.count == rhs.count, "Operand buffers must have the same count")
+        return lhs.withMemoryRebound(to: F.BitPattern.self) { lhs in
+            rhs.withMemoryRebound(to: F.BitPattern.self) { rhs in
+                result.withMemoryRebound(to: F.BitPattern.self) { result in
+                    compact(lhs, into: result) { range, words in
+                        evaluate(
+                            UnsafeBufferPointer(rebasing: lhs[range]),
+                            UnsafeBufferPointer(rebasing: rhs[range]),
+                            using: relation,
+                            as: format,
+                            into: words
+                        )
+                    }
+                }
+            }
+        }
+    }
+
+    @inlinable
+    internal static func filter<T, F: IEEE_754.BinaryFormat>(
+        _ lhs: UnsafeBufferPointer<T>,
+        _ rhs: F.BitPattern,
+        using relation: Relation,
+        as format: F.Type,
+        into result: UnsafeMutableBufferPointer<T>
+    ) -> Int where F.BitPattern: SIMDScalar {
+        lhs.withMemoryRebound(to: F.BitPattern.self) { lhs in
+            result.withMemoryRebound(to: F.BitPattern.self) { result in
+                compact(lhs, into: result) { range, words in
+                    evaluate(UnsafeBufferPointer(rebasing: lhs[range]), rhs, using: relation, as: format, into: words)
+                }
+            }
+        }
+    }
+
+    /// Collects `filter(into:)` into an array sized for the worst case
+    @inlinable
+    internal static func filtered<T>(
+        count: Int,
+        _ filter: (UnsafeMutableBufferPointer<T>) -> Int
+    ) -> [T] {
+        [T](unsafeUninitializedCapacity: count) { buffer, initialized in
+            initialized = filter(buffer)
+        }
+    }
+}
+
+// MARK: - Double Column Comparisons
+
+extension IEEE_754.Comparison {
+    /// Packed selection of `relation(lhs[i], rhs[i])` over two Double columns
+    ///
+    /// The relation is resolved once and evaluated eight elements at a time
+    /// on the bit patterns, with no per-element branch. Each bit equals the
+    /// scalar ``compare(_:_:using:)``, ``totalOrder(_:_:)`` or
+    /// ``totalOrderMag(_:_:)`` of its pair. Signals no exceptions.
+    ///
+    /// - Parameters:
+    ///   - lhs: Left-hand values
+    ///   - rhs: Right-hand values, same count as `lhs`
+    ///   - relation: The relation to evaluate
+    /// - Returns: A bitmask with one bit per pair
+    ///
+    /// Example:
+    /// ```swift
+    /// let less = IEEE_754.Comparison.Relation.compare(.ordering(.less(orEqual: false)))
+    /// let mask = IEEE_754.Comparison.mask([1.0, .nan, 3.0], [2.0, 2.0, 2.0], using: less)
+    /// Array(mask)  // [true, false, false]
+    /// ```
+    @inlinable
+    public static func mask<L: Collection<Double>, R: Collection<Double>>(
+        _ lhs: L,
+        _ rhs: R,
+        using relation: Relation
+    ) -> IEEE_754.Classification.Bitmask {
+        IEEE_754.Arithmetic.contiguous(lhs) { lhs in
+            IEEE_754.Arithmetic.contiguous(rhs) { rhs in mask(lhs, rhs, using: relation, as: IEEE_754.Binary64.self) }
+        }
+    }
+
+    /// Packed selection of `relation(values[i], scalar)` over a Double column
+    ///
+    /// - Parameters:
+    ///   - values: Left-hand values
+    ///   - scalar: Right-hand value for every element
+    ///   - relation: The relation to evaluate
+    /// - Returns: A bitmask with one bit per element
+    @inlinable
+    public static func mask<C: Collection<Double>>(
+        _ values: C,
+        _ scalar: Double,
+        using relation: Relation
+    ) -> IEEE_754.Classification.Bitmask {
+        IEEE_754.Arithmetic.contiguous(values) { values in
+            mask(values, scalar.bitPattern, using: relation, as: IEEE_754.Binary64.self)
+        }
+    }
+
+    /// Positions where `relation(lhs[i], rhs[i])` holds over two Double columns
+    ///
+    /// - Parameters:
+    ///   - lhs: Left-hand values
+    ///   - rhs: Right-hand values, same count as `lhs`
+    ///   - relation: The relation to evaluate
+    /// - Returns: The selected positions, ascending
+    @inlinable
+    public static func indices<L: Collection<Double>, R: Collection<Double>>(
+        _ lhs: L,
+        _ rhs: R,
+        using relation: Relation
+    ) -> [Int] {
+        indices(mask(lhs, rhs, using: relation))
+    }
+
+    /// Positions where `relation(values[i], scalar)` holds over a Double column
+    ///
+    /// - Parameters:
+    ///   - values: Left-hand values
+    ///   - scalar: Right-hand value for every element
+    ///   - relation: The relation to evaluate
+    /// - Returns: The selected positions, ascending
+    ///
+    /// Example:
+    /// ```swift
+    /// IEEE_754.Comparison.indices([3.0, -0.0, 7.0, 0.0], 0.0, using: .compare(.equality(.equal)))  // [1, 3]
+    /// ```
+    @inlinable
+    public static func indices<C: Collection<Double>>(
+        _ values: C,
+        _ scalar: Double,
+        using relation: Relation
+    ) -> [Int] {
+        indices(mask(values, scalar, using: relation))
+    }
+
+    /// Copies the elements of `lhs` for which `relation(lhs[i], rhs[i])` holds
+    ///
+    /// Selection words are built per block of 4096 pairs and consumed at
+    /// once, so neither `Bool`s nor a whole-column mask are materialized.
+    ///
+    /// - Parameters:
+    ///   - lhs: Values to select from
+    ///   - rhs: Right-hand values, same count as `lhs`
+    ///   - relation: The relation to evaluate
+    ///   - result: Receives the selected values in order; must hold all of them
+    /// - Returns: Number of values written
+    @discardableResult
+    @inlinable
+    public static func filter(
+        _ lhs: UnsafeBufferPointer<Double>,
+        _ rhs: UnsafeBufferPointer<Double>,
+        using relation: Relation,
+        into result: UnsafeMutableBufferPointer<Double>
+    ) -> Int {
+        filter(lhs, rhs, using: relation, as: IEEE_754.Binary64.self, into: result)
+    }
+
+    /// Copies the elements of `values` for which `relation(values[i], scalar)` holds
+    ///
+    /// - Parameters:
+    ///   - values: Values to select from
+    ///   - scalar: Right-hand value for every element
+    ///   - relation: The relation to evaluate
+    ///   - result: Receives the selected values in order; must hold all of them
+    /// - Returns: Number of values written
+    @discardableResult
+    @inlinable
+    public static func filter(
+        _ values: UnsafeBufferPointer<Double>,
+        _ scalar: Double,
+        using relation: Relation,
+        into result: UnsafeMutableBufferPointer<Double>
+    ) -> Int {
+        filter(values, scalar.bitPattern, using: relation, as: IEEE_754.Binary64.self, into: result)
+    }
+
+    /// The elements of `lhs` for which `relation(lhs[i], rhs[i])` holds
+    ///
+    /// - Parameters:
+    ///   - lhs: Values to select from
+    ///   - rhs: Right-hand values, same count as `lhs`
+    ///   - relation: The relation to evaluate
+    /// - Returns: The selected values, in order
+    @inlinable
+    public static func filter<L: Collection<Double>, R: Collection<Double>>(
+        _ lhs: L,
+        _ rhs: R,
+        using relation: Relation
+    ) -> [Double] {
+        IEEE_754.Arithmetic.contiguous(lhs) { lhs in
+            IEEE_754.Arithmetic.contiguous(rhs) { rhs in
+                filtered(count: lhs.count) { filter(lhs, rhs, using: relation, into: $0) }
+            }
+        }
+    }
+
+    /// The elements of `values` for which `relation(values[i], scalar)` holds
+    ///
+    /// - Parameters:
+    ///   - values: Values to select from
+    ///   - scalar: Right-hand value for every element
+    ///   - relation: The relation to evaluate
+    /// - Returns: The selected values, in order
+    ///
+    /// Example:
+    /// ```swift
+    /// IEEE_754.Comparison.filter([4.0, .nan, -1.0, 9.0], 2.0, using: .compare(.ordering(.greater(orEqual: true))))
+    /// // [4.0, 9.0]
+    /// ```
+    @inlinable
+    public static func filter<C: Collection<Double>>(
+        _ values: C,
+        _ scalar: Double,
+        using relation: Relation
+    ) -> [Double] {
+        IEEE_754.Arithmetic.contiguous(values) { values in
+            filtered(count: values.count) { filter(values, scalar, using: relation, into: $0) }
+        }
+    }
+}
+
+// MARK: - Float Column Comparisons
+
+extension IEEE_754.Comparison {
+    /// Packed selection of `relation(lhs[i], rhs[i])` over two Float columns
+    ///
+    /// - Parameters:
+    ///   - lhs: Left-hand values
+    ///   - rhs: Right-hand values, same count as `lhs`
+    ///   - relation: The relation to evaluate
+    /// - Returns: A bitmask with one bit per pair
+    @inlinable
+    public static func mask<L: Collection<Float>, R: Collection<Float>>(
+        _ lhs: L,
+        _ rhs: R,
+        using relation: Relation
+    ) -> IEEE_754.Classification.Bitmask {
+        IEEE_754.Arithmetic.contiguous(lhs) { lhs in
+            IEEE_754.Arithmetic.contiguous(rhs) { rhs in mask(lhs, rhs, using: relation, as: IEEE_754.Binary32.self) }
+        }
+    }
+
+    /// Packed selection of `relation(values[i], scalar)` over a Float column
+    ///
+    /// - Parameters:
+    ///   - values: Left-hand values
+    ///   - scalar: Right-hand value for every element
+    ///   - relation: The relation to evaluate
+    /// - Returns: A bitmask with one bit per element
+    @inlinable
+    public static func mask<C: Collection<Float>>(
+        _ values: C,
+        _ scalar: Float,
+        using relation: Relation
+    ) -> IEEE_754.Classification.Bitmask {
+        IEEE_754.Arithmetic.contiguous(values) { values in
+            mask(values, scalar.bitPattern, using: relation, as: IEEE_754.Binary32.self)
+        }
+    }
+
+    /// Positions where `relation(lhs[i], rhs[i])` holds over two Float columns
+    ///
+    /// - Parameters:
+    ///   - lhs: Left-hand values
+    ///   - rhs: Right-hand values, same count as `lhs`
+    ///   - relation: The relation to evaluate
+    /// - Returns: The selected positions, ascending
+    @inlinable
+    public static func indices<L: Collection<Float>, R: Collection<Float>>(
+        _ lhs: L,
+        _ rhs: R,
+        using relation: Relation
+    ) -> [Int] {
+        indices(mask(lhs, rhs, using: relation))
+    }
+
+    /// Positions where `relation(values[i], scalar)` holds over a Float column
+    ///
+    /// - Parameters:
+    ///   - values: Left-hand values
+    ///   - scalar: Right-hand value for every element
+    ///   - relation: The relation to evaluate
+    /// - Returns: The selected positions, ascending
+    @inlinable
+    public static func indices<C: Collection<Float>>(
+        _ values: C,
+        _ scalar: Float,
+        using relation: Relation
+    ) -> [Int] {
+        indices(mask(values, scalar, using: relation))
+    }
+
+    /// Copies the elements of `lhs` for which `relation(lhs[i], rhs[i])` holds
+    ///
+    /// - Parameters:
+    ///   - lhs: Values to select from
+    ///   - rhs: Right-hand values, same count as `lhs`
+    ///   - relation: The relation to evaluate
+    ///   - result: Receives the selected values in order; must hold all of them
+    /// - Returns: Number of values written
+    @discardableResult
+    @inlinable
+    public static func filter(
+        _ lhs: UnsafeBufferPointer<Float>,
+        _ rhs: UnsafeBufferPointer<Float>,
+        using relation: Relation,
+        into result: UnsafeMutableBufferPointer<Float>
+    ) -> Int {
+        filter(lhs, rhs, using: relation, as: IEEE_754.Binary32.self, into: result)
+    }
+
+    /// Copies the elements of `values` for which `relation(values[i], scalar)` holds
+    ///
+    /// - Parameters:
+    ///   - values: Values to select from
+    ///   - scalar: Right-hand value for every element
+    ///   - relation: The relation to evaluate
+    ///   - result: Receives the selected values in order; must hold all of them
+    /// - Returns: Number of values written
+    @discardableResult
+    @inlinable
+    public static func filter(
+        _ values: UnsafeBufferPointer<Float>,
+        _ scalar: Float,
+        using relation: Relation,
+        into result: UnsafeMutableBufferPointer<Float>
+    ) -> Int {
+        filter(values, scalar.bitPattern, using: relation, as: IEEE_754.Binary32.self, into: result)
+    }
+
+    /// The elements of `lhs` for which `relation(lhs[i], rhs[i])` holds
+    ///
+    /// - Parameters:
+    ///   - lhs: Values to select from
+    ///   - rhs: Right-hand values, same count as `lhs`
+    ///   - relation: The relation to evaluate
+    /// - Returns: The selected values, in order
+    @inlinable
+    public static func filter<L: Collection<Float>, R: Collection<Float>>(
+        _ lhs: L,
+        _ rhs: R,
+        using relation: Relation
+    ) -> [Float] {
+        IEEE_754.Arithmetic.contiguous(lhs) { lhs in
+            IEEE_754.Arithmetic.contiguous(rhs) { rhs in
+                filtered(count: lhs.count) { filter(lhs, rhs, using: relation, into: $0) }
+            }
+        }
+    }
+
+    /// The elements of `values` for which `relation(values[i], scalar)` holds
+    ///
+    /// - Parameters:
+    ///   - values: Values to select from
+    ///   - scalar: Right-hand value for every element
+    ///   - relation: The relation to evaluate
+    /// - Returns: The selected values, in order
+    @inlinable
+    public static func filter<C: Collection<Float>>(
+        _ values: C,
+        _ scalar: Float,
+        using relation: Relation
+    ) -> [Float] {
+        IEEE_754.Arithmetic.contiguous(values) { values in
+            filtered(count: values.count) { filter(values, scalar, using: relation, into: $0) }
+        }
+    }
+}
@@ -616,3 +616,437 @@ extension IEEE_754.Comparison {
         }
     }
 #endif
+
+#if canImport(CIEEE754)
+    // MARK: - Batch Signaling Comparisons
+
+    extension IEEE_754.Comparison.Signaling {
+        /// Element-wise signaling comparison into a caller-provided buffer
+        ///
+        /// Runs one C kernel over the whole span, so NaN detection and the
+        /// comparison are vectorized and the invalid exception is raised at
+        /// most once per call rather than once per unordered pair.
+        private static func batch<T>(
+            _ kernel: (UnsafePointer<T>?, UnsafePointer<T>?, UnsafeMutablePointer<UInt8>?, Int) -> Int,
+            _ lhs: UnsafeBufferPointer<T>,
+            _ rhs: UnsafeBufferPointer<T>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            precondition(lhs.count == rhs.count, "Operand buffers must have the same count")
+            precondition(results.count >= lhs.count, "Result buffer is too small")
+            guard !lhs.isEmpty else { return 0 }
+
+            // The kernel writes only 0 or 1, both valid Bool representations
+            return results.withMemoryRebound(to: UInt8.self) { bytes in
+                kernel(lhs.baseAddress, rhs.baseAddress, bytes.baseAddress, lhs.count)
+            }
+        }
+
+        /// Element-wise signaling comparison of two arrays
+        private static func batch<T>(
+            _ kernel: (UnsafePointer<T>?, UnsafePointer<T>?, UnsafeMutablePointer<UInt8>?, Int) -> Int,
+            _ lhs: [T],
+            _ rhs: [T]
+        ) -> (results: [Bool], unordered: Int) {
+            precondition(lhs.count == rhs.count, "Operand arrays must have the same count")
+            var unordered = 0
+            let results = [Bool](unsafeUninitializedCapacity: lhs.count) { buffer, initializedCount in
+                unordered = lhs.withUnsafeBufferPointer { lhs in
+                    rhs.withUnsafeBufferPointer { rhs in
+                        batch(kernel, lhs, rhs, into: buffer)
+                    }
+                }
+                initializedCount = lhs.count
+            }
+            return (results, unordered)
+        }
+
+        // MARK: - Double (binary64) Batch Comparisons
+
+        /// Signaling `==` comparison of two Double buffers
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        ///   - results: Receives `lhs[i] == rhs[i]`; must hold at least `lhs.count` elements
+        /// - Returns: Number of unordered pairs (either operand NaN)
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        @discardableResult
+        public static func equal(
+            _ lhs: UnsafeBufferPointer<Double>,
+            _ rhs: UnsafeBufferPointer<Double>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            batch(ieee754_signaling_equal_array, lhs, rhs, into: results)
+        }
+
+        /// Signaling `==` comparison of two Double arrays
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        /// - Returns: Per-element results and the number of unordered pairs
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        public static func equal(_ lhs: [Double], _ rhs: [Double]) -> (results: [Bool], unordered: Int) {
+            batch(ieee754_signaling_equal_array, lhs, rhs)
+        }
+
+        /// Signaling `<` comparison of two Double buffers
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        ///   - results: Receives `lhs[i] < rhs[i]`; must hold at least `lhs.count` elements
+        /// - Returns: Number of unordered pairs (either operand NaN)
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        @discardableResult
+        public static func less(
+            _ lhs: UnsafeBufferPointer<Double>,
+            _ rhs: UnsafeBufferPointer<Double>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            batch(ieee754_signaling_less_array, lhs, rhs, into: results)
+        }
+
+        /// Signaling `<` comparison of two Double arrays
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        /// - Returns: Per-element results and the number of unordered pairs
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        public static func less(_ lhs: [Double], _ rhs: [Double]) -> (results: [Bool], unordered: Int) {
+            batch(ieee754_signaling_less_array, lhs, rhs)
+        }
+
+        /// Signaling `<=` comparison of two Double buffers
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        ///   - results: Receives `lhs[i] <= rhs[i]`; must hold at least `lhs.count` elements
+        /// - Returns: Number of unordered pairs (either operand NaN)
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        @discardableResult
+        public static func lessEqual(
+            _ lhs: UnsafeBufferPointer<Double>,
+            _ rhs: UnsafeBufferPointer<Double>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            batch(ieee754_signaling_less_equal_array, lhs, rhs, into: results)
+        }
+
+        /// Signaling `<=` comparison of two Double arrays
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        /// - Returns: Per-element results and the number of unordered pairs
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        public static func lessEqual(_ lhs: [Double], _ rhs: [Double]) -> (results: [Bool], unordered: Int) {
+            batch(ieee754_signaling_less_equal_array, lhs, rhs)
+        }
+
+        /// Signaling `>` comparison of two Double buffers
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        ///   - results: Receives `lhs[i] > rhs[i]`; must hold at least `lhs.count` elements
+        /// - Returns: Number of unordered pairs (either operand NaN)
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        @discardableResult
+        public static func greater(
+            _ lhs: UnsafeBufferPointer<Double>,
+            _ rhs: UnsafeBufferPointer<Double>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            batch(ieee754_signaling_greater_array, lhs, rhs, into: results)
+        }
+
+        /// Signaling `>` comparison of two Double arrays
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        /// - Returns: Per-element results and the number of unordered pairs
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        public static func greater(_ lhs: [Double], _ rhs: [Double]) -> (results: [Bool], unordered: Int) {
+            batch(ieee754_signaling_greater_array, lhs, rhs)
+        }
+
+        /// Signaling `>=` comparison of two Double buffers
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        ///   - results: Receives `lhs[i] >= rhs[i]`; must hold at least `lhs.count` elements
+        /// - Returns: Number of unordered pairs (either operand NaN)
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        @discardableResult
+        public static func greaterEqual(
+            _ lhs: UnsafeBufferPointer<Double>,
+            _ rhs: UnsafeBufferPointer<Double>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            batch(ieee754_signaling_greater_equal_array, lhs, rhs, into: results)
+        }
+
+        /// Signaling `>=` comparison of two Double arrays
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        /// - Returns: Per-element results and the number of unordered pairs
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        public static func greaterEqual(_ lhs: [Double], _ rhs: [Double]) -> (results: [Bool], unordered: Int) {
+            batch(ieee754_signaling_greater_equal_array, lhs, rhs)
+        }
+
+        /// Signaling `!=` comparison of two Double buffers
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        ///   - results: Receives `lhs[i] != rhs[i]`; must hold at least `lhs.count` elements
+        /// - Returns: Number of unordered pairs (either operand NaN)
+        ///
+        /// Unordered pairs yield `true`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        @discardableResult
+        public static func notEqual(
+            _ lhs: UnsafeBufferPointer<Double>,
+            _ rhs: UnsafeBufferPointer<Double>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            batch(ieee754_signaling_not_equal_array, lhs, rhs, into: results)
+        }
+
+        /// Signaling `!=` comparison of two Double arrays
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        /// - Returns: Per-element results and the number of unordered pairs
+        ///
+        /// Unordered pairs yield `true`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        public static func notEqual(_ lhs: [Double], _ rhs: [Double]) -> (results: [Bool], unordered: Int) {
+            batch(ieee754_signaling_not_equal_array, lhs, rhs)
+        }
+
+        // MARK: - Float (binary32) Batch Comparisons
+
+        /// Signaling `==` comparison of two Float buffers
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        ///   - results: Receives `lhs[i] == rhs[i]`; must hold at least `lhs.count` elements
+        /// - Returns: Number of unordered pairs (either operand NaN)
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        @discardableResult
+        public static func equal(
+            _ lhs: UnsafeBufferPointer<Float>,
+            _ rhs: UnsafeBufferPointer<Float>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            batch(ieee754_signaling_equal_array_f, lhs, rhs, into: results)
+        }
+
+        /// Signaling `==` comparison of two Float arrays
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        /// - Returns: Per-element results and the number of unordered pairs
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        public static func equal(_ lhs: [Float], _ rhs: [Float]) -> (results: [Bool], unordered: Int) {
+            batch(ieee754_signaling_equal_array_f, lhs, rhs)
+        }
+
+        /// Signaling `<` comparison of two Float buffers
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        ///   - results: Receives `lhs[i] < rhs[i]`; must hold at least `lhs.count` elements
+        /// - Returns: Number of unordered pairs (either operand NaN)
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        @discardableResult
+        public static func less(
+            _ lhs: UnsafeBufferPointer<Float>,
+            _ rhs: UnsafeBufferPointer<Float>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            batch(ieee754_signaling_less_array_f, lhs, rhs, into: results)
+        }
+
+        /// Signaling `<` comparison of two Float arrays
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        /// - Returns: Per-element results and the number of unordered pairs
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        public static func less(_ lhs: [Float], _ rhs: [Float]) -> (results: [Bool], unordered: Int) {
+            batch(ieee754_signaling_less_array_f, lhs, rhs)
+        }
+
+        /// Signaling `<=` comparison of two Float buffers
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        ///   - results: Receives `lhs[i] <= rhs[i]`; must hold at least `lhs.count` elements
+        /// - Returns: Number of unordered pairs (either operand NaN)
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        @discardableResult
+        public static func lessEqual(
+            _ lhs: UnsafeBufferPointer<Float>,
+            _ rhs: UnsafeBufferPointer<Float>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            batch(ieee754_signaling_less_equal_array_f, lhs, rhs, into: results)
+        }
+
+        /// Signaling `<=` comparison of two Float arrays
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        /// - Returns: Per-element results and the number of unordered pairs
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        public static func lessEqual(_ lhs: [Float], _ rhs: [Float]) -> (results: [Bool], unordered: Int) {
+            batch(ieee754_signaling_less_equal_array_f, lhs, rhs)
+        }
+
+        /// Signaling `>` comparison of two Float buffers
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        ///   - results: Receives `lhs[i] > rhs[i]`; must hold at least `lhs.count` elements
+        /// - Returns: Number of unordered pairs (either operand NaN)
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        @discardableResult
+        public static func greater(
+            _ lhs: UnsafeBufferPointer<Float>,
+            _ rhs: UnsafeBufferPointer<Float>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            batch(ieee754_signaling_greater_array_f, lhs, rhs, into: results)
+        }
+
+        /// Signaling `>` comparison of two Float arrays
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        /// - Returns: Per-element results and the number of unordered pairs
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        public static func greater(_ lhs: [Float], _ rhs: [Float]) -> (results: [Bool], unordered: Int) {
+            batch(ieee754_signaling_greater_array_f, lhs, rhs)
+        }
+
+        /// Signaling `>=` comparison of two Float buffers
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        ///   - results: Receives `lhs[i] >= rhs[i]`; must hold at least `lhs.count` elements
+        /// - Returns: Number of unordered pairs (either operand NaN)
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        @discardableResult
+        public static func greaterEqual(
+            _ lhs: UnsafeBufferPointer<Float>,
+            _ rhs: UnsafeBufferPointer<Float>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            batch(ieee754_signaling_greater_equal_array_f, lhs, rhs, into: results)
+        }
+
+        /// Signaling `>=` comparison of two Float arrays
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        /// - Returns: Per-element results and the number of unordered pairs
+        ///
+        /// Unordered pairs yield `false`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        public static func greaterEqual(_ lhs: [Float], _ rhs: [Float]) -> (results: [Bool], unordered: Int) {
+            batch(ieee754_signaling_greater_equal_array_f, lhs, rhs)
+        }
+
+        /// Signaling `!=` comparison of two Float buffers
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        ///   - results: Receives `lhs[i] != rhs[i]`; must hold at least `lhs.count` elements
+        /// - Returns: Number of unordered pairs (either operand NaN)
+        ///
+        /// Unordered pairs yield `true`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        @discardableResult
+        public static func notEqual(
+            _ lhs: UnsafeBufferPointer<Float>,
+            _ rhs: UnsafeBufferPointer<Float>,
+            into results: UnsafeMutableBufferPointer<Bool>
+        ) -> Int {
+            batch(ieee754_signaling_not_equal_array_f, lhs, rhs, into: results)
+        }
+
+        /// Signaling `!=` comparison of two Float arrays
+        ///
+        /// - Parameters:
+        ///   - lhs: Left-hand values
+        ///   - rhs: Right-hand values, same count as `lhs`
+        /// - Returns: Per-element results and the number of unordered pairs
+        ///
+        /// Unordered pairs yield `true`. If any pair is unordered, raises the
+        /// invalid exception once for the whole batch.
+        public static func notEqual(_ lhs: [Float], _ rhs: [Float]) -> (results: [Bool], unordered: Int) {
+            batch(ieee754_signaling_not_equal_array_f, lhs, rhs)
+        }
+    }
+#endif
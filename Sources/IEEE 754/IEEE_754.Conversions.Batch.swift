@@ -0,0 +1,174 @@
+// IEEE_754.Conversions.Batch.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 5.4.2: Bulk narrowing conversions with exception summaries
+
+#if canImport(CIEEE754)
+    import CIEEE754
+
+    // MARK: - Conversion Summary
+
+    extension IEEE_754.Conversions {
+        /// Exceptions signaled by one bulk conversion
+        ///
+        /// Each count is the number of elements whose conversion signaled that
+        /// exception under default exception handling. Underflow counts only
+        /// inexact tiny results, with tininess detected before rounding.
+        ///
+        /// Example:
+        /// ```swift
+        /// let summary = IEEE_754.Conversions.floatToBinary16(weights, into: storage)
+        /// if summary.overflow > 0 {
+        ///     // Some weights became ±infinity
+        /// }
+        /// ```
+        public struct Summary: Sendable, Equatable {
+            /// Signaling NaN inputs (converted to quiet NaN)
+            public var invalid: Int
+
+            /// Finite inputs whose rounded result exceeds the target format
+            public var overflow: Int
+
+            /// Inexact results smaller than the target's least normal magnitude
+            public var underflow: Int
+
+            /// Results that differ from their input
+            public var inexact: Int
+
+            /// Creates a summary from explicit counts
+            public init(invalid: Int = 0, overflow: Int = 0, underflow: Int = 0, inexact: Int = 0) {
+                self.invalid = invalid
+                self.overflow = overflow
+                self.underflow = underflow
+                self.inexact = inexact
+            }
+
+            /// Whether every element converted exactly
+            public var isExact: Bool {
+                invalid == 0 && overflow == 0 && underflow == 0 && inexact == 0
+            }
+
+            /// The exceptions that occurred at least once
+            public var flags: IEEE_754.Exceptions.FlagSet {
+                var flags = IEEE_754.Exceptions.FlagSet()
+                if invalid > 0 { flags = flags.union(.init(.invalid)) }
+                if overflow > 0 { flags = flags.union(.init(.overflow)) }
+                if underflow > 0 { flags = flags.union(.init(.underflow)) }
+                if inexact > 0 { flags = flags.union(.init(.inexact)) }
+                return flags
+            }
+
+            internal init(_ summary: IEEE754ConversionSummary) {
+                self.init(
+                    invalid: summary.invalid,
+                    overflow: summary.overflow,
+                    underflow: summary.underflow,
+                    inexact: summary.inexact
+                )
+            }
+        }
+    }
+
+    // MARK: - Bulk Narrowing
+
+    extension IEEE_754.Conversions {
+        /// Converts Doubles to Floats in bulk - IEEE 754 `convertFormat`
+        ///
+        /// Converts `source[i]` into `destination[i]` using the hardware
+        /// conversion in the current rounding mode. The counts are gathered in
+        /// the same vectorized pass, and each exception that occurs is raised
+        /// once for the whole batch rather than once per element.
+        ///
+        /// - Parameters:
+        ///   - source: The values to narrow
+        ///   - destination: Storage for at least `source.count` results
+        /// - Returns: Exception counts for the batch
+        @discardableResult
+        public static func doubleToFloat(
+            _ source: UnsafeBufferPointer<Double>,
+            into destination: UnsafeMutableBufferPointer<Float>
+        ) -> Summary {
+            precondition(destination.count >= source.count, "Destination buffer is too small")
+            guard let input = source.baseAddress, let output = destination.baseAddress else { return Summary() }
+            return Summary(ieee754_convert_f64_to_f32_array(input, output, source.count))
+        }
+
+        /// Converts Floats to binary16 bit patterns in bulk - IEEE 754 `convertFormat`
+        ///
+        /// Rounds to nearest, ties to even. Uses F16C on x86 (when the CPU
+        /// has it) and NEON on arm64.
+        ///
+        /// - Parameters:
+        ///   - source: The values to narrow
+        ///   - destination: Storage for at least `source.count` binary16 encodings
+        /// - Returns: Exception counts for the batch
+        ///
+        /// Example:
+        /// ```swift
+        /// var storage = [UInt16](repeating: 0, count: weights.count)
+        /// let summary = weights.withUnsafeBufferPointer { weights in
+        ///     storage.withUnsafeMutableBufferPointer { storage in
+        ///         IEEE_754.Conversions.floatToBinary16(weights, into: storage)
+        ///     }
+        /// }
+        /// ```
+        @discardableResult
+        public static func floatToBinary16(
+            _ source: UnsafeBufferPointer<Float>,
+            into destination: UnsafeMutableBufferPointer<UInt16>
+        ) -> Summary {
+            precondition(destination.count >= source.count, "Destination buffer is too small")
+            guard let input = source.baseAddress, let output = destination.baseAddress else { return Summary() }
+            return Summary(ieee754_convert_f32_to_f16_array(input, output, source.count))
+        }
+
+        /// Converts Doubles to binary16 bit patterns in bulk - IEEE 754 `convertFormat`
+        ///
+        /// Rounds once, to nearest with ties to even. Going through Float would
+        /// round twice and can differ in the last bit.
+        ///
+        /// - Parameters:
+        ///   - source: The values to narrow
+        ///   - destination: Storage for at least `source.count` binary16 encodings
+        /// - Returns: Exception counts for the batch
+        @discardableResult
+        public static func doubleToBinary16(
+            _ source: UnsafeBufferPointer<Double>,
+            into destination: UnsafeMutableBufferPointer<UInt16>
+        ) -> Summary {
+            precondition(destination.count >= source.count, "Destination buffer is too small")
+            guard let input = source.baseAddress, let output = destination.baseAddress else { return Summary() }
+            return Summary(ieee754_convert_f64_to_f16_array(input, output, source.count))
+        }
+
+        #if !((os(macOS) || targetEnvironment(macCatalyst)) && arch(x86_64))
+            /// Converts Floats to Float16 in bulk - IEEE 754 `convertFormat`
+            ///
+            /// Same as ``floatToBinary16(_:into:)`` with typed output.
+            @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+            @discardableResult
+            public static func floatToFloat16(
+                _ source: UnsafeBufferPointer<Float>,
+                into destination: UnsafeMutableBufferPointer<Float16>
+            ) -> Summary {
+                destination.withMemoryRebound(to: UInt16.self) { bits in
+                    floatToBinary16(source, into: bits)
+                }
+            }
+
+            /// Converts Doubles to Float16 in bulk - IEEE 754 `convertFormat`
+            ///
+            /// Same as ``doubleToBinary16(_:into:)`` with typed output.
+            @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+            @discardableResult
+            public static func doubleToFloat16(
+                _ source: UnsafeBufferPointer<Double>,
+                into destination: UnsafeMutableBufferPointer<Float16>
+            ) -> Summary {
+                destination.withMemoryRebound(to: UInt16.self) { bits in
+                    doubleToBinary16(source, into: bits)
+                }
+            }
+        #endif
+    }
+#endif
@@ -0,0 +1,423 @@
+// IEEE_754.Conversions.DecimalText.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 5.12: Conversion between binary formats and decimal character sequences
+
+#if canImport(CIEEE754)
+    import CIEEE754
+
+    extension IEEE_754.Conversions {
+        /// Decimal character sequences for binary16, binary32 and binary64
+        ///
+        /// IEEE 754-2019 Section 5.12.2 asks for conversions that round-trip:
+        /// a value formatted and parsed back comes back unchanged. Formatting
+        /// writes the shortest such decimal (Schubfach), and of several with
+        /// that many digits the one closest to the value. Parsing rounds any
+        /// number of digits correctly to nearest, ties to even, directly to
+        /// the target format (Eisel-Lemire, with an exact big-integer
+        /// fallback when more than 19 digits decide the result).
+        ///
+        /// Text is ASCII bytes in caller-provided buffers: nothing is
+        /// allocated per value and no `String` is involved. Neither direction
+        /// depends on the current rounding mode or signals exceptions.
+        ///
+        /// ## Text Layout
+        ///
+        /// Formatting follows ECMAScript's `Number::toString`: integers and
+        /// decimals while the decimal point is within 21 digits
+        /// (`123`, `0.001`, `1.5`), and scientific notation with a signed
+        /// exponent otherwise (`1e+21`, `5e-324`). Zeros keep their sign
+        /// (`-0`); the special values are `inf`, `-inf`, `nan` and `snan`,
+        /// without payloads.
+        ///
+        /// Parsing accepts an optional sign, digits with an optional point and
+        /// an optional exponent (`+1`, `-.5`, `2.5E-3`), or case-insensitively
+        /// `inf`, `infinity`, `nan` and `snan`. The whole text must match; no
+        /// whitespace is skipped.
+        ///
+        /// Example:
+        /// ```swift
+        /// let text = IEEE_754.Conversions.DecimalText.bytes(0.1 + 0.2)  // "0.30000000000000004"
+        /// let value = IEEE_754.Conversions.DecimalText.double(from: text)  // 0.30000000000000004
+        /// ```
+        public enum DecimalText {
+            /// Longest text written for a Double (`-0.0000012345678901234567`)
+            public static var binary64MaximumLength: Int { 25 }
+
+            /// Longest text written for a Float (`-123456790000000000000`)
+            public static var binary32MaximumLength: Int { 22 }
+
+            /// Longest text written for a binary16 encoding (`-0.00006104`)
+            public static var binary16MaximumLength: Int { 11 }
+        }
+    }
+
+    // MARK: - Formatting
+
+    extension IEEE_754.Conversions.DecimalText {
+        /// Writes the shortest round-trip decimal for a Double into caller-owned memory
+        ///
+        /// Formats in place when at least ``binary64MaximumLength`` bytes
+        /// follow `offset`, otherwise through a stack buffer.
+        ///
+        /// - Parameters:
+        ///   - value: The value to format
+        ///   - buffer: Destination buffer
+        ///   - offset: Byte offset within `buffer` (defaults to 0)
+        /// - Returns: Number of bytes written
+        ///
+        /// - Precondition: The text fits in `buffer` after `offset`
+        ///
+        /// Example:
+        /// ```swift
+        /// var position = 0
+        /// position += IEEE_754.Conversions.DecimalText.write(x, into: line, at: position)
+        /// ```
+        @discardableResult
+        public static func write(
+            _ value: Double,
+            into buffer: UnsafeMutableRawBufferPointer,
+            at offset: Int = 0
+        ) -> Int {
+            write(into: buffer, at: offset, maximumLength: binary64MaximumLength) { ieee754_format_f64(value, $0) }
+        }
+
+        /// Writes the shortest round-trip decimal for a Float into caller-owned memory
+        ///
+        /// - Parameters:
+        ///   - value: The value to format
+        ///   - buffer: Destination buffer
+        ///   - offset: Byte offset within `buffer` (defaults to 0)
+        /// - Returns: Number of bytes written
+        ///
+        /// - Precondition: The text fits in `buffer` after `offset`
+        @discardableResult
+        public static func write(
+            _ value: Float,
+            into buffer: UnsafeMutableRawBufferPointer,
+            at offset: Int = 0
+        ) -> Int {
+            write(into: buffer, at: offset, maximumLength: binary32MaximumLength) { ieee754_format_f32(value, $0) }
+        }
+
+        /// Writes the shortest round-trip decimal for a binary16 encoding into caller-owned memory
+        ///
+        /// - Parameters:
+        ///   - bitPattern: The binary16 encoding to format
+        ///   - buffer: Destination buffer
+        ///   - offset: Byte offset within `buffer` (defaults to 0)
+        /// - Returns: Number of bytes written
+        ///
+        /// - Precondition: The text fits in `buffer` after `offset`
+        @discardableResult
+        public static func write(
+            binary16 bitPattern: UInt16,
+            into buffer: UnsafeMutableRawBufferPointer,
+            at offset: Int = 0
+        ) -> Int {
+            write(into: buffer, at: offset, maximumLength: binary16MaximumLength) { ieee754_format_f16(bitPattern, $0) }
+        }
+
+        /// The shortest round-trip decimal for a Double
+        ///
+        /// - Parameter value: The value to format
+        /// - Returns: ASCII text
+        ///
+        /// Example:
+        /// ```swift
+        /// IEEE_754.Conversions.DecimalText.bytes(1e21)  // "1e+21"
+        /// ```
+        public static func bytes(_ value: Double) -> [UInt8] {
+            [UInt8](unsafeUninitializedCapacity: binary64MaximumLength) { buffer, initializedCount in
+                initializedCount = ieee754_format_f64(value, buffer.baseAddress!)
+            }
+        }
+
+        /// The shortest round-trip decimal for a Float
+        ///
+        /// - Parameter value: The value to format
+        /// - Returns: ASCII text
+        public static func bytes(_ value: Float) -> [UInt8] {
+            [UInt8](unsafeUninitializedCapacity: binary32MaximumLength) { buffer, initializedCount in
+                initializedCount = ieee754_format_f32(value, buffer.baseAddress!)
+            }
+        }
+
+        /// The shortest round-trip decimal for a binary16 encoding
+        ///
+        /// - Parameter bitPattern: The binary16 encoding to format
+        /// - Returns: ASCII text
+        public static func bytes(binary16 bitPattern: UInt16) -> [UInt8] {
+            [UInt8](unsafeUninitializedCapacity: binary16MaximumLength) { buffer, initializedCount in
+                initializedCount = ieee754_format_f16(bitPattern, buffer.baseAddress!)
+            }
+        }
+
+        /// Formats through a stack buffer when `buffer` may be too short for the longest text
+        internal static func write(
+            into buffer: UnsafeMutableRawBufferPointer,
+            at offset: Int,
+            maximumLength: Int,
+            _ format: (UnsafeMutableRawPointer) -> Int
+        ) -> Int {
+            precondition(offset >= 0 && offset <= buffer.count, "Offset outside buffer")
+            let available = buffer.count - offset
+            if available >= maximumLength, let base = buffer.baseAddress {
+                return format(base + offset)
+            }
+            return withUnsafeTemporaryAllocation(byteCount: maximumLength, alignment: 1) { scratch in
+                let count = format(scratch.baseAddress!)
+                precondition(count <= available, "Buffer too small for decimal text")
+                if count > 0 {
+                    buffer.baseAddress!.advanced(by: offset).copyMemory(from: scratch.baseAddress!, byteCount: count)
+                }
+                return count
+            }
+        }
+    }
+
+    // MARK: - Bulk Formatting
+
+    extension IEEE_754.Conversions.DecimalText {
+        /// Formats a column of Doubles as separated decimal fields
+        ///
+        /// One pass over the values writing straight into the result, with
+        /// `separator` between fields and none after the last.
+        ///
+        /// - Parameters:
+        ///   - values: The values to format
+        ///   - separator: Byte between fields (defaults to a comma)
+        /// - Returns: ASCII text
+        ///
+        /// Example:
+        /// ```swift
+        /// IEEE_754.Conversions.DecimalText.bytes([1.5, -0.0, 1e300])  // "1.5,-0,1e+300"
+        /// ```
+        @inlinable
+        public static func bytes<C: Collection<Double>>(_ values: C, separator: UInt8 = UInt8(ascii: ",")) -> [UInt8] {
+            if let text = values.withContiguousStorageIfAvailable({ bytes($0, separator: separator) }) {
+                return text
+            }
+            return Array(values).withUnsafeBufferPointer { bytes($0, separator: separator) }
+        }
+
+        /// Formats a column of Floats as separated decimal fields
+        ///
+        /// - Parameters:
+        ///   - values: The values to format
+        ///   - separator: Byte between fields (defaults to a comma)
+        /// - Returns: ASCII text
+        @inlinable
+        public static func bytes<C: Collection<Float>>(_ values: C, separator: UInt8 = UInt8(ascii: ",")) -> [UInt8] {
+            if let text = values.withContiguousStorageIfAvailable({ bytes($0, separator: separator) }) {
+                return text
+            }
+            return Array(values).withUnsafeBufferPointer { bytes($0, separator: separator) }
+        }
+
+        /// Formats a column of binary16 encodings as separated decimal fields
+        ///
+        /// - Parameters:
+        ///   - bitPatterns: The binary16 encodings to format
+        ///   - separator: Byte between fields (defaults to a comma)
+        /// - Returns: ASCII text
+        @inlinable
+        public static func bytes<C: Collection<UInt16>>(
+            binary16 bitPatterns: C,
+            separator: UInt8 = UInt8(ascii: ",")
+        ) -> [UInt8] {
+            if let text = bitPatterns.withContiguousStorageIfAvailable({ bytes(binary16: $0, separator: separator) }) {
+                return text
+            }
+            return Array(bitPatterns).withUnsafeBufferPointer { bytes(binary16: $0, separator: separator) }
+        }
+
+        /// Formats a buffer of Doubles as separated decimal fields
+        public static func bytes(_ values: UnsafeBufferPointer<Double>, separator: UInt8) -> [UInt8] {
+            let capacity = values.count * (binary64MaximumLength + 1)
+            return [UInt8](unsafeUninitializedCapacity: capacity) { buffer, initializedCount in
+                guard let input = values.baseAddress, let output = buffer.baseAddress else { return }
+                initializedCount = ieee754_format_f64_array(input, values.count, separator, output)
+            }
+        }
+
+        /// Formats a buffer of Floats as separated decimal fields
+        public static func bytes(_ values: UnsafeBufferPointer<Float>, separator: UInt8) -> [UInt8] {
+            let capacity = values.count * (binary32MaximumLength + 1)
+            return [UInt8](unsafeUninitializedCapacity: capacity) { buffer, initializedCount in
+                guard let input = values.baseAddress, let output = buffer.baseAddress else { return }
+                initializedCount = ieee754_format_f32_array(input, values.count, separator, output)
+            }
+        }
+
+        /// Formats a buffer of binary16 encodings as separated decimal fields
+        public static func bytes(binary16 bitPatterns: UnsafeBufferPointer<UInt16>, separator: UInt8) -> [UInt8] {
+            let capacity = bitPatterns.count * (binary16MaximumLength + 1)
+            return [UInt8](unsafeUninitializedCapacity: capacity) { buffer, initializedCount in
+                guard let input = bitPatterns.baseAddress, let output = buffer.baseAddress else { return }
+                initializedCount = ieee754_format_f16_array(input, bitPatterns.count, separator, output)
+            }
+        }
+    }
+
+    // MARK: - Parsing
+
+    extension IEEE_754.Conversions.DecimalText {
+        /// Parses decimal text into a Double
+        ///
+        /// Correctly rounded to nearest, ties to even, for any number of
+        /// digits. Out-of-range text gives ±infinity or a subnormal or ±0.
+        ///
+        /// - Parameter text: ASCII text; all of it must be the number
+        /// - Returns: The value, or nil if the text is not a decimal number, infinity or NaN
+        public static func double(from text: UnsafeRawBufferPointer) -> Double? {
+            var result = 0.0
+            guard ieee754_parse_f64(text.baseAddress, text.count, &result) != 0 else { return nil }
+            return result
+        }
+
+        /// Parses decimal text into a Float
+        ///
+        /// Rounded once, directly to binary32; parsing as a Double and
+        /// narrowing instead could round twice.
+        ///
+        /// - Parameter text: ASCII text; all of it must be the number
+        /// - Returns: The value, or nil if the text is malformed
+        public static func float(from text: UnsafeRawBufferPointer) -> Float? {
+            var result: Float = 0
+            guard ieee754_parse_f32(text.baseAddress, text.count, &result) != 0 else { return nil }
+            return result
+        }
+
+        /// Parses decimal text into a binary16 encoding
+        ///
+        /// Rounded once, directly to binary16.
+        ///
+        /// - Parameter text: ASCII text; all of it must be the number
+        /// - Returns: The binary16 encoding, or nil if the text is malformed
+        public static func binary16(from text: UnsafeRawBufferPointer) -> UInt16? {
+            var result: UInt16 = 0
+            guard ieee754_parse_f16(text.baseAddress, text.count, &result) != 0 else { return nil }
+            return result
+        }
+
+        /// Parses decimal text into a Double
+        ///
+        /// Contiguous collections (`[UInt8]`, `ArraySlice<UInt8>`, a native
+        /// `String`'s `utf8`) are read in place.
+        ///
+        /// - Parameter text: ASCII text; all of it must be the number
+        /// - Returns: The value, or nil if the text is malformed
+        ///
+        /// Example:
+        /// ```swift
+        /// IEEE_754.Conversions.DecimalText.double(from: "2.5e-3".utf8)  // 0.0025
+        /// ```
+        @inlinable
+        public static func double<C: Collection<UInt8>>(from text: C) -> Double? {
+            if let value = text.withContiguousStorageIfAvailable({ double(from: UnsafeRawBufferPointer($0)) }) {
+                return value
+            }
+            return Array(text).withUnsafeBytes { double(from: $0) }
+        }
+
+        /// Parses decimal text into a Float
+        ///
+        /// - Parameter text: ASCII text; all of it must be the number
+        /// - Returns: The value, or nil if the text is malformed
+        @inlinable
+        public static func float<C: Collection<UInt8>>(from text: C) -> Float? {
+            if let value = text.withContiguousStorageIfAvailable({ float(from: UnsafeRawBufferPointer($0)) }) {
+                return value
+            }
+            return Array(text).withUnsafeBytes { float(from: $0) }
+        }
+
+        /// Parses decimal text into a binary16 encoding
+        ///
+        /// - Parameter text: ASCII text; all of it must be the number
+        /// - Returns: The binary16 encoding, or nil if the text is malformed
+        @inlinable
+        public static func binary16<C: Collection<UInt8>>(from text: C) -> UInt16? {
+            if let value = text.withContiguousStorageIfAvailable({ binary16(from: UnsafeRawBufferPointer($0)) }) {
+                return value
+            }
+            return Array(text).withUnsafeBytes { binary16(from: $0) }
+        }
+    }
+
+    // MARK: - Bulk Parsing
+
+    extension IEEE_754.Conversions.DecimalText {
+        /// Parses a column of separated decimal fields into Doubles
+        ///
+        /// Each field is parsed as by `double(from:)`, in one pass into the
+        /// result. A single trailing separator is
+        /// allowed, so newline-terminated lines parse as expected.
+        ///
+        /// - Parameters:
+        ///   - text: ASCII fields
+        ///   - separator: Byte between fields (defaults to a comma)
+        /// - Returns: One value per field, or nil if any field is malformed
+        ///
+        /// Example:
+        /// ```swift
+        /// let column = file.withUnsafeBytes {
+        ///     IEEE_754.Conversions.DecimalText.doubles(from: $0, separator: UInt8(ascii: "\n"))
+        /// }
+        /// ```
+        public static func doubles(
+            from text: UnsafeRawBufferPointer,
+            separator: UInt8 = UInt8(ascii: ",")
+        ) -> [Double]? {
+            let count = ieee754_decimal_field_count(text.baseAddress, text.count, separator)
+            var parsed = true
+            let values = [Double](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+                guard let output = buffer.baseAddress else { return }
+                parsed = ieee754_parse_f64_array(text.baseAddress, text.count, separator, output) != 0
+                initializedCount = parsed ? count : 0
+            }
+            return parsed ? values : nil
+        }
+
+        /// Parses a column of separated decimal fields into Floats
+        ///
+        /// - Parameters:
+        ///   - text: ASCII fields
+        ///   - separator: Byte between fields (defaults to a comma)
+        /// - Returns: One value per field, or nil if any field is malformed
+        public static func floats(
+            from text: UnsafeRawBufferPointer,
+            separator: UInt8 = UInt8(ascii: ",")
+        ) -> [Float]? {
+            let count = ieee754_decimal_field_count(text.baseAddress, text.count, separator)
+            var parsed = true
+            let values = [Float](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+                guard let output = buffer.baseAddress else { return }
+                parsed = ieee754_parse_f32_array(text.baseAddress, text.count, separator, output) != 0
+                initializedCount = parsed ? count : 0
+            }
+            return parsed ? values : nil
+        }
+
+        /// Parses a column of separated decimal fields into binary16 encodings
+        ///
+        /// - Parameters:
+        ///   - text: ASCII fields
+        ///   - separator: Byte between fields (defaults to a comma)
+        /// - Returns: One encoding per field, or nil if any field is malformed
+        public static func binary16s(
+            from text: UnsafeRawBufferPointer,
+            separator: UInt8 = UInt8(ascii: ",")
+        ) -> [UInt16]? {
+            let count = ieee754_decimal_field_count(text.baseAddress, text.count, separator)
+            var parsed = true
+            let values = [UInt16](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+                guard let output = buffer.baseAddress else { return }
+                parsed = ieee754_parse_f16_array(text.baseAddress, text.count, separator, output) != 0
+                initializedCount = parsed ? count : 0
+            }
+            return parsed ? values : nil
+        }
+    }
+#endif
@@ -0,0 +1,246 @@
+// IEEE_754.Exceptions.Accounting.swift
+// swift-ieee-754
+//
+// Opt-in per-thread counters of raised exceptions, attributed to labelled scopes
+
+#if canImport(CIEEE754)
+    import CIEEE754
+
+    extension IEEE_754.Exceptions {
+        /// Counting of raised exceptions by call site
+        ///
+        /// Sticky flags say whether an exception happened; accounting says how
+        /// often, and where. Inside ``IEEE_754/Exceptions/withAccounting(_:_:)``
+        /// every raise of a thread-local flag adds one to a 64-bit counter
+        /// owned by the calling thread, under the scope's label. Counters are
+        /// summed across threads only when a ``Snapshot`` is taken, so
+        /// counting never contends between threads, and outside any scope the
+        /// raise path pays a single branch.
+        ///
+        /// Counts are raise events: bulk operations that raise a flag once
+        /// per batch count once per batch.
+        ///
+        /// Example:
+        /// ```swift
+        /// IEEE_754.Exceptions.withAccounting("pricing") {
+        ///     reprice(book)
+        /// }
+        /// let snapshot = IEEE_754.Exceptions.Accounting.snapshot()
+        /// for sample in snapshot.samples {
+        ///     metrics.counter("fp_exceptions", ["scope": sample.scope, "flag": "\(sample.flag)"])
+        ///         .set(sample.count)
+        /// }
+        /// ```
+        public enum Accounting {}
+    }
+
+    // MARK: - Scopes
+
+    extension IEEE_754.Exceptions.Accounting {
+        /// A labelled accounting scope
+        ///
+        /// Labels are registered once per process and compared by content.
+        /// Creating a scope looks its label up; keep hot-path scopes in a
+        /// `static let` to skip the lookup. Up to 62 labels get their own
+        /// counters; further labels share a scope labelled `"other"`.
+        public struct Scope: Sendable, Hashable {
+            internal let index: Int32
+
+            /// Registers or finds the scope for `label`
+            public init(_ label: String) {
+                self.index = label.withCString { ieee754_accounting_scope($0) }
+            }
+
+            /// The scope's label (`"other"` once the label space is exhausted)
+            public var label: String {
+                ieee754_accounting_scope_label(index).map { String(cString: $0) } ?? ""
+            }
+        }
+    }
+
+    // MARK: - Counts
+
+    extension IEEE_754.Exceptions.Accounting {
+        /// Number of times each exception was raised in a scope
+        public struct Counts: Sendable, Hashable {
+            public var invalid: UInt64
+            public var divisionByZero: UInt64
+            public var overflow: UInt64
+            public var underflow: UInt64
+            public var inexact: UInt64
+
+            /// Creates counts from explicit values
+            public init(
+                invalid: UInt64 = 0,
+                divisionByZero: UInt64 = 0,
+                overflow: UInt64 = 0,
+                underflow: UInt64 = 0,
+                inexact: UInt64 = 0
+            ) {
+                self.invalid = invalid
+                self.divisionByZero = divisionByZero
+                self.overflow = overflow
+                self.underflow = underflow
+                self.inexact = inexact
+            }
+
+            internal init(_ counts: IEEE754ExceptionCounts) {
+                self.init(
+                    invalid: counts.invalid,
+                    divisionByZero: counts.divByZero,
+                    overflow: counts.overflow,
+                    underflow: counts.underflow,
+                    inexact: counts.inexact
+                )
+            }
+
+            /// The count for `flag`
+            public subscript(flag: IEEE_754.Exceptions.Flag) -> UInt64 {
+                switch flag {
+                case .invalid: return invalid
+                case .divisionByZero: return divisionByZero
+                case .overflow: return overflow
+                case .underflow: return underflow
+                case .inexact: return inexact
+                }
+            }
+
+            /// Whether nothing was counted
+            public var isZero: Bool {
+                IEEE_754.Exceptions.Flag.allCases.allSatisfy { self[$0] == 0 }
+            }
+        }
+
+        /// One counter in a form ready for a metrics pipeline
+        public struct Sample: Sendable, Hashable {
+            /// Label of the scope the exceptions were raised in
+            public let scope: String
+
+            /// The exception counted
+            public let flag: IEEE_754.Exceptions.Flag
+
+            /// Raises since the last ``IEEE_754/Exceptions/Accounting/reset()``
+            public let count: UInt64
+        }
+
+        /// Counts of every scope, summed over all threads at one point in time
+        public struct Snapshot: Sendable, Equatable {
+            /// Counts by scope label, for scopes with any count
+            public let counts: [String: Counts]
+
+            /// Counts for `label`, zero if nothing was raised under it
+            public subscript(label: String) -> Counts {
+                counts[label] ?? Counts()
+            }
+
+            /// Counts for `scope`
+            public subscript(scope: Scope) -> Counts {
+                self[scope.label]
+            }
+
+            /// Every non-zero counter, ordered by scope label, then flag
+            public var samples: [Sample] {
+                counts.keys.sorted().flatMap { label in
+                    IEEE_754.Exceptions.Flag.allCases.compactMap { flag in
+                        let count = counts[label]![flag]
+                        return count == 0 ? nil : Sample(scope: label, flag: flag, count: count)
+                    }
+                }
+            }
+
+            /// The samples in Prometheus/OpenMetrics text exposition format
+            ///
+            /// One `counter` line per sample, labelled by `scope` and `flag`,
+            /// e.g. `fp_exceptions_total{scope="pricing",flag="overflow"} 3`.
+            ///
+            /// - Parameter metric: Metric name, without the `_total` suffix
+            public func exposition(metric: String = "ieee754_exceptions") -> String {
+                var text = "# TYPE \(metric) counter\n"
+                for sample in samples {
+                    let scope = sample.scope
+                        .replacing("\\", with: "\\\\")
+                        .replacing("\"", with: "\\\"")
+                        .replacing("\n", with: "\\n")
+                    text += "\(metric)_total{scope=\"\(scope)\",flag=\"\(sample.flag)\"} \(sample.count)\n"
+                }
+                return text
+            }
+        }
+    }
+
+    // MARK: - Operations
+
+    extension IEEE_754.Exceptions.Accounting {
+        /// Counts exceptions raised on the current thread under `scope` while `body` runs
+        ///
+        /// Scopes nest: the innermost one receives the counts, and the outer
+        /// scope resumes when `body` returns or throws. Counting follows the
+        /// thread, so `body` is synchronous.
+        ///
+        /// - Parameters:
+        ///   - scope: The scope to count under
+        ///   - body: The code to instrument
+        /// - Returns: The value returned by `body`
+        public static func counting<T>(in scope: Scope, _ body: () throws -> T) rethrows -> T {
+            let previous = ieee754_accounting_enter(scope.index)
+            defer { ieee754_accounting_exit(previous) }
+            return try body()
+        }
+
+        /// Counts of every scope, summed over all threads
+        ///
+        /// Visits each thread's counters once; threads that have exited keep
+        /// contributing their counts.
+        public static func snapshot() -> Snapshot {
+            var counts: [String: Counts] = [:]
+            for index in 0..<Int32(IEEE754_ACCOUNTING_MAX_SCOPES) {
+                guard let label = ieee754_accounting_scope_label(index) else { continue }
+                let scope = Counts(ieee754_accounting_counts(index))
+                if !scope.isZero {
+                    counts[String(cString: label)] = scope
+                }
+            }
+            return Snapshot(counts: counts)
+        }
+
+        /// Counts for one scope, summed over all threads
+        public static func counts(for scope: Scope) -> Counts {
+            Counts(ieee754_accounting_counts(scope.index))
+        }
+
+        /// Resets every counter on every thread
+        ///
+        /// A count added on another thread while the reset runs is either
+        /// cleared or kept; counts taken before it never come back.
+        public static func reset() {
+            ieee754_accounting_reset()
+        }
+    }
+
+    extension IEEE_754.Exceptions {
+        /// Counts exceptions raised on the current thread under `label` while `body` runs
+        ///
+        /// Opt-in accounting: see ``IEEE_754/Exceptions/Accounting``.
+        ///
+        /// - Parameters:
+        ///   - label: Scope label, such as a subsystem name
+        ///   - body: The code to instrument
+        /// - Returns: The value returned by `body`
+        ///
+        /// Example:
+        /// ```swift
+        /// let quote = IEEE_754.Exceptions.withAccounting("pricing") {
+        ///     price(instrument)
+        /// }
+        /// IEEE_754.Exceptions.Accounting.snapshot()["pricing"].overflow
+        /// ```
+        public static func withAccounting<T>(_ label: String, _ body: () throws -> T) rethrows -> T {
+            try Accounting.counting(in: Accounting.Scope(label), body)
+        }
+
+        /// Counts exceptions raised on the current thread under `scope` while `body` runs
+        public static func withAccounting<T>(_ scope: Accounting.Scope, _ body: () throws -> T) rethrows -> T {
+            try Accounting.counting(in: scope, body)
+        }
+    }
+#endif
@@ -30,9 +30,9 @@ extension IEEE_754 {
     ///
     /// ## Thread Safety
     ///
-    /// Exception state is maintained in a thread-safe shared store using Swift's
-    /// Synchronization.Mutex (Foundation-free). All operations are atomic and safe
-    /// to call from multiple threads.
+    /// Exception flags are per-thread: each thread keeps its own 5-bit atomic
+    /// bitmask, so raising a flag is a lock-free relaxed OR that never contends
+    /// with other threads. ``aggregate()`` merges all threads' flags on read.
     ///
     /// ## Usage
     ///
@@ -158,84 +158,171 @@ extension IEEE_754.Exceptions {
     }
 }
 
-// MARK: - Thread-Local Exception State
+// MARK: - Flag Sets
+
+extension IEEE_754.Exceptions.Flag {
+    /// Bit position of this flag in a packed ``IEEE_754/Exceptions/FlagSet``
+    ///
+    /// Matches the `IEEE754ExceptionFlag` numbering of the CIEEE754 target.
+    @inlinable
+    internal var bit: UInt8 {
+        switch self {
+        case .invalid: return 1 << 0
+        case .divisionByZero: return 1 << 1
+        case .overflow: return 1 << 2
+        case .underflow: return 1 << 3
+        case .inexact: return 1 << 4
+        }
+    }
+}
 
 extension IEEE_754.Exceptions {
-    /// Exception state container
-    @usableFromInline
-    final class ExceptionState: @unchecked Sendable {
-        @usableFromInline
-        struct Flags {
-            var invalid: Bool = false
-            var divisionByZero: Bool = false
-            var overflow: Bool = false
-            var underflow: Bool = false
-            var inexact: Bool = false
+    /// A set of IEEE 754 exception flags packed into five bits
+    ///
+    /// Used wherever several flags are read or raised at once, such as
+    /// snapshots of the current thread's state or the aggregate view.
+    ///
+    /// ## Usage
+    ///
+    /// ```swift
+    /// let raised = IEEE_754.Exceptions.raised()
+    /// if raised.contains(.overflow) {
+    ///     // Handle overflow
+    /// }
+    ///
+    /// IEEE_754.Exceptions.raise([.overflow, .inexact])
+    /// ```
+    public struct FlagSet: Sendable, Hashable, ExpressibleByArrayLiteral, CustomStringConvertible {
+        /// Packed flags, one bit per ``IEEE_754/Exceptions/Flag`` in declaration order
+        public let rawValue: UInt8
+
+        /// Creates a set from packed flags, ignoring bits above the fifth
+        @inlinable
+        public init(rawValue: UInt8) {
+            self.rawValue = rawValue & 0x1F
+        }
+
+        /// Creates an empty set
+        @inlinable
+        public init() {
+            self.rawValue = 0
+        }
+
+        /// Creates a set containing a single flag
+        @inlinable
+        public init(_ flag: Flag) {
+            self.rawValue = flag.bit
+        }
+
+        @inlinable
+        public init(arrayLiteral flags: Flag...) {
+            self.rawValue = flags.reduce(0) { $0 | $1.bit }
+        }
+
+        /// All five exception flags
+        public static let all = FlagSet(rawValue: 0x1F)
+
+        /// Whether no flag is set
+        @inlinable
+        public var isEmpty: Bool {
+            rawValue == 0
+        }
+
+        /// Whether the set contains `flag`
+        @inlinable
+        public func contains(_ flag: Flag) -> Bool {
+            rawValue & flag.bit != 0
         }
 
-        private let state = Mutex(Flags())
+        /// Flags present in either set
+        @inlinable
+        public func union(_ other: FlagSet) -> FlagSet {
+            FlagSet(rawValue: rawValue | other.rawValue)
+        }
+
+        /// Flags present in both sets
+        @inlinable
+        public func intersection(_ other: FlagSet) -> FlagSet {
+            FlagSet(rawValue: rawValue & other.rawValue)
+        }
+
+        /// The flags in this set, in ``IEEE_754/Exceptions/Flag/allCases`` order
+        @inlinable
+        public var flags: [Flag] {
+            Flag.allCases.filter { contains($0) }
+        }
+
+        public var description: String {
+            "[" + flags.map(\.description).joined(separator: ", ") + "]"
+        }
+    }
+}
+
+// MARK: - Thread-Local Exception State
+
+extension IEEE_754.Exceptions {
+    /// Software exception flag store
+    ///
+    /// Each thread keeps its own flags as a 5-bit atomic bitmask in the
+    /// CIEEE754 target. Raising a flag is a relaxed atomic OR on memory owned
+    /// by the calling thread: it never takes a lock and never writes a cache
+    /// line shared with other threads. ``IEEE_754/Exceptions/aggregate()``
+    /// merges every thread's flags on read.
+    ///
+    /// Without the C target there is no portable thread-local storage, so a
+    /// single process-wide atomic bitmask is used instead; it is still
+    /// lock-free, but flags are shared between threads.
+    @usableFromInline
+    internal enum Store {
+        #if !canImport(CIEEE754)
+            static let flags = Atomic<UInt8>(0)
+        #endif
 
         @usableFromInline
-        init() {}
+        static func raise(_ mask: UInt8) {
+            #if canImport(CIEEE754)
+                ieee754_raise_exceptions_mask(mask)
+            #else
+                flags.bitwiseOr(mask, ordering: .relaxed)
+            #endif
+        }
 
         @usableFromInline
-        func set(_ flag: Flag) {
-            state.withLock { flags in
-                switch flag {
-                case .invalid: flags.invalid = true
-                case .divisionByZero: flags.divisionByZero = true
-                case .overflow: flags.overflow = true
-                case .underflow: flags.underflow = true
-                case .inexact: flags.inexact = true
-                }
-            }
+        static func load() -> UInt8 {
+            #if canImport(CIEEE754)
+                ieee754_get_exceptions_mask()
+            #else
+                flags.load(ordering: .relaxed)
+            #endif
         }
 
         @usableFromInline
-        func clear(_ flag: Flag) {
-            state.withLock { flags in
-                switch flag {
-                case .invalid: flags.invalid = false
-                case .divisionByZero: flags.divisionByZero = false
-                case .overflow: flags.overflow = false
-                case .underflow: flags.underflow = false
-                case .inexact: flags.inexact = false
-                }
-            }
+        static func clear(_ mask: UInt8) {
+            #if canImport(CIEEE754)
+                ieee754_clear_exceptions_mask(mask)
+            #else
+                flags.bitwiseAnd(~mask, ordering: .relaxed)
+            #endif
         }
 
         @usableFromInline
-        func get(_ flag: Flag) -> Bool {
-            state.withLock { flags in
-                switch flag {
-                case .invalid: return flags.invalid
-                case .divisionByZero: return flags.divisionByZero
-                case .overflow: return flags.overflow
-                case .underflow: return flags.underflow
-                case .inexact: return flags.inexact
-                }
-            }
+        static func loadAggregate() -> UInt8 {
+            #if canImport(CIEEE754)
+                ieee754_get_aggregate_exceptions_mask()
+            #else
+                flags.load(ordering: .relaxed)
+            #endif
         }
 
         @usableFromInline
-        func clearAll() {
-            state.withLock { flags in
-                flags.invalid = false
-                flags.divisionByZero = false
-                flags.overflow = false
-                flags.underflow = false
-                flags.inexact = false
-            }
+        static func clearAggregate() {
+            #if canImport(CIEEE754)
+                ieee754_clear_aggregate_exceptions()
+            #else
+                flags.store(0, ordering: .relaxed)
+            #endif
         }
     }
-
-    /// Global shared exception state
-    ///
-    /// Uses Swift 6.0 Synchronization.Mutex for Foundation-free thread safety.
-    /// For true thread-local storage, use the CIEEE754 C target which provides
-    /// pthread-based TLS on supported platforms.
-    @usableFromInline
-    static let sharedState = ExceptionState()
 }
 
 // MARK: - Exception Operations
@@ -243,7 +330,7 @@ extension IEEE_754.Exceptions {
 extension IEEE_754.Exceptions {
     /// Raise an exception flag
     ///
-    /// Sets the specified exception flag.
+    /// Sets the specified exception flag for the current thread.
     ///
     /// - Parameter flag: The exception flag to raise
     ///
@@ -252,27 +339,29 @@ extension IEEE_754.Exceptions {
     /// IEEE_754.Exceptions.raise(.invalid)
     /// ```
     ///
-    /// Note: This operation is thread-safe.
+    /// Note: This operation is lock-free and thread-safe.
+    @inlinable
     public static func raise(_ flag: Flag) {
-        sharedState.set(flag)
-
-        #if canImport(CIEEE754)
-            // Also raise in C thread-local storage for consistency
-            let cFlag: IEEE754ExceptionFlag
-            switch flag {
-            case .invalid: cFlag = IEEE754_EXCEPTION_INVALID
-            case .divisionByZero: cFlag = IEEE754_EXCEPTION_DIVBYZERO
-            case .overflow: cFlag = IEEE754_EXCEPTION_OVERFLOW
-            case .underflow: cFlag = IEEE754_EXCEPTION_UNDERFLOW
-            case .inexact: cFlag = IEEE754_EXCEPTION_INEXACT
-            }
-            ieee754_raise_exception(cFlag)
-        #endif
+        Store.raise(flag.bit)
+    }
+
+    /// Raise several exception flags at once
+    ///
+    /// - Parameter flags: The exception flags to raise
+    ///
+    /// Example:
+    /// ```swift
+    /// IEEE_754.Exceptions.raise([.overflow, .inexact])
+    /// ```
+    @inlinable
+    public static func raise(_ flags: FlagSet) {
+        Store.raise(flags.rawValue)
     }
 
     /// Test if an exception flag is raised
     ///
-    /// Checks whether the specified exception flag is currently set.
+    /// Checks whether the specified exception flag is currently set for the
+    /// current thread.
     ///
     /// - Parameter flag: The exception flag to test
     /// - Returns: true if the flag is raised, false otherwise
@@ -283,26 +372,30 @@ extension IEEE_754.Exceptions {
     ///     print("Overflow occurred")
     /// }
     /// ```
+    @inlinable
     public static func testFlag(_ flag: Flag) -> Bool {
-        #if canImport(CIEEE754)
-            // Check C thread-local storage (preferred if available)
-            let cFlag: IEEE754ExceptionFlag
-            switch flag {
-            case .invalid: cFlag = IEEE754_EXCEPTION_INVALID
-            case .divisionByZero: cFlag = IEEE754_EXCEPTION_DIVBYZERO
-            case .overflow: cFlag = IEEE754_EXCEPTION_OVERFLOW
-            case .underflow: cFlag = IEEE754_EXCEPTION_UNDERFLOW
-            case .inexact: cFlag = IEEE754_EXCEPTION_INEXACT
-            }
-            return ieee754_test_exception(cFlag) != 0 || sharedState.get(flag)
-        #else
-            return sharedState.get(flag)
-        #endif
+        raised().contains(flag)
+    }
+
+    /// Get the exception flags raised on the current thread
+    ///
+    /// Reads all five flags with a single load.
+    ///
+    /// - Returns: The set of raised flags
+    ///
+    /// Example:
+    /// ```swift
+    /// let raised = IEEE_754.Exceptions.raised()
+    /// if raised.contains(.invalid) { ... }
+    /// ```
+    @inlinable
+    public static func raised() -> FlagSet {
+        FlagSet(rawValue: Store.load())
     }
 
     /// Clear an exception flag
     ///
-    /// Resets the specified exception flag.
+    /// Resets the specified exception flag for the current thread.
     ///
     /// - Parameter flag: The exception flag to clear
     ///
@@ -310,38 +403,60 @@ extension IEEE_754.Exceptions {
     /// ```swift
     /// IEEE_754.Exceptions.clear(.overflow)
     /// ```
+    @inlinable
     public static func clear(_ flag: Flag) {
-        sharedState.clear(flag)
-
-        #if canImport(CIEEE754)
-            // Also clear in C thread-local storage
-            let cFlag: IEEE754ExceptionFlag
-            switch flag {
-            case .invalid: cFlag = IEEE754_EXCEPTION_INVALID
-            case .divisionByZero: cFlag = IEEE754_EXCEPTION_DIVBYZERO
-            case .overflow: cFlag = IEEE754_EXCEPTION_OVERFLOW
-            case .underflow: cFlag = IEEE754_EXCEPTION_UNDERFLOW
-            case .inexact: cFlag = IEEE754_EXCEPTION_INEXACT
-            }
-            ieee754_clear_exception(cFlag)
-        #endif
+        Store.clear(flag.bit)
+    }
+
+    /// Clear several exception flags at once
+    ///
+    /// - Parameter flags: The exception flags to clear
+    @inlinable
+    public static func clear(_ flags: FlagSet) {
+        Store.clear(flags.rawValue)
     }
 
     /// Clear all exception flags
     ///
-    /// Resets all five exception flags to their initial (unraised) state.
+    /// Resets all five exception flags of the current thread to their initial
+    /// (unraised) state.
     ///
     /// Example:
     /// ```swift
     /// IEEE_754.Exceptions.clearAll()
     /// ```
+    @inlinable
     public static func clearAll() {
-        sharedState.clearAll()
+        Store.clear(FlagSet.all.rawValue)
+    }
 
-        #if canImport(CIEEE754)
-            // Also clear C thread-local storage
-            ieee754_clear_all_exceptions()
-        #endif
+    /// Get the exception flags raised on any thread
+    ///
+    /// Merges the flags of every thread on read, including threads that have
+    /// exited since the last ``clearAggregate()``. Use this to check a whole
+    /// worker pool after a parallel computation.
+    ///
+    /// - Returns: The union of all threads' raised flags
+    ///
+    /// Example:
+    /// ```swift
+    /// await runWorkers()
+    /// if IEEE_754.Exceptions.aggregate().contains(.invalid) {
+    ///     print("Some worker hit an invalid operation")
+    /// }
+    /// ```
+    @inlinable
+    public static func aggregate() -> FlagSet {
+        FlagSet(rawValue: Store.loadAggregate())
+    }
+
+    /// Clear exception flags on every thread
+    ///
+    /// Resets the flags of all threads. A flag raised concurrently on another
+    /// thread may survive the clear.
+    @inlinable
+    public static func clearAggregate() {
+        Store.clearAggregate()
     }
 
     /// Test if any exception is raised
@@ -358,7 +473,7 @@ extension IEEE_754.Exceptions {
     /// ```
     @inlinable
     public static func anyRaised() -> Bool {
-        Flag.allCases.contains { testFlag($0) }
+        !raised().isEmpty
     }
 
     /// Get all raised exception flags
@@ -376,7 +491,7 @@ extension IEEE_754.Exceptions {
     /// ```
     @inlinable
     public static func getRaisedFlags() -> [Flag] {
-        Flag.allCases.filter { testFlag($0) }
+        raised().flags
     }
 }
 
@@ -516,3 +631,54 @@ extension IEEE_754.Exceptions {
         }
     #endif
 }
+
+// MARK: - Exception Capture
+
+#if canImport(CIEEE754)
+    extension IEEE_754.Exceptions {
+        /// Runs `body` and reports the exceptions it raised
+        ///
+        /// Saves and clears both the hardware FPU flags and this thread's
+        /// flags on entry, then reads and restores them on exit, with one
+        /// `fegetexceptflag`/`fesetexceptflag` pair in total. Wrapping a whole
+        /// batch costs the same as testing a single operation, so prefer one
+        /// capture around a loop to clearing and testing inside it.
+        ///
+        /// The reported set is the union of hardware and thread-local flags
+        /// raised by `body`; flags that were already raised do not appear.
+        ///
+        /// - Parameters:
+        ///   - merging: When true the raised flags stay set after the call,
+        ///     as if `body` had run without capture; when false the state on
+        ///     entry is restored exactly
+        ///   - body: The code to observe; it must not move to another thread
+        /// - Returns: The value returned by `body` and the exceptions it raised
+        ///
+        /// Example:
+        /// ```swift
+        /// let (scaled, raised) = IEEE_754.Exceptions.capturing {
+        ///     samples.map { $0 * gain }
+        /// }
+        /// if raised.contains(.overflow) {
+        ///     // Some samples no longer fit the format
+        /// }
+        /// ```
+        public static func capturing<T>(
+            merging: Bool = true,
+            _ body: () throws -> T
+        ) rethrows -> (result: T, raised: FlagSet) {
+            var scope = IEEE754ExceptionScope()
+            ieee754_exception_scope_begin(&scope)
+
+            let result: T
+            do {
+                result = try body()
+            } catch {
+                ieee754_exception_scope_end(&scope, merging ? 1 : 0)
+                throw error
+            }
+            let raised = ieee754_exception_scope_end(&scope, merging ? 1 : 0)
+            return (result, FlagSet(rawValue: raised))
+        }
+    }
+#endif
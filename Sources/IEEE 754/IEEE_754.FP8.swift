@@ -0,0 +1,323 @@
+// IEEE_754.FP8.swift
+// swift-ieee-754
+//
+// OCP 8-bit floating point (OFP8) storage formats E4M3 and E5M2
+
+#if canImport(CIEEE754)
+    import CIEEE754
+#endif
+
+extension IEEE_754 {
+    /// 8-bit floating-point storage formats
+    ///
+    /// The two encodings of the Open Compute Project OFP8 specification,
+    /// used for machine learning weights, activations and gradients:
+    ///
+    /// | Format | Exponent | Significand | Bias | Largest finite | Infinities |
+    /// |--------|----------|-------------|------|----------------|------------|
+    /// | E4M3   | 4 bits   | 3 bits      | 7    | 448            | No         |
+    /// | E5M2   | 5 bits   | 2 bits      | 15   | 57344          | Yes        |
+    ///
+    /// E5M2 follows the IEEE 754 layout rules and conforms to
+    /// ``IEEE_754/BinaryFormat``. E4M3 trades infinities for range: only
+    /// `S.1111.111` is NaN, so the top exponent holds finite values.
+    ///
+    /// Both formats widen exactly to Float and narrow with round to
+    /// nearest, ties to even, optionally saturating at the largest finite
+    /// magnitude. Encodings are plain `UInt8` bit patterns.
+    public enum FP8 {}
+}
+
+extension IEEE_754.FP8 {
+    /// OCP FP8 E4M3: 1 sign, 4 exponent and 3 significand bits, no infinities
+    ///
+    /// Example:
+    /// ```swift
+    /// IEEE_754.FP8.E4M3.bitPattern(from: 300)                    // 0x79 (288)
+    /// IEEE_754.FP8.E4M3.bitPattern(from: 1000)                   // 0x7F (NaN)
+    /// IEEE_754.FP8.E4M3.bitPattern(from: 1000, saturating: true) // 0x7E (448)
+    /// ```
+    public enum E4M3 {
+        /// Exponent bits: 4 bits
+        public static let exponentBits: Int = 4
+
+        /// Significand bits: 3 bits (plus implicit leading 1)
+        public static let significandBits: Int = 3
+
+        /// Exponent bias: 7
+        public static let exponentBias: Int = 7
+
+        /// Largest finite value: 1.75 × 2⁸ = 448
+        public static let maxNormal: Float = 448
+
+        /// Smallest positive normal value: 2⁻⁶
+        public static let minNormal: Float = 0x1p-6
+
+        /// Smallest positive subnormal value: 2⁻⁹
+        public static let minSubnormal: Float = 0x1p-9
+
+        /// The positive NaN encoding; `0xFF` is the negative one
+        public static let nanBitPattern: UInt8 = 0x7F
+    }
+
+    /// OCP FP8 E5M2: 1 sign, 5 exponent and 2 significand bits, IEEE 754 rules
+    ///
+    /// The upper byte of a binary16 encoding, with the same special values.
+    ///
+    /// Example:
+    /// ```swift
+    /// IEEE_754.FP8.E5M2.value(bitPattern: 0x3C)      // 1.0
+    /// IEEE_754.FP8.E5M2.numberClass(0xFC)            // .negative(.infinity)
+    /// ```
+    public enum E5M2: IEEE_754.BinaryFormat {
+        public typealias BitPattern = UInt8
+
+        /// Exponent bits: 5 bits, as in binary16
+        @inlinable
+        public static var exponentBits: Int { 5 }
+
+        /// Significand bits: 2 bits (plus implicit leading 1)
+        @inlinable
+        public static var significandBits: Int { 2 }
+
+        /// Largest finite value: 1.75 × 2¹⁵ = 57344
+        public static let maxNormal: Float = 57344
+
+        /// Smallest positive normal value: 2⁻¹⁴
+        public static let minNormal: Float = 0x1p-14
+
+        /// Smallest positive subnormal value: 2⁻¹⁶
+        public static let minSubnormal: Float = 0x1p-16
+    }
+}
+
+// MARK: - Rounding
+
+extension IEEE_754.FP8 {
+    /// Rounds a finite Float magnitude encoding to a narrow format, to nearest with ties to even
+    ///
+    /// Returns the target's magnitude encoding without clamping, so values
+    /// beyond its range come back past the largest finite code.
+    @inlinable
+    internal static func round(_ magnitude: UInt32, significandBits: Int, bias: Int) -> UInt32 {
+        let exponent = Int(magnitude >> 23)
+        let significand = (magnitude & 0x7F_FFFF) | (exponent == 0 ? 0 : 0x80_0000)
+        let effective = max(exponent, 1)
+
+        // Below the target's normal range the quantum stays fixed at 2^(1-bias-t)
+        let denormal = max(0, (1 - bias + 127) - effective)
+        let shift = min(23 - significandBits + denormal, 31)
+
+        var quotient = significand >> shift
+        let remainder = significand & ((1 << shift) - 1)
+        let half: UInt32 = 1 << (shift - 1)
+        if remainder > half || (remainder == half && quotient & 1 == 1) {
+            quotient += 1
+        }
+
+        if denormal > 0 { return quotient }
+        // A carry out of the significand bumps the exponent field by itself
+        return (UInt32(effective - 127 + bias) << significandBits) + quotient - (1 << significandBits)
+    }
+}
+
+// MARK: - Scalar Conversion
+
+extension IEEE_754.FP8.E4M3 {
+    /// Widens an E4M3 encoding to Float
+    ///
+    /// Exact. Both NaN encodings widen to the default quiet NaN with the
+    /// same sign.
+    @inlinable
+    public static func value(bitPattern: UInt8) -> Float {
+        let exponent = Int(bitPattern >> 3) & 0xF
+        let fraction = Float(bitPattern & 0x7)
+        let magnitude: Float
+        if bitPattern & 0x7F == 0x7F {
+            magnitude = .nan
+        } else if exponent == 0 {
+            magnitude = fraction * minSubnormal
+        } else {
+            magnitude = Float(sign: .plus, exponent: exponent - exponentBias, significand: 1 + fraction / 8)
+        }
+        return bitPattern & 0x80 == 0 ? magnitude : -magnitude
+    }
+
+    /// Narrows a Float to an E4M3 encoding
+    ///
+    /// Rounds to nearest, ties to even. E4M3 has no infinities: without
+    /// saturation, infinities and finite values that round beyond
+    /// ``maxNormal`` become NaN. Raises no exceptions; use the bulk
+    /// ``narrow(_:into:saturating:)`` for exception counts.
+    ///
+    /// - Parameters:
+    ///   - value: The value to narrow
+    ///   - saturating: When true, out-of-range values and infinities become ±``maxNormal``
+    /// - Returns: The E4M3 encoding
+    @inlinable
+    public static func bitPattern(from value: Float, saturating: Bool = false) -> UInt8 {
+        let bits = value.bitPattern
+        let sign = UInt8(truncatingIfNeeded: bits >> 24) & 0x80
+        let magnitude = bits & 0x7FFF_FFFF
+
+        if magnitude > 0x7F80_0000 {
+            return sign | nanBitPattern
+        }
+        let rounded =
+            magnitude == 0x7F80_0000
+            ? UInt32.max : IEEE_754.FP8.round(magnitude, significandBits: significandBits, bias: exponentBias)
+        if rounded > 0x7E {
+            return sign | (saturating ? 0x7E : nanBitPattern)
+        }
+        return sign | UInt8(rounded)
+    }
+}
+
+extension IEEE_754.FP8.E5M2 {
+    /// Widens an E5M2 encoding to Float
+    ///
+    /// Exact. NaN payloads are kept unchanged.
+    @inlinable
+    public static func value(bitPattern: UInt8) -> Float {
+        let sign = UInt32(bitPattern & 0x80) << 24
+        let exponent = UInt32(bitPattern >> 2) & 0x1F
+        let fraction = UInt32(bitPattern & 0x3)
+        switch exponent {
+        case 0:
+            let subnormal = Float(fraction) * minSubnormal
+            return Float(bitPattern: sign | subnormal.bitPattern)
+        case 0x1F:
+            return Float(bitPattern: sign | 0x7F80_0000 | fraction << 21)
+        default:
+            return Float(bitPattern: sign | (exponent + 112) << 23 | fraction << 21)
+        }
+    }
+
+    /// Narrows a Float to an E5M2 encoding
+    ///
+    /// Rounds to nearest, ties to even. NaNs are quieted; finite values
+    /// that round beyond ``maxNormal`` become ±infinity. Raises no
+    /// exceptions; use the bulk ``narrow(_:into:saturating:)`` for
+    /// exception counts.
+    ///
+    /// - Parameters:
+    ///   - value: The value to narrow
+    ///   - saturating: When true, out-of-range values and infinities become ±``maxNormal``
+    /// - Returns: The E5M2 encoding
+    @inlinable
+    public static func bitPattern(from value: Float, saturating: Bool = false) -> UInt8 {
+        let bits = value.bitPattern
+        let sign = UInt8(truncatingIfNeeded: bits >> 24) & 0x80
+        let magnitude = bits & 0x7FFF_FFFF
+
+        if magnitude > 0x7F80_0000 {
+            return sign | 0x7E | UInt8(truncatingIfNeeded: magnitude >> 21) & 1
+        }
+        let rounded =
+            magnitude == 0x7F80_0000
+            ? UInt32.max : IEEE_754.FP8.round(magnitude, significandBits: significandBits, bias: exponentBias)
+        if rounded > 0x7B {
+            return sign | (saturating ? 0x7B : 0x7C)
+        }
+        return sign | UInt8(rounded)
+    }
+}
+
+// MARK: - Bulk Conversion
+
+#if canImport(CIEEE754)
+    extension IEEE_754.FP8.E4M3 {
+        /// Widens E4M3 encodings to Float in bulk
+        ///
+        /// Exact and vectorized; signals no exceptions.
+        ///
+        /// - Parameters:
+        ///   - source: E4M3 encodings
+        ///   - destination: Storage for at least `source.count` results
+        public static func widen(
+            _ source: UnsafeBufferPointer<UInt8>,
+            into destination: UnsafeMutableBufferPointer<Float>
+        ) {
+            precondition(destination.count >= source.count, "Result buffer is too small")
+            guard let input = source.baseAddress, let output = destination.baseAddress else { return }
+            ieee754_fp8_e4m3_widen_array(input, output, source.count)
+        }
+
+        /// Narrows Floats to E4M3 encodings in bulk
+        ///
+        /// Same results as ``bitPattern(from:saturating:)``, vectorized, with
+        /// each exception raised once for the batch. Finite values that
+        /// become NaN, and saturated infinities, count as overflow; an
+        /// infinity that becomes NaN signals invalid.
+        ///
+        /// - Parameters:
+        ///   - source: The values to narrow
+        ///   - destination: Storage for at least `source.count` encodings
+        ///   - saturating: Clamp out-of-range values to ±``maxNormal``
+        /// - Returns: Exception counts for the batch
+        ///
+        /// Example:
+        /// ```swift
+        /// let summary = IEEE_754.FP8.E4M3.narrow(activations, into: storage, saturating: true)
+        /// if summary.overflow > 0 {
+        ///     // Rescale before the next step
+        /// }
+        /// ```
+        @discardableResult
+        public static func narrow(
+            _ source: UnsafeBufferPointer<Float>,
+            into destination: UnsafeMutableBufferPointer<UInt8>,
+            saturating: Bool = false
+        ) -> IEEE_754.Conversions.Summary {
+            precondition(destination.count >= source.count, "Destination buffer is too small")
+            guard let input = source.baseAddress, let output = destination.baseAddress else {
+                return IEEE_754.Conversions.Summary()
+            }
+            let summary = ieee754_convert_f32_to_fp8_e4m3_array(input, output, source.count, saturating ? 1 : 0)
+            return IEEE_754.Conversions.Summary(summary)
+        }
+    }
+
+    extension IEEE_754.FP8.E5M2 {
+        /// Widens E5M2 encodings to Float in bulk
+        ///
+        /// Exact and vectorized; signals no exceptions.
+        ///
+        /// - Parameters:
+        ///   - source: E5M2 encodings
+        ///   - destination: Storage for at least `source.count` results
+        public static func widen(
+            _ source: UnsafeBufferPointer<UInt8>,
+            into destination: UnsafeMutableBufferPointer<Float>
+        ) {
+            precondition(destination.count >= source.count, "Result buffer is too small")
+            guard let input = source.baseAddress, let output = destination.baseAddress else { return }
+            ieee754_fp8_e5m2_widen_array(input, output, source.count)
+        }
+
+        /// Narrows Floats to E5M2 encodings in bulk
+        ///
+        /// Same results as ``bitPattern(from:saturating:)``, vectorized, with
+        /// each exception raised once for the batch. Saturated infinities
+        /// count as overflow.
+        ///
+        /// - Parameters:
+        ///   - source: The values to narrow
+        ///   - destination: Storage for at least `source.count` encodings
+        ///   - saturating: Clamp out-of-range values to ±``maxNormal``
+        /// - Returns: Exception counts for the batch
+        @discardableResult
+        public static func narrow(
+            _ source: UnsafeBufferPointer<Float>,
+            into destination: UnsafeMutableBufferPointer<UInt8>,
+            saturating: Bool = false
+        ) -> IEEE_754.Conversions.Summary {
+            precondition(destination.count >= source.count, "Destination buffer is too small")
+            guard let input = source.baseAddress, let output = destination.baseAddress else {
+                return IEEE_754.Conversions.Summary()
+            }
+            let summary = ieee754_convert_f32_to_fp8_e5m2_array(input, output, source.count, saturating ? 1 : 0)
+            return IEEE_754.Conversions.Summary(summary)
+        }
+    }
+#endif
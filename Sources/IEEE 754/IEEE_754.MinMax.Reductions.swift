@@ -0,0 +1,482 @@
+// IEEE_754.MinMax.Reductions.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 9.6: Minimum and maximum reductions over collections
+
+// MARK: - Reduction Engine
+
+extension IEEE_754.MinMax {
+    /// Result of one pass over a run of bit patterns
+    ///
+    /// Every IEEE 754 min/max operation is an unsigned integer min or max over
+    /// a key derived from the bit pattern:
+    ///
+    /// - `minimum`/`maximum` use the totalOrder key, which orders -0 before +0
+    /// - Magnitude operations use `|bits| << 1 | isPositive`, which orders by
+    ///   magnitude and breaks ties toward -x for minimum and +x for maximum
+    ///
+    /// NaN lanes are excluded from both extremes and reported separately, so
+    /// the selection itself is branch-free and runs SIMD-wide.
+    @usableFromInline
+    internal struct Reduction<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar> {
+        /// Smallest key among non-NaN elements (`Key.max` if there were none)
+        @usableFromInline
+        internal var lowest: Key
+
+        /// Largest key among non-NaN elements (`0` if there were none)
+        @usableFromInline
+        internal var highest: Key
+
+        @usableFromInline
+        internal var sawNaN: Bool
+
+        @usableFromInline
+        internal var sawNumber: Bool
+
+        @inlinable
+        internal init(lowest: Key, highest: Key, sawNaN: Bool, sawNumber: Bool) {
+            self.lowest = lowest
+            self.highest = highest
+            self.sawNaN = sawNaN
+            self.sawNumber = sawNumber
+        }
+    }
+
+    @inlinable
+    @inline(__always)
+    internal static func reductionKey<Key: FixedWidthInteger & UnsignedInteger>(_ bits: Key, magnitude: Bool) -> Key {
+        if magnitude {
+            return (bits &<< 1) | (~bits &>> (Key.bitWidth &- 1))
+        }
+        return IEEE_754.RadixSort.totalOrderKey(bits)
+    }
+
+    @inlinable
+    @inline(__always)
+    internal static func reductionKey<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar>(
+        _ bits: SIMD8<Key>,
+        magnitude: Bool
+    ) -> SIMD8<Key> {
+        if magnitude {
+            return (bits &<< 1) | (~bits &>> Key(Key.bitWidth &- 1))
+        }
+        let signBit: Key = 1 &<< (Key.bitWidth &- 1)
+        let negative = 0 &- (bits &>> Key(Key.bitWidth &- 1))
+        return bits ^ (negative | signBit)
+    }
+
+    @inlinable
+    @inline(__always)
+    internal static func bits<Key: FixedWidthInteger & UnsignedInteger>(
+        fromReductionKey key: Key,
+        magnitude: Bool
+    ) -> Key {
+        if magnitude {
+            return (key &>> 1) | ((~key & 1) &<< (Key.bitWidth &- 1))
+        }
+        return IEEE_754.RadixSort.bits(fromTotalOrderKey: key)
+    }
+
+    /// Single pass over `bits`, eight lanes at a time
+    ///
+    /// - Parameters:
+    ///   - bits: Bit patterns of the values
+    ///   - infinity: Bit pattern of +∞; larger magnitudes are NaN
+    ///   - magnitude: Whether to use magnitude keys
+    @inlinable
+    internal static func reduce<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar>(
+        _ bits: UnsafeBufferPointer<Key>,
+        infinity: Key,
+        magnitude: Bool
+    ) -> Reduction<Key> {
+        let signMask: Key = ~(1 &<< (Key.bitWidth &- 1))
+        let count = bits.count
+        var index = 0
+
+        var lowest = SIMD8<Key>(repeating: .max)
+        var highest = SIMD8<Key>(repeating: 0)
+        var nanLanes = lowest .!= lowest
+        var numberLanes = nanLanes
+
+        if let base = bits.baseAddress {
+            while index &+ 8 <= count {
+                let p = base + index
+                let lanes = SIMD8<Key>(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7])
+                let isNaN = (lanes & signMask) .> infinity
+                let keys = reductionKey(lanes, magnitude: magnitude)
+
+                lowest = pointwiseMin(lowest, keys.replacing(with: .max, where: isNaN))
+                highest = pointwiseMax(highest, keys.replacing(with: 0, where: isNaN))
+                nanLanes .|= isNaN
+                numberLanes .|= .!isNaN
+                index &+= 8
+            }
+        }
+
+        var result = Reduction(
+            lowest: lowest.min(),
+            highest: highest.max(),
+            sawNaN: any(nanLanes),
+            sawNumber: any(numberLanes)
+        )
+
+        while index < count {
+            let value = bits[index]
+            if value & signMask > infinity {
+                result.sawNaN = true
+            } else {
+                let key = reductionKey(value, magnitude: magnitude)
+                result.lowest = Swift.min(result.lowest, key)
+                result.highest = Swift.max(result.highest, key)
+                result.sawNumber = true
+            }
+            index &+= 1
+        }
+
+        return result
+    }
+}
+
+// MARK: - Double Reductions
+
+extension IEEE_754.MinMax {
+    @inlinable
+    internal static func reduction<C: Collection<Double>>(_ values: C, magnitude: Bool) -> Reduction<UInt64>? {
+        if let summary = values.withContiguousStorageIfAvailable({ reduction($0, magnitude: magnitude) }) {
+            return summary
+        }
+        return Array(values).withUnsafeBufferPointer { reduction($0, magnitude: magnitude) }
+    }
+
+    @inlinable
+    internal static func reduction(_ values: UnsafeBufferPointer<Double>, magnitude: Bool) -> Reduction<UInt64>? {
+        guard !values.isEmpty else { return nil }
+        return values.withMemoryRebound(to: UInt64.self) { bits in
+            reduce(bits, infinity: 0x7FF0_0000_0000_0000, magnitude: magnitude)
+        }
+    }
+
+    @inlinable
+    internal static func value(_ reduction: Reduction<UInt64>, _ mode: Operation.Mode, magnitude: Bool) -> Double {
+        let key = mode == .minimum ? reduction.lowest : reduction.highest
+        return Double(bitPattern: bits(fromReductionKey: key, magnitude: magnitude))
+    }
+
+    /// Reduces a collection of Double values with any IEEE 754 min/max operation
+    ///
+    /// Equivalent to folding `apply(_:_:operation:)` over the elements, but
+    /// computed in one vectorized pass with no per-element branches. Contiguous
+    /// collections (arrays, slices, buffers) are read in place.
+    ///
+    /// - Parameters:
+    ///   - values: The values to reduce
+    ///   - operation: The min/max operation
+    /// - Returns: The selected element, NaN as the operation prescribes, or
+    ///   nil if `values` is empty
+    ///
+    /// Example:
+    /// ```swift
+    /// let values: [Double] = [3.0, -0.0, .nan, 0.0]
+    /// IEEE_754.MinMax.reduce(values, operation: .standard(.minimum))  // nan
+    /// IEEE_754.MinMax.reduce(values, operation: .number(.minimum))    // -0.0
+    /// ```
+    @inlinable
+    public static func reduce<C: Collection<Double>>(_ values: C, operation: Operation) -> Double? {
+        switch operation {
+        case .standard(let mode):
+            guard let summary = reduction(values, magnitude: false) else { return nil }
+            return summary.sawNaN ? .nan : value(summary, mode, magnitude: false)
+        case .number(let mode):
+            guard let summary = reduction(values, magnitude: false) else { return nil }
+            return summary.sawNumber ? value(summary, mode, magnitude: false) : .nan
+        case .magnitude(let mode, preferNumber: false):
+            guard let summary = reduction(values, magnitude: true) else { return nil }
+            return summary.sawNaN ? .nan : value(summary, mode, magnitude: true)
+        case .magnitude(let mode, preferNumber: true):
+            guard let summary = reduction(values, magnitude: true) else { return nil }
+            return summary.sawNumber ? value(summary, mode, magnitude: true) : .nan
+        }
+    }
+
+    /// `minimum` reduction over Double values
+    ///
+    /// Smallest element; NaN if any element is NaN. -0.0 is below +0.0.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func minimum<C: Collection<Double>>(_ values: C) -> Double? {
+        reduce(values, operation: .standard(.minimum))
+    }
+
+    /// `maximum` reduction over Double values
+    ///
+    /// Largest element; NaN if any element is NaN. +0.0 is above -0.0.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func maximum<C: Collection<Double>>(_ values: C) -> Double? {
+        reduce(values, operation: .standard(.maximum))
+    }
+
+    /// `minimumNumber` reduction over Double values
+    ///
+    /// Smallest non-NaN element; NaN only if every element is NaN.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func minimumNumber<C: Collection<Double>>(_ values: C) -> Double? {
+        reduce(values, operation: .number(.minimum))
+    }
+
+    /// `maximumNumber` reduction over Double values
+    ///
+    /// Largest non-NaN element; NaN only if every element is NaN.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func maximumNumber<C: Collection<Double>>(_ values: C) -> Double? {
+        reduce(values, operation: .number(.maximum))
+    }
+
+    /// `minimumMagnitude` reduction over Double values
+    ///
+    /// Element of smallest magnitude (ties prefer the negative); NaN if any element is NaN.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func minimumMagnitude<C: Collection<Double>>(_ values: C) -> Double? {
+        reduce(values, operation: .magnitude(.minimum, preferNumber: false))
+    }
+
+    /// `maximumMagnitude` reduction over Double values
+    ///
+    /// Element of largest magnitude (ties prefer the positive); NaN if any element is NaN.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func maximumMagnitude<C: Collection<Double>>(_ values: C) -> Double? {
+        reduce(values, operation: .magnitude(.maximum, preferNumber: false))
+    }
+
+    /// `minimumMagnitudeNumber` reduction over Double values
+    ///
+    /// Non-NaN element of smallest magnitude; NaN only if every element is NaN.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func minimumMagnitudeNumber<C: Collection<Double>>(_ values: C) -> Double? {
+        reduce(values, operation: .magnitude(.minimum, preferNumber: true))
+    }
+
+    /// `maximumMagnitudeNumber` reduction over Double values
+    ///
+    /// Non-NaN element of largest magnitude; NaN only if every element is NaN.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func maximumMagnitudeNumber<C: Collection<Double>>(_ values: C) -> Double? {
+        reduce(values, operation: .magnitude(.maximum, preferNumber: true))
+    }
+
+    /// `minimum` and `maximum` of Double values in a single pass
+    ///
+    /// Both results follow `minimum`/`maximum` semantics: if any
+    /// element is NaN, both are NaN.
+    ///
+    /// - Returns: The extremes, or nil if `values` is empty
+    ///
+    /// Example:
+    /// ```swift
+    /// IEEE_754.MinMax.minMax([Double]([2.0, -0.0, 7.5, 0.0]))  // (-0.0, 7.5)
+    /// ```
+    @inlinable
+    public static func minMax<C: Collection<Double>>(_ values: C) -> (minimum: Double, maximum: Double)? {
+        guard let summary = reduction(values, magnitude: false) else { return nil }
+        guard !summary.sawNaN else { return (.nan, .nan) }
+        return (value(summary, .minimum, magnitude: false), value(summary, .maximum, magnitude: false))
+    }
+
+    /// `minimumNumber` and `maximumNumber` of Double values in a single pass
+    ///
+    /// NaN elements are skipped; both results are NaN only if every element is NaN.
+    ///
+    /// - Returns: The extremes, or nil if `values` is empty
+    @inlinable
+    public static func minMaxNumber<C: Collection<Double>>(_ values: C) -> (minimum: Double, maximum: Double)? {
+        guard let summary = reduction(values, magnitude: false) else { return nil }
+        guard summary.sawNumber else { return (.nan, .nan) }
+        return (value(summary, .minimum, magnitude: false), value(summary, .maximum, magnitude: false))
+    }
+}
+
+// MARK: - Float Reductions
+
+extension IEEE_754.MinMax {
+    @inlinable
+    internal static func reduction<C: Collection<Float>>(_ values: C, magnitude: Bool) -> Reduction<UInt32>? {
+        if let summary = values.withContiguousStorageIfAvailable({ reduction($0, magnitude: magnitude) }) {
+            return summary
+        }
+        return Array(values).withUnsafeBufferPointer { reduction($0, magnitude: magnitude) }
+    }
+
+    @inlinable
+    internal static func reduction(_ values: UnsafeBufferPointer<Float>, magnitude: Bool) -> Reduction<UInt32>? {
+        guard !values.isEmpty else { return nil }
+        return values.withMemoryRebound(to: UInt32.self) { bits in
+            reduce(bits, infinity: 0x7F80_0000, magnitude: magnitude)
+        }
+    }
+
+    @inlinable
+    internal static func value(_ reduction: Reduction<UInt32>, _ mode: Operation.Mode, magnitude: Bool) -> Float {
+        let key = mode == .minimum ? reduction.lowest : reduction.highest
+        return Float(bitPattern: bits(fromReductionKey: key, magnitude: magnitude))
+    }
+
+    /// Reduces a collection of Float values with any IEEE 754 min/max operation
+    ///
+    /// Equivalent to folding `apply(_:_:operation:)` over the elements, but
+    /// computed in one vectorized pass with no per-element branches. Contiguous
+    /// collections (arrays, slices, buffers) are read in place.
+    ///
+    /// - Parameters:
+    ///   - values: The values to reduce
+    ///   - operation: The min/max operation
+    /// - Returns: The selected element, NaN as the operation prescribes, or
+    ///   nil if `values` is empty
+    ///
+    /// Example:
+    /// ```swift
+    /// let values: [Float] = [3.0, -0.0, .nan, 0.0]
+    /// IEEE_754.MinMax.reduce(values, operation: .standard(.minimum))  // nan
+    /// IEEE_754.MinMax.reduce(values, operation: .number(.minimum))    // -0.0
+    /// ```
+    @inlinable
+    public static func reduce<C: Collection<Float>>(_ values: C, operation: Operation) -> Float? {
+        switch operation {
+        case .standard(let mode):
+            guard let summary = reduction(values, magnitude: false) else { return nil }
+            return summary.sawNaN ? .nan : value(summary, mode, magnitude: false)
+        case .number(let mode):
+            guard let summary = reduction(values, magnitude: false) else { return nil }
+            return summary.sawNumber ? value(summary, mode, magnitude: false) : .nan
+        case .magnitude(let mode, preferNumber: false):
+            guard let summary = reduction(values, magnitude: true) else { return nil }
+            return summary.sawNaN ? .nan : value(summary, mode, magnitude: true)
+        case .magnitude(let mode, preferNumber: true):
+            guard let summary = reduction(values, magnitude: true) else { return nil }
+            return summary.sawNumber ? value(summary, mode, magnitude: true) : .nan
+        }
+    }
+
+    /// `minimum` reduction over Float values
+    ///
+    /// Smallest element; NaN if any element is NaN. -0.0 is below +0.0.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func minimum<C: Collection<Float>>(_ values: C) -> Float? {
+        reduce(values, operation: .standard(.minimum))
+    }
+
+    /// `maximum` reduction over Float values
+    ///
+    /// Largest element; NaN if any element is NaN. +0.0 is above -0.0.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func maximum<C: Collection<Float>>(_ values: C) -> Float? {
+        reduce(values, operation: .standard(.maximum))
+    }
+
+    /// `minimumNumber` reduction over Float values
+    ///
+    /// Smallest non-NaN element; NaN only if every element is NaN.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func minimumNumber<C: Collection<Float>>(_ values: C) -> Float? {
+        reduce(values, operation: .number(.minimum))
+    }
+
+    /// `maximumNumber` reduction over Float values
+    ///
+    /// Largest non-NaN element; NaN only if every element is NaN.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func maximumNumber<C: Collection<Float>>(_ values: C) -> Float? {
+        reduce(values, operation: .number(.maximum))
+    }
+
+    /// `minimumMagnitude` reduction over Float values
+    ///
+    /// Element of smallest magnitude (ties prefer the negative); NaN if any element is NaN.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func minimumMagnitude<C: Collection<Float>>(_ values: C) -> Float? {
+        reduce(values, operation: .magnitude(.minimum, preferNumber: false))
+    }
+
+    /// `maximumMagnitude` reduction over Float values
+    ///
+    /// Element of largest magnitude (ties prefer the positive); NaN if any element is NaN.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func maximumMagnitude<C: Collection<Float>>(_ values: C) -> Float? {
+        reduce(values, operation: .magnitude(.maximum, preferNumber: false))
+    }
+
+    /// `minimumMagnitudeNumber` reduction over Float values
+    ///
+    /// Non-NaN element of smallest magnitude; NaN only if every element is NaN.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func minimumMagnitudeNumber<C: Collection<Float>>(_ values: C) -> Float? {
+        reduce(values, operation: .magnitude(.minimum, preferNumber: true))
+    }
+
+    /// `maximumMagnitudeNumber` reduction over Float values
+    ///
+    /// Non-NaN element of largest magnitude; NaN only if every element is NaN.
+    ///
+    /// - Returns: The reduced value, or nil if `values` is empty
+    @inlinable
+    public static func maximumMagnitudeNumber<C: Collection<Float>>(_ values: C) -> Float? {
+        reduce(values, operation: .magnitude(.maximum, preferNumber: true))
+    }
+
+    /// `minimum` and `maximum` of Float values in a single pass
+    ///
+    /// Both results follow `minimum`/`maximum` semantics: if any
+    /// element is NaN, both are NaN.
+    ///
+    /// - Returns: The extremes, or nil if `values` is empty
+    ///
+    /// Example:
+    /// ```swift
+    /// IEEE_754.MinMax.minMax([Float]([2.0, -0.0, 7.5, 0.0]))  // (-0.0, 7.5)
+    /// ```
+    @inlinable
+    public static func minMax<C: Collection<Float>>(_ values: C) -> (minimum: Float, maximum: Float)? {
+        guard let summary = reduction(values, magnitude: false) else { return nil }
+        guard !summary.sawNaN else { return (.nan, .nan) }
+        return (value(summary, .minimum, magnitude: false), value(summary, .maximum, magnitude: false))
+    }
+
+    /// `minimumNumber` and `maximumNumber` of Float values in a single pass
+    ///
+    /// NaN elements are skipped; both results are NaN only if every element is NaN.
+    ///
+    /// - Returns: The extremes, or nil if `values` is empty
+    @inlinable
+    public static func minMaxNumber<C: Collection<Float>>(_ values: C) -> (minimum: Float, maximum: Float)? {
+        guard let summary = reduction(values, magnitude: false) else { return nil }
+        guard summary.sawNumber else { return (.nan, .nan) }
+        return (value(summary, .minimum, magnitude: false), value(summary, .maximum, magnitude: false))
+    }
+}
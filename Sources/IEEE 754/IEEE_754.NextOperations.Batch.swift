@@ -0,0 +1,586 @@
+// IEEE_754.NextOperations.Batch.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 5.3.1: Next operations and ULP distances over whole buffers
+
+// MARK: - Lane Kernels
+
+extension IEEE_754.NextOperations {
+    @inlinable
+    @inline(__always)
+    internal static func load<Element: SIMDScalar>(_ p: UnsafePointer<Element>) -> SIMD8<Element> {
+        SIMD8<Element>(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7])
+    }
+
+    /// Applies `kernel` to `source` eight elements at a time, writing to `result`
+    ///
+    /// The final partial block is run from a zero-padded copy and only its
+    /// live lanes are stored. `result` may be `source`'s own storage: each
+    /// block is read in full before it is written.
+    @inlinable
+    @inline(__always)
+    internal static func map<Element: SIMDScalar, Result: SIMDScalar>(
+        _ source: UnsafeBufferPointer<Element>,
+        into result: UnsafeMutablePointer<Result>,
+        _ kernel: (SIMD8<Element>) -> SIMD8<Result>
+    ) {
+        guard let base = source.baseAddress else { return }
+        let full = source.count & ~7
+
+        var index = 0
+        while index < full {
+            let lanes = kernel(load(base + index))
+            for lane in 0..<8 {
+                result[index &+ lane] = lanes[lane]
+            }
+            index &+= 8
+        }
+
+        let remainder = source.count &- full
+        guard remainder > 0 else { return }
+        var tail = SIMD8<Element>()
+        for lane in 0..<remainder {
+            tail[lane] = base[full &+ lane]
+        }
+        let lanes = kernel(tail)
+        for lane in 0..<remainder {
+            result[full &+ lane] = lanes[lane]
+        }
+    }
+
+    /// Two-input form of ``map(_:into:_:)``
+    @inlinable
+    @inline(__always)
+    internal static func map<Element: SIMDScalar, Result: SIMDScalar>(
+        _ first: UnsafeBufferPointer<Element>,
+        _ second: UnsafeBufferPointer<Element>,
+        into result: UnsafeMutablePointer<Result>,
+        _ kernel: (SIMD8<Element>, SIMD8<Element>) -> SIMD8<Result>
+    ) {
+        precondition(first.count == second.count, "Buffers differ in length")
+        guard let a = first.baseAddress, let b = second.baseAddress else { return }
+        let full = first.count & ~7
+
+        var index = 0
+        while index < full {
+            let lanes = kernel(load(a + index), load(b + index))
+            for lane in 0..<8 {
+                result[index &+ lane] = lanes[lane]
+            }
+            index &+= 8
+        }
+
+        let remainder = first.count &- full
+        guard remainder > 0 else { return }
+        var tailA = SIMD8<Element>()
+        var tailB = SIMD8<Element>()
+        for lane in 0..<remainder {
+            tailA[lane] = a[full &+ lane]
+            tailB[lane] = b[full &+ lane]
+        }
+        let lanes = kernel(tailA, tailB)
+        for lane in 0..<remainder {
+            result[full &+ lane] = lanes[lane]
+        }
+    }
+
+    /// `nextUp` of eight encodings, without branches
+    ///
+    /// Same results as ``IEEE_754/BinaryFormat/nextUp(_:)``: one integer
+    /// step away from zero for positive values and toward zero for negative
+    /// ones, then `±0 → +least subnormal`, `+∞ → +∞` and NaNs quieted are
+    /// blended in with lane selects.
+    @inlinable
+    @inline(__always)
+    internal static func nextUp<F: IEEE_754.BinaryFormat>(
+        _ lanes: SIMD8<F.BitPattern>,
+        as _: F.Type
+    ) -> SIMD8<F.BitPattern> where F.BitPattern: SIMDScalar {
+        let magnitude = lanes & ~F.signMask
+        let step = SIMD8<F.BitPattern>(repeating: 1).replacing(with: F.BitPattern.max, where: lanes .!= magnitude)
+
+        var result = lanes &+ step
+        result.replace(with: 1, where: magnitude .== 0)
+        result.replace(with: lanes, where: lanes .== F.exponentMask)
+        result.replace(with: lanes | F.quietBit, where: magnitude .> F.exponentMask)
+        return result
+    }
+
+    /// `nextDown` of eight encodings: `-nextUp(-x)`, which also holds for NaNs
+    @inlinable
+    @inline(__always)
+    internal static func nextDown<F: IEEE_754.BinaryFormat>(
+        _ lanes: SIMD8<F.BitPattern>,
+        as format: F.Type
+    ) -> SIMD8<F.BitPattern> where F.BitPattern: SIMDScalar {
+        nextUp(lanes ^ F.signMask, as: format) ^ F.signMask
+    }
+
+    /// Maps encodings to unsigned keys that count representable values
+    ///
+    /// Like the totalOrder key, but with the sign-magnitude encoding turned
+    /// into two's complement first, so that −0 and +0 share a key and
+    /// neighbouring values of any sign differ by exactly one. Meaningless
+    /// for NaNs.
+    @inlinable
+    @inline(__always)
+    internal static func ordinalKey<F: IEEE_754.BinaryFormat>(
+        _ lanes: SIMD8<F.BitPattern>,
+        as _: F.Type
+    ) -> SIMD8<F.BitPattern> where F.BitPattern: SIMDScalar {
+        let magnitude = lanes & ~F.signMask
+        let ordinal = magnitude.replacing(with: SIMD8(repeating: 0) &- magnitude, where: lanes .!= magnitude)
+        return ordinal ^ F.signMask
+    }
+
+    /// `nextAfter` of eight encodings toward eight targets
+    ///
+    /// Matches the scalar `nextAfter(_:toward:)`: the default NaN if either
+    /// operand is NaN, `target` when the two compare equal, and otherwise
+    /// `nextUp` or `nextDown` of `value`.
+    @inlinable
+    @inline(__always)
+    internal static func nextAfter<F: IEEE_754.BinaryFormat>(
+        _ value: SIMD8<F.BitPattern>,
+        toward target: SIMD8<F.BitPattern>,
+        as format: F.Type
+    ) -> SIMD8<F.BitPattern> where F.BitPattern: SIMDScalar {
+        let valueKey = ordinalKey(value, as: format)
+        let targetKey = ordinalKey(target, as: format)
+        let unordered = ((value & ~F.signMask) .> F.exponentMask) .| ((target & ~F.signMask) .> F.exponentMask)
+
+        var result = nextUp(value, as: format)
+        result.replace(with: nextDown(value, as: format), where: valueKey .> targetKey)
+        result.replace(with: target, where: valueKey .== targetKey)
+        result.replace(with: F.exponentMask | F.quietBit, where: unordered)
+        return result
+    }
+
+    /// ULP distance of eight pairs of encodings; `BitPattern.max` where either is NaN
+    @inlinable
+    @inline(__always)
+    internal static func ulpDistance<F: IEEE_754.BinaryFormat>(
+        _ a: SIMD8<F.BitPattern>,
+        _ b: SIMD8<F.BitPattern>,
+        as format: F.Type
+    ) -> SIMD8<F.BitPattern> where F.BitPattern: SIMDScalar {
+        let keyA = ordinalKey(a, as: format)
+        let keyB = ordinalKey(b, as: format)
+        let unordered = ((a & ~F.signMask) .> F.exponentMask) .| ((b & ~F.signMask) .> F.exponentMask)
+
+        var distance = (keyA &- keyB).replacing(with: keyB &- keyA, where: keyA .< keyB)
+        distance.replace(with: F.BitPattern.max, where: unordered)
+        return distance
+    }
+
+    /// Largest ``ulpDistance(_:_:as:)`` over two equally long buffers; 0 if empty
+    @inlinable
+    internal static func maximumUlpDistance<F: IEEE_754.BinaryFormat>(
+        _ first: UnsafeBufferPointer<F.BitPattern>,
+        _ second: UnsafeBufferPointer<F.BitPattern>,
+        as format: F.Type
+    ) -> F.BitPattern where F.BitPattern: SIMDScalar {
+        precondition(first.count == second.count, "Buffers differ in length")
+        guard let a = first.baseAddress, let b = second.baseAddress else { return 0 }
+        let full = first.count & ~7
+
+        var maximum = SIMD8<F.BitPattern>(repeating: 0)
+        var index = 0
+        while index < full {
+            let distance = ulpDistance(load(a + index), load(b + index), as: format)
+            maximum.replace(with: distance, where: distance .> maximum)
+            index &+= 8
+        }
+
+        var result = maximum.max()
+        for index in full..<first.count {
+            let distance = ulpDistance(
+                SIMD8(repeating: a[index]), SIMD8(repeating: b[index]), as: format
+            )[0]
+            result = Swift.max(result, distance)
+        }
+        return result
+    }
+}
+
+// MARK: - Buffer Kernels
+
+extension IEEE_754.NextOperations {
+    @inlinable
+    internal static func transformed<T, F: IEEE_754.BinaryFormat>(
+        _ values: UnsafeBufferPointer<T>,
+        as format: F.Type,
+        _ kernel: (SIMD8<F.BitPattern>) -> SIMD8<F.BitPattern>
+    ) -> [T] where F.BitPattern: SIMDScalar {
+        [T](unsafeUninitializedCapacity: values.count) { buffer, initialized in
+            values.withMemoryRebound(to: F.BitPattern.self) { bits in
+                buffer.withMemoryRebound(to: F.BitPattern.self) { result in
+                    if let output = result.baseAddress {
+                        map(bits, into: output, kernel)
+                    }
+                }
+            }
+            initialized = values.count
+        }
+    }
+
+    @inlinable
+    internal static func transform<T, F: IEEE_754.BinaryFormat>(
+        _ values: UnsafeMutableBufferPointer<T>,
+        as format: F.Type,
+        _ kernel: (SIMD8<F.BitPattern>) -> SIMD8<F.BitPattern>
+    ) where F.BitPattern: SIMDScalar {
+        values.withMemoryRebound(to: F.BitPattern.self) { bits in
+            if let output = bits.baseAddress {
+                map(UnsafeBufferPointer(bits), into: output, kernel)
+            }
+        }
+    }
+}
+
+// MARK: - Double Batch Operations
+
+extension IEEE_754.NextOperations {
+    /// `nextUp` of every element - IEEE 754 `nextUp` over a buffer
+    ///
+    /// Eight bit patterns per step, with zeros, +∞ and NaNs handled by lane
+    /// selects rather than branches. Element-for-element equal to
+    /// `nextUp(_:)`, NaNs included. Contiguous collections are
+    /// read in place.
+    ///
+    /// - Parameter values: The starting values
+    /// - Returns: The next value toward +∞ of each element
+    ///
+    /// Example:
+    /// ```swift
+    /// let upper = IEEE_754.NextOperations.nextUp(bounds.upper)
+    /// let lower = IEEE_754.NextOperations.nextDown(bounds.lower)
+    /// ```
+    @inlinable
+    public static func nextUp<C: Collection<Double>>(_ values: C) -> [Double] {
+        if let result = values.withContiguousStorageIfAvailable({ nextUp($0) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { nextUp($0) }
+    }
+
+    @inlinable
+    internal static func nextUp(_ values: UnsafeBufferPointer<Double>) -> [Double] {
+        transformed(values, as: IEEE_754.Binary64.self) { nextUp($0, as: IEEE_754.Binary64.self) }
+    }
+
+    /// `nextDown` of every element - IEEE 754 `nextDown` over a buffer
+    ///
+    /// - Parameter values: The starting values
+    /// - Returns: The next value toward -∞ of each element
+    @inlinable
+    public static func nextDown<C: Collection<Double>>(_ values: C) -> [Double] {
+        if let result = values.withContiguousStorageIfAvailable({ nextDown($0) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { nextDown($0) }
+    }
+
+    @inlinable
+    internal static func nextDown(_ values: UnsafeBufferPointer<Double>) -> [Double] {
+        transformed(values, as: IEEE_754.Binary64.self) { nextDown($0, as: IEEE_754.Binary64.self) }
+    }
+
+    /// Replaces every element with its `nextUp`, in place
+    ///
+    /// - Parameter values: The values to step toward +∞
+    @inlinable
+    public static func formNextUp<C: MutableCollection<Double>>(_ values: inout C) {
+        let done = values.withContiguousMutableStorageIfAvailable { buffer in
+            transform(buffer, as: IEEE_754.Binary64.self) { nextUp($0, as: IEEE_754.Binary64.self) }
+        }
+        guard done == nil else { return }
+        for index in values.indices {
+            values[index] = values[index].nextUp
+        }
+    }
+
+    /// Replaces every element with its `nextDown`, in place
+    ///
+    /// - Parameter values: The values to step toward -∞
+    @inlinable
+    public static func formNextDown<C: MutableCollection<Double>>(_ values: inout C) {
+        let done = values.withContiguousMutableStorageIfAvailable { buffer in
+            transform(buffer, as: IEEE_754.Binary64.self) { nextDown($0, as: IEEE_754.Binary64.self) }
+        }
+        guard done == nil else { return }
+        for index in values.indices {
+            values[index] = values[index].nextDown
+        }
+    }
+
+    /// `nextAfter` of every element toward the matching target
+    ///
+    /// Element-for-element equal to `nextAfter(_:toward:)`.
+    ///
+    /// - Parameters:
+    ///   - values: The starting values
+    ///   - targets: One target per value
+    /// - Returns: The next value of each element toward its target
+    @inlinable
+    public static func nextAfter<C: Collection<Double>, Targets: Collection<Double>>(
+        _ values: C,
+        toward targets: Targets
+    ) -> [Double] {
+        precondition(values.count == targets.count, "Values and targets differ in length")
+        return withContiguous(values, targets) { values, targets in
+            [Double](unsafeUninitializedCapacity: values.count) { buffer, initialized in
+                values.withMemoryRebound(to: UInt64.self) { values in
+                    targets.withMemoryRebound(to: UInt64.self) { targets in
+                        buffer.withMemoryRebound(to: UInt64.self) { result in
+                            guard let output = result.baseAddress else { return }
+                            map(values, targets, into: output) {
+                                nextAfter($0, toward: $1, as: IEEE_754.Binary64.self)
+                            }
+                        }
+                    }
+                }
+                initialized = values.count
+            }
+        }
+    }
+
+    /// Distance in units in the last place - the number of `nextUp` steps from one value to the other
+    ///
+    /// Counts the representable values between `a` and `b`: adjacent values
+    /// are 1 apart, −0 and +0 are 0 apart, and ±∞ is one step beyond
+    /// ±`greatestFiniteMagnitude`. Symmetric in `a` and `b`.
+    ///
+    /// - Parameters:
+    ///   - a: First value
+    ///   - b: Second value
+    /// - Returns: The distance, or `UInt64.max` if either value is NaN
+    ///
+    /// Example:
+    /// ```swift
+    /// IEEE_754.NextOperations.ulpDistance(1.0, 1.0.nextUp)                 // 1
+    /// IEEE_754.NextOperations.ulpDistance(-0.0, 0.0)                       // 0
+    /// IEEE_754.NextOperations.ulpDistance(-.leastNonzeroMagnitude, .leastNonzeroMagnitude)  // 2
+    /// ```
+    @inlinable
+    public static func ulpDistance(_ a: Double, _ b: Double) -> UInt64 {
+        ulpDistance(SIMD8(repeating: a.bitPattern), SIMD8(repeating: b.bitPattern), as: IEEE_754.Binary64.self)[0]
+    }
+
+    /// ULP distance of every pair of elements
+    ///
+    /// Element-for-element equal to `ulpDistance(_:_:)`,
+    /// computed eight pairs per step on the bit patterns.
+    ///
+    /// - Parameters:
+    ///   - a: First values, for example computed results
+    ///   - b: Second values, for example reference results
+    /// - Returns: One distance per pair; `UInt64.max` where either is NaN
+    @inlinable
+    public static func ulpDistance<A: Collection<Double>, B: Collection<Double>>(_ a: A, _ b: B) -> [UInt64] {
+        precondition(a.count == b.count, "Collections differ in length")
+        return withContiguous(a, b) { a, b in
+            [UInt64](unsafeUninitializedCapacity: a.count) { buffer, initialized in
+                a.withMemoryRebound(to: UInt64.self) { a in
+                    b.withMemoryRebound(to: UInt64.self) { b in
+                        guard let output = buffer.baseAddress else { return }
+                        map(a, b, into: output) { ulpDistance($0, $1, as: IEEE_754.Binary64.self) }
+                    }
+                }
+                initialized = a.count
+            }
+        }
+    }
+
+    /// Largest ULP distance between paired elements, without materializing the distances
+    ///
+    /// - Parameters:
+    ///   - a: First values
+    ///   - b: Second values
+    /// - Returns: The largest distance; 0 for empty input, `UInt64.max` if any pair has a NaN
+    ///
+    /// Example:
+    /// ```swift
+    /// let worst = IEEE_754.NextOperations.maximumUlpDistance(computed, reference)
+    /// #expect(worst <= 4)
+    /// ```
+    @inlinable
+    public static func maximumUlpDistance<A: Collection<Double>, B: Collection<Double>>(_ a: A, _ b: B) -> UInt64 {
+        precondition(a.count == b.count, "Collections differ in length")
+        return withContiguous(a, b) { a, b in
+            a.withMemoryRebound(to: UInt64.self) { a in
+                b.withMemoryRebound(to: UInt64.self) { b in
+                    maximumUlpDistance(a, b, as: IEEE_754.Binary64.self)
+                }
+            }
+        }
+    }
+}
+
+// MARK: - Float Batch Operations
+
+extension IEEE_754.NextOperations {
+    /// `nextUp` of every element - IEEE 754 `nextUp` over a buffer
+    ///
+    /// - Parameter values: The starting values
+    /// - Returns: The next value toward +∞ of each element
+    @inlinable
+    public static func nextUp<C: Collection<Float>>(_ values: C) -> [Float] {
+        if let result = values.withContiguousStorageIfAvailable({ nextUp($0) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { nextUp($0) }
+    }
+
+    @inlinable
+    internal static func nextUp(_ values: UnsafeBufferPointer<Float>) -> [Float] {
+        transformed(values, as: IEEE_754.Binary32.self) { nextUp($0, as: IEEE_754.Binary32.self) }
+    }
+
+    /// `nextDown` of every element - IEEE 754 `nextDown` over a buffer
+    ///
+    /// - Parameter values: The starting values
+    /// - Returns: The next value toward -∞ of each element
+    @inlinable
+    public static func nextDown<C: Collection<Float>>(_ values: C) -> [Float] {
+        if let result = values.withContiguousStorageIfAvailable({ nextDown($0) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { nextDown($0) }
+    }
+
+    @inlinable
+    internal static func nextDown(_ values: UnsafeBufferPointer<Float>) -> [Float] {
+        transformed(values, as: IEEE_754.Binary32.self) { nextDown($0, as: IEEE_754.Binary32.self) }
+    }
+
+    /// Replaces every element with its `nextUp`, in place
+    ///
+    /// - Parameter values: The values to step toward +∞
+    @inlinable
+    public static func formNextUp<C: MutableCollection<Float>>(_ values: inout C) {
+        let done = values.withContiguousMutableStorageIfAvailable { buffer in
+            transform(buffer, as: IEEE_754.Binary32.self) { nextUp($0, as: IEEE_754.Binary32.self) }
+        }
+        guard done == nil else { return }
+        for index in values.indices {
+            values[index] = values[index].nextUp
+        }
+    }
+
+    /// Replaces every element with its `nextDown`, in place
+    ///
+    /// - Parameter values: The values to step toward -∞
+    @inlinable
+    public static func formNextDown<C: MutableCollection<Float>>(_ values: inout C) {
+        let done = values.withContiguousMutableStorageIfAvailable { buffer in
+            transform(buffer, as: IEEE_754.Binary32.self) { nextDown($0, as: IEEE_754.Binary32.self) }
+        }
+        guard done == nil else { return }
+        for index in values.indices {
+            values[index] = values[index].nextDown
+        }
+    }
+
+    /// `nextAfter` of every element toward the matching target
+    ///
+    /// - Parameters:
+    ///   - values: The starting values
+    ///   - targets: One target per value
+    /// - Returns: The next value of each element toward its target
+    @inlinable
+    public static func nextAfter<C: Collection<Float>, Targets: Collection<Float>>(
+        _ values: C,
+        toward targets: Targets
+    ) -> [Float] {
+        precondition(values.count == targets.count, "Values and targets differ in length")
+        return withContiguous(values, targets) { values, targets in
+            [Float](unsafeUninitializedCapacity: values.count) { buffer, initialized in
+                values.withMemoryRebound(to: UInt32.self) { values in
+                    targets.withMemoryRebound(to: UInt32.self) { targets in
+                        buffer.withMemoryRebound(to: UInt32.self) { result in
+                            guard let output = result.baseAddress else { return }
+                            map(values, targets, into: output) {
+                                nextAfter($0, toward: $1, as: IEEE_754.Binary32.self)
+                            }
+                        }
+                    }
+                }
+                initialized = values.count
+            }
+        }
+    }
+
+    /// Distance in units in the last place between two Float values
+    ///
+    /// - Parameters:
+    ///   - a: First value
+    ///   - b: Second value
+    /// - Returns: The distance, or `UInt32.max` if either value is NaN
+    @inlinable
+    public static func ulpDistance(_ a: Float, _ b: Float) -> UInt32 {
+        ulpDistance(SIMD8(repeating: a.bitPattern), SIMD8(repeating: b.bitPattern), as: IEEE_754.Binary32.self)[0]
+    }
+
+    /// ULP distance of every pair of elements
+    ///
+    /// - Parameters:
+    ///   - a: First values
+    ///   - b: Second values
+    /// - Returns: One distance per pair; `UInt32.max` where either is NaN
+    @inlinable
+    public static func ulpDistance<A: Collection<Float>, B: Collection<Float>>(_ a: A, _ b: B) -> [UInt32] {
+        precondition(a.count == b.count, "Collections differ in length")
+        return withContiguous(a, b) { a, b in
+            [UInt32](unsafeUninitializedCapacity: a.count) { buffer, initialized in
+                a.withMemoryRebound(to: UInt32.self) { a in
+                    b.withMemoryRebound(to: UInt32.self) { b in
+                        guard let output = buffer.baseAddress else { return }
+                        map(a, b, into: output) { ulpDistance($0, $1, as: IEEE_754.Binary32.self) }
+                    }
+                }
+                initialized = a.count
+            }
+        }
+    }
+
+    /// Largest ULP distance between paired elements
+    ///
+    /// - Parameters:
+    ///   - a: First values
+    ///   - b: Second values
+    /// - Returns: The largest distance; 0 for empty input, `UInt32.max` if any pair has a NaN
+    @inlinable
+    public static func maximumUlpDistance<A: Collection<Float>, B: Collection<Float>>(_ a: A, _ b: B) -> UInt32 {
+        precondition(a.count == b.count, "Collections differ in length")
+        return withContiguous(a, b) { a, b in
+            a.withMemoryRebound(to: UInt32.self) { a in
+                b.withMemoryRebound(to: UInt32.self) { b in
+                    maximumUlpDistance(a, b, as: IEEE_754.Binary32.self)
+                }
+            }
+        }
+    }
+}
+
+// MARK: - Contiguous Access
+
+extension IEEE_754.NextOperations {
+    /// Calls `body` with contiguous views of both collections, copying only those that are not contiguous
+    @inlinable
+    internal static func withContiguous<A: Collection, B: Collection<A.Element>, R>(
+        _ a: A,
+        _ b: B,
+        _ body: (UnsafeBufferPointer<A.Element>, UnsafeBufferPointer<A.Element>) -> R
+    ) -> R {
+        let result = a.withContiguousStorageIfAvailable { a in
+            b.withContiguousStorageIfAvailable { b in body(a, b) }
+        }
+        if let result = result ?? nil {
+            return result
+        }
+        return Array(a).withUnsafeBufferPointer { a in
+            Array(b).withUnsafeBufferPointer { b in body(a, b) }
+        }
+    }
+}
@@ -0,0 +1,201 @@
+// IEEE_754.Parallel.swift
+// swift-ieee-754
+//
+// Chunked structured-concurrency helpers for bulk operations
+
+#if canImport(CIEEE754)
+    import CIEEE754
+#endif
+
+#if canImport(Dispatch)
+    import Dispatch
+#endif
+
+extension IEEE_754 {
+    /// Chunked parallel execution for bulk IEEE 754 kernels
+    ///
+    /// Splits an index space into a fixed set of contiguous chunks and runs
+    /// one child task per chunk in a task group. Chunk boundaries depend only
+    /// on the element count and the processor count, so work that combines
+    /// per-chunk results in chunk order is deterministic.
+    @usableFromInline
+    internal enum Parallel {}
+}
+
+extension IEEE_754.Parallel {
+    /// A mutable buffer that may be shared across child tasks
+    ///
+    /// Callers are responsible for giving each task a disjoint region to write.
+    @usableFromInline
+    internal struct Buffer<Element>: @unchecked Sendable {
+        @usableFromInline
+        internal let base: UnsafeMutablePointer<Element>
+
+        @usableFromInline
+        internal let count: Int
+
+        @inlinable
+        internal init(_ buffer: UnsafeMutableBufferPointer<Element>) {
+            // An empty buffer may have no base address; never dereferenced then
+            self.base = buffer.baseAddress ?? UnsafeMutablePointer(bitPattern: MemoryLayout<Element>.alignment)!
+            self.count = buffer.count
+        }
+
+        @inlinable
+        internal subscript(index: Int) -> Element {
+            get { base[index] }
+            nonmutating set { base[index] = newValue }
+        }
+
+        /// The elements in `range` as a buffer
+        @inlinable
+        internal func slice(_ range: Range<Int>) -> UnsafeMutableBufferPointer<Element> {
+            UnsafeMutableBufferPointer(start: base + range.lowerBound, count: range.count)
+        }
+    }
+
+    /// Number of processors available for parallel work
+    @usableFromInline
+    internal static var processorCount: Int {
+        #if canImport(CIEEE754)
+            Int(ieee754_processor_count())
+        #else
+            1
+        #endif
+    }
+
+    /// Splits `0..<count` into contiguous chunks of at least `minimumChunk` elements
+    ///
+    /// Produces at most one chunk per processor, and a single chunk when
+    /// `count` is too small to be worth splitting.
+    @usableFromInline
+    internal static func chunks(count: Int, minimumChunk: Int) -> [Range<Int>] {
+        let parts = max(1, min(processorCount, count / max(1, minimumChunk)))
+        let base = count / parts
+        let remainder = count % parts
+
+        var ranges: [Range<Int>] = []
+        ranges.reserveCapacity(parts)
+        var start = 0
+        for part in 0..<parts {
+            let end = start + base + (part < remainder ? 1 : 0)
+            ranges.append(start..<end)
+            start = end
+        }
+        return ranges
+    }
+
+    /// Runs `body` once per chunk, concurrently, and waits for all of them
+    @usableFromInline
+    internal static func forEach(
+        _ chunks: [Range<Int>],
+        _ body: @escaping @Sendable (_ chunk: Int, _ range: Range<Int>) -> Void
+    ) async {
+        guard chunks.count > 1 else {
+            if let only = chunks.first { body(0, only) }
+            return
+        }
+
+        await withTaskGroup(of: Void.self) { group in
+            for (chunk, range) in chunks.enumerated() {
+                group.addTask { body(chunk, range) }
+            }
+        }
+    }
+}
+
+// MARK: - Codec Parallelism
+
+extension IEEE_754 {
+    /// When and how bulk codecs split their work across cores
+    ///
+    /// Inputs smaller than `threshold` bytes are processed on the calling
+    /// thread. Larger inputs are cut into `chunkSize`-byte pieces that idle
+    /// cores pick up one at a time, so a slow core delays at most one piece.
+    /// The output is written in place, so the result is the same for every
+    /// setting.
+    ///
+    /// Example:
+    /// ```swift
+    /// let samples = [Double](bytes: payload, endianness: .big, parallel: .automatic)
+    /// let eager = IEEE_754.Parallelism(threshold: 1 << 20)
+    /// ```
+    public struct Parallelism: Sendable, Hashable {
+        /// Smallest input, in bytes, that is split across cores
+        public var threshold: Int
+
+        /// Bytes per work item; the default fits comfortably in a per-core L2 cache
+        public var chunkSize: Int
+
+        /// Creates a policy from a threshold and a chunk size, both in bytes
+        public init(threshold: Int = 1 << 22, chunkSize: Int = 1 << 18) {
+            precondition(chunkSize > 0, "Chunk size must be positive")
+            self.threshold = threshold
+            self.chunkSize = chunkSize
+        }
+
+        /// Splits inputs of 4 MiB and more into 256 KiB chunks
+        public static let automatic = Parallelism()
+
+        /// Always processes on the calling thread
+        public static let disabled = Parallelism(threshold: .max)
+    }
+}
+
+extension IEEE_754.Parallel {
+    /// Source and destination of one codec run, shared by the worker threads
+    internal struct Region: @unchecked Sendable {
+        let source: UnsafeRawPointer
+        let destination: UnsafeMutableRawPointer
+    }
+
+    /// Copies `count` elements of `size` bytes, byte-swapping each one when `swapping` is set
+    ///
+    /// Runs of at least `parallelism.threshold` bytes are split into chunks
+    /// handed out to libdispatch's worker pool, with the calling thread
+    /// taking part; each chunk writes its own disjoint part of
+    /// `destination`. Task groups are not used here because the decoders
+    /// write into an array still being initialized, which cannot be kept
+    /// open across a suspension point.
+    ///
+    /// `size` must be 2, 4 or 8; the regions must not overlap.
+    @usableFromInline
+    internal static func transcode(
+        _ count: Int,
+        size: Int,
+        from source: UnsafeRawPointer,
+        to destination: UnsafeMutableRawPointer,
+        swapping: Bool,
+        parallelism: IEEE_754.Parallelism
+    ) {
+        let region = Region(source: source, destination: destination)
+        let chunk = max(1, parallelism.chunkSize / size)
+        let chunks = (count + chunk - 1) / chunk
+
+        #if canImport(Dispatch)
+            if count * size >= parallelism.threshold, chunks > 1, processorCount > 1 {
+                DispatchQueue.concurrentPerform(iterations: chunks) { index in
+                    let start = index * chunk
+                    transcode(region, start..<min(count, start + chunk), size: size, swapping: swapping)
+                }
+                return
+            }
+        #endif
+        transcode(region, 0..<count, size: size, swapping: swapping)
+    }
+
+    internal static func transcode(_ region: Region, _ range: Range<Int>, size: Int, swapping: Bool) {
+        let offset = range.lowerBound * size
+        let source = region.source + offset
+        let destination = region.destination + offset
+        guard swapping else {
+            destination.copyMemory(from: source, byteCount: range.count * size)
+            return
+        }
+        switch size {
+        case 2: IEEE_754.ByteOrder.swap16(range.count, from: source, to: destination)
+        case 4: IEEE_754.ByteOrder.swap32(range.count, from: source, to: destination)
+        default: IEEE_754.ByteOrder.swap64(range.count, from: source, to: destination)
+        }
+    }
+}
@@ -0,0 +1,307 @@
+// IEEE_754.Payload.Batch.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 6.2: NaN payload scans and rewrites over whole buffers
+
+// MARK: - Results
+
+extension IEEE_754.Payload {
+    /// Positions and payloads of the NaN elements of a buffer
+    ///
+    /// `payloads[i]` is the payload of the NaN at `indices[i]`, as returned by
+    /// `extract(from:)`; indices are ascending.
+    ///
+    /// Example:
+    /// ```swift
+    /// let missing = IEEE_754.Payload.scan(column)
+    /// for (row, reason) in zip(missing.indices, missing.payloads) {
+    ///     log(row, MissingReason(rawValue: reason))
+    /// }
+    /// ```
+    public struct Occurrences<Payload: FixedWidthInteger & UnsignedInteger & Sendable>: Sendable, Equatable {
+        /// Positions of the NaN elements
+        public let indices: [Int]
+
+        /// Payload of each NaN element
+        public let payloads: [Payload]
+
+        @inlinable
+        public init(indices: [Int], payloads: [Payload]) {
+            precondition(indices.count == payloads.count, "Index and payload counts differ")
+            self.indices = indices
+            self.payloads = payloads
+        }
+
+        /// Number of NaN elements found
+        @inlinable
+        public var count: Int { indices.count }
+    }
+}
+
+// MARK: - Batch Kernel
+
+extension IEEE_754.Payload {
+    /// Calls `body` with the index of every NaN in `bits`, in ascending order
+    ///
+    /// Tests eight bit patterns per step and skips blocks without a NaN, so
+    /// the cost on mostly-numeric data is a compare and a branch per block.
+    @inlinable
+    @inline(__always)
+    internal static func forEachNaN<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar>(
+        _ bits: UnsafeBufferPointer<Key>,
+        infinity: Key,
+        _ body: (Int) -> Void
+    ) {
+        guard let base = bits.baseAddress else { return }
+        let magnitudeMask = Key.max &>> 1
+        let full = bits.count & ~7
+
+        var block = 0
+        while block < full {
+            let p = base + block
+            let lanes = SIMD8<Key>(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7])
+            var mask = IEEE_754.Classification.byte((lanes & magnitudeMask) .> infinity, as: Key.self)
+            while mask != 0 {
+                body(block &+ mask.trailingZeroBitCount)
+                mask &= mask &- 1
+            }
+            block &+= 8
+        }
+        for index in full..<bits.count where bits[index] & magnitudeMask > infinity {
+            body(index)
+        }
+    }
+
+    @inlinable
+    internal static func occurrences<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar & Sendable>(
+        _ bits: UnsafeBufferPointer<Key>,
+        infinity: Key,
+        payloadMask: Key
+    ) -> Occurrences<Key> {
+        var indices: [Int] = []
+        var payloads: [Key] = []
+        forEachNaN(bits, infinity: infinity) { index in
+            indices.append(index)
+            payloads.append(bits[index] & payloadMask)
+        }
+        return Occurrences(indices: indices, payloads: payloads)
+    }
+
+    @inlinable
+    internal static func column<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar>(
+        _ bits: UnsafeBufferPointer<Key>,
+        infinity: Key,
+        payloadMask: Key,
+        default value: Key
+    ) -> [Key] {
+        [Key](unsafeUninitializedCapacity: bits.count) { column, initialized in
+            column.initialize(repeating: value)
+            forEachNaN(bits, infinity: infinity) { index in
+                column[index] = bits[index] & payloadMask
+            }
+            initialized = bits.count
+        }
+    }
+
+    /// Rewrites each NaN payload `p` below `table.count` to `table[p]`
+    ///
+    /// Sign and quiet bit are kept. A signaling NaN whose new payload is
+    /// zero gets payload 1 instead, as in `encodeSignalingNaN(payload:)`, so
+    /// it cannot turn into an infinity.
+    ///
+    /// - Returns: Number of elements rewritten
+    @inlinable
+    internal static func remap<Key: FixedWidthInteger & UnsignedInteger & SIMDScalar>(
+        _ bits: UnsafeMutableBufferPointer<Key>,
+        table: UnsafeBufferPointer<Key>,
+        infinity: Key,
+        quietBit: Key,
+        payloadMask: Key
+    ) -> Int {
+        var rewritten = 0
+        forEachNaN(UnsafeBufferPointer(bits), infinity: infinity) { index in
+            let pattern = bits[index]
+            let payload = Int(truncatingIfNeeded: pattern & payloadMask)
+            guard payload < table.count else { return }
+            var replacement = table[payload] & payloadMask
+            if pattern & quietBit == 0 && replacement == 0 {
+                replacement = 1
+            }
+            bits[index] = pattern & ~payloadMask | replacement
+            rewritten &+= 1
+        }
+        return rewritten
+    }
+}
+
+// MARK: - Double Batch Operations
+
+extension IEEE_754.Payload {
+    /// Finds every NaN in a buffer of Double values with its payload
+    ///
+    /// One pass over the bit patterns; contiguous collections are read in
+    /// place. Quiet and signaling NaNs are both reported.
+    ///
+    /// - Parameter values: The values to scan
+    /// - Returns: Indices and payloads of the NaN elements
+    @inlinable
+    public static func scan<C: Collection<Double>>(_ values: C) -> Occurrences<UInt64> {
+        if let result = values.withContiguousStorageIfAvailable({ scan($0) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { scan($0) }
+    }
+
+    @inlinable
+    internal static func scan(_ values: UnsafeBufferPointer<Double>) -> Occurrences<UInt64> {
+        values.withMemoryRebound(to: UInt64.self) { bits in
+            occurrences(bits, infinity: 0x7FF0_0000_0000_0000, payloadMask: 0x0007_FFFF_FFFF_FFFF)
+        }
+    }
+
+    /// Dense payload column for a buffer of Double values
+    ///
+    /// - Parameters:
+    ///   - values: The values to scan
+    ///   - value: Entry for elements that are not NaN; the default `UInt64.max`
+    ///     is wider than any payload, so it cannot be mistaken for one
+    /// - Returns: One entry per element: the NaN payload, or `value`
+    ///
+    /// Example:
+    /// ```swift
+    /// let reasons = IEEE_754.Payload.payloads([1.0, IEEE_754.Payload.encodeQuietNaN(payload: 7)])
+    /// // [UInt64.max, 7]
+    /// ```
+    @inlinable
+    public static func payloads<C: Collection<Double>>(_ values: C, default value: UInt64 = .max) -> [UInt64] {
+        if let result = values.withContiguousStorageIfAvailable({ payloads($0, default: value) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { payloads($0, default: value) }
+    }
+
+    @inlinable
+    internal static func payloads(_ values: UnsafeBufferPointer<Double>, default value: UInt64) -> [UInt64] {
+        values.withMemoryRebound(to: UInt64.self) { bits in
+            column(bits, infinity: 0x7FF0_0000_0000_0000, payloadMask: 0x0007_FFFF_FFFF_FFFF, default: value)
+        }
+    }
+
+    /// Rewrites NaN payloads in place through a lookup table
+    ///
+    /// Each NaN whose payload `p` is below `table.count` gets payload
+    /// `table[p]`; other NaNs and all numbers are left untouched. The sign
+    /// and the quiet/signaling kind of every NaN are preserved.
+    ///
+    /// - Parameters:
+    ///   - values: The values to rewrite
+    ///   - table: Replacement payload for each source payload
+    /// - Returns: Number of NaNs rewritten
+    ///
+    /// Example:
+    /// ```swift
+    /// // Collapse legacy reason codes 0...3 onto the current scheme
+    /// IEEE_754.Payload.remap(&column, table: [0, 10, 10, 20])
+    /// ```
+    @inlinable
+    @discardableResult
+    public static func remap<C: MutableCollection<Double>>(_ values: inout C, table: [UInt64]) -> Int {
+        if let result = values.withContiguousMutableStorageIfAvailable({ remap($0, table: table) }) {
+            return result
+        }
+        var copy = Array(values)
+        let result = copy.withUnsafeMutableBufferPointer { remap($0, table: table) }
+        for (index, value) in zip(values.indices, copy) {
+            values[index] = value
+        }
+        return result
+    }
+
+    @inlinable
+    internal static func remap(_ values: UnsafeMutableBufferPointer<Double>, table: [UInt64]) -> Int {
+        values.withMemoryRebound(to: UInt64.self) { bits in
+            table.withUnsafeBufferPointer { table in
+                remap(
+                    bits,
+                    table: table,
+                    infinity: 0x7FF0_0000_0000_0000,
+                    quietBit: 0x0008_0000_0000_0000,
+                    payloadMask: 0x0007_FFFF_FFFF_FFFF
+                )
+            }
+        }
+    }
+}
+
+// MARK: - Float Batch Operations
+
+extension IEEE_754.Payload {
+    /// Finds every NaN in a buffer of Float values with its payload
+    ///
+    /// - Parameter values: The values to scan
+    /// - Returns: Indices and payloads of the NaN elements
+    @inlinable
+    public static func scan<C: Collection<Float>>(_ values: C) -> Occurrences<UInt32> {
+        if let result = values.withContiguousStorageIfAvailable({ scan($0) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { scan($0) }
+    }
+
+    @inlinable
+    internal static func scan(_ values: UnsafeBufferPointer<Float>) -> Occurrences<UInt32> {
+        values.withMemoryRebound(to: UInt32.self) { bits in
+            occurrences(bits, infinity: 0x7F80_0000, payloadMask: 0x001F_FFFF)
+        }
+    }
+
+    /// Dense payload column for a buffer of Float values
+    ///
+    /// - Parameters:
+    ///   - values: The values to scan
+    ///   - value: Entry for elements that are not NaN (defaults to `UInt32.max`)
+    /// - Returns: One entry per element: the NaN payload, or `value`
+    @inlinable
+    public static func payloads<C: Collection<Float>>(_ values: C, default value: UInt32 = .max) -> [UInt32] {
+        if let result = values.withContiguousStorageIfAvailable({ payloads($0, default: value) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { payloads($0, default: value) }
+    }
+
+    @inlinable
+    internal static func payloads(_ values: UnsafeBufferPointer<Float>, default value: UInt32) -> [UInt32] {
+        values.withMemoryRebound(to: UInt32.self) { bits in
+            column(bits, infinity: 0x7F80_0000, payloadMask: 0x001F_FFFF, default: value)
+        }
+    }
+
+    /// Rewrites Float NaN payloads in place through a lookup table
+    ///
+    /// - Parameters:
+    ///   - values: The values to rewrite
+    ///   - table: Replacement payload for each source payload
+    /// - Returns: Number of NaNs rewritten
+    @inlinable
+    @discardableResult
+    public static func remap<C: MutableCollection<Float>>(_ values: inout C, table: [UInt32]) -> Int {
+        if let result = values.withContiguousMutableStorageIfAvailable({ remap($0, table: table) }) {
+            return result
+        }
+        var copy = Array(values)
+        let result = copy.withUnsafeMutableBufferPointer { remap($0, table: table) }
+        for (index, value) in zip(values.indices, copy) {
+            values[index] = value
+        }
+        return result
+    }
+
+    @inlinable
+    internal static func remap(_ values: UnsafeMutableBufferPointer<Float>, table: [UInt32]) -> Int {
+        values.withMemoryRebound(to: UInt32.self) { bits in
+            table.withUnsafeBufferPointer { table in
+                remap(bits, table: table, infinity: 0x7F80_0000, quietBit: 0x0040_0000, payloadMask: 0x001F_FFFF)
+            }
+        }
+    }
+}
@@ -0,0 +1,325 @@
+// IEEE_754.RadixSort.swift
+// swift-ieee-754
+//
+// LSD radix sort by IEEE 754 totalOrder and totalOrderMag
+
+extension IEEE_754 {
+    /// Radix sorting of binary floating-point bit patterns
+    ///
+    /// Sorts by IEEE 754-2019 `totalOrder` (Section 5.10) without comparisons.
+    /// Bit patterns are mapped to unsigned keys whose integer order is the
+    /// total order:
+    ///
+    /// - Positive values (sign bit clear) set the sign bit
+    /// - Negative values (sign bit set) invert every bit
+    ///
+    /// giving `-NaN < -∞ < -finite < -0 < +0 < +finite < +∞ < +NaN`, with NaNs
+    /// ordered by payload. For `totalOrderMag` the key is the bit pattern with
+    /// the sign bit cleared.
+    ///
+    /// Keys are sorted least-significant byte first with a stable counting
+    /// scatter per byte. All byte histograms are built in one read pass, and
+    /// bytes that are identical across the whole input (for example the
+    /// high exponent byte of data in a narrow range) are skipped.
+    @usableFromInline
+    internal enum RadixSort {}
+}
+
+extension IEEE_754.RadixSort {
+    /// Which total order to sort by
+    @usableFromInline
+    internal enum Order: Sendable {
+        /// IEEE 754 `totalOrder`
+        case totalOrder
+        /// IEEE 754 `totalOrderMag` (absolute value; ties keep input order)
+        case magnitude
+    }
+
+    /// Inputs at least this long are sorted concurrently by the async entry points
+    @usableFromInline
+    internal static let concurrencyThreshold = 1 << 17
+
+    /// Smallest chunk handed to one task when sorting concurrently
+    @usableFromInline
+    internal static let minimumChunk = 1 << 15
+
+    // MARK: - Key Transform
+
+    /// Maps a bit pattern to its unsigned totalOrder key
+    @inlinable
+    @inline(__always)
+    internal static func totalOrderKey<Key: FixedWidthInteger & UnsignedInteger>(_ bits: Key) -> Key {
+        let signBit: Key = 1 &<< (Key.bitWidth &- 1)
+        // All ones for negative inputs, zero for positive
+        let negative: Key = 0 &- (bits &>> (Key.bitWidth &- 1))
+        return bits ^ (negative | signBit)
+    }
+
+    /// Inverse of ``totalOrderKey(_:)``
+    @inlinable
+    @inline(__always)
+    internal static func bits<Key: FixedWidthInteger & UnsignedInteger>(fromTotalOrderKey key: Key) -> Key {
+        let signBit: Key = 1 &<< (Key.bitWidth &- 1)
+        // A clear top bit means the original value was negative
+        let negative: Key = (key &>> (Key.bitWidth &- 1)) &- 1
+        return key ^ (negative | signBit)
+    }
+
+    /// Mask applied to bit patterns before digit extraction
+    @inlinable
+    @inline(__always)
+    internal static func keyMask<Key: FixedWidthInteger & UnsignedInteger>(_: Key.Type, for order: Order) -> Key {
+        switch order {
+        case .totalOrder:
+            return ~0
+        case .magnitude:
+            return ~(1 &<< (Key.bitWidth &- 1))
+        }
+    }
+
+    @inlinable
+    @inline(__always)
+    internal static func digit<Key: FixedWidthInteger & UnsignedInteger>(_ key: Key, _ mask: Key, shift: Int) -> Int {
+        Int(truncatingIfNeeded: ((key & mask) &>> shift) & 0xFF)
+    }
+
+    // MARK: - Sequential Sort
+
+    /// Sorts bit patterns in place by `order`
+    @inlinable
+    internal static func sort<Key: FixedWidthInteger & UnsignedInteger>(
+        _ bits: UnsafeMutableBufferPointer<Key>,
+        by order: Order
+    ) {
+        guard bits.count > 1 else { return }
+
+        if order == .totalOrder {
+            for index in bits.indices {
+                bits[index] = totalOrderKey(bits[index])
+            }
+        }
+
+        sortKeys(bits, mask: keyMask(Key.self, for: order))
+
+        if order == .totalOrder {
+            for index in bits.indices {
+                bits[index] = self.bits(fromTotalOrderKey: bits[index])
+            }
+        }
+    }
+
+    /// Stable LSD radix sort of `keys` by the unsigned value of `key & mask`
+    @inlinable
+    internal static func sortKeys<Key: FixedWidthInteger & UnsignedInteger>(
+        _ keys: UnsafeMutableBufferPointer<Key>,
+        mask: Key
+    ) {
+        let count = keys.count
+        let digits = Key.bitWidth / 8
+
+        let histograms = UnsafeMutablePointer<Int>.allocate(capacity: digits * 256)
+        histograms.initialize(repeating: 0, count: digits * 256)
+        defer { histograms.deallocate() }
+
+        for key in keys {
+            for digit in 0..<digits {
+                histograms[digit &* 256 &+ self.digit(key, mask, shift: digit &* 8)] &+= 1
+            }
+        }
+
+        let scratch = UnsafeMutableBufferPointer<Key>.allocate(capacity: count)
+        defer { scratch.deallocate() }
+
+        var source = keys
+        var destination = scratch
+
+        for digit in 0..<digits {
+            let shift = digit * 8
+            let histogram = histograms + digit * 256
+
+            // Every key shares this byte: the pass would not move anything
+            if histogram[self.digit(source[0], mask, shift: shift)] == count { continue }
+
+            var offset = 0
+            for bucket in 0..<256 {
+                let size = histogram[bucket]
+                histogram[bucket] = offset
+                offset &+= size
+            }
+
+            for key in source {
+                let bucket = self.digit(key, mask, shift: shift)
+                destination[histogram[bucket]] = key
+                histogram[bucket] &+= 1
+            }
+
+            swap(&source, &destination)
+        }
+
+        if source.baseAddress != keys.baseAddress {
+            keys.baseAddress!.update(from: source.baseAddress!, count: count)
+        }
+    }
+
+    // MARK: - Array Entry Points
+
+    /// Sorts an array of floating-point values through its bit patterns
+    @inlinable
+    internal static func sort<Value, Key: FixedWidthInteger & UnsignedInteger>(
+        _ values: inout [Value],
+        as _: Key.Type,
+        by order: Order
+    ) {
+        precondition(MemoryLayout<Value>.stride == MemoryLayout<Key>.stride)
+        values.withUnsafeMutableBufferPointer { buffer in
+            buffer.withMemoryRebound(to: Key.self) { bits in
+                sort(bits, by: order)
+            }
+        }
+    }
+
+    /// Sorts an array of floating-point values, splitting large inputs across cores
+    ///
+    /// Inputs shorter than ``concurrencyThreshold`` use the sequential sort.
+    /// The result is identical to the sequential sort for every input.
+    @inlinable
+    internal static func sortConcurrently<Value, Key: FixedWidthInteger & UnsignedInteger & Sendable>(
+        _ values: inout [Value],
+        as _: Key.Type,
+        by order: Order
+    ) async {
+        precondition(MemoryLayout<Value>.stride == MemoryLayout<Key>.stride)
+        let count = values.count
+        let chunks = IEEE_754.Parallel.chunks(count: count, minimumChunk: minimumChunk)
+        guard count >= concurrencyThreshold, chunks.count > 1 else {
+            sort(&values, as: Key.self, by: order)
+            return
+        }
+
+        // Task groups cannot run inside withUnsafeMutableBufferPointer, so the
+        // keys are sorted in a separate buffer and copied back at the end
+        let keys = UnsafeMutableBufferPointer<Key>.allocate(capacity: count)
+        let scratch = UnsafeMutableBufferPointer<Key>.allocate(capacity: count)
+        defer {
+            keys.deallocate()
+            scratch.deallocate()
+        }
+
+        values.withUnsafeBytes { source in
+            UnsafeMutableRawBufferPointer(keys).copyMemory(from: source)
+        }
+
+        let sorted = await sortKeysConcurrently(
+            IEEE_754.Parallel.Buffer(keys),
+            scratch: IEEE_754.Parallel.Buffer(scratch),
+            chunks: chunks,
+            order: order
+        )
+
+        values.withUnsafeMutableBytes { destination in
+            destination.copyMemory(from: UnsafeRawBufferPointer(sorted.slice(0..<count)))
+        }
+    }
+
+    // MARK: - Concurrent Sort
+
+    /// Parallel stable LSD radix sort
+    ///
+    /// Each pass counts the current byte per chunk, assigns every
+    /// (bucket, chunk) pair a disjoint output range in bucket-major,
+    /// chunk-minor order, and lets each chunk scatter its own keys. That is
+    /// exactly the order the sequential scatter produces.
+    ///
+    /// - Returns: The buffer (`keys` or `scratch`) holding the sorted bit patterns
+    @inlinable
+    internal static func sortKeysConcurrently<Key: FixedWidthInteger & UnsignedInteger & Sendable>(
+        _ keys: IEEE_754.Parallel.Buffer<Key>,
+        scratch: IEEE_754.Parallel.Buffer<Key>,
+        chunks: [Range<Int>],
+        order: Order
+    ) async -> IEEE_754.Parallel.Buffer<Key> {
+        let count = keys.count
+        let digits = Key.bitWidth / 8
+        let mask = keyMask(Key.self, for: order)
+        let transform = order == .totalOrder
+
+        // Per-chunk histograms, laid out [chunk][digit][bucket]
+        let counts = UnsafeMutableBufferPointer<Int>.allocate(capacity: chunks.count * digits * 256)
+        counts.initialize(repeating: 0)
+        defer { counts.deallocate() }
+        let shared = IEEE_754.Parallel.Buffer(counts)
+
+        // Pass 0: apply the key transform and count every byte position
+        await IEEE_754.Parallel.forEach(chunks) { chunk, range in
+            let histogram = shared.base + chunk * digits * 256
+            for index in range {
+                var key = keys[index]
+                if transform {
+                    key = totalOrderKey(key)
+                    keys[index] = key
+                }
+                for digit in 0..<digits {
+                    histogram[digit &* 256 &+ self.digit(key, mask, shift: digit &* 8)] &+= 1
+                }
+            }
+        }
+
+        var source = keys
+        var destination = scratch
+
+        for digit in 0..<digits {
+            let shift = digit * 8
+            let firstBucket = self.digit(source[0], mask, shift: shift)
+
+            var total = 0
+            for chunk in 0..<chunks.count {
+                total += counts[(chunk * digits + digit) * 256 + firstBucket]
+            }
+            if total == count { continue }
+
+            // Chunk contents change after each scatter, so recount this byte
+            let from = source
+            let to = destination
+            await IEEE_754.Parallel.forEach(chunks) { chunk, range in
+                let histogram = shared.base + (chunk * digits + digit) * 256
+                histogram.update(repeating: 0, count: 256)
+                for index in range {
+                    histogram[self.digit(from[index], mask, shift: shift)] &+= 1
+                }
+            }
+
+            var offset = 0
+            for bucket in 0..<256 {
+                for chunk in 0..<chunks.count {
+                    let slot = (chunk * digits + digit) * 256 + bucket
+                    let size = counts[slot]
+                    counts[slot] = offset
+                    offset &+= size
+                }
+            }
+
+            await IEEE_754.Parallel.forEach(chunks) { chunk, range in
+                let offsets = shared.base + (chunk * digits + digit) * 256
+                for index in range {
+                    let key = from[index]
+                    let bucket = self.digit(key, mask, shift: shift)
+                    to[offsets[bucket]] = key
+                    offsets[bucket] &+= 1
+                }
+            }
+
+            swap(&source, &destination)
+        }
+
+        if transform {
+            let result = source
+            await IEEE_754.Parallel.forEach(chunks) { _, range in
+                for index in range {
+                    result[index] = bits(fromTotalOrderKey: result[index])
+                }
+            }
+        }
+
+        return source
+    }
+}
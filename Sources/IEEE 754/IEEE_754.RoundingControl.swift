@@ -140,16 +140,61 @@
                 }
             }
 
+            /// Rounding state saved by ``swap(_:)``
+            ///
+            /// Pass it to ``restore(_:)`` on the same thread to return to the
+            /// previous rounding direction.
+            public struct Saved: Sendable {
+                @usableFromInline
+                internal let state: UInt64
+
+                @usableFromInline
+                internal init(state: UInt64) {
+                    self.state = state
+                }
+            }
+
+            /// Set the rounding mode and return the previous state
+            ///
+            /// Reads the control register once and writes it only if the mode
+            /// changes. Together with ``restore(_:)`` this is the cheapest way to
+            /// switch modes around a single operation.
+            ///
+            /// - Parameter mode: The rounding mode to set
+            /// - Returns: The state to pass to ``restore(_:)``
+            ///
+            /// ## Example
+            ///
+            /// ```swift
+            /// let saved = IEEE_754.RoundingControl.swap(.downward)
+            /// let lower = a + b
+            /// IEEE_754.RoundingControl.restore(saved)
+            /// ```
+            public static func swap(_ mode: Mode) -> Saved {
+                Saved(state: ieee754_swap_rounding_mode(mode.cValue))
+            }
+
+            /// Restore the rounding mode saved by ``swap(_:)``
+            ///
+            /// Only the rounding direction is restored; exception flags raised
+            /// since the swap are kept.
+            ///
+            /// - Parameter saved: The state returned by ``swap(_:)``
+            public static func restore(_ saved: Saved) {
+                ieee754_restore_rounding_mode(saved.state)
+            }
+
             /// Execute a closure with a specific rounding mode
             ///
             /// Sets the rounding mode, executes the closure, then restores the
-            /// original rounding mode.
+            /// original rounding mode. Neither step writes the control register
+            /// when the mode is already the one requested.
             ///
             /// - Parameters:
             ///   - mode: The rounding mode to use during closure execution
             ///   - body: The closure to execute
             /// - Returns: The value returned by the closure
-            /// - Throws: Rethrows any error from the closure, or `Error.setFailed`
+            /// - Throws: Rethrows any error from the closure
             ///
             /// ## Example
             ///
@@ -163,11 +208,8 @@
                 _ mode: Mode,
                 _ body: () throws -> T
             ) rethrows -> T {
-                let originalMode = get()
-                try? set(mode)
-                defer {
-                    try? set(originalMode)
-                }
+                let saved = swap(mode)
+                defer { restore(saved) }
                 return try body()
             }
         }
@@ -0,0 +1,278 @@
+// IEEE_754.Scaling.Batch.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 5.3.3: scaleB, logB and significand over whole buffers
+
+// MARK: - Lane Kernels
+
+extension IEEE_754.Scaling {
+    /// Powers of two whose product is 2ⁿ, each exactly representable
+    ///
+    /// `n` is clamped to the widest scale that can still change a result,
+    /// then split as in musl's `scalbn`: steps of 2^emax going up, and steps
+    /// of 2^(emin + p) going down, which keep any value that can survive the
+    /// final multiply normal until then. Multiplying by the three factors in
+    /// order therefore rounds once, in the last multiply, and gives the
+    /// correctly rounded x × 2ⁿ for every n.
+    @inlinable
+    internal static func factors<T: BinaryFloatingPoint>(_ n: Int, as _: T.Type) -> (T, T, T) {
+        let emax = T.greatestFiniteMagnitude.exponent
+        let emin = T.leastNormalMagnitude.exponent
+        let precision = T.significandBitCount + 1
+        let limit = emax - emin + precision + 1
+
+        var remaining = Swift.min(Swift.max(n, -limit), limit)
+        func step() -> T {
+            let k = remaining > emax ? emax : remaining < emin ? emin + precision : remaining
+            remaining -= k
+            return T(sign: .plus, exponent: k, significand: 1)
+        }
+        let first = step()
+        let second = step()
+        return (first, second, T(sign: .plus, exponent: Swift.min(Swift.max(remaining, emin), emax), significand: 1))
+    }
+
+    /// `scaleB` of eight values by the same factors
+    ///
+    /// NaNs are passed through unchanged, as by the scalar `scaleB(_:_:)`,
+    /// and never reach the multiplier, so signaling NaNs raise nothing.
+    @inlinable
+    @inline(__always)
+    internal static func scaleB<T: BinaryFloatingPoint & SIMDScalar>(
+        _ lanes: SIMD8<T>,
+        by factors: (T, T, T)
+    ) -> SIMD8<T> {
+        let isNaN = lanes .!= lanes
+        var result = lanes.replacing(with: 1, where: isNaN) * factors.0 * factors.1 * factors.2
+        result.replace(with: lanes, where: isNaN)
+        return result
+    }
+
+    /// `logB` of eight encodings, offset by `exponentBias + significandBits`
+    ///
+    /// Normal values give their exponent field plus `t`; subnormals give the
+    /// position of their leading bit plus one, so both land on the same
+    /// scale. Zeros give 0 and infinities and NaNs `BitPattern.max`; the
+    /// caller maps those to `Int.min` and `Int.max`.
+    @inlinable
+    @inline(__always)
+    internal static func logBCode<F: IEEE_754.BinaryFormat>(
+        _ lanes: SIMD8<F.BitPattern>,
+        as _: F.Type
+    ) -> SIMD8<F.BitPattern> where F.BitPattern: SIMDScalar {
+        let magnitude = lanes & ~F.signMask
+        let field = magnitude &>> F.BitPattern(F.significandBits)
+
+        var code = field &+ F.BitPattern(F.significandBits)
+        let leading = SIMD8(repeating: F.BitPattern(F.BitPattern.bitWidth)) &- magnitude.leadingZeroBitCount
+        code.replace(with: leading, where: field .== 0)
+        code.replace(with: F.BitPattern.max, where: field .== F.BitPattern(F.maxExponent))
+        return code
+    }
+
+    @inlinable
+    @inline(__always)
+    internal static func logB<F: IEEE_754.BinaryFormat>(
+        _ lanes: SIMD8<F.BitPattern>,
+        as format: F.Type
+    ) -> SIMD8<Int> where F.BitPattern: SIMDScalar {
+        let code = SIMD8<Int>(truncatingIfNeeded: logBCode(lanes, as: format))
+        var result = code &- (F.exponentBias + F.significandBits)
+        result.replace(with: .min, where: code .== 0)
+        result.replace(with: .max, where: code .== Int(truncatingIfNeeded: F.BitPattern.max))
+        return result
+    }
+
+    /// `significand` of eight encodings, as Swift's `significand` property
+    ///
+    /// Finite nonzero values keep their fraction under the biased exponent of
+    /// 1.0, subnormals after shifting their leading bit into the implicit
+    /// position. Zeros and infinities become +0 and +∞; NaNs are returned
+    /// unchanged.
+    @inlinable
+    @inline(__always)
+    internal static func significand<F: IEEE_754.BinaryFormat>(
+        _ lanes: SIMD8<F.BitPattern>,
+        as _: F.Type
+    ) -> SIMD8<F.BitPattern> where F.BitPattern: SIMDScalar {
+        let magnitude = lanes & ~F.signMask
+        let field = magnitude & F.exponentMask
+        let one = F.BitPattern(F.exponentBias) &<< F.BitPattern(F.significandBits)
+
+        var result = one | (magnitude & F.fractionMask)
+        let shift = magnitude.leadingZeroBitCount &- F.BitPattern(F.exponentBits)
+        result.replace(with: one | ((magnitude &<< shift) & F.fractionMask), where: field .== 0)
+        result.replace(with: magnitude, where: (magnitude .== 0) .| (magnitude .== F.exponentMask))
+        result.replace(with: lanes, where: magnitude .> F.exponentMask)
+        return result
+    }
+}
+
+// MARK: - Double Batch Operations
+
+extension IEEE_754.Scaling {
+    /// Scales every element by 2ⁿ - IEEE 754 `scaleB` over a buffer
+    ///
+    /// The scale is split once into at most three exact powers of two, so
+    /// each element costs three multiplies on eight lanes at a time, with
+    /// no per-element checks for zeros, infinities, subnormal results or
+    /// overflow. Each result is x × 2ⁿ rounded once; for every `n` with 2ⁿ
+    /// representable this is exactly the scalar `scaleB(_:_:)`, and beyond
+    /// that range it stays correctly rounded. NaNs pass through unchanged.
+    ///
+    /// - Parameters:
+    ///   - values: The values to scale
+    ///   - n: The power of 2 to scale by
+    /// - Returns: Each element × 2ⁿ
+    ///
+    /// Example:
+    /// ```swift
+    /// IEEE_754.Scaling.scaleB([1.0, 3.0, -0.5], 4)  // [16.0, 48.0, -8.0]
+    /// ```
+    @inlinable
+    public static func scaleB<C: Collection<Double>>(_ values: C, _ n: Int) -> [Double] {
+        if let result = values.withContiguousStorageIfAvailable({ scaleB($0, n) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { scaleB($0, n) }
+    }
+
+    @inlinable
+    internal static func scaleB(_ values: UnsafeBufferPointer<Double>, _ n: Int) -> [Double] {
+        let scale = factors(n, as: Double.self)
+        return [Double](unsafeUninitializedCapacity: values.count) { buffer, initialized in
+            if let output = buffer.baseAddress {
+                IEEE_754.NextOperations.map(values, into: output) { scaleB($0, by: scale) }
+            }
+            initialized = values.count
+        }
+    }
+
+    /// Exponent of every element - IEEE 754 `logB` over a buffer
+    ///
+    /// Read from the bit patterns eight at a time, with subnormals normalized
+    /// by a leading-zero count instead of a branch. Element-for-element
+    /// equal to the scalar `logB(_:)`: `Int.min` for zeros and `Int.max` for
+    /// infinities and NaNs.
+    ///
+    /// - Parameter values: The values
+    /// - Returns: The exponent of each element
+    ///
+    /// Example:
+    /// ```swift
+    /// IEEE_754.Scaling.logB([8.0, 0.75, .leastNonzeroMagnitude])  // [3, -1, -1074]
+    /// ```
+    @inlinable
+    public static func logB<C: Collection<Double>>(_ values: C) -> [Int] {
+        if let result = values.withContiguousStorageIfAvailable({ logB($0) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { logB($0) }
+    }
+
+    @inlinable
+    internal static func logB(_ values: UnsafeBufferPointer<Double>) -> [Int] {
+        [Int](unsafeUninitializedCapacity: values.count) { buffer, initialized in
+            values.withMemoryRebound(to: UInt64.self) { bits in
+                if let output = buffer.baseAddress {
+                    IEEE_754.NextOperations.map(bits, into: output) { logB($0, as: IEEE_754.Binary64.self) }
+                }
+            }
+            initialized = values.count
+        }
+    }
+
+    /// Significand of every element, in [1, 2) for finite nonzero values
+    ///
+    /// Element-for-element equal to the scalar `significand(_:)`,
+    /// computed on the bit patterns.
+    ///
+    /// - Parameter values: The values
+    /// - Returns: The significand of each element
+    @inlinable
+    public static func significand<C: Collection<Double>>(_ values: C) -> [Double] {
+        if let result = values.withContiguousStorageIfAvailable({ significand($0) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { significand($0) }
+    }
+
+    @inlinable
+    internal static func significand(_ values: UnsafeBufferPointer<Double>) -> [Double] {
+        IEEE_754.NextOperations.transformed(values, as: IEEE_754.Binary64.self) {
+            significand($0, as: IEEE_754.Binary64.self)
+        }
+    }
+}
+
+// MARK: - Float Batch Operations
+
+extension IEEE_754.Scaling {
+    /// Scales every element by 2ⁿ - IEEE 754 `scaleB` over a buffer
+    ///
+    /// - Parameters:
+    ///   - values: The values to scale
+    ///   - n: The power of 2 to scale by
+    /// - Returns: Each element × 2ⁿ
+    @inlinable
+    public static func scaleB<C: Collection<Float>>(_ values: C, _ n: Int) -> [Float] {
+        if let result = values.withContiguousStorageIfAvailable({ scaleB($0, n) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { scaleB($0, n) }
+    }
+
+    @inlinable
+    internal static func scaleB(_ values: UnsafeBufferPointer<Float>, _ n: Int) -> [Float] {
+        let scale = factors(n, as: Float.self)
+        return [Float](unsafeUninitializedCapacity: values.count) { buffer, initialized in
+            if let output = buffer.baseAddress {
+                IEEE_754.NextOperations.map(values, into: output) { scaleB($0, by: scale) }
+            }
+            initialized = values.count
+        }
+    }
+
+    /// Exponent of every element - IEEE 754 `logB` over a buffer
+    ///
+    /// - Parameter values: The values
+    /// - Returns: The exponent of each element
+    @inlinable
+    public static func logB<C: Collection<Float>>(_ values: C) -> [Int] {
+        if let result = values.withContiguousStorageIfAvailable({ logB($0) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { logB($0) }
+    }
+
+    @inlinable
+    internal static func logB(_ values: UnsafeBufferPointer<Float>) -> [Int] {
+        [Int](unsafeUninitializedCapacity: values.count) { buffer, initialized in
+            values.withMemoryRebound(to: UInt32.self) { bits in
+                if let output = buffer.baseAddress {
+                    IEEE_754.NextOperations.map(bits, into: output) { logB($0, as: IEEE_754.Binary32.self) }
+                }
+            }
+            initialized = values.count
+        }
+    }
+
+    /// Significand of every element, in [1, 2) for finite nonzero values
+    ///
+    /// - Parameter values: The values
+    /// - Returns: The significand of each element
+    @inlinable
+    public static func significand<C: Collection<Float>>(_ values: C) -> [Float] {
+        if let result = values.withContiguousStorageIfAvailable({ significand($0) }) {
+            return result
+        }
+        return Array(values).withUnsafeBufferPointer { significand($0) }
+    }
+
+    @inlinable
+    internal static func significand(_ values: UnsafeBufferPointer<Float>) -> [Float] {
+        IEEE_754.NextOperations.transformed(values, as: IEEE_754.Binary32.self) {
+            significand($0, as: IEEE_754.Binary32.self)
+        }
+    }
+}
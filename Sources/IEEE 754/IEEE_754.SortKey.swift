@@ -0,0 +1,454 @@
+// IEEE_754.SortKey.swift
+// swift-ieee-754
+//
+// IEEE 754-2019 Section 5.10: Byte encodings whose lexicographic order is totalOrder
+
+// MARK: - Key Transform
+
+extension IEEE_754 {
+    /// Order-preserving byte encoding of binary floating-point values
+    ///
+    /// A sort key is the ``RadixSort`` totalOrder key of the bit pattern
+    /// (sign bit set for positive values, every bit inverted for negative
+    /// ones) stored big-endian. Comparing two keys with `memcmp` therefore
+    /// gives the same result as IEEE 754 `totalOrder` on the values:
+    ///
+    /// `-NaN < -∞ < -finite < -0 < +0 < +finite < +∞ < +NaN`
+    ///
+    /// The transform is a bijection on bit patterns, so decoding is exact,
+    /// NaN payloads and signs included.
+    @usableFromInline
+    internal enum SortKey {}
+}
+
+extension IEEE_754.SortKey {
+    @inlinable
+    @inline(__always)
+    internal static func store<Key: FixedWidthInteger & UnsignedInteger>(
+        _ bits: Key,
+        to destination: UnsafeMutableRawPointer,
+        at offset: Int
+    ) {
+        let key = IEEE_754.RadixSort.totalOrderKey(bits)
+        destination.storeBytes(of: key.bigEndian, toByteOffset: offset, as: Key.self)
+    }
+
+    @inlinable
+    @inline(__always)
+    internal static func load<Key: FixedWidthInteger & UnsignedInteger>(
+        from source: UnsafeRawPointer,
+        at offset: Int,
+        as _: Key.Type
+    ) -> Key {
+        let key = Key(bigEndian: source.loadUnaligned(fromByteOffset: offset, as: Key.self))
+        return IEEE_754.RadixSort.bits(fromTotalOrderKey: key)
+    }
+
+    /// Encodes a run of bit patterns into consecutive keys
+    ///
+    /// A single branch-free loop of xor and byte swap that the compiler
+    /// vectorizes; `destination` need not be aligned.
+    @inlinable
+    internal static func encode<Key: FixedWidthInteger & UnsignedInteger>(
+        _ source: UnsafeBufferPointer<Key>,
+        to destination: UnsafeMutableRawPointer
+    ) {
+        for index in source.indices {
+            store(source[index], to: destination, at: index &* MemoryLayout<Key>.size)
+        }
+    }
+
+    /// Decodes consecutive keys back into bit patterns
+    @inlinable
+    internal static func decode<Key: FixedWidthInteger & UnsignedInteger>(
+        _ source: UnsafeRawPointer,
+        to destination: UnsafeMutableBufferPointer<Key>
+    ) {
+        for index in destination.indices {
+            destination[index] = load(from: source, at: index &* MemoryLayout<Key>.size, as: Key.self)
+        }
+    }
+}
+
+// MARK: - Binary64 Sort Keys
+
+extension IEEE_754.Binary64 {
+    /// Encodes a Double as an 8-byte key whose byte order is `totalOrder`
+    ///
+    /// For keys `a` and `b` of values `x` and `y`, `memcmp(a, b, 8) < 0`
+    /// exactly when `totalOrder(x, y)` holds and `x` and `y` differ in bit
+    /// pattern, so byte-comparing stores (LSM trees, B-trees, sorted files)
+    /// can range-scan floating-point keys without decoding them.
+    ///
+    /// - Parameter value: Double to encode
+    /// - Returns: 8-byte sort key
+    ///
+    /// Example:
+    /// ```swift
+    /// let low = IEEE_754.Binary64.sortKey(from: -1.5)
+    /// let high = IEEE_754.Binary64.sortKey(from: 2.0)
+    /// low.lexicographicallyPrecedes(high)  // true
+    /// ```
+    @inlinable
+    public static func sortKey(from value: Double) -> [UInt8] {
+        [UInt8](unsafeUninitializedCapacity: byteSize) { buffer, initializedCount in
+            initializedCount = writeSortKey(value, into: UnsafeMutableRawBufferPointer(buffer))
+        }
+    }
+
+    /// Decodes an 8-byte sort key - inverse of ``sortKey(from:)``
+    ///
+    /// - Parameter bytes: Key produced by ``sortKey(from:)``
+    /// - Returns: The encoded Double (bit-exact), or nil if bytes.count ≠ 8
+    @inlinable
+    public static func value(fromSortKey bytes: [UInt8]) -> Double? {
+        guard bytes.count == byteSize else { return nil }
+        return bytes.withUnsafeBytes {
+            Double(bitPattern: IEEE_754.SortKey.load(from: $0.baseAddress!, at: 0, as: UInt64.self))
+        }
+    }
+
+    /// Writes the sort key of a Double into caller-owned memory
+    ///
+    /// - Parameters:
+    ///   - value: Double to encode
+    ///   - buffer: Destination buffer
+    ///   - offset: Byte offset within `buffer` (defaults to 0)
+    /// - Returns: Number of bytes written (always 8)
+    ///
+    /// - Precondition: `offset + 8 <= buffer.count`
+    @inlinable
+    @discardableResult
+    public static func writeSortKey(
+        _ value: Double,
+        into buffer: UnsafeMutableRawBufferPointer,
+        at offset: Int = 0
+    ) -> Int {
+        precondition(offset >= 0 && offset <= buffer.count - byteSize, "Buffer too small for binary64 sort key")
+        IEEE_754.SortKey.store(value.bitPattern, to: buffer.baseAddress!, at: offset)
+        return byteSize
+    }
+
+    /// Writes the sort keys of a sequence of Doubles back to back into caller-owned memory
+    ///
+    /// Contiguous sequences are encoded in one vectorized pass; other
+    /// sequences are written value by value. Fixed-size key slots of a
+    /// preallocated page can be filled this way without intermediate arrays.
+    ///
+    /// - Parameters:
+    ///   - values: Doubles to encode
+    ///   - buffer: Destination buffer
+    ///   - offset: Byte offset within `buffer` (defaults to 0)
+    /// - Returns: Number of bytes written
+    ///
+    /// - Precondition: `buffer` has room for every key starting at `offset`
+    @inlinable
+    @discardableResult
+    public static func writeSortKeys<S: Sequence>(
+        contentsOf values: S,
+        into buffer: UnsafeMutableRawBufferPointer,
+        at offset: Int = 0
+    ) -> Int where S.Element == Double {
+        let contiguous = values.withContiguousStorageIfAvailable { source -> Int in
+            let byteCount = source.count * byteSize
+            precondition(offset >= 0 && offset <= buffer.count - byteCount, "Buffer too small for binary64 sort keys")
+            guard byteCount > 0 else { return 0 }
+            source.withMemoryRebound(to: UInt64.self) { bits in
+                IEEE_754.SortKey.encode(bits, to: buffer.baseAddress! + offset)
+            }
+            return byteCount
+        }
+
+        if let contiguous { return contiguous }
+
+        var position = offset
+        for value in values {
+            position += writeSortKey(value, into: buffer, at: position)
+        }
+        return position - offset
+    }
+
+    /// Encodes an array of Doubles as concatenated 8-byte sort keys
+    ///
+    /// - Parameter values: Doubles to encode
+    /// - Returns: `values.count * 8` bytes of keys
+    @inlinable
+    public static func sortKeys(from values: [Double]) -> [UInt8] {
+        [UInt8](unsafeUninitializedCapacity: values.count * byteSize) { buffer, initializedCount in
+            initializedCount = writeSortKeys(contentsOf: values, into: UnsafeMutableRawBufferPointer(buffer))
+        }
+    }
+
+    /// Decodes concatenated 8-byte sort keys
+    ///
+    /// - Parameter bytes: Keys produced by ``sortKeys(from:)`` or ``writeSortKeys(contentsOf:into:at:)``
+    /// - Returns: The encoded Doubles, or nil if bytes.count is not a multiple of 8
+    @inlinable
+    public static func values(fromSortKeys bytes: UnsafeRawBufferPointer) -> [Double]? {
+        guard bytes.count % byteSize == 0 else { return nil }
+        let count = bytes.count / byteSize
+        return [Double](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+            if count > 0 {
+                buffer.withMemoryRebound(to: UInt64.self) { bits in
+                    IEEE_754.SortKey.decode(bytes.baseAddress!, to: bits)
+                }
+            }
+            initializedCount = count
+        }
+    }
+
+    /// Decodes a byte array of concatenated 8-byte sort keys
+    ///
+    /// - Parameter bytes: Concatenated sort keys
+    /// - Returns: The encoded Doubles, or nil if bytes.count is not a multiple of 8
+    @inlinable
+    public static func values(fromSortKeys bytes: [UInt8]) -> [Double]? {
+        bytes.withUnsafeBytes { values(fromSortKeys: $0) }
+    }
+}
+
+// MARK: - Binary32 Sort Keys
+
+extension IEEE_754.Binary32 {
+    /// Encodes a Float as a 4-byte key whose byte order is `totalOrder`
+    ///
+    /// - Parameter value: Float to encode
+    /// - Returns: 4-byte sort key
+    @inlinable
+    public static func sortKey(from value: Float) -> [UInt8] {
+        [UInt8](unsafeUninitializedCapacity: byteSize) { buffer, initializedCount in
+            initializedCount = writeSortKey(value, into: UnsafeMutableRawBufferPointer(buffer))
+        }
+    }
+
+    /// Decodes a 4-byte sort key - inverse of ``sortKey(from:)``
+    ///
+    /// - Parameter bytes: Key produced by ``sortKey(from:)``
+    /// - Returns: The encoded Float (bit-exact), or nil if bytes.count ≠ 4
+    @inlinable
+    public static func value(fromSortKey bytes: [UInt8]) -> Float? {
+        guard bytes.count == byteSize else { return nil }
+        return bytes.withUnsafeBytes {
+            Float(bitPattern: IEEE_754.SortKey.load(from: $0.baseAddress!, at: 0, as: UInt32.self))
+        }
+    }
+
+    /// Writes the sort key of a Float into caller-owned memory
+    ///
+    /// - Parameters:
+    ///   - value: Float to encode
+    ///   - buffer: Destination buffer
+    ///   - offset: Byte offset within `buffer` (defaults to 0)
+    /// - Returns: Number of bytes written (always 4)
+    @inlinable
+    @discardableResult
+    public static func writeSortKey(
+        _ value: Float,
+        into buffer: UnsafeMutableRawBufferPointer,
+        at offset: Int = 0
+    ) -> Int {
+        precondition(offset >= 0 && offset <= buffer.count - byteSize, "Buffer too small for binary32 sort key")
+        IEEE_754.SortKey.store(value.bitPattern, to: buffer.baseAddress!, at: offset)
+        return byteSize
+    }
+
+    /// Writes the sort keys of a sequence of Floats back to back into caller-owned memory
+    ///
+    /// - Parameters:
+    ///   - values: Floats to encode
+    ///   - buffer: Destination buffer
+    ///   - offset: Byte offset within `buffer` (defaults to 0)
+    /// - Returns: Number of bytes written
+    @inlinable
+    @discardableResult
+    public static func writeSortKeys<S: Sequence>(
+        contentsOf values: S,
+        into buffer: UnsafeMutableRawBufferPointer,
+        at offset: Int = 0
+    ) -> Int where S.Element == Float {
+        let contiguous = values.withContiguousStorageIfAvailable { source -> Int in
+            let byteCount = source.count * byteSize
+            precondition(offset >= 0 && offset <= buffer.count - byteCount, "Buffer too small for binary32 sort keys")
+            guard byteCount > 0 else { return 0 }
+            source.withMemoryRebound(to: UInt32.self) { bits in
+                IEEE_754.SortKey.encode(bits, to: buffer.baseAddress! + offset)
+            }
+            return byteCount
+        }
+
+        if let contiguous { return contiguous }
+
+        var position = offset
+        for value in values {
+            position += writeSortKey(value, into: buffer, at: position)
+        }
+        return position - offset
+    }
+
+    /// Encodes an array of Floats as concatenated 4-byte sort keys
+    ///
+    /// - Parameter values: Floats to encode
+    /// - Returns: `values.count * 4` bytes of keys
+    @inlinable
+    public static func sortKeys(from values: [Float]) -> [UInt8] {
+        [UInt8](unsafeUninitializedCapacity: values.count * byteSize) { buffer, initializedCount in
+            initializedCount = writeSortKeys(contentsOf: values, into: UnsafeMutableRawBufferPointer(buffer))
+        }
+    }
+
+    /// Decodes concatenated 4-byte sort keys
+    ///
+    /// - Parameter bytes: Concatenated sort keys
+    /// - Returns: The encoded Floats, or nil if bytes.count is not a multiple of 4
+    @inlinable
+    public static func values(fromSortKeys bytes: UnsafeRawBufferPointer) -> [Float]? {
+        guard bytes.count % byteSize == 0 else { return nil }
+        let count = bytes.count / byteSize
+        return [Float](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+            if count > 0 {
+                buffer.withMemoryRebound(to: UInt32.self) { bits in
+                    IEEE_754.SortKey.decode(bytes.baseAddress!, to: bits)
+                }
+            }
+            initializedCount = count
+        }
+    }
+
+    /// Decodes a byte array of concatenated 4-byte sort keys
+    ///
+    /// - Parameter bytes: Concatenated sort keys
+    /// - Returns: The encoded Floats, or nil if bytes.count is not a multiple of 4
+    @inlinable
+    public static func values(fromSortKeys bytes: [UInt8]) -> [Float]? {
+        bytes.withUnsafeBytes { values(fromSortKeys: $0) }
+    }
+}
+
+// MARK: - Binary16 Sort Keys
+
+#if !((os(macOS) || targetEnvironment(macCatalyst)) && arch(x86_64))
+    extension IEEE_754.Binary16 {
+        /// Encodes a Float16 as a 2-byte key whose byte order is `totalOrder`
+        ///
+        /// - Parameter value: Float16 to encode
+        /// - Returns: 2-byte sort key
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        public static func sortKey(from value: Float16) -> [UInt8] {
+            [UInt8](unsafeUninitializedCapacity: byteSize) { buffer, initializedCount in
+                initializedCount = writeSortKey(value, into: UnsafeMutableRawBufferPointer(buffer))
+            }
+        }
+
+        /// Decodes a 2-byte sort key - inverse of ``sortKey(from:)``
+        ///
+        /// - Parameter bytes: Key produced by ``sortKey(from:)``
+        /// - Returns: The encoded Float16 (bit-exact), or nil if bytes.count ≠ 2
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        public static func value(fromSortKey bytes: [UInt8]) -> Float16? {
+            guard bytes.count == byteSize else { return nil }
+            return bytes.withUnsafeBytes {
+                Float16(bitPattern: IEEE_754.SortKey.load(from: $0.baseAddress!, at: 0, as: UInt16.self))
+            }
+        }
+
+        /// Writes the sort key of a Float16 into caller-owned memory
+        ///
+        /// - Parameters:
+        ///   - value: Float16 to encode
+        ///   - buffer: Destination buffer
+        ///   - offset: Byte offset within `buffer` (defaults to 0)
+        /// - Returns: Number of bytes written (always 2)
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        @discardableResult
+        public static func writeSortKey(
+            _ value: Float16,
+            into buffer: UnsafeMutableRawBufferPointer,
+            at offset: Int = 0
+        ) -> Int {
+            precondition(offset >= 0 && offset <= buffer.count - byteSize, "Buffer too small for binary16 sort key")
+            IEEE_754.SortKey.store(value.bitPattern, to: buffer.baseAddress!, at: offset)
+            return byteSize
+        }
+
+        /// Writes the sort keys of a sequence of Float16 values back to back into caller-owned memory
+        ///
+        /// - Parameters:
+        ///   - values: Float16 values to encode
+        ///   - buffer: Destination buffer
+        ///   - offset: Byte offset within `buffer` (defaults to 0)
+        /// - Returns: Number of bytes written
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        @discardableResult
+        public static func writeSortKeys<S: Sequence>(
+            contentsOf values: S,
+            into buffer: UnsafeMutableRawBufferPointer,
+            at offset: Int = 0
+        ) -> Int where S.Element == Float16 {
+            let contiguous = values.withContiguousStorageIfAvailable { source -> Int in
+                let byteCount = source.count * byteSize
+                precondition(
+                    offset >= 0 && offset <= buffer.count - byteCount,
+                    "Buffer too small for binary16 sort keys"
+                )
+                guard byteCount > 0 else { return 0 }
+                source.withMemoryRebound(to: UInt16.self) { bits in
+                    IEEE_754.SortKey.encode(bits, to: buffer.baseAddress! + offset)
+                }
+                return byteCount
+            }
+
+            if let contiguous { return contiguous }
+
+            var position = offset
+            for value in values {
+                position += writeSortKey(value, into: buffer, at: position)
+            }
+            return position - offset
+        }
+
+        /// Encodes an array of Float16 values as concatenated 2-byte sort keys
+        ///
+        /// - Parameter values: Float16 values to encode
+        /// - Returns: `values.count * 2` bytes of keys
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        public static func sortKeys(from values: [Float16]) -> [UInt8] {
+            [UInt8](unsafeUninitializedCapacity: values.count * byteSize) { buffer, initializedCount in
+                initializedCount = writeSortKeys(contentsOf: values, into: UnsafeMutableRawBufferPointer(buffer))
+            }
+        }
+
+        /// Decodes concatenated 2-byte sort keys
+        ///
+        /// - Parameter bytes: Concatenated sort keys
+        /// - Returns: The encoded Float16 values, or nil if bytes.count is odd
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        public static func values(fromSortKeys bytes: UnsafeRawBufferPointer) -> [Float16]? {
+            guard bytes.count % byteSize == 0 else { return nil }
+            let count = bytes.count / byteSize
+            return [Float16](unsafeUninitializedCapacity: count) { buffer, initializedCount in
+                if count > 0 {
+                    buffer.withMemoryRebound(to: UInt16.self) { bits in
+                        IEEE_754.SortKey.decode(bytes.baseAddress!, to: bits)
+                    }
+                }
+                initializedCount = count
+            }
+        }
+
+        /// Decodes a byte array of concatenated 2-byte sort keys
+        ///
+        /// - Parameter bytes: Concatenated sort keys
+        /// - Returns: The encoded Float16 values, or nil if bytes.count is odd
+        @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+        @inlinable
+        public static func values(fromSortKeys bytes: [UInt8]) -> [Float16]? {
+            bytes.withUnsafeBytes { values(fromSortKeys: $0) }
+        }
+    }
+#endif
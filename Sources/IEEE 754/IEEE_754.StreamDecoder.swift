@@ -0,0 +1,285 @@
+// IEEE_754.StreamDecoder.swift
+// swift-ieee-754
+//
+// Incremental decoding of binary16/32/64 values from chunked byte input
+
+public import Binary
+
+// MARK: - Stream Decoder
+
+extension IEEE_754 {
+    /// Incremental decoder for a stream of IEEE 754 binary16, binary32 or binary64 values
+    ///
+    /// Accepts byte chunks of any size, as they arrive from a socket or file,
+    /// and returns every element completed by each chunk. Bytes of an element
+    /// split across chunks are carried over to the next call, so peak memory
+    /// is one chunk plus its decoded values rather than the whole payload.
+    ///
+    /// Complete elements are moved with a single copy, or a single vectorized
+    /// byte swap when `endianness` differs from the host byte order, exactly
+    /// as the bulk `values(from:endianness:)` codecs do.
+    ///
+    /// `Element` must be a 2, 4 or 8-byte IEEE 754 type: `Float16`, `Float`
+    /// or `Double`.
+    ///
+    /// Example:
+    /// ```swift
+    /// var decoder = IEEE_754.StreamDecoder(of: Double.self, endianness: .big)
+    /// while let chunk = try socket.receive(maximumLength: 65_536) {
+    ///     process(decoder.decode(chunk))
+    /// }
+    /// try decoder.finish()
+    /// ```
+    public struct StreamDecoder<Element: BinaryFloatingPoint & BitwiseCopyable>: Sendable {
+        /// Byte order of the incoming stream
+        public let endianness: Binary.Endianness
+
+        /// Leading bytes of an element split across chunks, in arrival order
+        @usableFromInline
+        internal var carry: UInt64 = 0
+
+        @usableFromInline
+        internal var carryCount: Int = 0
+
+        /// Creates a decoder for a stream of `Element` values
+        ///
+        /// - Parameters:
+        ///   - type: The element type (`Float16`, `Float` or `Double`)
+        ///   - endianness: Byte order of the stream (defaults to little-endian)
+        @inlinable
+        public init(of type: Element.Type = Element.self, endianness: Binary.Endianness = .little) {
+            precondition(
+                [2, 4, 8].contains(MemoryLayout<Element>.size),
+                "StreamDecoder supports binary16, binary32 and binary64 elements"
+            )
+            self.endianness = endianness
+        }
+    }
+
+    /// Errors reported when a byte stream ends
+    public enum StreamError: Swift.Error, Equatable, Sendable {
+        /// The stream ended partway through an element
+        case truncated(pendingByteCount: Int)
+    }
+}
+
+extension IEEE_754.StreamDecoder {
+    /// Number of bytes held back waiting for the rest of an element
+    @inlinable
+    public var pendingByteCount: Int { carryCount }
+
+    /// Decodes the elements completed by `chunk`, appending them to `values`
+    ///
+    /// Lets a caller reuse one array across chunks: clear it with
+    /// `removeAll(keepingCapacity: true)` after processing each batch.
+    ///
+    /// - Parameters:
+    ///   - chunk: The next bytes of the stream, of any length and alignment
+    ///   - values: Array to append decoded elements to
+    @inlinable
+    public mutating func decode(_ chunk: UnsafeRawBufferPointer, into values: inout [Element]) {
+        let size = MemoryLayout<Element>.size
+        guard let source = chunk.baseAddress else { return }
+        var offset = 0
+
+        if carryCount > 0 {
+            let filled = carryCount
+            let needed = min(size - filled, chunk.count)
+            withUnsafeMutableBytes(of: &carry) { carried in
+                carried.baseAddress!.advanced(by: filled).copyMemory(from: source, byteCount: needed)
+            }
+            carryCount += needed
+            offset = needed
+            guard carryCount == size else { return }
+
+            var element = Element.zero
+            withUnsafeBytes(of: carry) { carried in
+                withUnsafeMutableBytes(of: &element) { destination in
+                    Self.move(1, from: carried.baseAddress!, to: destination.baseAddress!, endianness: endianness)
+                }
+            }
+            values.append(element)
+            carry = 0
+            carryCount = 0
+        }
+
+        let complete = (chunk.count - offset) / size
+        if complete > 0 {
+            let start = values.count
+            values.append(contentsOf: repeatElement(.zero, count: complete))
+            values.withUnsafeMutableBufferPointer { buffer in
+                Self.move(
+                    complete,
+                    from: source + offset,
+                    to: UnsafeMutableRawPointer(buffer.baseAddress! + start),
+                    endianness: endianness
+                )
+            }
+            offset += complete * size
+        }
+
+        let remaining = chunk.count - offset
+        if remaining > 0 {
+            withUnsafeMutableBytes(of: &carry) { carried in
+                carried.baseAddress!.copyMemory(from: source + offset, byteCount: remaining)
+            }
+            carryCount = remaining
+        }
+    }
+
+    /// Decodes the elements completed by `chunk`
+    ///
+    /// - Parameter chunk: The next bytes of the stream, of any length and alignment
+    /// - Returns: The elements completed by this chunk, possibly none
+    @inlinable
+    public mutating func decode(_ chunk: UnsafeRawBufferPointer) -> [Element] {
+        var values: [Element] = []
+        values.reserveCapacity((carryCount + chunk.count) / MemoryLayout<Element>.size)
+        decode(chunk, into: &values)
+        return values
+    }
+
+    /// Decodes the elements completed by a chunk of bytes
+    ///
+    /// Contiguous collections (`[UInt8]`, `ArraySlice<UInt8>`, `Data`) are
+    /// read in place; other collections are gathered into an array first.
+    ///
+    /// - Parameter chunk: The next bytes of the stream
+    /// - Returns: The elements completed by this chunk, possibly none
+    @inlinable
+    public mutating func decode<C: Collection<UInt8>>(_ chunk: C) -> [Element] {
+        if let values = chunk.withContiguousStorageIfAvailable({ decode(UnsafeRawBufferPointer($0)) }) {
+            return values
+        }
+        return Array(chunk).withUnsafeBytes { decode($0) }
+    }
+
+    /// Checks that the stream ended on an element boundary
+    ///
+    /// - Throws: ``IEEE_754/StreamError/truncated(pendingByteCount:)`` if
+    ///   bytes of an incomplete element are still pending
+    @inlinable
+    public func finish() throws {
+        if carryCount > 0 {
+            throw IEEE_754.StreamError.truncated(pendingByteCount: carryCount)
+        }
+    }
+
+    /// Copies `count` elements, byte-swapping them unless the stream is in host order
+    @inlinable
+    @inline(__always)
+    internal static func move(
+        _ count: Int,
+        from source: UnsafeRawPointer,
+        to destination: UnsafeMutableRawPointer,
+        endianness: Binary.Endianness
+    ) {
+        guard !endianness.isHostOrder else {
+            destination.copyMemory(from: source, byteCount: count * MemoryLayout<Element>.size)
+            return
+        }
+        switch MemoryLayout<Element>.size {
+        case 2:
+            IEEE_754.ByteOrder.swap16(count, from: source, to: destination)
+        case 4:
+            IEEE_754.ByteOrder.swap32(count, from: source, to: destination)
+        default:
+            IEEE_754.ByteOrder.swap64(count, from: source, to: destination)
+        }
+    }
+}
+
+// MARK: - AsyncSequence Adapter
+
+extension IEEE_754 {
+    /// Batches of values decoded from an asynchronous sequence of byte chunks
+    ///
+    /// Each element is the batch completed by one incoming chunk; chunks that
+    /// complete no element are skipped. Iteration throws
+    /// ``StreamError/truncated(pendingByteCount:)`` if the base sequence ends
+    /// partway through an element, and rethrows errors from the base.
+    ///
+    /// Created with `decodingIEEE754(_:endianness:)` on any `AsyncSequence`
+    /// of byte collections.
+    public struct AsyncDecodedSequence<Base: AsyncSequence, Value>: AsyncSequence
+    where Base.Element: Collection<UInt8>, Value: BinaryFloatingPoint & BitwiseCopyable {
+        public typealias Element = [Value]
+
+        @usableFromInline
+        internal let base: Base
+
+        @usableFromInline
+        internal let endianness: Binary.Endianness
+
+        @inlinable
+        internal init(base: Base, endianness: Binary.Endianness) {
+            self.base = base
+            self.endianness = endianness
+        }
+
+        /// Iterator that decodes each chunk as it arrives
+        public struct AsyncIterator: AsyncIteratorProtocol {
+            @usableFromInline
+            internal var base: Base.AsyncIterator
+
+            @usableFromInline
+            internal var decoder: StreamDecoder<Value>
+
+            @usableFromInline
+            internal var finished = false
+
+            @inlinable
+            internal init(base: Base.AsyncIterator, endianness: Binary.Endianness) {
+                self.base = base
+                self.decoder = StreamDecoder(of: Value.self, endianness: endianness)
+            }
+
+            @inlinable
+            public mutating func next() async throws -> [Value]? {
+                while !finished {
+                    guard let chunk = try await base.next() else {
+                        finished = true
+                        try decoder.finish()
+                        return nil
+                    }
+                    let values = decoder.decode(chunk)
+                    if !values.isEmpty { return values }
+                }
+                return nil
+            }
+        }
+
+        @inlinable
+        public func makeAsyncIterator() -> AsyncIterator {
+            AsyncIterator(base: base.makeAsyncIterator(), endianness: endianness)
+        }
+    }
+}
+
+extension IEEE_754.AsyncDecodedSequence: Sendable where Base: Sendable {}
+
+extension AsyncSequence where Element: Collection<UInt8> {
+    /// Decodes IEEE 754 values from this sequence of byte chunks as they arrive
+    ///
+    /// Chunks may split elements anywhere; partial elements are carried over
+    /// to the next chunk.
+    ///
+    /// - Parameters:
+    ///   - type: The element type (`Float16`, `Float` or `Double`)
+    ///   - endianness: Byte order of the stream (defaults to little-endian)
+    /// - Returns: An asynchronous sequence of decoded batches
+    ///
+    /// Example:
+    /// ```swift
+    /// for try await batch in file.chunks.decodingIEEE754(Double.self, endianness: .big) {
+    ///     histogram.add(batch)
+    /// }
+    /// ```
+    @inlinable
+    public func decodingIEEE754<Value: BinaryFloatingPoint & BitwiseCopyable>(
+        _ type: Value.Type,
+        endianness: Binary.Endianness = .little
+    ) -> IEEE_754.AsyncDecodedSequence<Self, Value> {
+        IEEE_754.AsyncDecodedSequence(base: self, endianness: endianness)
+    }
+}
@@ -0,0 +1,100 @@
+// [Float16].swift
+// swift-ieee-754
+//
+// Array extensions for Swift standard library Float16 (IEEE 754 binary16)
+
+#if !((os(macOS) || targetEnvironment(macCatalyst)) && arch(x86_64))
+
+    // MARK: - Total Order Sorting
+
+    @available(macOS 14.0, iOS 17.0, watchOS 10.0, tvOS 17.0, *)
+    extension [Float16] {
+        /// Sorts the array in place by IEEE 754 `totalOrder`
+        ///
+        /// Orders every value, including NaNs and signed zeros:
+        /// `-NaN < -∞ < -finite < -0.0 < +0.0 < +finite < +∞ < +NaN`,
+        /// with NaNs ordered by payload. Equivalent to sorting with
+        /// `IEEE_754.Comparison.totalOrder`, but computed with an LSD radix sort
+        /// on the bit patterns: linear time, no comparisons.
+        ///
+        /// Example:
+        /// ```swift
+        /// var values: [Float16] = [1.0, .nan, -0.0, 0.0, -.infinity]
+        /// values.sortByTotalOrder()
+        /// // [-inf, -0.0, 0.0, 1.0, nan]
+        /// ```
+        ///
+        /// - Note: The `async` overload splits large arrays across cores.
+        @inlinable
+        public mutating func sortByTotalOrder() {
+            IEEE_754.RadixSort.sort(&self, as: UInt16.self, by: .totalOrder)
+        }
+
+        /// Sorts the array in place by IEEE 754 `totalOrder`, using all cores for large inputs
+        ///
+        /// Produces exactly the same order as the synchronous overload. Arrays of
+        /// more than about a hundred thousand elements are partitioned into one
+        /// chunk per core; each radix pass counts and scatters the chunks
+        /// concurrently.
+        @inlinable
+        public mutating func sortByTotalOrder() async {
+            await IEEE_754.RadixSort.sortConcurrently(&self, as: UInt16.self, by: .totalOrder)
+        }
+
+        /// Returns the elements sorted by IEEE 754 `totalOrder`
+        ///
+        /// - Returns: A sorted copy; see ``sortByTotalOrder()``
+        @inlinable
+        public func sortedByTotalOrder() -> [Float16] {
+            var sorted = self
+            sorted.sortByTotalOrder()
+            return sorted
+        }
+
+        /// Returns the elements sorted by IEEE 754 `totalOrder`, using all cores for large inputs
+        @inlinable
+        public func sortedByTotalOrder() async -> [Float16] {
+            var sorted = self
+            await sorted.sortByTotalOrder()
+            return sorted
+        }
+
+        /// Sorts the array in place by IEEE 754 `totalOrderMag`
+        ///
+        /// Orders by absolute value (`|x|`), with NaNs last. Values of equal
+        /// magnitude, such as `-2.0` and `2.0`, keep their original relative order.
+        ///
+        /// Example:
+        /// ```swift
+        /// var values: [Float16] = [-3.0, 2.0, -1.0, .nan]
+        /// values.sortByTotalOrderMag()
+        /// // [-1.0, 2.0, -3.0, nan]
+        /// ```
+        @inlinable
+        public mutating func sortByTotalOrderMag() {
+            IEEE_754.RadixSort.sort(&self, as: UInt16.self, by: .magnitude)
+        }
+
+        /// Sorts the array in place by IEEE 754 `totalOrderMag`, using all cores for large inputs
+        @inlinable
+        public mutating func sortByTotalOrderMag() async {
+            await IEEE_754.RadixSort.sortConcurrently(&self, as: UInt16.self, by: .magnitude)
+        }
+
+        /// Returns the elements sorted by IEEE 754 `totalOrderMag`
+        @inlinable
+        public func sortedByTotalOrderMag() -> [Float16] {
+            var sorted = self
+            sorted.sortByTotalOrderMag()
+            return sorted
+        }
+
+        /// Returns the elements sorted by IEEE 754 `totalOrderMag`, using all cores for large inputs
+        @inlinable
+        public func sortedByTotalOrderMag() async -> [Float16] {
+            var sorted = self
+            await sorted.sortByTotalOrderMag()
+            return sorted
+        }
+    }
+#endif
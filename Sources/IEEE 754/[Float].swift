@@ -31,24 +31,184 @@ extension [Float] {
     /// - Empty byte arrays return an empty array (vacuous truth semantics)
     /// - Invalid byte counts (not divisible by 4) return `nil`
     ///
-    /// - Note: Uses ``Float/init(bytes:endianness:)`` under the hood
+    /// Contiguous collections (`[UInt8]`, `ArraySlice<UInt8>`, `ContiguousArray<UInt8>`)
+    /// are decoded directly from their storage with a single copy into the result;
+    /// other collections are first gathered into one contiguous buffer.
+    ///
+    /// - Note: Uses ``IEEE_754/Binary32/values(from:endianness:)`` under the hood
     public init?<C: Collection>(bytes: C, endianness: Binary.Endianness = .little)
     where C.Element == UInt8 {
-        let elementSize = MemoryLayout<Element>.size
-        guard bytes.count % elementSize == 0 else { return nil }
+        let decoded = bytes.withContiguousStorageIfAvailable { buffer in
+            IEEE_754.Binary32.values(from: UnsafeRawBufferPointer(buffer), endianness: endianness)
+        }
 
-        var result: [Element] = []
-        result.reserveCapacity(bytes.count / elementSize)
+        if let decoded {
+            guard let decoded else { return nil }
+            self = decoded
+            return
+        }
 
         let byteArray: [UInt8] = .init(bytes)
-        for i in stride(from: 0, to: byteArray.count, by: elementSize) {
-            let chunk: [UInt8] = .init(byteArray[i..<i + elementSize])
-            guard let element = Element(bytes: chunk, endianness: endianness) else {
-                return nil
-            }
-            result.append(element)
+        guard
+            let values = byteArray.withUnsafeBytes({ buffer in
+                IEEE_754.Binary32.values(from: buffer, endianness: endianness)
+            })
+        else { return nil }
+
+        self = values
+    }
+
+    /// Creates an array of Floats from raw memory
+    ///
+    /// Decodes IEEE 754 binary32 values straight out of a raw buffer, such as a
+    /// memory-mapped file or a network receive buffer, without staging the bytes
+    /// in an intermediate array. The buffer does not need to be aligned.
+    ///
+    /// - Parameters:
+    ///   - bytes: Raw bytes representing multiple Floats
+    ///   - endianness: Byte order of the input bytes (defaults to little-endian)
+    /// - Returns: Array of Floats, or nil if byte count is not a multiple of 4
+    ///
+    /// Example:
+    /// ```swift
+    /// let values = payload.withUnsafeBytes { [Float](bytes: $0, endianness: .big) }
+    /// ```
+    public init?(bytes: UnsafeRawBufferPointer, endianness: Binary.Endianness = .little) {
+        guard let values = IEEE_754.Binary32.values(from: bytes, endianness: endianness) else {
+            return nil
         }
+        self = values
+    }
+
+    /// Creates an array of Floats from raw memory, decoding on several cores
+    ///
+    /// For GB-scale payloads where one core cannot saturate memory bandwidth.
+    /// Inputs of at least `parallel.threshold` bytes are split into
+    /// cache-sized chunks decoded concurrently, each written straight into
+    /// the new array; smaller inputs are decoded on the calling thread.
+    ///
+    /// - Parameters:
+    ///   - bytes: Raw bytes representing multiple Floats
+    ///   - endianness: Byte order of the input bytes (defaults to little-endian)
+    ///   - parallel: When and how to split the work
+    /// - Returns: Array of Floats, or nil if byte count is not a multiple of 4
+    ///
+    /// Example:
+    /// ```swift
+    /// let values = mapped.withUnsafeBytes { [Float](bytes: $0, endianness: .big, parallel: .automatic) }
+    /// ```
+    public init?(
+        bytes: UnsafeRawBufferPointer,
+        endianness: Binary.Endianness = .little,
+        parallel: IEEE_754.Parallelism
+    ) {
+        guard let values = IEEE_754.Binary32.values(from: bytes, endianness: endianness, parallel: parallel) else {
+            return nil
+        }
+        self = values
+    }
+
+    /// Creates an array of Floats from a byte array, decoding on several cores
+    ///
+    /// Same as ``init(bytes:endianness:parallel:)`` over the array's storage.
+    public init?(bytes: [UInt8], endianness: Binary.Endianness = .little, parallel: IEEE_754.Parallelism) {
+        guard
+            let values = bytes.withUnsafeBytes({ buffer in
+                IEEE_754.Binary32.values(from: buffer, endianness: endianness, parallel: parallel)
+            })
+        else { return nil }
+        self = values
+    }
+}
+
+// MARK: - Total Order Sorting
+
+extension [Float] {
+    /// Sorts the array in place by IEEE 754 `totalOrder`
+    ///
+    /// Orders every value, including NaNs and signed zeros:
+    /// `-NaN < -∞ < -finite < -0.0 < +0.0 < +finite < +∞ < +NaN`,
+    /// with NaNs ordered by payload. Equivalent to sorting with
+    /// `IEEE_754.Comparison.totalOrder`, but computed with an LSD radix sort
+    /// on the bit patterns: linear time, no comparisons.
+    ///
+    /// Example:
+    /// ```swift
+    /// var values: [Float] = [1.0, .nan, -0.0, 0.0, -.infinity]
+    /// values.sortByTotalOrder()
+    /// // [-inf, -0.0, 0.0, 1.0, nan]
+    /// ```
+    ///
+    /// - Note: The `async` overload splits large arrays across cores.
+    @inlinable
+    public mutating func sortByTotalOrder() {
+        IEEE_754.RadixSort.sort(&self, as: UInt32.self, by: .totalOrder)
+    }
+
+    /// Sorts the array in place by IEEE 754 `totalOrder`, using all cores for large inputs
+    ///
+    /// Produces exactly the same order as the synchronous overload. Arrays of
+    /// more than about a hundred thousand elements are partitioned into one
+    /// chunk per core; each radix pass counts and scatters the chunks
+    /// concurrently.
+    @inlinable
+    public mutating func sortByTotalOrder() async {
+        await IEEE_754.RadixSort.sortConcurrently(&self, as: UInt32.self, by: .totalOrder)
+    }
+
+    /// Returns the elements sorted by IEEE 754 `totalOrder`
+    ///
+    /// - Returns: A sorted copy; see ``sortByTotalOrder()``
+    @inlinable
+    public func sortedByTotalOrder() -> [Float] {
+        var sorted = self
+        sorted.sortByTotalOrder()
+        return sorted
+    }
+
+    /// Returns the elements sorted by IEEE 754 `totalOrder`, using all cores for large inputs
+    @inlinable
+    public func sortedByTotalOrder() async -> [Float] {
+        var sorted = self
+        await sorted.sortByTotalOrder()
+        return sorted
+    }
+
+    /// Sorts the array in place by IEEE 754 `totalOrderMag`
+    ///
+    /// Orders by absolute value (`|x|`), with NaNs last. Values of equal
+    /// magnitude, such as `-2.0` and `2.0`, keep their original relative order.
+    ///
+    /// Example:
+    /// ```swift
+    /// var values: [Float] = [-3.0, 2.0, -1.0, .nan]
+    /// values.sortByTotalOrderMag()
+    /// // [-1.0, 2.0, -3.0, nan]
+    /// ```
+    @inlinable
+    public mutating func sortByTotalOrderMag() {
+        IEEE_754.RadixSort.sort(&self, as: UInt32.self, by: .magnitude)
+    }
+
+    /// Sorts the array in place by IEEE 754 `totalOrderMag`, using all cores for large inputs
+    @inlinable
+    public mutating func sortByTotalOrderMag() async {
+        await IEEE_754.RadixSort.sortConcurrently(&self, as: UInt32.self, by: .magnitude)
+    }
+
+    /// Returns the elements sorted by IEEE 754 `totalOrderMag`
+    @inlinable
+    public func sortedByTotalOrderMag() -> [Float] {
+        var sorted = self
+        sorted.sortByTotalOrderMag()
+        return sorted
+    }
 
-        self = result
+    /// Returns the elements sorted by IEEE 754 `totalOrderMag`, using all cores for large inputs
+    @inlinable
+    public func sortedByTotalOrderMag() async -> [Float] {
+        var sorted = self
+        await sorted.sortByTotalOrderMag()
+        return sorted
     }
 }
@@ -75,6 +75,52 @@ struct CIEEERoundingModeTests {
         #expect(result1 > 0)
         #expect(result2 > 0)
     }
+
+    @Test func swapAndRestore() {
+        let original = ieee754_get_rounding_mode()
+        let saved = ieee754_swap_rounding_mode(IEEE754_ROUND_UPWARD)
+        #expect(ieee754_get_rounding_mode() == IEEE754_ROUND_UPWARD)
+
+        let nested = ieee754_swap_rounding_mode(IEEE754_ROUND_UPWARD)
+        #expect(ieee754_get_rounding_mode() == IEEE754_ROUND_UPWARD)
+        ieee754_restore_rounding_mode(nested)
+        #expect(ieee754_get_rounding_mode() == IEEE754_ROUND_UPWARD)
+
+        ieee754_restore_rounding_mode(saved)
+        #expect(ieee754_get_rounding_mode() == original)
+    }
+
+    @inline(never)
+    func divide(_ x: Double, _ y: Double) -> Double {
+        x / y
+    }
+
+    @Test func swapAffectsOperations() {
+        let down = withRoundingMode(IEEE754_ROUND_DOWNWARD) { divide(1, 3) }
+        let up = withRoundingMode(IEEE754_ROUND_UPWARD) { divide(1, 3) }
+        #expect(up == down.nextUp)
+    }
+
+    @Test func restoreKeepsHardwareExceptionFlags() {
+        ieee754_clear_fpu_exceptions()
+        let saved = ieee754_swap_rounding_mode(IEEE754_ROUND_TOWARDZERO)
+        _ = divide(1, 3)
+        ieee754_restore_rounding_mode(saved)
+        #expect(ieee754_test_fpu_exceptions().inexact == 1)
+        ieee754_clear_fpu_exceptions()
+    }
+
+    @Test func swiftSwapAndRestore() {
+        let original = IEEE_754.RoundingControl.get()
+        let saved = IEEE_754.RoundingControl.swap(.towardZero)
+        #expect(IEEE_754.RoundingControl.get() == .towardZero)
+        IEEE_754.RoundingControl.restore(saved)
+        #expect(IEEE_754.RoundingControl.get() == original)
+
+        let mode = IEEE_754.RoundingControl.withMode(.downward) { IEEE_754.RoundingControl.get() }
+        #expect(mode == .downward)
+        #expect(IEEE_754.RoundingControl.get() == original)
+    }
 }
 
 // MARK: - Thread-Local Exception Tests
@@ -173,6 +219,41 @@ struct CIEEEExceptionTests {
         #expect(exceptions.divByZero == 0)
         #expect(exceptions.underflow == 0)
     }
+
+    @Test func raiseExceptionsMask() {
+        ieee754_clear_all_exceptions()
+        let mask = UInt8(IEEE754_EXCEPTION_MASK_INVALID | IEEE754_EXCEPTION_MASK_INEXACT)
+        ieee754_raise_exceptions_mask(mask)
+
+        #expect(ieee754_get_exceptions_mask() == mask)
+        #expect(ieee754_test_exception(IEEE754_EXCEPTION_INVALID) == 1)
+        #expect(ieee754_test_exception(IEEE754_EXCEPTION_INEXACT) == 1)
+        #expect(ieee754_test_exception(IEEE754_EXCEPTION_OVERFLOW) == 0)
+    }
+
+    @Test func raiseExceptionsMaskIgnoresUnknownBits() {
+        ieee754_clear_all_exceptions()
+        ieee754_raise_exceptions_mask(0xE0 | UInt8(IEEE754_EXCEPTION_MASK_OVERFLOW))
+
+        #expect(ieee754_get_exceptions_mask() == UInt8(IEEE754_EXCEPTION_MASK_OVERFLOW))
+    }
+
+    @Test func exceptionsMaskMatchesStructure() {
+        ieee754_clear_all_exceptions()
+        ieee754_raise_exception(IEEE754_EXCEPTION_DIVBYZERO)
+        ieee754_raise_exception(IEEE754_EXCEPTION_UNDERFLOW)
+
+        let exceptions = ieee754_get_exceptions()
+        #expect(exceptions.divByZero == 1)
+        #expect(exceptions.underflow == 1)
+        #expect(
+            ieee754_get_exceptions_mask()
+                == UInt8(IEEE754_EXCEPTION_MASK_DIVBYZERO | IEEE754_EXCEPTION_MASK_UNDERFLOW)
+        )
+
+        ieee754_clear_all_exceptions()
+        #expect(ieee754_get_exceptions_mask() == 0)
+    }
 }
 
 // MARK: - Hardware FPU Exception Tests
@@ -377,3 +458,735 @@ struct CIEEEIntegrationTests {
         #expect(ieee754_test_exception(IEEE754_EXCEPTION_OVERFLOW) == 0)
     }
 }
+
+// MARK: - Byte Order Kernel Tests
+
+@Suite("CIEEE754 - Byte Order Kernels")
+struct CIEEEByteOrderTests {
+    @Test(arguments: [0, 1, 7, 8, 16, 33, 100])
+    func byteswap64MatchesScalar(count: Int) {
+        let source = (0..<count).map { UInt64($0) &* 0x0102_0304_0506_0708 }
+        var destination = [UInt64](repeating: 0, count: count)
+        source.withUnsafeBytes { src in
+            destination.withUnsafeMutableBytes { dst in
+                ieee754_byteswap64(dst.baseAddress, src.baseAddress, count)
+            }
+        }
+        #expect(destination == source.map(\.byteSwapped))
+    }
+
+    @Test(arguments: [0, 1, 3, 4, 8, 17, 100])
+    func byteswap32MatchesScalar(count: Int) {
+        let source = (0..<count).map { UInt32($0) &* 0x0102_0304 }
+        var destination = [UInt32](repeating: 0, count: count)
+        source.withUnsafeBytes { src in
+            destination.withUnsafeMutableBytes { dst in
+                ieee754_byteswap32(dst.baseAddress, src.baseAddress, count)
+            }
+        }
+        #expect(destination == source.map(\.byteSwapped))
+    }
+
+    @Test(arguments: [0, 1, 7, 8, 16, 31, 100])
+    func byteswap16MatchesScalar(count: Int) {
+        let source = (0..<count).map { UInt16(truncatingIfNeeded: $0 &* 0x0102) }
+        var destination = [UInt16](repeating: 0, count: count)
+        source.withUnsafeBytes { src in
+            destination.withUnsafeMutableBytes { dst in
+                ieee754_byteswap16(dst.baseAddress, src.baseAddress, count)
+            }
+        }
+        #expect(destination == source.map(\.byteSwapped))
+    }
+
+    @Test func byteswapInPlace() {
+        let original = (0..<21).map { UInt64($0) << 56 | UInt64($0) }
+        var values = original
+        values.withUnsafeMutableBytes { buffer in
+            ieee754_byteswap64(buffer.baseAddress, buffer.baseAddress, 21)
+        }
+        #expect(values == original.map(\.byteSwapped))
+    }
+
+    @Test func byteswapUnaligned() {
+        let source = (0..<41).map { UInt8(truncatingIfNeeded: $0) }
+        var destination = [UInt8](repeating: 0, count: 41)
+        source.withUnsafeBytes { src in
+            destination.withUnsafeMutableBytes { dst in
+                ieee754_byteswap32(dst.baseAddress! + 1, src.baseAddress! + 1, 10)
+            }
+        }
+        for element in 0..<10 {
+            let base = 1 + element * 4
+            #expect(Array(destination[base..<base + 4]) == Array(source[base..<base + 4].reversed()))
+        }
+    }
+}
+
+// MARK: - Batch Signaling Comparison Tests
+
+@Suite("CIEEE754 - Batch Signaling Comparisons", .serialized)
+struct CIEEEBatchSignalingCompareTests {
+    // Long enough to cover full vectors and a scalar tail for both widths
+    static let lhs: [Double] = [1, 2, .nan, 4, 5, 6, 7, 8, .nan, 10, -0.0, .infinity, 3, -1, 2, 9, 0, 0.5, 1e300]
+    static let rhs: [Double] = [2, 2, 3, .nan, 4, 6, 8, 7, 1, 10, 0.0, .infinity, .nan, -2, 2, 9, 1, 0.25, -1e300]
+
+    @Test func lessArrayMatchesScalar() {
+        var out = [UInt8](repeating: 0xFF, count: Self.lhs.count)
+        let unordered = ieee754_signaling_less_array(Self.lhs, Self.rhs, &out, Self.lhs.count)
+        #expect(unordered == 4)
+        for i in Self.lhs.indices {
+            #expect(Int32(out[i]) == ieee754_signaling_less(Self.lhs[i], Self.rhs[i]))
+        }
+    }
+
+    @Test func notEqualArrayTreatsNaNAsUnequal() {
+        var out = [UInt8](repeating: 0xFF, count: Self.lhs.count)
+        _ = ieee754_signaling_not_equal_array(Self.lhs, Self.rhs, &out, Self.lhs.count)
+        #expect(out[2] == 1)
+        #expect(out[3] == 1)
+        #expect(out[10] == 0, "-0 and +0 compare equal")
+        #expect(out[11] == 0)
+    }
+
+    @Test func floatArrayMatchesScalar() {
+        let lhs = Self.lhs.map(Float.init)
+        let rhs = Self.rhs.map(Float.init)
+        var out = [UInt8](repeating: 0xFF, count: lhs.count)
+        let unordered = ieee754_signaling_greater_equal_array_f(lhs, rhs, &out, lhs.count)
+        #expect(unordered == 4)
+        for i in lhs.indices {
+            #expect(Int32(out[i]) == ieee754_signaling_greater_equal_f(lhs[i], rhs[i]))
+        }
+    }
+
+    @Test func arrayRaisesInvalidOnlyWhenUnordered() {
+        let values: [Double] = (0..<37).map(Double.init)
+        var out = [UInt8](repeating: 0, count: values.count)
+
+        ieee754_clear_all_exceptions()
+        #expect(ieee754_signaling_equal_array(values, values, &out, values.count) == 0)
+        #expect(out.allSatisfy { $0 == 1 })
+        #expect(ieee754_test_exception(IEEE754_EXCEPTION_INVALID) == 0)
+
+        var withNaN = values
+        withNaN[36] = .nan
+        #expect(ieee754_signaling_equal_array(withNaN, values, &out, values.count) == 1)
+        #expect(ieee754_test_exception(IEEE754_EXCEPTION_INVALID) == 1)
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func emptyArray() {
+        ieee754_clear_all_exceptions()
+        #expect(ieee754_signaling_less_array(nil, nil, nil, 0) == 0)
+        #expect(ieee754_test_exception(IEEE754_EXCEPTION_INVALID) == 0)
+    }
+
+    @Test func swiftArrayAPI() {
+        ieee754_clear_all_exceptions()
+        let (results, unordered) = IEEE_754.Comparison.Signaling.lessEqual(Self.lhs, Self.rhs)
+        #expect(unordered == 4)
+        #expect(results == zip(Self.lhs, Self.rhs).map { $0 <= $1 })
+        #expect(IEEE_754.Exceptions.testFlag(.invalid))
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func swiftBufferAPI() {
+        let lhs: [Float] = [1, 5, 3, .nan, 9, 9, 9, 9, 9, 0]
+        let rhs: [Float] = [2, 4, 3, 1, 9, 9, 9, 9, 9, 1]
+        var results = [Bool](repeating: false, count: lhs.count)
+        let unordered = lhs.withUnsafeBufferPointer { lhs in
+            rhs.withUnsafeBufferPointer { rhs in
+                results.withUnsafeMutableBufferPointer { results in
+                    IEEE_754.Comparison.Signaling.greater(lhs, rhs, into: results)
+                }
+            }
+        }
+        #expect(unordered == 1)
+        #expect(results == [false, true, false, false, false, false, false, false, false, false])
+        ieee754_clear_all_exceptions()
+    }
+}
+
+// MARK: - Bulk Narrowing Conversion Tests
+
+@Suite("CIEEE754 - Bulk Narrowing Conversions", .serialized)
+struct CIEEEBulkNarrowingTests {
+    static let doubles: [Double] = [
+        0, -0.0, 1, 1.5, 0.1, -1e300, 1e-300, .infinity, -.infinity, .nan,
+        Double(Float.greatestFiniteMagnitude), 65504, 65520, 65519.99, 0x1p-25, 0x1.0000000000001p-25,
+        0x1p-24, 3.4028235677973366e38,
+    ]
+
+    static func convert(_ values: [Double]) -> ([Float], IEEE_754.Conversions.Summary) {
+        var floats = [Float](repeating: 0, count: values.count)
+        let summary = values.withUnsafeBufferPointer { source in
+            floats.withUnsafeMutableBufferPointer { destination in
+                IEEE_754.Conversions.doubleToFloat(source, into: destination)
+            }
+        }
+        return (floats, summary)
+    }
+
+    static func convert(_ values: [Float]) -> ([UInt16], IEEE_754.Conversions.Summary) {
+        var bits = [UInt16](repeating: 0, count: values.count)
+        let summary = values.withUnsafeBufferPointer { source in
+            bits.withUnsafeMutableBufferPointer { destination in
+                IEEE_754.Conversions.floatToBinary16(source, into: destination)
+            }
+        }
+        return (bits, summary)
+    }
+
+    static func convertToBinary16(_ values: [Double]) -> ([UInt16], IEEE_754.Conversions.Summary) {
+        var bits = [UInt16](repeating: 0, count: values.count)
+        let summary = values.withUnsafeBufferPointer { source in
+            bits.withUnsafeMutableBufferPointer { destination in
+                IEEE_754.Conversions.doubleToBinary16(source, into: destination)
+            }
+        }
+        return (bits, summary)
+    }
+
+    @Test func doubleToFloatMatchesScalar() {
+        ieee754_clear_all_exceptions()
+        let (floats, summary) = Self.convert(Self.doubles)
+        for (value, converted) in zip(Self.doubles, floats) {
+            let expected = Float(value)
+            #expect(converted.bitPattern == expected.bitPattern || (converted.isNaN && expected.isNaN))
+        }
+        #expect(summary.overflow == 2)
+        #expect(summary.underflow == 1)
+        #expect(summary.invalid == 0)
+        #expect(IEEE_754.Exceptions.testFlag(.overflow))
+        #expect(IEEE_754.Exceptions.testFlag(.inexact))
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func floatToBinary16Boundaries() {
+        let (bits, summary) = Self.convert([65504, 65520, 65519.99, 0x1p-25, 0x1.000002p-25, 0x1p-14, 1, -2])
+        #expect(bits == [0x7BFF, 0x7C00, 0x7BFF, 0x0000, 0x0001, 0x0400, 0x3C00, 0xC000])
+        #expect(summary.overflow == 1)
+        #expect(summary.underflow == 2)
+        #expect(summary.inexact == 4)
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func floatToBinary16QuietsSignalingNaN() {
+        let signaling = Float(bitPattern: 0x7FA0_0001)
+        let (bits, summary) = Self.convert([signaling, .nan, .infinity])
+        #expect(bits[0] & 0x7E00 == 0x7E00)
+        #expect(bits[1] & 0x7E00 == 0x7E00)
+        #expect(bits[2] == 0x7C00)
+        #expect(summary.invalid == 1)
+        #expect(summary.flags.contains(.invalid))
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func floatToBinary16MatchesSoftwareAcrossBlocks() {
+        var values: [Float] = []
+        var state: UInt32 = 0x1234_5678
+        for _ in 0..<1_000 {
+            state = state &* 1_664_525 &+ 1_013_904_223
+            values.append(Float(bitPattern: (state & 0x8FFF_FFFF) | 0x3000_0000))
+        }
+        let (bits, _) = Self.convert(values)
+        let (reference, _) = Self.convertToBinary16(values.map(Double.init))
+        #expect(bits == reference)
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func floatToBinary16IgnoresRoundingMode() {
+        // 1 + 2^-12 is below the binary16 tie: nearest gives 1, upward would give 1 + 2^-10
+        let values = [Float](repeating: 1 + 0x1p-12, count: 64) + [-(1 + 0x1p-12)]
+        for mode in [IEEE754_ROUND_UPWARD, IEEE754_ROUND_DOWNWARD, IEEE754_ROUND_TOWARDZERO] {
+            let (bits, _) = withRoundingMode(mode) { Self.convert(values) }
+            #expect(bits == [UInt16](repeating: 0x3C00, count: 64) + [0xBC00])
+        }
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func doubleToBinary16RoundsOnce() {
+        // Halfway between two binary16 values after rounding to Float, but just above it as a Double
+        let value = 1 + 0x1p-11 + 0x1p-40
+        let (bits, summary) = Self.convertToBinary16([value])
+        #expect(bits == [0x3C01])
+        #expect(summary.inexact == 1)
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func exactBatchRaisesNothing() {
+        ieee754_clear_all_exceptions()
+        let (_, summary) = Self.convert([Float](repeating: 0.5, count: 33))
+        #expect(summary.isExact)
+        #expect(summary.flags.isEmpty)
+        #expect(!IEEE_754.Exceptions.testFlag(.inexact))
+    }
+
+    @Test func emptyBuffers() {
+        let (floats, summary) = Self.convert([Double]())
+        #expect(floats.isEmpty)
+        #expect(summary == IEEE_754.Conversions.Summary())
+    }
+
+    #if !((os(macOS) || targetEnvironment(macCatalyst)) && arch(x86_64))
+        @Test func float16StorageMatchesBitPatterns() {
+            let floats: [Float] = [65504, 65520, 0x1p-25, 0x1.000002p-25, 1, -2, 0.1]
+            let (bits, expected) = Self.convert(floats)
+            var halves = [Float16](repeating: 0, count: floats.count)
+            let summary = floats.withUnsafeBufferPointer { source in
+                halves.withUnsafeMutableBufferPointer { IEEE_754.Conversions.floatToFloat16(source, into: $0) }
+            }
+            #expect(halves.map(\.bitPattern) == bits)
+            #expect(halves.map(\.bitPattern) == floats.map { Float16($0).bitPattern })
+            #expect(summary == expected)
+
+            let doubles = Self.doubles.filter { !$0.isNaN }
+            let (doubleBits, doubleExpected) = Self.convertToBinary16(doubles)
+            var narrowed = [Float16](repeating: 0, count: doubles.count)
+            let doubleSummary = doubles.withUnsafeBufferPointer { source in
+                narrowed.withUnsafeMutableBufferPointer { IEEE_754.Conversions.doubleToFloat16(source, into: $0) }
+            }
+            #expect(narrowed.map(\.bitPattern) == doubleBits)
+            #expect(narrowed.map(\.bitPattern) == doubles.map { Float16($0).bitPattern })
+            #expect(doubleSummary == doubleExpected)
+            ieee754_clear_all_exceptions()
+        }
+    #endif
+}
+
+// MARK: - Directed Arithmetic Against Hardware Rounding
+
+@Suite("CIEEE754 - Directed Arithmetic Matches Hardware", .serialized)
+struct CIEEEDirectedArithmeticTests {
+    static let modes: [(IEEE754RoundingMode, IEEE_754.Rounding.Direction)] = [
+        (IEEE754_ROUND_TONEAREST, .toNearest(.toEven)),
+        (IEEE754_ROUND_UPWARD, .towardInfinity(.positive)),
+        (IEEE754_ROUND_DOWNWARD, .towardInfinity(.negative)),
+        (IEEE754_ROUND_TOWARDZERO, .towardZero),
+    ]
+
+    @inline(never) static func add(_ x: Double, _ y: Double) -> Double { x + y }
+    @inline(never) static func multiply(_ x: Double, _ y: Double) -> Double { x * y }
+    @inline(never) static func divide(_ x: Double, _ y: Double) -> Double { x / y }
+    @inline(never) static func root(_ x: Double) -> Double { x.squareRoot() }
+    @inline(never) static func fused(_ x: Double, _ y: Double, _ z: Double) -> Double { z.addingProduct(x, y) }
+
+    /// Finite operands spanning normal, subnormal and near-overflow magnitudes
+    static let operands: [Double] = {
+        var state: UInt64 = 0x9E37_79B9_7F4A_7C15
+        return (0..<2_000).map { _ in
+            state = state &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+            let exponent: UInt64 = state >> 62 == 0 ? (state >> 20) & 0x7FE : 0x3DF + (state >> 20) % 64
+            return Double(bitPattern: (state & 0x800F_FFFF_FFFF_FFFF) | exponent << 52)
+        }
+    }()
+
+    func check(_ hardware: () -> Double, _ software: Double) {
+        #expect(hardware().bitPattern == software.bitPattern)
+    }
+
+    @Test func `scalar operations`() {
+        let x = Self.operands
+        for (mode, direction) in Self.modes {
+            let expected = withRoundingMode(mode) {
+                (0..<x.count - 2).map { i in
+                    [
+                        Self.add(x[i], x[i + 1]), Self.multiply(x[i], x[i + 1]), Self.divide(x[i], x[i + 1]),
+                        Self.root(x[i].magnitude), Self.fused(x[i], x[i + 1], x[i + 2]),
+                    ]
+                }
+            }
+            for i in 0..<x.count - 2 {
+                let actual = [
+                    IEEE_754.Arithmetic.addition(x[i], x[i + 1], rounding: direction),
+                    IEEE_754.Arithmetic.multiplication(x[i], x[i + 1], rounding: direction),
+                    IEEE_754.Arithmetic.division(x[i], x[i + 1], rounding: direction),
+                    IEEE_754.Arithmetic.squareRoot(x[i].magnitude, rounding: direction),
+                    IEEE_754.Arithmetic.fusedMultiplyAdd(a: x[i], b: x[i + 1], c: x[i + 2], rounding: direction),
+                ]
+                #expect(actual.map(\.bitPattern) == expected[i].map(\.bitPattern), "operands at \(i)")
+            }
+        }
+    }
+
+    @Test func `batch operations`() {
+        let a = Self.operands
+        let b = Array(a.dropFirst()) + [1]
+        for (mode, direction) in Self.modes {
+            let expected = withRoundingMode(mode) { zip(a, b).map { Self.add($0, $1) } }
+            let actual = IEEE_754.Arithmetic.addition(a, b, rounding: direction)
+            #expect(actual.map(\.bitPattern) == expected.map(\.bitPattern))
+
+            let products = withRoundingMode(mode) { zip(a, b).map { Self.multiply($0, $1) } }
+            #expect(IEEE_754.Arithmetic.multiplication(a, b, rounding: direction).map(\.bitPattern)
+                == products.map(\.bitPattern))
+        }
+    }
+
+    @Test func `leaves the rounding mode alone`() {
+        let before = ieee754_get_rounding_mode()
+        _ = IEEE_754.Arithmetic.division(1.0, 3.0, rounding: .towardInfinity(.positive))
+        _ = IEEE_754.Arithmetic.addition([1.0, 2.0], [0x1p-60, 0x1p-60], rounding: .towardZero)
+        #expect(ieee754_get_rounding_mode() == before)
+    }
+}
+
+// MARK: - Binary16 Batch Arithmetic
+
+@Suite("CIEEE754 - Binary16 Batch Arithmetic", .serialized)
+struct CIEEEBinary16BatchTests {
+    static func binary16(_ value: Double) -> UInt16 {
+        var bits: [UInt16] = [0]
+        [value].withUnsafeBufferPointer { source in
+            bits.withUnsafeMutableBufferPointer { _ = IEEE_754.Conversions.doubleToBinary16(source, into: $0) }
+        }
+        return bits[0]
+    }
+
+    static func apply(
+        _ lhs: [UInt16],
+        _ rhs: [UInt16],
+        _ operation: (UnsafeBufferPointer<UInt16>, UnsafeBufferPointer<UInt16>, UnsafeMutableBufferPointer<UInt16>)
+            -> IEEE_754.Exceptions.FlagSet
+    ) -> ([UInt16], IEEE_754.Exceptions.FlagSet) {
+        var result = [UInt16](repeating: 0, count: lhs.count)
+        let flags = lhs.withUnsafeBufferPointer { a in
+            rhs.withUnsafeBufferPointer { b in
+                result.withUnsafeMutableBufferPointer { operation(a, b, $0) }
+            }
+        }
+        return (result, flags)
+    }
+
+    static func widen(_ bits: [UInt16]) -> ([Float], IEEE_754.Exceptions.FlagSet) {
+        var floats = [Float](repeating: 0, count: bits.count)
+        let flags = bits.withUnsafeBufferPointer { source in
+            floats.withUnsafeMutableBufferPointer { IEEE_754.Binary16.widen(source, into: $0) }
+        }
+        return (floats, flags)
+    }
+
+    /// Pseudo-random finite operands spread over the binary16 exponent range
+    static let operands: ([UInt16], [UInt16], [UInt16]) = {
+        var state: UInt32 = 0x9E37_79B9
+        func next() -> UInt16 {
+            state = state &* 1_664_525 &+ 1_013_904_223
+            let bits = UInt16(truncatingIfNeeded: state >> 16)
+            return bits & 0x7C00 == 0x7C00 ? bits & 0xBFFF : bits
+        }
+        var x: [UInt16] = [], y: [UInt16] = [], z: [UInt16] = []
+        for _ in 0..<1_037 {
+            x.append(next())
+            y.append(next())
+            z.append(next())
+        }
+        return (x, y, z)
+    }()
+
+    @Test func widenIsExact() {
+        let (x, _, _) = Self.operands
+        let (floats, flags) = Self.widen(x)
+        for (bits, value) in zip(x, floats) {
+            #expect(Self.binary16(Double(value)) == bits)
+        }
+        #expect(flags.isEmpty)
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func widenSpecialValues() {
+        let (floats, flags) = Self.widen([0x0001, 0x8400, 0x7C00, 0x7E01, 0x7C01])
+        #expect(floats[0] == 0x1p-24)
+        #expect(floats[1] == -0x1p-14)
+        #expect(floats[2] == .infinity)
+        #expect(floats[3].isNaN && !floats[3].isSignalingNaN)
+        #expect(floats[4].isNaN && !floats[4].isSignalingNaN)
+        #expect(flags == [.invalid])
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func additionAndMultiplicationRoundOnce() {
+        let (x, y, _) = Self.operands
+        let (widenedX, _) = Self.widen(x)
+        let (widenedY, _) = Self.widen(y)
+        let (sums, _) = Self.apply(x, y) { IEEE_754.Binary16.addition($0, $1, into: $2) }
+        let (products, _) = Self.apply(x, y) { IEEE_754.Binary16.multiplication($0, $1, into: $2) }
+        for index in x.indices {
+            // Sums and products of binary16 values are exact in Double
+            let a = Double(widenedX[index]), b = Double(widenedY[index])
+            #expect(sums[index] == Self.binary16(a + b))
+            #expect(products[index] == Self.binary16(a * b))
+        }
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func fusedMultiplyAddRoundsOnce() {
+        let (x, y, z) = Self.operands
+        let (wx, _) = Self.widen(x)
+        let (wy, _) = Self.widen(y)
+        let (wz, _) = Self.widen(z)
+        var result = [UInt16](repeating: 0, count: x.count)
+        x.withUnsafeBufferPointer { a in
+            y.withUnsafeBufferPointer { b in
+                z.withUnsafeBufferPointer { c in
+                    result.withUnsafeMutableBufferPointer { _ = IEEE_754.Binary16.fusedMultiplyAdd(a, b, c, into: $0) }
+                }
+            }
+        }
+        var checked = 0
+        for index in x.indices {
+            // The product is exact in Double; when TwoSum shows the sum is
+            // too, narrowing it is the single correctly rounded reference
+            let product = Double(wx[index]) * Double(wy[index]), addend = Double(wz[index])
+            let sum = product + addend
+            let virtual = sum - product
+            let error = (product - (sum - virtual)) + (addend - virtual)
+            guard error == 0 else { continue }
+            #expect(result[index] == Self.binary16(sum))
+            checked += 1
+        }
+        #expect(checked > x.count / 2)
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func fusedMultiplyAddAvoidsDoubleRounding() {
+        // 1.5 × 683·2^-10 = 1 + 2^-11 exactly; adding 2^-24 lifts it just
+        // above the binary16 tie, but a binary32 intermediate rounds back
+        // onto the tie, which then rounds to even (down)
+        let (x, y, z) = ([Self.binary16(1.5)], [Self.binary16(683 * 0x1p-10)], [UInt16(0x0001)])
+        var result: [UInt16] = [0]
+        x.withUnsafeBufferPointer { a in
+            y.withUnsafeBufferPointer { b in
+                z.withUnsafeBufferPointer { c in
+                    result.withUnsafeMutableBufferPointer { _ = IEEE_754.Binary16.fusedMultiplyAdd(a, b, c, into: $0) }
+                }
+            }
+        }
+        #expect(result == [0x3C01])
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func flagsAreReportedOncePerBatch() {
+        ieee754_clear_all_exceptions()
+        let max = Self.binary16(65504), tiny: UInt16 = 0x0001
+        let (products, flags) = Self.apply([max, tiny, max], [max, tiny, 0x3C00]) {
+            IEEE_754.Binary16.multiplication($0, $1, into: $2)
+        }
+        #expect(products == [0x7C00, 0x0000, max])
+        #expect(flags == [.overflow, .underflow, .inexact])
+        #expect(IEEE_754.Exceptions.testFlag(.overflow))
+        #expect(IEEE_754.Exceptions.testFlag(.underflow))
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func underflowFollowsAnInexactNormalElement() {
+        // (1 + 2^-10)² is inexact but normal; 2^-24 × (1 + 2^-10) is tiny and inexact
+        let x: [UInt16] = [0x3C01, 0x0001], y: [UInt16] = [0x3C01, 0x3C01], z: [UInt16] = [0, 0]
+        let (products, flags) = Self.apply(x, y) { IEEE_754.Binary16.multiplication($0, $1, into: $2) }
+        #expect(products == [0x3C02, 0x0001])
+        #expect(flags == [.underflow, .inexact])
+
+        var result: [UInt16] = [0, 0]
+        let fused = x.withUnsafeBufferPointer { a in
+            y.withUnsafeBufferPointer { b in
+                z.withUnsafeBufferPointer { c in
+                    result.withUnsafeMutableBufferPointer { IEEE_754.Binary16.fusedMultiplyAdd(a, b, c, into: $0) }
+                }
+            }
+        }
+        #expect(result == [0x3C02, 0x0001])
+        #expect(fused == [.underflow, .inexact])
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func exactBatchRaisesNothing() {
+        ieee754_clear_all_exceptions()
+        let halves = [UInt16](repeating: Self.binary16(0.5), count: 100)
+        let (sums, flags) = Self.apply(halves, halves) { IEEE_754.Binary16.addition($0, $1, into: $2) }
+        #expect(sums == [UInt16](repeating: Self.binary16(1), count: 100))
+        #expect(flags.isEmpty)
+        #expect(!IEEE_754.Exceptions.testFlag(.inexact))
+    }
+
+    @Test func invalidOperations() {
+        let (sums, flags) = Self.apply([0x7C00, 0x7D01, 0x7E05], [0xFC00, 0x3C00, 0x3C00]) {
+            IEEE_754.Binary16.addition($0, $1, into: $2)
+        }
+        #expect(sums[0] & 0x7E00 == 0x7E00)
+        #expect(sums[1] == 0x7F01)
+        #expect(sums[2] == 0x7E05)
+        #expect(flags == [.invalid])
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func roundingModeIsRestored() {
+        let before = ieee754_get_rounding_mode()
+        _ = ieee754_set_rounding_mode(IEEE754_ROUND_UPWARD)
+        let (sums, _) = Self.apply([Self.binary16(1)], [0x0001]) { IEEE_754.Binary16.addition($0, $1, into: $2) }
+        #expect(sums == [Self.binary16(1)])
+        #expect(ieee754_get_rounding_mode() == IEEE754_ROUND_UPWARD)
+        _ = ieee754_set_rounding_mode(before)
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func emptyBuffers() {
+        let (sums, flags) = Self.apply([], []) { IEEE_754.Binary16.addition($0, $1, into: $2) }
+        #expect(sums.isEmpty)
+        #expect(flags.isEmpty)
+    }
+
+    #if !((os(macOS) || targetEnvironment(macCatalyst)) && arch(x86_64))
+        @Test func float16StorageMatchesBitPatterns() {
+            let (x, y, z) = Self.operands
+            let (a, b, c) = (
+                x.map(Float16.init(bitPattern:)), y.map(Float16.init(bitPattern:)), z.map(Float16.init(bitPattern:))
+            )
+            let (sums, sumFlags) = Self.apply(x, y) { IEEE_754.Binary16.addition($0, $1, into: $2) }
+            let (products, productFlags) = Self.apply(x, y) { IEEE_754.Binary16.multiplication($0, $1, into: $2) }
+            var fused = [UInt16](repeating: 0, count: x.count)
+            let fusedFlags = x.withUnsafeBufferPointer { p in
+                y.withUnsafeBufferPointer { q in
+                    z.withUnsafeBufferPointer { r in
+                        fused.withUnsafeMutableBufferPointer { IEEE_754.Binary16.fusedMultiplyAdd(p, q, r, into: $0) }
+                    }
+                }
+            }
+            var result = [Float16](repeating: 0, count: x.count)
+
+            let typedSum = a.withUnsafeBufferPointer { p in
+                b.withUnsafeBufferPointer { q in
+                    result.withUnsafeMutableBufferPointer { IEEE_754.Binary16.addition(p, q, into: $0) }
+                }
+            }
+            #expect(result.map(\.bitPattern) == sums)
+            #expect(typedSum == sumFlags)
+
+            let typedProduct = a.withUnsafeBufferPointer { p in
+                b.withUnsafeBufferPointer { q in
+                    result.withUnsafeMutableBufferPointer { IEEE_754.Binary16.multiplication(p, q, into: $0) }
+                }
+            }
+            #expect(result.map(\.bitPattern) == products)
+            #expect(typedProduct == productFlags)
+
+            let typedFused = a.withUnsafeBufferPointer { p in
+                b.withUnsafeBufferPointer { q in
+                    c.withUnsafeBufferPointer { r in
+                        result.withUnsafeMutableBufferPointer { IEEE_754.Binary16.fusedMultiplyAdd(p, q, r, into: $0) }
+                    }
+                }
+            }
+            #expect(result.map(\.bitPattern) == fused)
+            #expect(typedFused == fusedFlags)
+            ieee754_clear_all_exceptions()
+        }
+
+        @Test func float16StorageConvertsLikeTheStandardLibrary() {
+            let (x, _, _) = Self.operands
+            let halves = x.map(Float16.init(bitPattern:))
+            var floats = [Float](repeating: 0, count: halves.count)
+            let widened = halves.withUnsafeBufferPointer { source in
+                floats.withUnsafeMutableBufferPointer { IEEE_754.Binary16.widen(source, into: $0) }
+            }
+            #expect(floats.map(\.bitPattern) == halves.map { Float($0).bitPattern })
+            #expect(widened.isEmpty)
+
+            // Thirds of binary16 values are mostly inexact in binary16
+            let source = floats.map { $0 / 3 }
+            var narrowed = [Float16](repeating: 0, count: source.count)
+            _ = source.withUnsafeBufferPointer { values in
+                narrowed.withUnsafeMutableBufferPointer { IEEE_754.Binary16.narrow(values, into: $0) }
+            }
+            #expect(narrowed.map(\.bitPattern) == source.map { Float16($0).bitPattern })
+            ieee754_clear_all_exceptions()
+        }
+    #endif
+}
+
+// MARK: - Exception Capture Tests
+
+@Suite("CIEEE754 - Exception Capture", .serialized)
+struct CIEEEExceptionCaptureTests {
+    @Test func capturesHardwareAndThreadLocalFlags() {
+        ieee754_clear_fpu_exceptions()
+        ieee754_clear_all_exceptions()
+
+        let (result, raised) = IEEE_754.Exceptions.capturing {
+            IEEE_754.Exceptions.raise(.overflow)
+            return ieee754_signaling_equal(.nan, 1.0)
+        }
+
+        #expect(result == 0)
+        #expect(raised == [.invalid, .overflow])
+        #expect(ieee754_test_fpu_exceptions().invalid == 1)
+        #expect(IEEE_754.Exceptions.raised() == [.overflow])
+
+        ieee754_clear_fpu_exceptions()
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func reportsOnlyFlagsRaisedInside() {
+        ieee754_clear_fpu_exceptions()
+        ieee754_clear_all_exceptions()
+        IEEE_754.Exceptions.raise(.underflow)
+        _ = ieee754_signaling_less(.nan, 0.0)
+
+        let raised = IEEE_754.Exceptions.capturing {
+            #expect(IEEE_754.Exceptions.raised().isEmpty)
+            #expect(ieee754_test_fpu_exceptions().invalid == 0)
+            IEEE_754.Exceptions.raise(.divisionByZero)
+        }.raised
+
+        #expect(raised == [.divisionByZero])
+        #expect(IEEE_754.Exceptions.raised() == [.divisionByZero, .underflow])
+        #expect(ieee754_test_fpu_exceptions().invalid == 1)
+
+        ieee754_clear_fpu_exceptions()
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func restoresEntryStateWithoutMerging() {
+        ieee754_clear_fpu_exceptions()
+        ieee754_clear_all_exceptions()
+        IEEE_754.Exceptions.raise(.inexact)
+
+        let raised = IEEE_754.Exceptions.capturing(merging: false) {
+            IEEE_754.Exceptions.raise(.invalid)
+            _ = ieee754_signaling_equal(.nan, .nan)
+        }.raised
+
+        #expect(raised == [.invalid])
+        #expect(IEEE_754.Exceptions.raised() == [.inexact])
+        #expect(ieee754_test_fpu_exceptions().invalid == 0)
+
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func restoresStateWhenBodyThrows() {
+        struct Failure: Error {}
+        ieee754_clear_fpu_exceptions()
+        ieee754_clear_all_exceptions()
+        IEEE_754.Exceptions.raise(.overflow)
+
+        #expect(throws: Failure.self) {
+            try IEEE_754.Exceptions.capturing(merging: false) {
+                IEEE_754.Exceptions.raise(.invalid)
+                throw Failure()
+            }
+        }
+
+        #expect(IEEE_754.Exceptions.raised() == [.overflow])
+        ieee754_clear_all_exceptions()
+    }
+
+    @Test func clearedExceptionsIsolateHardwareFlags() {
+        ieee754_clear_fpu_exceptions()
+
+        withClearedExceptions {
+            _ = ieee754_signaling_equal(.nan, 1.0)
+            #expect(ieee754_test_fpu_exceptions().invalid == 1)
+        }
+
+        #expect(ieee754_test_fpu_exceptions().invalid == 0)
+    }
+}
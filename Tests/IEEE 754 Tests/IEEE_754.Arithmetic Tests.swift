@@ -387,3 +387,397 @@ struct ArithmeticConsistencyTests {
         }
     }
 }
+
+// MARK: - Directed Rounding Tests
+
+@Suite("IEEE_754.Arithmetic - Directed rounding")
+struct ArithmeticDirectedRoundingTests {
+    typealias Direction = IEEE_754.Rounding.Direction
+
+    static let directions: [Direction] = [
+        .toNearest(.toEven), .toNearest(.awayFromZero), .towardInfinity(.positive), .towardInfinity(.negative),
+        .towardZero,
+    ]
+
+    @Test func `addition brackets the exact sum`() {
+        let down = IEEE_754.Arithmetic.addition(0.1, 0.2, rounding: .towardInfinity(.negative))
+        let up = IEEE_754.Arithmetic.addition(0.1, 0.2, rounding: .towardInfinity(.positive))
+        #expect(up == down.nextUp)
+        #expect(IEEE_754.Arithmetic.addition(0.1, 0.2, rounding: .toNearest(.toEven)) == 0.1 + 0.2)
+        #expect(IEEE_754.Arithmetic.addition(0.1, 0.2, rounding: .towardZero) == down)
+        #expect(IEEE_754.Arithmetic.addition(-0.1, -0.2, rounding: .towardZero) == -down)
+    }
+
+    @Test func `exact results ignore the direction`() {
+        for direction in Self.directions {
+            #expect(IEEE_754.Arithmetic.addition(1.0, 2.0, rounding: direction) == 3.0)
+            #expect(IEEE_754.Arithmetic.multiplication(1.5, 4.0, rounding: direction) == 6.0)
+            #expect(IEEE_754.Arithmetic.division(1.0, 8.0, rounding: direction) == 0.125)
+            #expect(IEEE_754.Arithmetic.squareRoot(4.0, rounding: direction) == 2.0)
+            #expect(IEEE_754.Arithmetic.fusedMultiplyAdd(a: 2.0, b: 3.0, c: 1.0, rounding: direction) == 7.0)
+        }
+    }
+
+    @Test func `ties round away from zero`() {
+        let tie = 0x1p-53
+        #expect(IEEE_754.Arithmetic.addition(1.0, tie, rounding: .toNearest(.toEven)) == 1.0)
+        #expect(IEEE_754.Arithmetic.addition(1.0, tie, rounding: .toNearest(.awayFromZero)) == 1.0.nextUp)
+        #expect(IEEE_754.Arithmetic.addition(-1.0, -tie, rounding: .toNearest(.awayFromZero)) == -1.0.nextUp)
+        #expect(
+            IEEE_754.Arithmetic.fusedMultiplyAdd(a: 1.0, b: 1.0, c: tie, rounding: .toNearest(.awayFromZero))
+                == 1.0.nextUp)
+
+        let product = IEEE_754.Arithmetic.multiplication(
+            Double.leastNonzeroMagnitude, 0.5, rounding: .toNearest(.awayFromZero))
+        #expect(product == Double.leastNonzeroMagnitude)
+        let even = IEEE_754.Arithmetic.multiplication(Double.leastNonzeroMagnitude, 0.5, rounding: .toNearest(.toEven))
+        #expect(even == 0)
+        #expect(
+            IEEE_754.Arithmetic.division(Double.leastNonzeroMagnitude, 2.0, rounding: .toNearest(.awayFromZero))
+                == Double.leastNonzeroMagnitude)
+    }
+
+    @Test func `exact zero sums are negative rounding downward`() {
+        let down = IEEE_754.Arithmetic.addition(0.5, -0.5, rounding: .towardInfinity(.negative))
+        #expect(down == 0 && down.sign == .minus)
+        let up = IEEE_754.Arithmetic.addition(0.5, -0.5, rounding: .towardInfinity(.positive))
+        #expect(up == 0 && up.sign == .plus)
+        let fused = IEEE_754.Arithmetic.fusedMultiplyAdd(a: 2.0, b: 0.25, c: -0.5, rounding: .towardInfinity(.negative))
+        #expect(fused == 0 && fused.sign == .minus)
+    }
+
+    @Test func `overflow saturates toward zero`() {
+        let max = Double.greatestFiniteMagnitude
+        #expect(IEEE_754.Arithmetic.addition(max, max, rounding: .towardZero) == max)
+        #expect(IEEE_754.Arithmetic.addition(max, max, rounding: .towardInfinity(.positive)) == .infinity)
+        #expect(IEEE_754.Arithmetic.multiplication(max, -2, rounding: .towardInfinity(.positive)) == -max)
+        #expect(IEEE_754.Arithmetic.division(max, 0.5, rounding: .towardInfinity(.negative)) == max)
+        #expect(IEEE_754.Arithmetic.addition(Double.infinity, 1, rounding: .towardZero) == .infinity)
+    }
+
+    @Test func `special values propagate`() {
+        for direction in Self.directions {
+            #expect(IEEE_754.Arithmetic.addition(Double.nan, 1, rounding: direction).isNaN)
+            #expect(IEEE_754.Arithmetic.division(0.0, 0.0, rounding: direction).isNaN)
+            #expect(IEEE_754.Arithmetic.squareRoot(-1.0, rounding: direction).isNaN)
+            #expect(IEEE_754.Arithmetic.division(1.0, 0.0, rounding: direction) == .infinity)
+        }
+    }
+
+    @Test func `square root and division bracket the exact result`() {
+        let root = IEEE_754.Arithmetic.squareRoot(2.0, rounding: .towardInfinity(.negative))
+        #expect(IEEE_754.Arithmetic.squareRoot(2.0, rounding: .towardInfinity(.positive)) == root.nextUp)
+        #expect(root * root < 2 && root.nextUp * root.nextUp > 2)
+
+        let third = IEEE_754.Arithmetic.division(1.0, 3.0, rounding: .towardZero)
+        #expect(IEEE_754.Arithmetic.division(1.0, 3.0, rounding: .towardInfinity(.positive)) == third.nextUp)
+        #expect(IEEE_754.Arithmetic.division(-1.0, 3.0, rounding: .towardZero) == -third)
+    }
+
+    @Test func `float operands`() {
+        let down = IEEE_754.Arithmetic.division(Float(1), 10, rounding: .towardInfinity(.negative))
+        let up = IEEE_754.Arithmetic.division(Float(1), 10, rounding: .towardInfinity(.positive))
+        #expect(up == down.nextUp)
+        #expect(IEEE_754.Arithmetic.addition(Float(1), 0x1p-24, rounding: .toNearest(.awayFromZero)) == Float(1).nextUp)
+    }
+
+    static func operands(_ count: Int, seed: UInt64) -> [Double] {
+        var state = seed
+        let specials: [Double] = [
+            0, -0.0, .infinity, -.infinity, .nan, .leastNonzeroMagnitude, .greatestFiniteMagnitude,
+        ]
+        return (0..<count).map { _ in
+            state = state &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+            if state >> 59 == 0 { return specials[Int(state >> 32) % specials.count] }
+            // Exponents clustered in [-64, 64] with an occasional full-range value
+            let exponent: UInt64 = state >> 58 == 1 ? (state >> 20) & 0x7FE : 0x3BF + (state >> 20) % 128
+            return Double(bitPattern: (state & 0x800F_FFFF_FFFF_FFFF) | exponent << 52)
+        }
+    }
+
+    @Test(arguments: [0, 7, 8, 100, 1_000])
+    func `batch results match scalar`(count: Int) {
+        let a = Self.operands(count, seed: 1)
+        let b = Self.operands(count, seed: 2)
+        let c = Self.operands(count, seed: 3)
+        func same(_ x: [Double], _ y: [Double]) -> Bool {
+            x.map(\.bitPattern) == y.map(\.bitPattern)
+        }
+
+        for direction in Self.directions {
+            let add = IEEE_754.Arithmetic.addition(a, b, rounding: direction)
+            #expect(same(add, zip(a, b).map { IEEE_754.Arithmetic.addition($0, $1, rounding: direction) }))
+
+            let sub = IEEE_754.Arithmetic.subtraction(a, b, rounding: direction)
+            #expect(same(sub, zip(a, b).map { IEEE_754.Arithmetic.subtraction($0, $1, rounding: direction) }))
+
+            let mul = IEEE_754.Arithmetic.multiplication(a, b, rounding: direction)
+            #expect(same(mul, zip(a, b).map { IEEE_754.Arithmetic.multiplication($0, $1, rounding: direction) }))
+
+            let div = IEEE_754.Arithmetic.division(a, b, rounding: direction)
+            #expect(same(div, zip(a, b).map { IEEE_754.Arithmetic.division($0, $1, rounding: direction) }))
+
+            let sqrt = IEEE_754.Arithmetic.squareRoot(a.map(\.magnitude), rounding: direction)
+            #expect(same(sqrt, a.map { IEEE_754.Arithmetic.squareRoot($0.magnitude, rounding: direction) }))
+
+            let fma = IEEE_754.Arithmetic.fusedMultiplyAdd(a: a, b: b, c: c, rounding: direction)
+            let reference = (0..<count).map {
+                IEEE_754.Arithmetic.fusedMultiplyAdd(a: a[$0], b: b[$0], c: c[$0], rounding: direction)
+            }
+            #expect(same(fma, reference))
+        }
+    }
+
+    @Test func `batch float results match scalar`() {
+        let a = Self.operands(64, seed: 4).map { Float($0) }
+        let b = Self.operands(64, seed: 5).map { Float($0) }
+        let up = IEEE_754.Arithmetic.multiplication(a, b, rounding: .towardInfinity(.positive))
+        let reference = zip(a, b).map {
+            IEEE_754.Arithmetic.multiplication($0, $1, rounding: .towardInfinity(.positive))
+        }
+        #expect(up.map(\.bitPattern) == reference.map(\.bitPattern))
+    }
+}
+
+// MARK: - Compensated Reductions
+
+@Suite("IEEE_754.Arithmetic - Compensated reductions")
+struct CompensatedReductionTests {
+    static let algorithms: [IEEE_754.Arithmetic.Summation] = [.kahan, .neumaier, .pairwise]
+
+    static func values(_ count: Int, seed: UInt64) -> [Double] {
+        var state = seed
+        return (0..<count).map { _ in
+            state = state &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+            return Double(bitPattern: (state & 0x800F_FFFF_FFFF_FFFF) | (0x3C0 + (state >> 20) % 128) << 52)
+        }
+    }
+
+    /// At most one ulp from the correctly rounded binary128 reference
+    static func faithful(_ value: Double, _ reference: IEEE_754.Binary128) -> Bool {
+        let rounded = Double(reference)
+        return value == rounded || value == rounded.nextUp || value == rounded.nextDown
+    }
+
+    @Test func `neumaier recovers cancelled terms`() {
+        #expect(IEEE_754.Arithmetic.sum([1e100, 1.0, -1e100]) == 1)
+        let pattern = (0..<10_000).flatMap { _ in [1e16, 1.0, -1e16] }
+        #expect(IEEE_754.Arithmetic.sum(pattern) == 10_000)
+        #expect(pattern.reduce(0, +) != 10_000)
+    }
+
+    @Test func `sums are faithful to the binary128 reference`() {
+        let values = Self.values(50_000, seed: 21)
+        let reference = IEEE_754.Binary128.sum(values)
+        #expect(Self.faithful(IEEE_754.Arithmetic.sum(values), reference))
+        #expect(Self.faithful(IEEE_754.Arithmetic.sum(values[...], using: .neumaier), reference))
+
+        let bound = 32 * Double.ulpOfOne * values.reduce(0) { $0 + $1.magnitude }
+        for algorithm in Self.algorithms {
+            #expect((IEEE_754.Arithmetic.sum(values, using: algorithm) - Double(reference)).magnitude <= bound)
+        }
+    }
+
+    @Test func `dot splits products exactly`() {
+        #expect(IEEE_754.Arithmetic.dot([1e8 + 1, -1e16], [1e8 - 1, 1]) == -1)
+        let x = (0..<1_000).flatMap { _ in [1e8 + 1, -1e16] }
+        let y = (0..<1_000).flatMap { _ in [1e8 - 1, 1.0] }
+        #expect(IEEE_754.Arithmetic.dot(x, y) == -1_000)
+
+        let a = Self.values(30_000, seed: 22)
+        let b = Self.values(30_000, seed: 23)
+        #expect(Self.faithful(IEEE_754.Arithmetic.dot(a, b), IEEE_754.Binary128.dot(a, b)))
+    }
+
+    @Test func `float reductions`() {
+        let values = Self.values(20_000, seed: 24).map { Float($0) }
+        let reference = Float(values.reduce(0.0) { $0 + Double($1) })
+        let sum = IEEE_754.Arithmetic.sum(values)
+        #expect(sum == reference || sum == reference.nextUp || sum == reference.nextDown)
+        #expect(IEEE_754.Arithmetic.dot([Float(4097), -16_785_408], [Float(4097), 1]) == 1)
+    }
+
+    @Test func `special values follow ordinary addition`() {
+        #expect(IEEE_754.Arithmetic.sum([Double]()) == 0)
+        #expect(IEEE_754.Arithmetic.dot([Double](), []) == 0)
+        for algorithm in Self.algorithms {
+            let long = Self.values(10_000, seed: 25)
+            #expect(IEEE_754.Arithmetic.sum(long + [.infinity], using: algorithm) == .infinity)
+            #expect(IEEE_754.Arithmetic.sum([.infinity] + long, using: algorithm) == .infinity)
+            #expect(IEEE_754.Arithmetic.sum([.infinity] + long + [-.infinity], using: algorithm).isNaN)
+            #expect(IEEE_754.Arithmetic.sum(long + [.nan], using: algorithm).isNaN)
+            let huge = [Double](repeating: .greatestFiniteMagnitude, count: 20)
+            #expect(IEEE_754.Arithmetic.sum(huge, using: algorithm) == .infinity)
+        }
+        #expect(IEEE_754.Arithmetic.dot([1e300, 1], [1e300, 1]) == .infinity)
+    }
+
+    @Test func `concurrent results are bit-identical to sequential`() async {
+        let values = Self.values(300_000, seed: 26)
+        let other = Self.values(300_000, seed: 27)
+        for algorithm in Self.algorithms {
+            let sequential = IEEE_754.Arithmetic.sum(values[...], using: algorithm)
+            let concurrent = await IEEE_754.Arithmetic.sum(values, using: algorithm)
+            #expect(concurrent.bitPattern == sequential.bitPattern)
+        }
+        let sequential = IEEE_754.Arithmetic.dot(values[...], other[...])
+        let concurrent = await IEEE_754.Arithmetic.dot(values, other)
+        #expect(concurrent.bitPattern == sequential.bitPattern)
+
+        let floats = values.map { Float($0) }
+        let floatSum = await IEEE_754.Arithmetic.sum(floats)
+        #expect(floatSum.bitPattern == IEEE_754.Arithmetic.sum(floats[...]).bitPattern)
+    }
+}
+
+// MARK: - Reproducible Reductions
+
+@Suite("IEEE_754.Arithmetic - Reproducible reductions", .serialized)
+struct ReproducibleReductionTests {
+    typealias BinnedSum = IEEE_754.Arithmetic.BinnedSum
+
+    /// Values spanning the whole finite range, with cancelling pairs
+    static func spread(_ count: Int, seed: UInt64) -> [Double] {
+        var state = seed
+        return (0..<count).map { index in
+            state = state &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+            let value = Double(bitPattern: state >> 1)
+            guard value.isFinite else { return Double(index) }
+            return index % 7 == 0 ? -value : value
+        }
+    }
+
+    static func shuffled(_ values: [Double], seed: UInt64) -> [Double] {
+        var values = values
+        var state = seed
+        for index in values.indices.reversed() where index > 0 {
+            state = state &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+            values.swapAt(index, Int((state >> 33) % UInt64(index + 1)))
+        }
+        return values
+    }
+
+    @Test func `order does not change the bits`() {
+        for values in [CompensatedReductionTests.values(30_000, seed: 31), Self.spread(30_000, seed: 32)] {
+            let sum = IEEE_754.Arithmetic.reproducibleSum(values)
+            let reversed = IEEE_754.Arithmetic.reproducibleSum(values.reversed())
+            let shuffled = IEEE_754.Arithmetic.reproducibleSum(Self.shuffled(values, seed: 33))
+            #expect(reversed.bitPattern == sum.bitPattern)
+            #expect(shuffled.bitPattern == sum.bitPattern)
+        }
+    }
+
+    @Test(arguments: [1, 7, 1_000, 4_097])
+    func `chunking does not change the bits`(chunk: Int) {
+        let values = Self.spread(20_000, seed: 34)
+        let expected = IEEE_754.Arithmetic.reproducibleSum(values)
+
+        var forward = BinnedSum()
+        var partials: [BinnedSum] = []
+        for start in stride(from: 0, to: values.count, by: chunk) {
+            let piece = values[start..<min(start + chunk, values.count)]
+            forward.add(contentsOf: piece)
+            var partial = BinnedSum()
+            partial.add(contentsOf: piece)
+            partials.append(partial)
+        }
+        let backward = partials.reversed().reduce(BinnedSum()) { $0.merging($1) }
+        #expect(forward.value.bitPattern == expected.bitPattern)
+        #expect(backward.value.bitPattern == expected.bitPattern)
+
+        var single = BinnedSum()
+        for value in values.prefix(chunk) {
+            single.add(value)
+        }
+        #expect(single.value.bitPattern == IEEE_754.Arithmetic.reproducibleSum(values.prefix(chunk)).bitPattern)
+    }
+
+    @Test func `sums are faithful to the binary128 reference`() {
+        let values = CompensatedReductionTests.values(50_000, seed: 35)
+        let reference = IEEE_754.Binary128.sum(values)
+        #expect(CompensatedReductionTests.faithful(IEEE_754.Arithmetic.reproducibleSum(values), reference))
+        #expect(IEEE_754.Arithmetic.reproducibleSum([1e16, 1.0, -1e16, 0.5]) == 1.5)
+        let least = Double.leastNonzeroMagnitude
+        #expect(IEEE_754.Arithmetic.reproducibleSum([least, 3 * least]) == 4 * least)
+        let greatest = Double.greatestFiniteMagnitude
+        #expect(IEEE_754.Arithmetic.reproducibleSum([greatest, greatest, -greatest]) == greatest)
+        #expect(IEEE_754.Arithmetic.reproducibleSum([Double]()) == 0)
+    }
+
+    @Test func `dot and norm`() {
+        #expect(IEEE_754.Arithmetic.reproducibleDot([1e8 + 1, -1e16], [1e8 - 1, 1]) == -1)
+        let a = CompensatedReductionTests.values(30_000, seed: 36)
+        let b = CompensatedReductionTests.values(30_000, seed: 37)
+        let dot = IEEE_754.Arithmetic.reproducibleDot(a, b)
+        #expect(CompensatedReductionTests.faithful(dot, IEEE_754.Binary128.dot(a, b)))
+        #expect(IEEE_754.Arithmetic.reproducibleDot(Self.shuffled(a, seed: 38), Self.shuffled(b, seed: 38)) == dot)
+
+        #expect(IEEE_754.Arithmetic.reproducibleNorm([3.0, 4.0]) == 5)
+        #expect(IEEE_754.Arithmetic.reproducibleNorm([3 * 0x1p600, -4 * 0x1p600]) == 5 * 0x1p600)
+        let least = Double.leastNonzeroMagnitude
+        #expect(IEEE_754.Arithmetic.reproducibleNorm([3 * least, 4 * least]) == 5 * least)
+        #expect(IEEE_754.Arithmetic.reproducibleNorm([Double]()) == 0)
+        #expect(IEEE_754.Arithmetic.reproducibleNorm([.nan, -.infinity]) == .infinity)
+        #expect(IEEE_754.Arithmetic.reproducibleNorm(a) == IEEE_754.Arithmetic.reproducibleNorm(a.reversed()))
+    }
+
+    @Test func `float reductions`() {
+        let values = CompensatedReductionTests.values(20_000, seed: 39).map { Float($0) }
+        let reference = Float(Double(IEEE_754.Binary128.sum(values.map { Double($0) })))
+        let sum = IEEE_754.Arithmetic.reproducibleSum(values)
+        #expect(sum == reference || sum == reference.nextUp || sum == reference.nextDown)
+        #expect(IEEE_754.Arithmetic.reproducibleSum(values.reversed()).bitPattern == sum.bitPattern)
+        #expect(IEEE_754.Arithmetic.reproducibleDot([Float(4097), -16_785_408], [Float(4097), 1]) == 1)
+        #expect(IEEE_754.Arithmetic.reproducibleNorm([3 * Float(0x1p90), 4 * 0x1p90]) == 5 * 0x1p90)
+    }
+
+    @Test func `special values and exceptions`() {
+        let long = CompensatedReductionTests.values(10_000, seed: 40)
+        IEEE_754.Exceptions.clearAll()
+        #expect(IEEE_754.Arithmetic.reproducibleSum([1.0, 2, 3, -0.5]) == 5.5)
+        #expect(IEEE_754.Exceptions.raised().isEmpty)
+
+        #expect(IEEE_754.Arithmetic.reproducibleSum([0.1, 0.2]) == 0.30000000000000004)
+        #expect(IEEE_754.Exceptions.raised() == [.inexact])
+        IEEE_754.Exceptions.clearAll()
+
+        #expect(IEEE_754.Arithmetic.reproducibleSum(long + [.infinity]) == .infinity)
+        #expect(IEEE_754.Arithmetic.reproducibleSum([.infinity] + long + [-.infinity]).isNaN)
+        #expect(IEEE_754.Exceptions.raised().contains(.invalid))
+        IEEE_754.Exceptions.clearAll()
+
+        #expect(IEEE_754.Arithmetic.reproducibleSum(long + [.nan]).isNaN)
+        #expect(!IEEE_754.Exceptions.raised().contains(.invalid))
+        #expect(IEEE_754.Arithmetic.reproducibleSum([1, .signalingNaN]).isNaN)
+        #expect(IEEE_754.Exceptions.raised().contains(.invalid))
+        IEEE_754.Exceptions.clearAll()
+
+        let huge = [Double](repeating: .greatestFiniteMagnitude, count: 20)
+        #expect(IEEE_754.Arithmetic.reproducibleSum(huge) == .infinity)
+        #expect(IEEE_754.Exceptions.raised().contains(.overflow))
+        IEEE_754.Exceptions.clearAll()
+
+        #expect(IEEE_754.Arithmetic.reproducibleDot([0, 1], [.infinity, 1]).isNaN)
+        #expect(IEEE_754.Exceptions.raised().contains(.invalid))
+        IEEE_754.Exceptions.clearAll()
+        let norm = IEEE_754.Arithmetic.reproducibleNorm([Float.greatestFiniteMagnitude, .greatestFiniteMagnitude])
+        #expect(norm == .infinity)
+        #expect(IEEE_754.Exceptions.raised().contains(.overflow))
+        IEEE_754.Exceptions.clearAll()
+    }
+
+    @Test func `concurrent results are bit-identical to sequential`() async {
+        let values = Self.spread(300_000, seed: 41)
+        let other = CompensatedReductionTests.values(300_000, seed: 42)
+        let concurrentSum = await IEEE_754.Arithmetic.reproducibleSum(values)
+        #expect(concurrentSum.bitPattern == IEEE_754.Arithmetic.reproducibleSum(values[...]).bitPattern)
+        let concurrentDot = await IEEE_754.Arithmetic.reproducibleDot(values, other)
+        #expect(concurrentDot.bitPattern == IEEE_754.Arithmetic.reproducibleDot(values[...], other[...]).bitPattern)
+        let concurrentNorm = await IEEE_754.Arithmetic.reproducibleNorm(other)
+        #expect(concurrentNorm.bitPattern == IEEE_754.Arithmetic.reproducibleNorm(other[...]).bitPattern)
+
+        let floats = other.map { Float($0) }
+        let floatSum = await IEEE_754.Arithmetic.reproducibleSum(floats)
+        #expect(floatSum.bitPattern == IEEE_754.Arithmetic.reproducibleSum(floats[...]).bitPattern)
+    }
+}
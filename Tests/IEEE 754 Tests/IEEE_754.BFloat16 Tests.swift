@@ -0,0 +1,109 @@
+// IEEE_754.BFloat16 Tests.swift
+// swift-ieee-754
+//
+// Tests for the bfloat16 storage format
+
+import Testing
+
+@testable import IEEE_754
+
+private typealias BF16 = IEEE_754.BFloat16
+
+@Suite("IEEE_754.BFloat16 - Format")
+struct BFloat16FormatTests {
+    @Test func `layout matches binary32 upper half`() {
+        #expect(BF16.bitSize == 16)
+        #expect(BF16.exponentBias == 127)
+        #expect(BF16.precision == 8)
+        #expect(BF16.value(bitPattern: 0x3F80) == 1)
+        #expect(BF16.value(bitPattern: 0x7F7F) == BF16.maxNormal)
+        #expect(BF16.value(bitPattern: 0x0001) == BF16.minSubnormal)
+        #expect(BF16.numberClass(0xFF80) == .negative(.infinity))
+    }
+
+    @Test func `narrowing rounds to nearest even`() {
+        #expect(BF16.bitPattern(from: 1) == 0x3F80)
+        // 1 + 2⁻⁸ is halfway between 1 and 1 + 2⁻⁷: ties to the even 1
+        #expect(BF16.bitPattern(from: 1 + 0x1p-8) == 0x3F80)
+        #expect(BF16.bitPattern(from: 1 + 3 * 0x1p-8) == 0x3F82)
+        #expect(BF16.bitPattern(from: 1 + 0x1p-8 + 0x1p-20) == 0x3F81)
+        #expect(BF16.bitPattern(from: -0.0) == 0x8000)
+    }
+
+    @Test func `overflow and saturation`() {
+        #expect(BF16.bitPattern(from: .greatestFiniteMagnitude) == 0x7F80)
+        #expect(BF16.bitPattern(from: .greatestFiniteMagnitude, saturating: true) == 0x7F7F)
+        #expect(BF16.bitPattern(from: -.infinity, saturating: true) == 0xFF7F)
+        #expect(BF16.bitPattern(from: -.infinity) == 0xFF80)
+    }
+
+    @Test func `NaNs are quieted with their payload`() {
+        let signaling = Float(bitPattern: 0x7FA0_0000)
+        #expect(BF16.bitPattern(from: signaling) == 0x7FE0)
+        #expect(BF16.value(bitPattern: 0x7FA0).bitPattern == 0x7FA0_0000)
+    }
+
+    @Test func `all encodings round trip`() {
+        for bits in UInt16.min...UInt16.max where !BF16.isNaN(bits) {
+            #expect(BF16.bitPattern(from: BF16.value(bitPattern: bits)) == bits)
+        }
+    }
+}
+
+#if canImport(CIEEE754)
+    @Suite("IEEE_754.BFloat16 - Bulk Conversion", .serialized)
+    struct BFloat16BulkTests {
+        @Test func `bulk narrowing matches scalar and counts exceptions`() {
+            let specials: [Float] = [.greatestFiniteMagnitude, .leastNonzeroMagnitude, -.infinity, .nan]
+            let values: [Float] = [1, 1 + 0x1p-8, 3.14159] + specials + (0..<100).map { Float($0) * 0.37 }
+            var narrowed = [UInt16](repeating: 0, count: values.count)
+            let summary = values.withUnsafeBufferPointer { source in
+                narrowed.withUnsafeMutableBufferPointer { BF16.narrow(source, into: $0) }
+            }
+
+            #expect(narrowed == values.map { BF16.bitPattern(from: $0) })
+            #expect(summary.overflow == 1)
+            #expect(summary.underflow == 1)
+            #expect(summary.invalid == 0)
+            #expect(summary.inexact > 3)
+            IEEE_754.Exceptions.clearAll()
+        }
+
+        @Test func `saturating narrowing counts saturated infinities`() {
+            let values: [Float] = [.infinity, .greatestFiniteMagnitude, 2]
+            var narrowed = [UInt16](repeating: 0, count: values.count)
+            let summary = values.withUnsafeBufferPointer { source in
+                narrowed.withUnsafeMutableBufferPointer { BF16.narrow(source, into: $0, saturating: true) }
+            }
+            #expect(narrowed == [0x7F7F, 0x7F7F, 0x4000])
+            #expect(summary.overflow == 2)
+            IEEE_754.Exceptions.clearAll()
+        }
+
+        @Test(arguments: [Binary.Endianness.little, .big])
+        func `stored bytes round trip`(endianness: Binary.Endianness) {
+            let values = (0..<1000).map { Float($0) - 500 }
+            let bytes = values.withUnsafeBufferPointer { BF16.bytes(from: $0, endianness: endianness) }
+            #expect(bytes.count == 2000)
+
+            let decoded = bytes.withUnsafeBytes { BF16.values(from: $0, endianness: endianness) }
+            #expect(decoded == values.map { BF16.value(bitPattern: BF16.bitPattern(from: $0)) })
+        }
+
+        @Test func `decoding reads unaligned little-endian bytes`() {
+            let bytes: [UInt8] = [0xFF, 0x80, 0x3F, 0x00, 0xC0]
+            let decoded = bytes.withUnsafeBytes { BF16.values(from: UnsafeRawBufferPointer(rebasing: $0[1...])) }
+            #expect(decoded == [1, -2])
+            #expect(bytes.withUnsafeBytes { BF16.values(from: UnsafeRawBufferPointer(rebasing: $0[0..<3])) } == nil)
+        }
+
+        @Test func `bulk widening is exact`() {
+            let encodings: [UInt16] = Array(0x3F80...0x3FFF)
+            var widened = [Float](repeating: 0, count: encodings.count)
+            encodings.withUnsafeBufferPointer { source in
+                widened.withUnsafeMutableBufferPointer { BF16.widen(source, into: $0) }
+            }
+            #expect(widened == encodings.map { BF16.value(bitPattern: $0) })
+        }
+    }
+#endif
@@ -0,0 +1,243 @@
+// IEEE_754.Binary128 Tests.swift
+// swift-ieee-754
+//
+// Tests for the IEEE 754 Binary128 storage type and its arithmetic
+
+import Testing
+
+@testable import IEEE_754
+
+private typealias Quad = IEEE_754.Binary128
+
+@Suite("IEEE_754.Binary128 - Encoding")
+struct Binary128EncodingTests {
+    @Test func `format constants are unchanged`() {
+        #expect(Quad.byteSize == 16)
+        #expect(Quad.precision == 113)
+        #expect(Quad.exponentBias == 16383)
+        #expect(MemoryLayout<Quad>.size == 16)
+    }
+
+    @Test func `halves compose the bit pattern`() {
+        let value = Quad(high: 0x3FFF_0000_0000_0000, low: 1)
+        #expect(value.bitPattern == 0x3FFF_0000_0000_0000_0000_0000_0000_0001)
+        #expect(Quad(bitPattern: value.bitPattern).high == value.high)
+        #expect(value.exponentBitPattern == 0x3FFF)
+        #expect(value.significandBitPattern == 1)
+    }
+
+    @Test func `classification`() {
+        #expect(Quad.nan.isNaN && !Quad.nan.isSignalingNaN)
+        #expect(Quad.signalingNaN.isSignalingNaN)
+        #expect(Quad.infinity.isInfinite && !Quad.infinity.isFinite)
+        #expect(Quad.zero.isZero && (-Quad.zero).sign == .minus)
+        #expect(Quad.leastNonzeroMagnitude.isSubnormal)
+        #expect(Quad.leastNormalMagnitude.isNormal && Quad.one.isNormal)
+        #expect((-Quad.one).magnitude == Quad.one)
+    }
+}
+
+@Suite("IEEE_754.Binary128 - Conversions")
+struct Binary128ConversionTests {
+    @Test(arguments: [0.1, -2.5, 1e300, -1e-300, 5e-324, .greatestFiniteMagnitude, -0.0, .infinity])
+    func `double round trip is exact`(value: Double) {
+        let quad = Quad(value)
+        #expect(Double(quad).bitPattern == value.bitPattern)
+    }
+
+    @Test func `double NaN payloads survive widening`() {
+        let payload = Double(nan: 0x1234, signaling: false)
+        #expect(Double(Quad(payload)).bitPattern == payload.bitPattern)
+        #expect(Double(Quad(Double.signalingNaN)).isNaN)
+        #expect(!Double(Quad(Double.signalingNaN)).isSignalingNaN)
+    }
+
+    @Test func `integers convert exactly`() {
+        #expect(Quad(Int.max) - Quad(Int.max - 1) == 1)
+        #expect(Quad(Int.min).sign == .minus)
+        #expect(Double(Quad(-42)) == -42)
+        #expect(Quad(0) == .zero)
+    }
+
+    @Test func `narrowing rounds to nearest even`() {
+        let one = Quad.one
+        #expect(Double(one + Quad(0x1p-53)) == 1.0)
+        #expect(Double(one + Quad(0x1p-53) + Quad(0x1p-100)) == 1.0.nextUp)
+        #expect(Double(Quad(Double.leastNonzeroMagnitude) * Quad(0.5)) == 0)
+        #expect(Double(Quad(Double.leastNonzeroMagnitude) * Quad(0.75)) == .leastNonzeroMagnitude)
+        #expect(Double(Quad.greatestFiniteMagnitude) == .infinity)
+        #expect(Double(Quad.leastNonzeroMagnitude) == 0)
+    }
+}
+
+@Suite("IEEE_754.Binary128 - Arithmetic")
+struct Binary128ArithmeticTests {
+    @Test func `sums keep what Double loses`() {
+        #expect(Quad(1e16) + Quad(1) - Quad(1e16) == 1)
+        #expect(Double(Quad(0.1) + Quad(0.2)) == 0.1 + 0.2)
+    }
+
+    @Test func `correctly rounded quotient and root`() {
+        #expect((Quad.one / Quad(3)).bitPattern == 0x3FFD_5555_5555_5555_5555_5555_5555_5555)
+        #expect(Quad(2).squareRoot().bitPattern == 0x3FFF_6A09_E667_F3BC_C908_B2FB_1366_EA95)
+        #expect(Quad(4).squareRoot() == 2)
+        #expect(Quad(-1).squareRoot().isNaN)
+        #expect((-Quad.zero).squareRoot().sign == .minus)
+    }
+
+    @Test func `ties round to even`() {
+        let half = Quad.ulpOfOne / 2
+        #expect(Quad.one + half == .one)
+        #expect((Quad.one + Quad.ulpOfOne + half).bitPattern == Quad.one.bitPattern + 2)
+    }
+
+    @Test func `subnormal results`() {
+        #expect((Quad.leastNormalMagnitude * Quad(0.5)).bitPattern == 1 << 111)
+        #expect(Quad.leastNonzeroMagnitude * Quad(0.5) == .zero)
+        #expect((Quad.leastNonzeroMagnitude * Quad(1.5)).bitPattern == 2)
+        #expect(Quad.leastNormalMagnitude - Quad.leastNormalMagnitude.nextDown == .leastNonzeroMagnitude)
+    }
+
+    @Test func `special values`() {
+        #expect((Quad.infinity - .infinity).isNaN)
+        #expect((Quad.zero / .zero).isNaN)
+        #expect(Quad.one / .zero == .infinity)
+        #expect(Quad.greatestFiniteMagnitude * Quad(2) == .infinity)
+        #expect((-Quad.zero + -Quad.zero).sign == .minus)
+        #expect((Quad.one - .one).sign == .plus)
+        #expect((Quad.nan + .one).isNaN)
+    }
+
+    @Test func `fused multiply-add rounds once`() {
+        let above = Quad.one + .ulpOfOne
+        let below = Quad.one - .ulpOfOne
+        let fused = (-Quad.one).addingProduct(above, below)
+        #expect(fused == -(Quad.ulpOfOne * .ulpOfOne))
+        #expect(above * below - .one == .zero)
+        #expect(IEEE_754.Arithmetic.fusedMultiplyAdd(a: Quad(2), b: Quad(3), c: .one) == 7)
+    }
+
+    @Test func `comparison`() {
+        #expect(Quad.nan != .nan)
+        #expect(-Quad.zero == .zero)
+        #expect(Quad(-2) < Quad(-1) && Quad(-1) < .zero && Quad.zero < .leastNonzeroMagnitude)
+        #expect(!(Quad.nan <= .one) && !(Quad.nan >= .one))
+        #expect(Quad.one <= .one && Quad(2) > .one)
+    }
+}
+
+extension IEEE_754.Binary128 {
+    fileprivate var nextDown: Self {
+        isZero ? -.leastNonzeroMagnitude : Quad(bitPattern: sign == .plus ? bitPattern - 1 : bitPattern + 1)
+    }
+}
+
+@Suite("IEEE_754.Binary128 - Batch")
+struct Binary128BatchTests {
+    static func doubles(_ count: Int, seed: UInt64) -> [Double] {
+        var state = seed
+        return (0..<count).map { _ in
+            state = state &* 6_364_136_223_846_793_005 &+ 1_442_695_040_888_963_407
+            return Double(bitPattern: (state & 0x800F_FFFF_FFFF_FFFF) | (0x3C0 + (state >> 20) % 128) << 52)
+        }
+    }
+
+    @Test func `sum matches sequential addition`() {
+        let values = Self.doubles(1_000, seed: 7)
+        let expected = values.reduce(Quad.zero) { $0 + Quad($1) }
+        #expect(Quad.sum(values).bitPattern == expected.bitPattern)
+        #expect(Quad.sum(values.map(Quad.init)).bitPattern == expected.bitPattern)
+        #expect(Quad.sum([1e16, 1, -1e16]) == 1)
+        #expect(Quad.sum([Double]()) == .zero)
+    }
+
+    @Test func `dot products are exact before accumulation`() {
+        let x = Self.doubles(500, seed: 8)
+        let y = Self.doubles(500, seed: 9)
+        let expected = zip(x, y).reduce(Quad.zero) { $0 + Quad($1.0) * Quad($1.1) }
+        #expect(Quad.dot(x, y).bitPattern == expected.bitPattern)
+        #expect(Quad.dot([1e8 + 1, -1e16], [1e8 - 1, 1]) == -1)
+    }
+
+    @Test func `element-wise operations match scalar`() {
+        let a = Self.doubles(37, seed: 10).map(Quad.init)
+        let b = Self.doubles(37, seed: 11).map(Quad.init)
+        var sums = [Quad](repeating: .zero, count: a.count)
+        var products = sums
+        a.withUnsafeBufferPointer { a in
+            b.withUnsafeBufferPointer { b in
+                sums.withUnsafeMutableBufferPointer { Quad.addition(a, b, into: $0) }
+                products.withUnsafeMutableBufferPointer { Quad.multiplication(a, b, into: $0) }
+            }
+        }
+        #expect(sums.map(\.bitPattern) == zip(a, b).map { ($0 + $1).bitPattern })
+        #expect(products.map(\.bitPattern) == zip(a, b).map { ($0 * $1).bitPattern })
+    }
+}
+
+#if canImport(CIEEE754)
+    @Suite("IEEE_754.Binary128 - Native and software agree")
+    struct Binary128NativeTests {
+        static func operands(_ count: Int) -> [UInt128] {
+            var state: UInt64 = 0x2545_F491_4F6C_DD1D
+            func next() -> UInt64 {
+                state ^= state << 13
+                state ^= state >> 7
+                state ^= state << 17
+                return state
+            }
+            return (0..<count).map { _ in
+                var bits = UInt128(next()) << 64 | UInt128(next())
+                let exponent: UInt128 =
+                    switch next() % 4 {
+                    case 0: 0
+                    case 1: UInt128(next() % 0x7FFF)
+                    default: UInt128(16383 - 100 + next() % 200)
+                    }
+                bits = bits & ~(0x7FFF << 112) | exponent << 112
+                return bits
+            }
+        }
+
+        @Test func `arithmetic is bit-identical`() {
+            guard Quad.isNative else { return }
+            let x = Self.operands(20_000)
+            for (a, b) in zip(x, x.dropFirst()) {
+                let (qa, qb) = (Quad(bitPattern: a), Quad(bitPattern: b))
+                #expect((qa + qb).bitPattern == Quad.Software.add(a, b))
+                #expect((qa - qb).bitPattern == Quad.Software.subtract(a, b))
+                #expect((qa * qb).bitPattern == Quad.Software.multiply(a, b))
+                #expect((qa / qb).bitPattern == Quad.Software.divide(a, b))
+            }
+        }
+
+        @Test(arguments: [IEEE_754.RoundingControl.Mode.upward, .downward, .towardZero])
+        func `directed rounding modes do not change results`(mode: IEEE_754.RoundingControl.Mode) {
+            let x = Self.operands(2_000)
+            let pairs = Array(zip(x, x.dropFirst()))
+            let (sums, quotients, sum, dot) = IEEE_754.RoundingControl.withMode(mode) {
+                (
+                    pairs.map { (Quad(bitPattern: $0) + Quad(bitPattern: $1)).bitPattern },
+                    pairs.map { (Quad(bitPattern: $0) / Quad(bitPattern: $1)).bitPattern },
+                    Quad.sum([1, 0x1p-200, 0x1p-200]),
+                    Quad.dot([1, 1], [1, 0x1p-200])
+                )
+            }
+            #expect(sums == pairs.map { Quad.Software.add($0, $1) })
+            #expect(quotients == pairs.map { Quad.Software.divide($0, $1) })
+            #expect(sum == 1)
+            #expect(dot == 1)
+        }
+
+        @Test func `arithmetic leaves hardware flags alone`() {
+            IEEE_754.Exceptions.clearFPU()
+            let third = Quad(1) / Quad(3)
+            let sum = Quad.sum([1, 0x1p-200])
+            let state = IEEE_754.Exceptions.testFPU()
+            #expect(!state.inexact && !state.underflow && !state.overflow && !state.invalid)
+            #expect(third.bitPattern == Quad.Software.divide(Quad(1).bitPattern, Quad(3).bitPattern))
+            #expect(sum == 1)
+            IEEE_754.Exceptions.clearFPU()
+        }
+    }
+#endif
@@ -0,0 +1,204 @@
+// IEEE_754.Binary16 Tests.swift
+// swift-ieee-754
+//
+// Tests for IEEE 754 Binary16 operations on Float16
+
+import Testing
+
+@testable import IEEE_754
+
+#if !((os(macOS) || targetEnvironment(macCatalyst)) && arch(x86_64))
+    @Suite("IEEE_754.Binary16 - Batch serialization")
+    struct Binary16BatchSerializationTests {
+        // Long enough to exercise the SIMD body and the scalar tail
+        static let values: [Float16] = (0..<37).map { Float16($0) * 1.5 - 20 } + [.infinity, -.nan, -0.0]
+
+        @Test(arguments: [Binary.Endianness.little, .big])
+        func `batch bytes match per-value bytes`(endianness: Binary.Endianness) {
+            let batch = IEEE_754.Binary16.bytes(from: Self.values, endianness: endianness)
+            let perValue = Self.values.flatMap { [UInt8]($0.bitPattern, endianness: endianness) }
+            #expect(batch == perValue)
+        }
+
+        @Test(arguments: [Binary.Endianness.little, .big])
+        func `batch round-trip preserves bit patterns`(endianness: Binary.Endianness) {
+            let bytes = IEEE_754.Binary16.bytes(from: Self.values, endianness: endianness)
+            let restored = IEEE_754.Binary16.values(from: bytes, endianness: endianness)
+            #expect(restored?.map(\.bitPattern) == Self.values.map(\.bitPattern))
+        }
+
+        @Test func `batch values rejects partial element`() {
+            let bytes = [UInt8](repeating: 0, count: 2 * 3 + 1)
+            #expect(IEEE_754.Binary16.values(from: bytes) == nil)
+        }
+
+        @Test func `empty batch`() {
+            #expect(IEEE_754.Binary16.bytes(from: [Float16]()).isEmpty)
+            #expect(IEEE_754.Binary16.values(from: [UInt8]())?.isEmpty == true)
+        }
+
+        @Test func `big-endian batch is network order`() {
+            let bytes = IEEE_754.Binary16.bytes(from: [1.0, -2.0], endianness: .big)
+            #expect(bytes == [0x3C, 0x00, 0xC0, 0x00])
+        }
+    }
+
+    @Suite("IEEE_754.Binary16 - Buffer serialization")
+    struct Binary16BufferSerializationTests {
+        static let values: [Float16] = (0..<19).map { Float16($0) * -0.75 } + [.greatestFiniteMagnitude, .nan]
+
+        static func encoded(_ values: [Float16], endianness: Binary.Endianness) -> [UInt8] {
+            values.flatMap { [UInt8]($0.bitPattern, endianness: endianness) }
+        }
+
+        @Test(arguments: [Binary.Endianness.little, .big])
+        func `write stores the encoding at the offset`(endianness: Binary.Endianness) {
+            var frame = [UInt8](repeating: 0xEE, count: 2 + 3)
+            let written = frame.withUnsafeMutableBytes { buffer in
+                IEEE_754.Binary16.write(3.5, into: buffer, at: 3, endianness: endianness)
+            }
+            #expect(written == 2)
+            #expect(Array(frame[0..<3]) == [0xEE, 0xEE, 0xEE])
+            #expect(Array(frame[3...]) == Self.encoded([3.5], endianness: endianness))
+        }
+
+        @Test(arguments: [Binary.Endianness.little, .big])
+        func `append grows the array in place`(endianness: Binary.Endianness) {
+            var frame: [UInt8] = [0x01, 0x02]
+            let appended = IEEE_754.Binary16.append(-1.25, to: &frame, endianness: endianness)
+            #expect(appended == 2)
+            #expect(frame == [0x01, 0x02] + Self.encoded([-1.25], endianness: endianness))
+        }
+
+        @Test(arguments: [Binary.Endianness.little, .big])
+        func `write contentsOf matches batch bytes`(endianness: Binary.Endianness) {
+            let expected = IEEE_754.Binary16.bytes(from: Self.values, endianness: endianness)
+            var frame = [UInt8](repeating: 0, count: expected.count + 1)
+            let written = frame.withUnsafeMutableBytes { buffer in
+                IEEE_754.Binary16.write(contentsOf: Self.values, into: buffer, at: 1, endianness: endianness)
+            }
+            #expect(written == expected.count)
+            #expect(Array(frame[1...]) == expected)
+        }
+
+        @Test(arguments: [Binary.Endianness.little, .big])
+        func `write contentsOf non-contiguous sequence`(endianness: Binary.Endianness) {
+            let expected = IEEE_754.Binary16.bytes(from: Self.values, endianness: endianness)
+            var frame = [UInt8](repeating: 0, count: expected.count)
+            let written = frame.withUnsafeMutableBytes { buffer in
+                IEEE_754.Binary16.write(contentsOf: Self.values.lazy.map { $0 }, into: buffer, endianness: endianness)
+            }
+            #expect(written == expected.count)
+            #expect(frame == expected)
+        }
+
+        @Test(arguments: [Binary.Endianness.little, .big])
+        func `append contentsOf matches batch bytes`(endianness: Binary.Endianness) {
+            var frame: [UInt8] = [0xFF]
+            let appended = IEEE_754.Binary16.append(contentsOf: Self.values, to: &frame, endianness: endianness)
+            #expect(appended == Self.values.count * 2)
+            #expect(frame == [0xFF] + IEEE_754.Binary16.bytes(from: Self.values, endianness: endianness))
+
+            var lazyFrame: [UInt8] = [0xFF]
+            IEEE_754.Binary16.append(contentsOf: Self.values.lazy.map { $0 }, to: &lazyFrame, endianness: endianness)
+            #expect(lazyFrame == frame)
+        }
+
+        @Test func `empty sequence writes nothing`() {
+            var frame: [UInt8] = []
+            #expect(IEEE_754.Binary16.append(contentsOf: [Float16](), to: &frame) == 0)
+            let written = frame.withUnsafeMutableBytes { buffer in
+                IEEE_754.Binary16.write(contentsOf: [Float16](), into: buffer)
+            }
+            #expect(written == 0)
+            #expect(frame.isEmpty)
+        }
+
+        @Test func `sequential writes fill a frame`() {
+            var frame = [UInt8](repeating: 0, count: 2 * 3)
+            frame.withUnsafeMutableBytes { buffer in
+                var position = 0
+                for value: Float16 in [1, 2, 3] {
+                    position += IEEE_754.Binary16.write(value, into: buffer, at: position, endianness: .big)
+                }
+                #expect(position == buffer.count)
+            }
+            #expect(IEEE_754.Binary16.values(from: frame, endianness: .big) == [1, 2, 3])
+        }
+
+        @Test func `write at the last valid offset`() {
+            var frame = [UInt8](repeating: 0, count: 5)
+            let written = frame.withUnsafeMutableBytes { buffer in
+                IEEE_754.Binary16.write(1, into: buffer, at: 3, endianness: .big)
+                    + IEEE_754.Binary16.write(contentsOf: [Float16](), into: buffer, at: 5)
+            }
+            #expect(written == 2)
+            #expect(frame == [0, 0, 0, 0x3C, 0x00])
+        }
+
+        #if os(macOS) || os(Linux) || os(FreeBSD) || os(Windows)
+            @Test func `write past the end traps`() async {
+                await #expect(processExitsWith: .failure) {
+                    var frame = [UInt8](repeating: 0, count: 3)
+                    frame.withUnsafeMutableBytes { _ = IEEE_754.Binary16.write(1, into: $0, at: 2) }
+                }
+            }
+
+            @Test func `write at a negative offset traps`() async {
+                await #expect(processExitsWith: .failure) {
+                    var frame = [UInt8](repeating: 0, count: 4)
+                    frame.withUnsafeMutableBytes { _ = IEEE_754.Binary16.write(1, into: $0, at: -1) }
+                }
+            }
+
+            @Test func `write contentsOf past the end traps`() async {
+                await #expect(processExitsWith: .failure) {
+                    var frame = [UInt8](repeating: 0, count: 5)
+                    frame.withUnsafeMutableBytes {
+                        _ = IEEE_754.Binary16.write(contentsOf: [Float16](repeating: 1, count: 2), into: $0, at: 2)
+                    }
+                }
+            }
+        #endif
+    }
+
+    @Suite("IEEE_754.Binary16 - Sort keys")
+    struct Binary16SortKeyTests {
+        static let values: [Float16] = [
+            -.nan, -.infinity, -3.5, -.leastNonzeroMagnitude, -0.0, 0.0, .leastNormalMagnitude, 1, .infinity, .nan,
+        ]
+
+        @Test func `byte order matches totalOrder`() {
+            let keys = Self.values.map(IEEE_754.Binary16.sortKey(from:))
+            for (x, a) in zip(Self.values, keys) {
+                for (y, b) in zip(Self.values, keys) where x.bitPattern != y.bitPattern {
+                    #expect(a.lexicographicallyPrecedes(b) == x.isTotallyOrdered(belowOrEqualTo: y), "\(x) \(y)")
+                }
+            }
+        }
+
+        @Test func `every encoding round trips in order`() {
+            let values = (UInt16.min...UInt16.max).map { Float16(bitPattern: $0) }
+            let keys = IEEE_754.Binary16.sortKeys(from: values)
+            #expect(keys.count == values.count * 2)
+            #expect(IEEE_754.Binary16.values(fromSortKeys: keys)?.map(\.bitPattern) == values.map(\.bitPattern))
+
+            let ordered = values.sorted { $0.bitPattern != $1.bitPattern && $0.isTotallyOrdered(belowOrEqualTo: $1) }
+            let encoded = ordered.map(IEEE_754.Binary16.sortKey(from:))
+            #expect(zip(encoded, encoded.dropFirst()).allSatisfy { $0.lexicographicallyPrecedes($1) })
+        }
+
+        @Test func `writes into caller memory`() {
+            var buffer = [UInt8](repeating: 0xAA, count: 7)
+            let written = buffer.withUnsafeMutableBytes { raw in
+                let first = IEEE_754.Binary16.writeSortKey(1, into: raw, at: 1)
+                return first + IEEE_754.Binary16.writeSortKeys(contentsOf: [Float16(-1), 0], into: raw, at: 1 + first)
+            }
+            #expect(written == 6)
+            #expect(buffer == [0xAA, 0xBC, 0x00, 0x43, 0xFF, 0x80, 0x00])
+            #expect(IEEE_754.Binary16.value(fromSortKey: [0xBC, 0x00]) == 1)
+            #expect(IEEE_754.Binary16.value(fromSortKey: [0xBC]) == nil)
+            #expect(IEEE_754.Binary16.values(fromSortKeys: [UInt8](repeating: 0, count: 3)) == nil)
+        }
+    }
+#endif
@@ -0,0 +1,171 @@
+// IEEE_754.Binary256 Tests.swift
+// swift-ieee-754
+//
+// Tests for the IEEE 754 Binary256 storage type, conversions and serialization
+
+import Testing
+
+@testable import IEEE_754
+
+private typealias Octuple = IEEE_754.Binary256
+
+extension IEEE_754.Binary256 {
+    /// Sets bit `index` (0 = least significant) of the fraction
+    fileprivate func settingFractionBit(_ index: Int) -> Self {
+        index >= 128 ? Self(high: high | 1 << (index - 128), low: low) : Self(high: high, low: low | 1 << index)
+    }
+
+    fileprivate static func exponent(_ exponent: Int) -> Self {
+        Self(high: UInt128(exponent + exponentBias) << 108, low: 0)
+    }
+}
+
+@Suite("IEEE_754.Binary256 - Encoding")
+struct Binary256EncodingTests {
+    @Test func `format constants are unchanged`() {
+        #expect(Octuple.byteSize == 32)
+        #expect(Octuple.precision == 237)
+        #expect(Octuple.exponentBias == 262143)
+        #expect(MemoryLayout<Octuple>.size == 32)
+    }
+
+    @Test func `classification`() {
+        #expect(Octuple.nan.isNaN && !Octuple.nan.isSignalingNaN)
+        #expect(Octuple.signalingNaN.isSignalingNaN)
+        #expect(Octuple.infinity.isInfinite && !Octuple.infinity.isFinite && !Octuple.infinity.isNaN)
+        #expect(Octuple.zero.isZero && (-Octuple.zero).sign == .minus)
+        #expect(Octuple.leastNonzeroMagnitude.isSubnormal)
+        #expect(Octuple.leastNormalMagnitude.isNormal && Octuple.one.isNormal)
+        #expect((-Octuple.one).magnitude.isBitwiseEqual(to: .one))
+        #expect(Octuple.one.exponentBitPattern == 262143)
+    }
+}
+
+@Suite("IEEE_754.Binary256 - Conversions")
+struct Binary256ConversionTests {
+    @Test(arguments: [0.1, -2.5, 1e300, -1e-300, 5e-324, 2.2e-308, .greatestFiniteMagnitude, -0.0, .infinity])
+    func `double round trip is exact`(value: Double) {
+        #expect(Double(Octuple(value)).bitPattern == value.bitPattern)
+    }
+
+    @Test func `binary128 round trip is exact`() {
+        let values: [IEEE_754.Binary128] = [
+            .one / IEEE_754.Binary128(3), .leastNonzeroMagnitude, .leastNormalMagnitude,
+            .greatestFiniteMagnitude, -.ulpOfOne, .infinity,
+        ]
+        for value in values {
+            #expect(IEEE_754.Binary128(Octuple(value)).bitPattern == value.bitPattern)
+        }
+        #expect(Octuple(IEEE_754.Binary128(1e300)).isBitwiseEqual(to: Octuple(1e300)))
+        #expect(Octuple(2).isBitwiseEqual(to: .exponent(1)))
+        #expect(Octuple(Float(0.5)).isBitwiseEqual(to: Octuple(0.5)))
+    }
+
+    @Test func `NaN payloads survive`() {
+        let payload = Double(nan: 0x1234, signaling: false)
+        #expect(Double(Octuple(payload)).bitPattern == payload.bitPattern)
+        #expect(Octuple(Double.signalingNaN).isSignalingNaN)
+        #expect(Double(Octuple.signalingNaN).isNaN)
+        #expect(IEEE_754.Binary128(Octuple.signalingNaN).isNaN)
+    }
+
+    @Test func `narrowing rounds to nearest even`() {
+        // Fraction bits 183 and 123 are the halfway points of Double and binary128
+        let doubleTie = Octuple.one.settingFractionBit(183)
+        #expect(Double(doubleTie) == 1.0)
+        #expect(Double(doubleTie.settingFractionBit(0)) == 1.0.nextUp)
+        #expect(Double(doubleTie.settingFractionBit(184)) == 1.0.nextUp.nextUp)
+
+        let quadTie = Octuple.one.settingFractionBit(123)
+        #expect(IEEE_754.Binary128(quadTie) == .one)
+        #expect(IEEE_754.Binary128(quadTie.settingFractionBit(0)).bitPattern == IEEE_754.Binary128.one.bitPattern + 1)
+    }
+
+    @Test func `float narrowing does not round twice`() {
+        // 1 + 2⁻²⁴ + 2⁻⁶⁰: via Double it lands on a Float tie and rounds down
+        let value = Octuple.one.settingFractionBit(212).settingFractionBit(176)
+        #expect(Float(value) == 1.0.nextUp)
+        #expect(Float(Double(value)) == 1.0)
+    }
+
+    @Test func `narrowing overflow and underflow`() {
+        #expect(Double(Octuple.greatestFiniteMagnitude) == .infinity)
+        #expect(Double(-Octuple.greatestFiniteMagnitude) == -.infinity)
+        #expect(IEEE_754.Binary128(Octuple.greatestFiniteMagnitude).isInfinite)
+        #expect(Double(Octuple.leastNonzeroMagnitude) == 0)
+        #expect(Double(-Octuple.leastNormalMagnitude).sign == .minus)
+
+        // Half the least Double subnormal ties to zero; anything above rounds up to it
+        let half = Octuple.exponent(-1075)
+        #expect(Double(half) == 0)
+        #expect(Double(half.settingFractionBit(0)) == .leastNonzeroMagnitude)
+
+        // A tie above the largest subnormal rounds to even: the least normal
+        let belowNormal = Octuple(Double.leastNormalMagnitude.nextDown).settingFractionBit(184)
+        #expect(Double(belowNormal) == .leastNormalMagnitude)
+    }
+}
+
+@Suite("IEEE_754.Binary256 - Serialization")
+struct Binary256SerializationTests {
+    static let samples: [Octuple] = [
+        .one, -.zero, .infinity, .nan, .leastNonzeroMagnitude, .greatestFiniteMagnitude,
+        Octuple(0.1), Octuple(IEEE_754.Binary128.one / IEEE_754.Binary128(3)),
+    ]
+
+    static func same(_ lhs: [Octuple], _ rhs: [Octuple]) -> Bool {
+        lhs.count == rhs.count && zip(lhs, rhs).allSatisfy { $0.isBitwiseEqual(to: $1) }
+    }
+
+    @Test func `single value layout`() {
+        let big = Octuple.bytes(from: .one, endianness: .big)
+        #expect(big.count == 32)
+        #expect(Array(big.prefix(3)) == [0x3F, 0xFF, 0xF0])
+        #expect(big.dropFirst(3).allSatisfy { $0 == 0 })
+        #expect(Octuple.bytes(from: .one, endianness: .little) == Array(big.reversed()))
+
+        #expect(Octuple.value(from: big, endianness: .big)?.isBitwiseEqual(to: .one) == true)
+        #expect(Octuple.value(from: [UInt8](repeating: 0, count: 31)) == nil)
+    }
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `bulk round trip`(endianness: Binary.Endianness) {
+        let bytes = Octuple.bytes(from: Self.samples, endianness: endianness)
+        #expect(bytes.count == Self.samples.count * 32)
+        for (index, value) in Self.samples.enumerated() {
+            #expect(Array(bytes[index * 32..<(index + 1) * 32]) == Octuple.bytes(from: value, endianness: endianness))
+        }
+        #expect(Self.same(Octuple.values(from: bytes, endianness: endianness) ?? [], Self.samples))
+        #expect(Octuple.values(from: [UInt8](repeating: 0, count: 33)) == nil)
+    }
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `writes into caller buffers`(endianness: Binary.Endianness) {
+        var frame = [UInt8](repeating: 0xAA, count: 3 + Self.samples.count * 32)
+        let written = frame.withUnsafeMutableBytes {
+            Octuple.write(contentsOf: Self.samples, into: $0, at: 3, endianness: endianness)
+        }
+        #expect(written == Self.samples.count * 32)
+        #expect(Array(frame.prefix(3)) == [0xAA, 0xAA, 0xAA])
+        #expect(Array(frame.dropFirst(3)) == Octuple.bytes(from: Self.samples, endianness: endianness))
+
+        // Non-contiguous sequences take the per-value path
+        var lazy = [UInt8](repeating: 0, count: Self.samples.count * 32)
+        _ = lazy.withUnsafeMutableBytes {
+            Octuple.write(contentsOf: Self.samples.lazy.map { $0 }, into: $0, endianness: endianness)
+        }
+        #expect(lazy == Octuple.bytes(from: Self.samples, endianness: endianness))
+    }
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `appends to byte arrays`(endianness: Binary.Endianness) {
+        var contiguous: [UInt8] = [1, 2]
+        var sequential: [UInt8] = [1, 2]
+        #expect(Octuple.append(contentsOf: Self.samples, to: &contiguous, endianness: endianness) == 256)
+        for value in Self.samples {
+            Octuple.append(value, to: &sequential, endianness: endianness)
+        }
+        #expect(contiguous == sequential)
+        #expect(Array(contiguous.dropFirst(2)) == Octuple.bytes(from: Self.samples, endianness: endianness))
+    }
+}
@@ -148,3 +148,183 @@ struct Binary32SpecialValuesTests {
         }
     }
 }
+
+@Suite("IEEE_754.Binary32 - Batch serialization")
+struct Binary32BatchSerializationTests {
+    // Long enough to exercise the SIMD body and the scalar tail
+    static let values: [Float] = (0..<37).map { Float($0) * 1.5 - 20 } + [.infinity, -.nan, -0.0]
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `batch bytes match per-value bytes`(endianness: Binary.Endianness) {
+        let batch = IEEE_754.Binary32.bytes(from: Self.values, endianness: endianness)
+        let perValue = Self.values.flatMap { IEEE_754.Binary32.bytes(from: $0, endianness: endianness) }
+        #expect(batch == perValue)
+    }
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `batch round-trip preserves bit patterns`(endianness: Binary.Endianness) {
+        let bytes = IEEE_754.Binary32.bytes(from: Self.values, endianness: endianness)
+        let restored = IEEE_754.Binary32.values(from: bytes, endianness: endianness)
+        #expect(restored?.map(\.bitPattern) == Self.values.map(\.bitPattern))
+    }
+
+    @Test func `batch values rejects partial element`() {
+        let bytes = [UInt8](repeating: 0, count: 4 * 3 + 1)
+        #expect(IEEE_754.Binary32.values(from: bytes) == nil)
+    }
+
+    @Test func `empty batch`() {
+        #expect(IEEE_754.Binary32.bytes(from: [Float]()).isEmpty)
+        #expect(IEEE_754.Binary32.values(from: [UInt8]())?.isEmpty == true)
+    }
+
+    @Test func `big-endian batch is network order`() {
+        let bytes = IEEE_754.Binary32.bytes(from: [1.0, -2.0], endianness: .big)
+        #expect(Array(bytes[0..<4]) == [UInt8]((1.0 as Float).bitPattern, endianness: .big))
+        #expect(Array(bytes[4..<8]) == [UInt8]((-2.0 as Float).bitPattern, endianness: .big))
+    }
+}
+
+@Suite("IEEE_754.Binary32 - Buffer serialization")
+struct Binary32BufferSerializationTests {
+    static let values: [Float] = (0..<19).map { Float($0) * -0.75 } + [.greatestFiniteMagnitude, .nan]
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `write matches bytes(from:)`(endianness: Binary.Endianness) {
+        var frame = [UInt8](repeating: 0xEE, count: 4 + 3)
+        let written = frame.withUnsafeMutableBytes { buffer in
+            IEEE_754.Binary32.write(3.5, into: buffer, at: 3, endianness: endianness)
+        }
+        #expect(written == 4)
+        #expect(Array(frame[0..<3]) == [0xEE, 0xEE, 0xEE])
+        #expect(Array(frame[3...]) == IEEE_754.Binary32.bytes(from: 3.5, endianness: endianness))
+    }
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `append grows the array in place`(endianness: Binary.Endianness) {
+        var frame: [UInt8] = [0x01, 0x02]
+        let appended = IEEE_754.Binary32.append(-1.25, to: &frame, endianness: endianness)
+        #expect(appended == 4)
+        #expect(frame == [0x01, 0x02] + IEEE_754.Binary32.bytes(from: -1.25, endianness: endianness))
+    }
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `write contentsOf matches batch bytes`(endianness: Binary.Endianness) {
+        let expected = IEEE_754.Binary32.bytes(from: Self.values, endianness: endianness)
+        var frame = [UInt8](repeating: 0, count: expected.count + 1)
+        let written = frame.withUnsafeMutableBytes { buffer in
+            IEEE_754.Binary32.write(contentsOf: Self.values, into: buffer, at: 1, endianness: endianness)
+        }
+        #expect(written == expected.count)
+        #expect(Array(frame[1...]) == expected)
+    }
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `write contentsOf non-contiguous sequence`(endianness: Binary.Endianness) {
+        let expected = IEEE_754.Binary32.bytes(from: Self.values, endianness: endianness)
+        var frame = [UInt8](repeating: 0, count: expected.count)
+        let written = frame.withUnsafeMutableBytes { buffer in
+            IEEE_754.Binary32.write(contentsOf: Self.values.lazy.map { $0 }, into: buffer, endianness: endianness)
+        }
+        #expect(written == expected.count)
+        #expect(frame == expected)
+    }
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `append contentsOf matches batch bytes`(endianness: Binary.Endianness) {
+        var frame: [UInt8] = [0xFF]
+        let appended = IEEE_754.Binary32.append(contentsOf: Self.values, to: &frame, endianness: endianness)
+        #expect(appended == Self.values.count * 4)
+        #expect(frame == [0xFF] + IEEE_754.Binary32.bytes(from: Self.values, endianness: endianness))
+
+        var lazyFrame: [UInt8] = [0xFF]
+        IEEE_754.Binary32.append(contentsOf: Self.values.lazy.map { $0 }, to: &lazyFrame, endianness: endianness)
+        #expect(lazyFrame == frame)
+    }
+
+    @Test func `empty sequence writes nothing`() {
+        var frame: [UInt8] = []
+        #expect(IEEE_754.Binary32.append(contentsOf: [Float](), to: &frame) == 0)
+        let written = frame.withUnsafeMutableBytes { buffer in
+            IEEE_754.Binary32.write(contentsOf: [Float](), into: buffer)
+        }
+        #expect(written == 0)
+        #expect(frame.isEmpty)
+    }
+
+    @Test func `sequential writes fill a frame`() {
+        var frame = [UInt8](repeating: 0, count: 4 * 3)
+        frame.withUnsafeMutableBytes { buffer in
+            var position = 0
+            for value: Float in [1, 2, 3] {
+                position += IEEE_754.Binary32.write(value, into: buffer, at: position, endianness: .big)
+            }
+            #expect(position == buffer.count)
+        }
+        #expect(IEEE_754.Binary32.values(from: frame, endianness: .big) == [1, 2, 3])
+    }
+}
+
+@Suite("IEEE_754.Binary32 - Sort keys")
+struct Binary32SortKeyTests {
+    static let values: [Float] = [
+        -.nan, -.infinity, -3.5, -.leastNonzeroMagnitude, -0.0, 0.0, .leastNormalMagnitude, 1, .infinity, .nan,
+    ]
+
+    @Test func `byte order matches totalOrder`() {
+        let keys = Self.values.map(IEEE_754.Binary32.sortKey(from:))
+        for (x, a) in zip(Self.values, keys) {
+            for (y, b) in zip(Self.values, keys) where x.bitPattern != y.bitPattern {
+                #expect(a.lexicographicallyPrecedes(b) == IEEE_754.Comparison.totalOrder(x, y), "\(x) \(y)")
+            }
+        }
+    }
+
+    @Test func `bulk round trip`() {
+        let keys = IEEE_754.Binary32.sortKeys(from: Self.values)
+        #expect(keys.count == Self.values.count * 4)
+        #expect(IEEE_754.Binary32.values(fromSortKeys: keys)?.map(\.bitPattern) == Self.values.map(\.bitPattern))
+        #expect(IEEE_754.Binary32.value(fromSortKey: Array(keys.prefix(4)))?.bitPattern == (-Float.nan).bitPattern)
+        #expect(IEEE_754.Binary32.values(fromSortKeys: [UInt8](repeating: 0, count: 6)) == nil)
+    }
+}
+
+@Suite("IEEE_754.Binary32 - Parallel serialization")
+struct Binary32ParallelTests {
+    static let values: [Float] = (0..<10_007).map { Float($0) * 1.25 - 4096 } + [.nan, -.infinity, -0.0]
+    static let eager = IEEE_754.Parallelism(threshold: 0, chunkSize: 1000)
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `chunked decode matches sequential decode`(endianness: Binary.Endianness) {
+        let bytes = IEEE_754.Binary32.bytes(from: Self.values, endianness: endianness)
+        let decoded = [Float](bytes: bytes, endianness: endianness, parallel: Self.eager)
+        #expect(decoded?.map(\.bitPattern) == Self.values.map(\.bitPattern))
+
+        let staying = [Float](bytes: bytes, endianness: endianness, parallel: .disabled)
+        #expect(staying?.map(\.bitPattern) == Self.values.map(\.bitPattern))
+    }
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `chunked encode matches sequential encode`(endianness: Binary.Endianness) {
+        let expected = IEEE_754.Binary32.bytes(from: Self.values, endianness: endianness)
+        #expect(IEEE_754.Binary32.bytes(from: Self.values, endianness: endianness, parallel: Self.eager) == expected)
+
+        var frame = [UInt8](repeating: 0xAA, count: expected.count + 3)
+        let written = Self.values.withUnsafeBufferPointer { values in
+            frame.withUnsafeMutableBytes { buffer in
+                IEEE_754.Binary32.write(
+                    contentsOf: values, into: buffer, at: 3, endianness: endianness, parallel: Self.eager
+                )
+            }
+        }
+        #expect(written == expected.count)
+        #expect(Array(frame.prefix(3)) == [0xAA, 0xAA, 0xAA])
+        #expect(Array(frame.dropFirst(3)) == expected)
+    }
+
+    @Test func `rejects partial elements and accepts empty input`() {
+        #expect([Float](bytes: [UInt8](repeating: 0, count: 6), parallel: Self.eager) == nil)
+        #expect([Float](bytes: [UInt8](), parallel: Self.eager) == [])
+        #expect(IEEE_754.Binary32.bytes(from: [], parallel: Self.eager).isEmpty)
+    }
+}
@@ -0,0 +1,179 @@
+// IEEE_754.BinaryFormat Tests.swift
+// swift-ieee-754
+//
+// Tests for the generic binary interchange format core
+
+import Testing
+
+@testable import IEEE_754
+
+private let doubleSamples: [Double] = [
+    0, -0, 1, -1, 0.1, -3.5, .pi,
+    .leastNonzeroMagnitude, -.leastNonzeroMagnitude, .leastNormalMagnitude, -.leastNormalMagnitude,
+    .leastNormalMagnitude.nextDown, .greatestFiniteMagnitude, -.greatestFiniteMagnitude,
+    .infinity, -.infinity, .nan, -.nan, .signalingNaN, -.signalingNaN,
+]
+
+private let floatSamples: [Float] = doubleSamples.map { value in
+    value.isSignalingNaN ? (value.sign == .minus ? -Float.signalingNaN : .signalingNaN) : Float(value)
+}
+
+@Suite("IEEE_754.BinaryFormat - Parameters")
+struct BinaryFormatParameterTests {
+    func expectParameters<F: IEEE_754.BinaryFormat>(
+        _ format: F.Type,
+        bitSize: Int,
+        exponentBias: Int,
+        precision: Int,
+        emin: Int,
+        emax: Int
+    ) {
+        #expect(F.bitSize == bitSize)
+        #expect(F.byteSize * 8 == bitSize)
+        #expect(F.exponentBias == exponentBias)
+        #expect(F.precision == precision)
+        #expect(F.emin == emin)
+        #expect(F.emax == emax)
+        #expect(F.signMask | F.exponentMask | F.fractionMask == F.BitPattern.max)
+        #expect(F.signMask & F.exponentMask == 0 && F.exponentMask & F.fractionMask == 0)
+    }
+
+    @Test func `derived parameters match Table 3.5`() {
+        expectParameters(IEEE_754.Binary16.self, bitSize: 16, exponentBias: 15, precision: 11, emin: -14, emax: 15)
+        expectParameters(IEEE_754.Binary32.self, bitSize: 32, exponentBias: 127, precision: 24, emin: -126, emax: 127)
+        expectParameters(
+            IEEE_754.Binary64.self, bitSize: 64, exponentBias: 1023, precision: 53, emin: -1022, emax: 1023)
+        expectParameters(
+            IEEE_754.Binary128.self, bitSize: 128, exponentBias: 16383, precision: 113, emin: -16382, emax: 16383)
+    }
+
+    @Test func `generic masks match the concrete Binary128 masks`() {
+        func masks<F: IEEE_754.BinaryFormat>(_: F.Type) -> [F.BitPattern] {
+            [F.signMask, F.exponentMask, F.fractionMask, F.quietBit]
+        }
+        let quad = IEEE_754.Binary128.self
+        #expect(masks(quad) == [quad.signMask, quad.exponentMask, quad.fractionMask, quad.quietBit])
+    }
+
+    @Test func `fields assemble and split`() {
+        let bits = IEEE_754.Binary32.bitPattern(sign: .minus, exponentBitPattern: 128, significandBitPattern: 0x40_0000)
+        #expect(bits == (-3.0 as Float).bitPattern)
+        #expect(IEEE_754.Binary32.sign(bits) == .minus)
+        #expect(IEEE_754.Binary32.exponentBitPattern(bits) == 128)
+        #expect(IEEE_754.Binary32.significandBitPattern(bits) == 0x40_0000)
+        #expect(IEEE_754.Binary32.magnitude(bits) == (3.0 as Float).bitPattern)
+    }
+}
+
+@Suite("IEEE_754.BinaryFormat - Classification")
+struct BinaryFormatClassificationTests {
+    @Test(arguments: doubleSamples)
+    func `binary64 predicates agree with Double`(value: Double) {
+        let bits = value.bitPattern
+        typealias F = IEEE_754.Binary64
+        #expect(F.isNaN(bits) == value.isNaN)
+        #expect(F.isSignalingNaN(bits) == value.isSignalingNaN)
+        #expect(F.isInfinite(bits) == value.isInfinite)
+        #expect(F.isFinite(bits) == value.isFinite)
+        #expect(F.isZero(bits) == value.isZero)
+        #expect(F.isSubnormal(bits) == value.isSubnormal)
+        #expect(F.isNormal(bits) == value.isNormal)
+        #expect(F.sign(bits) == value.sign)
+        #expect(F.numberClass(bits) == IEEE_754.Classification.numberClass(value))
+    }
+
+    @Test(arguments: floatSamples)
+    func `binary32 predicates agree with Float`(value: Float) {
+        let bits = value.bitPattern
+        typealias F = IEEE_754.Binary32
+        #expect(F.isNaN(bits) == value.isNaN)
+        #expect(F.isSignalingNaN(bits) == value.isSignalingNaN)
+        #expect(F.isSubnormal(bits) == value.isSubnormal)
+        #expect(F.isNormal(bits) == value.isNormal)
+        #expect(F.numberClass(bits) == IEEE_754.Classification.numberClass(value))
+    }
+
+    @Test func `binary16 classes`() {
+        typealias F = IEEE_754.Binary16
+        #expect(F.numberClass(0x0000) == .positive(.zero))
+        #expect(F.numberClass(0x8001) == .negative(.subnormal))
+        #expect(F.numberClass(0x0400) == .positive(.normal))
+        #expect(F.numberClass(0x7BFF) == .positive(.normal))
+        #expect(F.numberClass(0xFC00) == .negative(.infinity))
+        #expect(F.numberClass(0x7C01) == .nan(.signaling))
+        #expect(F.numberClass(0x7E00) == .nan(.quiet))
+    }
+
+    @Test func `binary128 predicates agree with the storage type`() {
+        let values: [IEEE_754.Binary128] = [
+            .zero, .one, .infinity, .nan, .signalingNaN, .greatestFiniteMagnitude,
+            .leastNormalMagnitude, .leastNonzeroMagnitude,
+        ]
+        for value in values {
+            typealias F = IEEE_754.Binary128
+            #expect(F.isNaN(value.bitPattern) == value.isNaN)
+            #expect(F.isSignalingNaN(value.bitPattern) == value.isSignalingNaN)
+            #expect(F.isSubnormal(value.bitPattern) == value.isSubnormal)
+            #expect(F.isNormal(value.bitPattern) == value.isNormal)
+        }
+    }
+}
+
+@Suite("IEEE_754.BinaryFormat - Next Operations")
+struct BinaryFormatNextTests {
+    @Test(arguments: doubleSamples)
+    func `binary64 nextUp and nextDown agree with Double`(value: Double) {
+        let up = Double(bitPattern: IEEE_754.Binary64.nextUp(value.bitPattern))
+        let down = Double(bitPattern: IEEE_754.Binary64.nextDown(value.bitPattern))
+        if value.isNaN {
+            #expect(up.isNaN && !up.isSignalingNaN)
+            #expect(down.isNaN && !down.isSignalingNaN)
+        } else {
+            #expect(up.bitPattern == value.nextUp.bitPattern)
+            #expect(down.bitPattern == value.nextDown.bitPattern)
+        }
+    }
+
+    @Test(arguments: floatSamples)
+    func `binary32 nextUp agrees with Float`(value: Float) {
+        guard !value.isNaN else { return }
+        #expect(IEEE_754.Binary32.nextUp(value.bitPattern) == value.nextUp.bitPattern)
+        #expect(IEEE_754.Binary32.nextDown(value.bitPattern) == value.nextDown.bitPattern)
+    }
+
+    @Test func `binary16 steps`() {
+        typealias F = IEEE_754.Binary16
+        #expect(F.nextUp(0x3C00) == 0x3C01)
+        #expect(F.nextUp(0x8000) == 0x0001)
+        #expect(F.nextUp(0x8001) == 0x8000)
+        #expect(F.nextUp(0x7BFF) == 0x7C00)
+        #expect(F.nextUp(0x7C00) == 0x7C00)
+        #expect(F.nextUp(0xFC00) == 0xFBFF)
+        #expect(F.nextDown(0x0000) == 0x8001)
+        #expect(F.nextDown(0xFC00) == 0xFC00)
+        #expect(F.nextUp(0x7C01) == 0x7E01)
+    }
+}
+
+@Suite("IEEE_754.BinaryFormat - Byte Codecs")
+struct BinaryFormatCodecTests {
+    @Test func `bytes match the concrete codecs`() {
+        let value = 3.14159 as Double
+        #expect(IEEE_754.Binary64.bytes(bitPattern: value.bitPattern) == IEEE_754.Binary64.bytes(from: value))
+        #expect(
+            IEEE_754.Binary64.bytes(bitPattern: value.bitPattern, endianness: .big)
+                == IEEE_754.Binary64.bytes(from: value, endianness: .big)
+        )
+        #expect(IEEE_754.Binary16.bytes(bitPattern: 0x3C00, endianness: .big) == [0x3C, 0x00])
+    }
+
+    @Test func `bit patterns round trip`() {
+        let bits: UInt128 = 0x4000_9215_0000_0000_0000_0000_0000_0001
+        for endianness in [Binary.Endianness.little, .big] {
+            let bytes = IEEE_754.Binary128.bytes(bitPattern: bits, endianness: endianness)
+            #expect(bytes.count == 16)
+            #expect(IEEE_754.Binary128.bitPattern(from: bytes, endianness: endianness) == bits)
+        }
+        #expect(IEEE_754.Binary32.bitPattern(from: [1, 2, 3]) == nil)
+    }
+}
@@ -0,0 +1,80 @@
+// IEEE_754.BufferView Tests.swift
+// swift-ieee-754
+//
+// Tests for lazily decoded views over raw IEEE 754 bytes
+
+import Testing
+
+@testable import IEEE_754
+
+@Suite("IEEE_754.BufferView - Element access")
+struct BufferViewAccessTests {
+    static let doubles: [Double] = (0..<61).map { Double($0) * 0.75 - 20 } + [.nan, -.infinity, -0.0]
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `matches the copying decoder`(endianness: Binary.Endianness) {
+        let bytes = IEEE_754.Binary64.bytes(from: Self.doubles, endianness: endianness)
+        bytes.withUnsafeBytes { raw in
+            let view = IEEE_754.BufferView(raw, of: Double.self, endianness: endianness)!
+            #expect(view.count == Self.doubles.count)
+            #expect(view.map(\.bitPattern) == Self.doubles.map(\.bitPattern))
+            #expect(view.reversed().map(\.bitPattern) == Self.doubles.reversed().map(\.bitPattern))
+            #expect(view[10..<20].map(\.bitPattern) == Self.doubles[10..<20].map(\.bitPattern))
+        }
+    }
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `unaligned regions`(endianness: Binary.Endianness) {
+        let floats = Self.doubles.map { Float($0) }
+        let bytes = [0xEE] + IEEE_754.Binary32.bytes(from: floats, endianness: endianness)
+        bytes.withUnsafeBytes { raw in
+            let region = UnsafeRawBufferPointer(rebasing: raw.dropFirst())
+            let view = IEEE_754.BufferView(region, of: Float.self, endianness: endianness)!
+            #expect(view.map(\.bitPattern) == floats.map(\.bitPattern))
+            #expect(view.withContiguousStorageIfAvailable { _ in true } == nil)
+        }
+    }
+
+    @Test func `rejects partial elements`() {
+        [UInt8](repeating: 0, count: 12).withUnsafeBytes { raw in
+            #expect(IEEE_754.BufferView(raw, of: Double.self) == nil)
+            #expect(IEEE_754.BufferView(raw, of: Float.self)?.count == 3)
+            #expect(IEEE_754.BufferView(UnsafeRawBufferPointer(start: nil, count: 0), of: Double.self)?.isEmpty == true)
+        }
+    }
+
+    @Test func `reductions read host-order storage in place`() {
+        let values = (1...1000).map { Double($0) / 7 }
+        values.withUnsafeBytes { raw in
+            let host: Binary.Endianness = Binary.Endianness.little.isHostOrder ? .little : .big
+            let view = IEEE_754.BufferView(raw, of: Double.self, endianness: host)!
+            let storage = view.withContiguousStorageIfAvailable { UnsafeRawPointer($0.baseAddress) }
+            #expect(storage == raw.baseAddress)
+            #expect(IEEE_754.Arithmetic.sum(view) == IEEE_754.Arithmetic.sum(values))
+            #expect(IEEE_754.MinMax.maximum(view) == values.last)
+        }
+    }
+}
+
+@Suite("IEEE_754.BufferView - SIMD iteration")
+struct BufferViewVectorTests {
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `vectors then remainder cover every element`(endianness: Binary.Endianness) {
+        let values = (0..<29).map { Double($0) - 3.5 }
+        let bytes = [0x01, 0x02, 0x03] + IEEE_754.Binary64.bytes(from: values, endianness: endianness)
+        bytes.withUnsafeBytes { raw in
+            let region = UnsafeRawBufferPointer(rebasing: raw.dropFirst(3))
+            let view = IEEE_754.BufferView(region, of: Double.self, endianness: endianness)!
+            #expect(view.vectors.count == 3)
+            #expect(view.remainder.count == 5)
+
+            var decoded: [Double] = []
+            for lanes in view.vectors {
+                for lane in 0..<lanes.scalarCount { decoded.append(lanes[lane]) }
+            }
+            decoded += view.remainder
+            #expect(decoded == values)
+            #expect(view.vector(at: 4) == SIMD8((4..<12).map { Double($0) - 3.5 }))
+        }
+    }
+}
@@ -361,3 +361,89 @@ struct FloatNumberClassTests {
         #expect(IEEE_754.Classification.numberClass(negSubnorm) == .negative(.subnormal))
     }
 }
+
+// MARK: - Batch Classification Tests
+
+@Suite("IEEE_754.Classification - Batch classification")
+struct BatchClassificationTests {
+    static let specials: [Double] = [
+        0.0, -0.0, 1.5, -2.5, .infinity, -.infinity, .leastNonzeroMagnitude, -.leastNormalMagnitude,
+        .nan, -.nan, .signalingNaN, .greatestFiniteMagnitude,
+    ]
+
+    /// Values whose count is not a multiple of 64 so the padded tail is exercised
+    static let column: [Double] = (0..<1_000).map { specials[$0 % specials.count] }
+
+    static func reference(_ classes: [IEEE_754.Classification.NumberClass]) -> IEEE_754.Classification.Histogram {
+        var histogram = IEEE_754.Classification.Histogram()
+        for numberClass in classes {
+            switch numberClass {
+            case .nan(.signaling): histogram.signalingNaN += 1
+            case .nan(.quiet): histogram.quietNaN += 1
+            case .positive(.infinity): histogram.positive.infinity += 1
+            case .positive(.normal): histogram.positive.normal += 1
+            case .positive(.subnormal): histogram.positive.subnormal += 1
+            case .positive(.zero): histogram.positive.zero += 1
+            case .negative(.infinity): histogram.negative.infinity += 1
+            case .negative(.normal): histogram.negative.normal += 1
+            case .negative(.subnormal): histogram.negative.subnormal += 1
+            case .negative(.zero): histogram.negative.zero += 1
+            }
+        }
+        return histogram
+    }
+
+    @Test func `histogram matches numberClass`() {
+        let histogram = IEEE_754.Classification.histogram(Self.column)
+        #expect(histogram == Self.reference(Self.column.map(IEEE_754.Classification.numberClass)))
+        #expect(histogram.count == 1_000)
+        #expect(histogram[.nan(.signaling)] == histogram.signalingNaN)
+        #expect(histogram.finite == Self.column.filter(\.isFinite).count)
+    }
+
+    @Test func `short and empty inputs`() {
+        for length in [0, 1, 7, 63, 64, 65, 129] {
+            let values = Array(Self.column.prefix(length))
+            #expect(IEEE_754.Classification.histogram(values) == Self.reference(values.map(IEEE_754.Classification.numberClass)))
+        }
+        #expect(IEEE_754.Classification.mask([Double](), .nan).isEmpty)
+    }
+
+    @Test func `bitmasks match scalar predicates`() {
+        let census = IEEE_754.Classification.classify(Self.column, masks: Set(IEEE_754.Classification.Predicate.allCases))
+        let scalar: [IEEE_754.Classification.Predicate: (Double) -> Bool] = [
+            .signMinus: IEEE_754.Classification.isSignMinus,
+            .normal: IEEE_754.Classification.isNormal,
+            .finite: IEEE_754.Classification.isFinite,
+            .zero: IEEE_754.Classification.isZero,
+            .subnormal: IEEE_754.Classification.isSubnormal,
+            .infinite: IEEE_754.Classification.isInfinite,
+            .nan: IEEE_754.Classification.isNaN,
+            .signaling: IEEE_754.Classification.isSignaling,
+        ]
+        for (predicate, test) in scalar {
+            let mask = census.masks[predicate]
+            #expect(mask.map { Array($0) } == Self.column.map(test), "\(predicate)")
+        }
+        #expect(census.masks[.nan]?.trueCount == census.histogram.nan)
+    }
+
+    @Test func `only requested masks are built`() {
+        let census = IEEE_754.Classification.classify(Self.column, masks: [.zero, .signaling])
+        #expect(Set(census.masks.keys) == [.zero, .signaling])
+        #expect(IEEE_754.Classification.classify(Self.column).masks.isEmpty)
+    }
+
+    @Test func `tail bits are cleared`() {
+        let mask = IEEE_754.Classification.mask([Double](repeating: 0, count: 70), .zero)
+        #expect(mask.words == [.max, 0x3F])
+    }
+
+    @Test func `Float batch classification`() {
+        let values: [Float] = Self.column.map(Float.init) + [.leastNonzeroMagnitude, -.leastNormalMagnitude, .signalingNaN]
+        let histogram = IEEE_754.Classification.histogram(values)
+        #expect(histogram == Self.reference(values.map(IEEE_754.Classification.numberClass)))
+        #expect(IEEE_754.Classification.mask(values, .normal).map { $0 } == values.map(\.isNormal))
+        #expect(IEEE_754.Classification.mask(values, .signaling).map { $0 } == values.map(\.isSignalingNaN))
+    }
+}
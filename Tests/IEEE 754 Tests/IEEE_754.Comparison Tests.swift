@@ -369,3 +369,117 @@ struct ComparisonPredicateTests {
         }
     }
 }
+
+// MARK: - Column Kernels
+
+@Suite("IEEE_754.Comparison - Column kernels")
+struct ComparisonColumnTests {
+    static let relations: [IEEE_754.Comparison.Relation] = [
+        .compare(.equality(.equal)),
+        .compare(.equality(.notEqual)),
+        .compare(.ordering(.less(orEqual: false))),
+        .compare(.ordering(.less(orEqual: true))),
+        .compare(.ordering(.greater(orEqual: false))),
+        .compare(.ordering(.greater(orEqual: true))),
+        .totalOrder,
+        .totalOrderMag,
+    ]
+
+    static let specials: [Double] = [
+        0, -0.0, 1, -1, 1.5, .leastNonzeroMagnitude, -.leastNormalMagnitude,
+        .greatestFiniteMagnitude, .infinity, -.infinity, .nan, -.nan, .signalingNaN,
+        Double(nan: 7, signaling: false), -Double(nan: 3, signaling: true),
+    ]
+
+    static func expected(_ lhs: Double, _ rhs: Double, _ relation: IEEE_754.Comparison.Relation) -> Bool {
+        switch relation {
+        case .compare(let predicate): IEEE_754.Comparison.compare(lhs, rhs, using: predicate)
+        case .totalOrder: IEEE_754.Comparison.totalOrder(lhs, rhs)
+        case .totalOrderMag: IEEE_754.Comparison.totalOrderMag(lhs, rhs)
+        }
+    }
+
+    static func expected(_ lhs: Float, _ rhs: Float, _ relation: IEEE_754.Comparison.Relation) -> Bool {
+        switch relation {
+        case .compare(let predicate): IEEE_754.Comparison.compare(lhs, rhs, using: predicate)
+        case .totalOrder: IEEE_754.Comparison.totalOrder(lhs, rhs)
+        case .totalOrderMag: IEEE_754.Comparison.totalOrderMag(lhs, rhs)
+        }
+    }
+
+    /// Every ordered pair of special values, repeated past several words
+    static let pairs: (lhs: [Double], rhs: [Double]) = {
+        let all = specials.flatMap { lhs in specials.map { (lhs, $0) } }
+        let repeated = (0..<3).flatMap { _ in all }
+        return (repeated.map(\.0), repeated.map(\.1))
+    }()
+
+    @Test(arguments: relations)
+    func `two columns match the scalar predicates`(relation: IEEE_754.Comparison.Relation) {
+        let (lhs, rhs) = Self.pairs
+        let mask = IEEE_754.Comparison.mask(lhs, rhs, using: relation)
+        #expect(mask.count == lhs.count)
+        #expect(Array(mask) == zip(lhs, rhs).map { Self.expected($0, $1, relation) })
+        #expect(mask.words.last! >> UInt64(lhs.count & 63) == 0)
+    }
+
+    @Test(arguments: relations)
+    func `column and scalar match the scalar predicates`(relation: IEEE_754.Comparison.Relation) {
+        for scalar in Self.specials {
+            for count in [0, 1, 7, 8, 63, 64, 65, 130] {
+                let values = (0..<count).map { Self.specials[$0 % Self.specials.count] }
+                let expected = values.map { Self.expected($0, scalar, relation) }
+                let positions = expected.indices.filter { expected[$0] }
+                #expect(Array(IEEE_754.Comparison.mask(values, scalar, using: relation)) == expected)
+                #expect(IEEE_754.Comparison.indices(values, scalar, using: relation) == positions)
+                #expect(
+                    IEEE_754.Comparison.filter(values, scalar, using: relation).map(\.bitPattern)
+                        == values.filter { Self.expected($0, scalar, relation) }.map(\.bitPattern)
+                )
+            }
+        }
+    }
+
+    @Test(arguments: relations)
+    func `float columns match the scalar predicates`(relation: IEEE_754.Comparison.Relation) {
+        let lhs = Self.pairs.lhs.map { Float($0) }
+        let rhs = Self.pairs.rhs.map { Float($0) }
+        let expected = zip(lhs, rhs).map { Self.expected($0, $1, relation) }
+        #expect(Array(IEEE_754.Comparison.mask(lhs, rhs, using: relation)) == expected)
+        #expect(IEEE_754.Comparison.indices(lhs, rhs, using: relation) == expected.indices.filter { expected[$0] })
+        let scalar = lhs.map { Self.expected($0, 1, relation) }
+        #expect(Array(IEEE_754.Comparison.mask(lhs, Float(1), using: relation)) == scalar)
+    }
+
+    @Test func `filters pairs into caller memory`() {
+        let lhs = (0..<10_000).map { Double($0 % 97) - 48 }
+        let rhs = (0..<10_000).map { Double($0 % 89) - 44 }
+        let less = IEEE_754.Comparison.Relation.compare(.ordering(.less(orEqual: false)))
+        let expected = zip(lhs, rhs).filter { $0 < $1 }.map(\.0)
+
+        var storage = [Double](repeating: .nan, count: expected.count)
+        let written = lhs.withUnsafeBufferPointer { lhs in
+            rhs.withUnsafeBufferPointer { rhs in
+                storage.withUnsafeMutableBufferPointer {
+                    IEEE_754.Comparison.filter(lhs, rhs, using: less, into: $0)
+                }
+            }
+        }
+        #expect(written == expected.count)
+        #expect(storage == expected)
+        #expect(IEEE_754.Comparison.filter(lhs, rhs, using: less) == expected)
+
+        let floats = lhs.map { Float($0) }
+        #expect(IEEE_754.Comparison.filter(floats, Float(0), using: .totalOrderMag) == floats.filter { $0 == 0 })
+    }
+
+    @Test func `zeros and NaNs`() {
+        let values: [Double] = [3, -0.0, 7, 0, .nan]
+        #expect(IEEE_754.Comparison.indices(values, 0, using: .compare(.equality(.equal))) == [1, 3])
+        #expect(IEEE_754.Comparison.indices(values, .nan, using: .compare(.equality(.notEqual))) == [0, 1, 2, 3, 4])
+        #expect(IEEE_754.Comparison.indices(values, 0, using: .totalOrder) == [1, 3])
+        #expect(IEEE_754.Comparison.indices(values, 0, using: .totalOrderMag) == [1, 3])
+        #expect(IEEE_754.Comparison.indices(values, -0.0, using: .totalOrder) == [1])
+        #expect(IEEE_754.Comparison.mask([Double](), [Double](), using: .totalOrder).words.isEmpty)
+    }
+}
@@ -0,0 +1,211 @@
+// IEEE_754.Conversions.DecimalText Tests.swift
+// swift-ieee-754
+//
+// Tests for IEEE 754-2019 Section 5.12 decimal character sequences
+
+import Testing
+
+@testable import IEEE_754
+
+#if canImport(CIEEE754)
+    private typealias Text = IEEE_754.Conversions.DecimalText
+
+    private func text(_ bytes: [UInt8]) -> String {
+        String(decoding: bytes, as: UTF8.self)
+    }
+
+    /// Deterministic bit patterns spread over the whole encoding space
+    private func patterns(_ count: Int) -> [UInt64] {
+        var state: UInt64 = 0x9E37_79B9_7F4A_7C15
+        return (0..<count).map { _ in
+            state ^= state << 13
+            state ^= state >> 7
+            state ^= state << 17
+            return state
+        }
+    }
+
+    @Suite("IEEE_754.Conversions.DecimalText - Formatting")
+    struct DecimalTextFormattingTests {
+        @Test(arguments: [
+            (0.1 + 0.2, "0.30000000000000004"),
+            (1e21, "1e+21"),
+            (1e20, "100000000000000000000"),
+            (123, "123"),
+            (1.5, "1.5"),
+            (0.000001, "0.000001"),
+            (1e-7, "1e-7"),
+            (-1.25e-5, "-0.0000125"),
+            (5e-324, "5e-324"),
+            (2.2250738585072014e-308, "2.2250738585072014e-308"),
+            (1.7976931348623157e308, "1.7976931348623157e+308"),
+        ])
+        func `binary64 shortest digits`(value: Double, expected: String) {
+            #expect(text(Text.bytes(value)) == expected)
+        }
+
+        @Test func `binary64 special values`() {
+            #expect(text(Text.bytes(0.0)) == "0")
+            #expect(text(Text.bytes(-0.0)) == "-0")
+            #expect(text(Text.bytes(Double.infinity)) == "inf")
+            #expect(text(Text.bytes(-Double.infinity)) == "-inf")
+            #expect(text(Text.bytes(Double.nan)) == "nan")
+            #expect(text(Text.bytes(-Double.signalingNaN)) == "-snan")
+        }
+
+        @Test func `binary32 shortest digits`() {
+            #expect(text(Text.bytes(Float(0.1))) == "0.1")
+            #expect(text(Text.bytes(Float.greatestFiniteMagnitude)) == "3.4028235e+38")
+            #expect(text(Text.bytes(Float.leastNonzeroMagnitude)) == "1e-45")
+            #expect(text(Text.bytes(Float(16_777_216))) == "16777216")
+        }
+
+        @Test func `binary16 shortest digits`() {
+            #expect(text(Text.bytes(binary16: 0x3C00)) == "1")
+            #expect(text(Text.bytes(binary16: 0x3555)) == "0.3333")
+            #expect(text(Text.bytes(binary16: 0x7BFF)) == "65500")
+            #expect(text(Text.bytes(binary16: 0x0001)) == "6e-8")
+            #expect(text(Text.bytes(binary16: 0xFC00)) == "-inf")
+        }
+
+        @Test func `writes into caller memory at an offset`() {
+            var storage = [UInt8](repeating: UInt8(ascii: "_"), count: 40)
+            let written = storage.withUnsafeMutableBytes { buffer in
+                let first = Text.write(1.5, into: buffer, at: 1)
+                return first + Text.write(Float(-2), into: buffer, at: 1 + first)
+            }
+            #expect(written == 5)
+            #expect(text(Array(storage[0..<7])) == "_1.5-2_")
+        }
+
+        @Test func `short buffers only need room for the text`() {
+            var storage = [UInt8](repeating: 0, count: 3)
+            let written = storage.withUnsafeMutableBytes { Text.write(0.5, into: $0) }
+            #expect(written == 3)
+            #expect(text(storage) == "0.5")
+        }
+
+        @Test func `maximum lengths are reached`() {
+            #expect(Text.bytes(-0.0000012345678901234567).count == Text.binary64MaximumLength)
+            #expect(Text.bytes(Float(-1e20)).count == Text.binary32MaximumLength)
+            #expect(Text.bytes(binary16: 0x8400).count == Text.binary16MaximumLength)
+        }
+    }
+
+    @Suite("IEEE_754.Conversions.DecimalText - Parsing")
+    struct DecimalTextParsingTests {
+        @Test func `grammar`() {
+            #expect(Text.double(from: "+1".utf8) == 1)
+            #expect(Text.double(from: "-.5".utf8) == -0.5)
+            #expect(Text.double(from: "5.".utf8) == 5)
+            #expect(Text.double(from: "2.5E-3".utf8) == 0.0025)
+            #expect(Text.double(from: "-Infinity".utf8) == -.infinity)
+            #expect(Text.double(from: "INF".utf8) == .infinity)
+            #expect(Text.double(from: "nan".utf8)?.isNaN == true)
+            #expect(Text.double(from: "snan".utf8)?.isSignalingNaN == true)
+            for malformed in ["", "-", ".", "e5", "1e", "1e+", "1.2.3", "--1", " 1", "1 ", "1,5", "0x10", "infinit"] {
+                #expect(Text.double(from: malformed.utf8) == nil, "\(malformed)")
+            }
+        }
+
+        @Test func `out of range`() {
+            #expect(Text.double(from: "1e309".utf8) == .infinity)
+            #expect(Text.double(from: "1e-400".utf8) == 0)
+            #expect(Text.double(from: "-1e-400".utf8)?.sign == .minus)
+            #expect(Text.float(from: "3.5e38".utf8) == .infinity)
+            #expect(Text.binary16(from: "65520".utf8) == 0x7C00)
+            #expect(Text.binary16(from: "65519.99".utf8) == 0x7BFF)
+        }
+
+        @Test func `exact ties round to even`() {
+            #expect(Text.double(from: "9007199254740993".utf8) == 9_007_199_254_740_992)
+            #expect(Text.double(from: "9007199254740995".utf8) == 9_007_199_254_740_996)
+            #expect(Text.double(from: "9007199254740993.00000000000000000000001".utf8) == 9_007_199_254_740_994)
+            // Halfway between 0 and the least binary16 subnormal, 2⁻²⁵
+            #expect(Text.binary16(from: "0.0000000298023223876953125".utf8) == 0x0000)
+            #expect(Text.binary16(from: "0.0000000298023223876953125000001".utf8) == 0x0001)
+        }
+
+        @Test func `long inputs are correctly rounded`() {
+            let tenth = "0.1000000000000000055511151231257827021181583404541015625"
+            #expect(Text.double(from: tenth.utf8) == 0.1)
+            let least = "4.9406564584124654e-324"
+            #expect(Text.double(from: least.utf8) == .leastNonzeroMagnitude)
+            let digits = "1" + String(repeating: "0", count: 400) + "e-400"
+            #expect(Text.double(from: digits.utf8) == 1)
+        }
+
+        @Test func `binary32 rounds once`() {
+            // 1 + 2⁻²⁴ + 2⁻⁵⁴: binary64 rounds it to the binary32 tie 1 + 2⁻²⁴, which then rounds to 1
+            let value = "1.000000059604644830901776231257827021181583404541015625"
+            #expect(Text.float(from: value.utf8) == Float(bitPattern: 0x3F80_0001))
+            #expect(Text.double(from: value.utf8).map { Float($0) } == 1)
+        }
+
+        @Test func `binary64 round trip`() {
+            for bits in patterns(20_000) {
+                let value = Double(bitPattern: bits)
+                guard !value.isNaN else { continue }
+                #expect(Text.double(from: Text.bytes(value))?.bitPattern == bits)
+            }
+        }
+
+        @Test func `binary32 round trip`() {
+            for bits in patterns(20_000) {
+                let value = Float(bitPattern: UInt32(truncatingIfNeeded: bits >> 16))
+                guard !value.isNaN else { continue }
+                #expect(Text.float(from: Text.bytes(value))?.bitPattern == value.bitPattern)
+            }
+        }
+
+        @Test func `every binary16 encoding round trips`() {
+            for bits in UInt16.min...UInt16.max where !IEEE_754.Binary16.isNaN(bits) {
+                #expect(Text.binary16(from: Text.bytes(binary16: bits)) == bits)
+            }
+        }
+    }
+
+    @Suite("IEEE_754.Conversions.DecimalText - Columns", .serialized)
+    struct DecimalTextColumnTests {
+        @Test func `formats separated fields`() {
+            #expect(text(Text.bytes([1.5, -0.0, 1e300] as [Double])) == "1.5,-0,1e+300")
+            #expect(text(Text.bytes([Float(0.1), 2], separator: UInt8(ascii: " "))) == "0.1 2")
+            #expect(text(Text.bytes(binary16: [0x3C00, 0x0001] as [UInt16], separator: UInt8(ascii: ";"))) == "1;6e-8")
+            #expect(Text.bytes([Double]()).isEmpty)
+        }
+
+        @Test func `columns round trip`() {
+            let values = patterns(5_000).map { Double(bitPattern: $0) }.filter { !$0.isNaN }
+            let column = Text.bytes(values, separator: UInt8(ascii: "\n"))
+            let parsed = column.withUnsafeBytes { Text.doubles(from: $0, separator: UInt8(ascii: "\n")) }
+            #expect(parsed?.map(\.bitPattern) == values.map(\.bitPattern))
+        }
+
+        @Test func `field rules`() {
+            func parse(_ string: String) -> [Double]? {
+                Array(string.utf8).withUnsafeBytes { Text.doubles(from: $0) }
+            }
+            #expect(parse("") == [])
+            #expect(parse("1,2.5,-3") == [1, 2.5, -3])
+            #expect(parse("1,2,") == [1, 2])
+            #expect(parse("1,,2") == nil)
+            #expect(parse(",") == nil)
+            #expect(parse("1,x") == nil)
+
+            let floats = Array("0.1,1e-45".utf8).withUnsafeBytes { Text.floats(from: $0) }
+            #expect(floats == [0.1, .leastNonzeroMagnitude])
+            let halves = Array("1 65504 -0".utf8).withUnsafeBytes {
+                Text.binary16s(from: $0, separator: UInt8(ascii: " "))
+            }
+            #expect(halves == [0x3C00, 0x7BFF, 0x8000])
+        }
+
+        @Test func `signals no exceptions`() {
+            IEEE_754.Exceptions.clearAll()
+            _ = Text.bytes([0.1, .leastNonzeroMagnitude, .greatestFiniteMagnitude, .signalingNaN])
+            _ = Array("1e400,1e-400,0.1,snan".utf8).withUnsafeBytes { Text.doubles(from: $0) }
+            #expect(IEEE_754.Exceptions.raised().isEmpty)
+            IEEE_754.Exceptions.clearAll()
+        }
+    }
+#endif
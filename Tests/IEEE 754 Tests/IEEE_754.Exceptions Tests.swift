@@ -3,6 +3,7 @@
 //
 // Comprehensive tests for IEEE 754-2019 Section 7 Exception Handling
 
+import Synchronization
 import Testing
 
 @testable import IEEE_754
@@ -296,3 +297,206 @@ struct ExceptionThreadTests {
         #expect(!IEEE_754.Exceptions.testFlag(.invalid))
     }
 }
+
+// MARK: - Flag Set Tests
+
+@Suite("IEEE_754.Exceptions - Flag Sets", .serialized)
+struct ExceptionFlagSetTests {
+    @Test func `flag set from array literal`() {
+        let flags: IEEE_754.Exceptions.FlagSet = [.overflow, .inexact]
+        #expect(flags.contains(.overflow))
+        #expect(flags.contains(.inexact))
+        #expect(!flags.contains(.invalid))
+        #expect(flags.flags == [.overflow, .inexact])
+    }
+
+    @Test func `raw value uses one bit per flag`() {
+        #expect(IEEE_754.Exceptions.FlagSet(.invalid).rawValue == 0b00001)
+        #expect(IEEE_754.Exceptions.FlagSet(.inexact).rawValue == 0b10000)
+        #expect(IEEE_754.Exceptions.FlagSet.all.rawValue == 0b11111)
+        #expect(IEEE_754.Exceptions.FlagSet(rawValue: 0xFF) == .all)
+    }
+
+    @Test func `raise flag set and read back`() {
+        IEEE_754.Exceptions.clearAll()
+        IEEE_754.Exceptions.raise([.divisionByZero, .underflow])
+
+        let raised = IEEE_754.Exceptions.raised()
+        #expect(raised == [.divisionByZero, .underflow])
+        #expect(IEEE_754.Exceptions.testFlag(.divisionByZero))
+        #expect(IEEE_754.Exceptions.testFlag(.underflow))
+        #expect(!IEEE_754.Exceptions.testFlag(.overflow))
+    }
+
+    @Test func `clear flag set leaves others`() {
+        IEEE_754.Exceptions.clearAll()
+        IEEE_754.Exceptions.raise(.invalid)
+        IEEE_754.Exceptions.raise(.overflow)
+        IEEE_754.Exceptions.raise(.inexact)
+
+        IEEE_754.Exceptions.clear([.invalid, .inexact])
+
+        #expect(IEEE_754.Exceptions.raised() == [.overflow])
+    }
+
+    @Test func `set algebra`() {
+        let a: IEEE_754.Exceptions.FlagSet = [.invalid, .overflow]
+        let b: IEEE_754.Exceptions.FlagSet = [.overflow, .underflow]
+        #expect(a.union(b) == [.invalid, .overflow, .underflow])
+        #expect(a.intersection(b) == [.overflow])
+        #expect(IEEE_754.Exceptions.FlagSet().isEmpty)
+    }
+
+    @Test func `description lists flags`() {
+        let flags: IEEE_754.Exceptions.FlagSet = [.invalid, .inexact]
+        #expect(flags.description == "[invalid, inexact]")
+    }
+}
+
+// MARK: - Aggregate View Tests
+
+@Suite("IEEE_754.Exceptions - Aggregate View", .serialized)
+struct ExceptionAggregateTests {
+    @Test func `aggregate includes current thread`() {
+        IEEE_754.Exceptions.clearAll()
+        IEEE_754.Exceptions.raise(.overflow)
+        #expect(IEEE_754.Exceptions.aggregate().contains(.overflow))
+        IEEE_754.Exceptions.clearAll()
+    }
+
+    @Test func `aggregate merges flags raised by worker tasks`() async {
+        await withTaskGroup(of: Void.self) { group in
+            for _ in 0..<8 {
+                group.addTask {
+                    IEEE_754.Exceptions.raise(.underflow)
+                }
+            }
+        }
+
+        #expect(IEEE_754.Exceptions.aggregate().contains(.underflow))
+    }
+
+    @Test func `worker task reads back its own flags`() async {
+        let raisedInWorker = await Task.detached {
+            IEEE_754.Exceptions.clearAll()
+            IEEE_754.Exceptions.raise(.divisionByZero)
+            let raised = IEEE_754.Exceptions.raised()
+            IEEE_754.Exceptions.clearAll()
+            return raised
+        }.value
+
+        #expect(raisedInWorker.contains(.divisionByZero))
+    }
+}
+
+// MARK: - Accounting
+
+#if canImport(CIEEE754)
+    @Suite("IEEE_754.Exceptions - Accounting", .serialized)
+    struct ExceptionsAccountingTests {
+        typealias Accounting = IEEE_754.Exceptions.Accounting
+
+        @Test func `counts every raise inside a scope`() {
+            IEEE_754.Exceptions.withAccounting("accounting.counts") {
+                for _ in 0..<5 { IEEE_754.Exceptions.raise(.overflow) }
+                IEEE_754.Exceptions.raise([.underflow, .inexact])
+            }
+            IEEE_754.Exceptions.raise(.overflow)
+
+            let counts = Accounting.snapshot()["accounting.counts"]
+            #expect(counts == Accounting.Counts(overflow: 5, underflow: 1, inexact: 1))
+            IEEE_754.Exceptions.clearAll()
+        }
+
+        @Test func `nested scopes attribute to the innermost`() {
+            let outer = Accounting.Scope("accounting.outer")
+            let inner = Accounting.Scope("accounting.inner")
+            struct Failure: Error {}
+
+            IEEE_754.Exceptions.withAccounting(outer) {
+                IEEE_754.Exceptions.raise(.invalid)
+                #expect(throws: Failure.self) {
+                    try IEEE_754.Exceptions.withAccounting(inner) {
+                        IEEE_754.Exceptions.raise(.invalid)
+                        IEEE_754.Exceptions.raise(.divisionByZero)
+                        throw Failure()
+                    }
+                }
+                IEEE_754.Exceptions.raise(.invalid)
+            }
+
+            #expect(Accounting.counts(for: outer) == Accounting.Counts(invalid: 2))
+            #expect(Accounting.counts(for: inner) == Accounting.Counts(invalid: 1, divisionByZero: 1))
+            #expect(inner.label == "accounting.inner")
+            #expect(Accounting.Scope("accounting.inner") == inner)
+            IEEE_754.Exceptions.clearAll()
+        }
+
+        @Test func `sums counters across threads`() async {
+            let scope = Accounting.Scope("accounting.workers")
+            await withTaskGroup(of: Void.self) { group in
+                for _ in 0..<8 {
+                    group.addTask {
+                        IEEE_754.Exceptions.withAccounting(scope) {
+                            for _ in 0..<100 { IEEE_754.Exceptions.raise(.inexact) }
+                        }
+                        IEEE_754.Exceptions.clearAll()
+                    }
+                }
+            }
+            #expect(Accounting.counts(for: scope).inexact == 800)
+        }
+
+        @Test func `samples and exposition list non-zero counters`() {
+            IEEE_754.Exceptions.withAccounting("accounting.export") {
+                IEEE_754.Exceptions.raise([.overflow, .inexact])
+            }
+            let snapshot = Accounting.snapshot()
+            let samples = snapshot.samples.filter { $0.scope == "accounting.export" }
+            #expect(samples.map(\.flag) == [.overflow, .inexact])
+            #expect(samples.map(\.count) == [1, 1])
+
+            let text = snapshot.exposition(metric: "fp")
+            #expect(text.hasPrefix("# TYPE fp counter\n"))
+            #expect(text.contains("fp_total{scope=\"accounting.export\",flag=\"overflow\"} 1\n"))
+            IEEE_754.Exceptions.clearAll()
+        }
+
+        @Test func `reset clears every scope`() {
+            IEEE_754.Exceptions.withAccounting("accounting.reset") {
+                IEEE_754.Exceptions.raise(.underflow)
+            }
+            Accounting.reset()
+            #expect(Accounting.snapshot()["accounting.reset"].isZero)
+            IEEE_754.Exceptions.clearAll()
+        }
+
+        static let phase = Atomic<Int>(0)
+
+        @Test func `concurrent reset never restores earlier counts`() async {
+            let scope = Accounting.Scope("accounting.concurrent-reset")
+            let (before, after) = (200_000, 100_000)
+            Self.phase.store(0, ordering: .relaxed)
+            await withTaskGroup(of: Void.self) { group in
+                group.addTask {
+                    IEEE_754.Exceptions.withAccounting(scope) {
+                        for _ in 0..<before { IEEE_754.Exceptions.raise(.inexact) }
+                        Self.phase.store(1, ordering: .releasing)
+                        for _ in 0..<after { IEEE_754.Exceptions.raise(.inexact) }
+                    }
+                    Self.phase.store(2, ordering: .releasing)
+                    IEEE_754.Exceptions.clearAll()
+                }
+                group.addTask {
+                    while Self.phase.load(ordering: .acquiring) < 1 { await Task.yield() }
+                    repeat {
+                        Accounting.reset()
+                        await Task.yield()
+                    } while Self.phase.load(ordering: .acquiring) < 2
+                }
+            }
+            // At least one reset ran after the first run was counted
+            #expect(Accounting.counts(for: scope).inexact <= UInt64(after))
+        }
+    }
+#endif
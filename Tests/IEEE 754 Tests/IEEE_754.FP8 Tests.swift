@@ -0,0 +1,114 @@
+// IEEE_754.FP8 Tests.swift
+// swift-ieee-754
+//
+// Tests for the OCP FP8 E4M3 and E5M2 storage formats
+
+import Testing
+
+@testable import IEEE_754
+
+private typealias E4M3 = IEEE_754.FP8.E4M3
+private typealias E5M2 = IEEE_754.FP8.E5M2
+
+@Suite("IEEE_754.FP8 - E4M3")
+struct FP8E4M3Tests {
+    @Test func `special encodings`() {
+        #expect(E4M3.value(bitPattern: 0x7E) == 448)
+        #expect(E4M3.value(bitPattern: 0x38) == 1)
+        #expect(E4M3.value(bitPattern: 0x01) == 0x1p-9)
+        #expect(E4M3.value(bitPattern: 0x08) == E4M3.minNormal)
+        #expect(E4M3.value(bitPattern: 0x7F).isNaN)
+        #expect(E4M3.value(bitPattern: 0xFF).isNaN)
+        #expect(E4M3.value(bitPattern: 0x78) == 256)
+    }
+
+    @Test func `narrowing rounds, saturates or becomes NaN`() {
+        #expect(E4M3.bitPattern(from: 300) == 0x79)
+        // 464 is halfway between 448 and the missing 480: ties to the even 448
+        #expect(E4M3.bitPattern(from: 464) == 0x7E)
+        #expect(E4M3.bitPattern(from: 465) == 0x7F)
+        #expect(E4M3.bitPattern(from: -1000, saturating: true) == 0xFE)
+        #expect(E4M3.bitPattern(from: .infinity) == 0x7F)
+        #expect(E4M3.bitPattern(from: .infinity, saturating: true) == 0x7E)
+        #expect(E4M3.bitPattern(from: 0x1p-10) == 0x00)
+        #expect(E4M3.bitPattern(from: 0x1p-9 * 1.5) == 0x02)
+    }
+
+    @Test func `all encodings round trip`() {
+        for bits in UInt8.min...UInt8.max where bits & 0x7F != 0x7F {
+            #expect(E4M3.bitPattern(from: E4M3.value(bitPattern: bits)) == bits)
+        }
+    }
+}
+
+@Suite("IEEE_754.FP8 - E5M2")
+struct FP8E5M2Tests {
+    @Test func `matches the upper byte of binary16`() {
+        #expect(E5M2.exponentBias == 15)
+        #expect(E5M2.value(bitPattern: 0x3C) == 1)
+        #expect(E5M2.value(bitPattern: 0x7B) == E5M2.maxNormal)
+        #expect(E5M2.value(bitPattern: 0x01) == E5M2.minSubnormal)
+        #expect(E5M2.value(bitPattern: 0xFC) == -.infinity)
+        #expect(E5M2.numberClass(0x7D) == .nan(.signaling))
+        #expect(E5M2.nextUp(0x7B) == 0x7C)
+    }
+
+    @Test func `narrowing rounds and overflows`() {
+        #expect(E5M2.bitPattern(from: 1.125) == 0x3C)
+        #expect(E5M2.bitPattern(from: 1.375) == 0x3E)
+        #expect(E5M2.bitPattern(from: 65536) == 0x7C)
+        #expect(E5M2.bitPattern(from: 65536, saturating: true) == 0x7B)
+        #expect(E5M2.bitPattern(from: -.infinity) == 0xFC)
+        #expect(E5M2.isNaN(E5M2.bitPattern(from: .nan)))
+    }
+
+    @Test func `all encodings round trip`() {
+        for bits in UInt8.min...UInt8.max where !E5M2.isNaN(bits) {
+            #expect(E5M2.bitPattern(from: E5M2.value(bitPattern: bits)) == bits)
+        }
+    }
+}
+
+#if canImport(CIEEE754)
+    @Suite("IEEE_754.FP8 - Bulk Conversion", .serialized)
+    struct FP8BulkTests {
+        static let samples: [Float] = [0, -0.0, 1, -1.5, 0.1, 300, 448, 464, 465, 1e6, 57344, 65536, 0x1p-12, 0x1p-17]
+            + [.infinity, -.infinity, .nan] + (0..<200).map { Float($0) * 0.731 - 73 }
+
+        @Test(arguments: [false, true])
+        func `E4M3 bulk matches scalar`(saturating: Bool) {
+            var narrowed = [UInt8](repeating: 0, count: Self.samples.count)
+            let summary = Self.samples.withUnsafeBufferPointer { source in
+                narrowed.withUnsafeMutableBufferPointer { E4M3.narrow(source, into: $0, saturating: saturating) }
+            }
+            #expect(narrowed == Self.samples.map { E4M3.bitPattern(from: $0, saturating: saturating) })
+            #expect(summary.overflow == (saturating ? 6 : 4))
+            #expect(summary.invalid == (saturating ? 0 : 2))
+
+            var widened = [Float](repeating: 0, count: narrowed.count)
+            narrowed.withUnsafeBufferPointer { source in
+                widened.withUnsafeMutableBufferPointer { E4M3.widen(source, into: $0) }
+            }
+            #expect(widened.map(\.bitPattern) == narrowed.map { E4M3.value(bitPattern: $0).bitPattern })
+            IEEE_754.Exceptions.clearAll()
+        }
+
+        @Test(arguments: [false, true])
+        func `E5M2 bulk matches scalar`(saturating: Bool) {
+            var narrowed = [UInt8](repeating: 0, count: Self.samples.count)
+            let summary = Self.samples.withUnsafeBufferPointer { source in
+                narrowed.withUnsafeMutableBufferPointer { E5M2.narrow(source, into: $0, saturating: saturating) }
+            }
+            #expect(narrowed == Self.samples.map { E5M2.bitPattern(from: $0, saturating: saturating) })
+            #expect(summary.overflow == (saturating ? 4 : 2))
+            #expect(summary.underflow == 1)
+
+            var widened = [Float](repeating: 0, count: narrowed.count)
+            narrowed.withUnsafeBufferPointer { source in
+                widened.withUnsafeMutableBufferPointer { E5M2.widen(source, into: $0) }
+            }
+            #expect(widened.map(\.bitPattern) == narrowed.map { E5M2.value(bitPattern: $0).bitPattern })
+            IEEE_754.Exceptions.clearAll()
+        }
+    }
+#endif
@@ -301,3 +301,102 @@ struct MinMaxOperationTests {
         }
     }
 }
+
+// MARK: - Reduction Tests
+
+@Suite("IEEE_754.MinMax - Collection reductions")
+struct MinMaxReductionTests {
+    static let operations: [IEEE_754.MinMax.Operation] = [
+        .standard(.minimum), .standard(.maximum),
+        .number(.minimum), .number(.maximum),
+        .magnitude(.minimum, preferNumber: false), .magnitude(.maximum, preferNumber: false),
+        .magnitude(.minimum, preferNumber: true), .magnitude(.maximum, preferNumber: true),
+    ]
+
+    static let specials: [Double] = [
+        0.0, -0.0, 1.5, -1.5, .infinity, -.infinity, .leastNonzeroMagnitude,
+        -.greatestFiniteMagnitude, 42, -7,
+    ]
+
+    /// Reference result: the scalar operation folded left to right
+    static func fold(_ values: [Double], _ operation: IEEE_754.MinMax.Operation) -> Double? {
+        guard let first = values.first else { return nil }
+        return values.dropFirst().reduce(first) { IEEE_754.MinMax.apply($0, $1, operation: operation) }
+    }
+
+    static func same(_ lhs: Double?, _ rhs: Double?) -> Bool {
+        switch (lhs, rhs) {
+        case (nil, nil): return true
+        case let (lhs?, rhs?): return lhs.isNaN ? rhs.isNaN : lhs.bitPattern == rhs.bitPattern
+        default: return false
+        }
+    }
+
+    @Test(arguments: [0, 1, 7, 8, 9, 16, 23, 64])
+    func `matches scalar fold`(count: Int) {
+        var generator = SystemRandomNumberGenerator()
+        for trial in 0..<20 {
+            var values = (0..<count).map { _ in Self.specials.randomElement(using: &generator)! }
+            if trial % 3 == 0, !values.isEmpty {
+                values[Int.random(in: 0..<values.count)] = .nan
+            }
+            for operation in Self.operations {
+                let reduced = IEEE_754.MinMax.reduce(values, operation: operation)
+                #expect(Self.same(reduced, Self.fold(values, operation)), "\(operation) of \(values)")
+            }
+        }
+    }
+
+    @Test func `signed zeros`() {
+        let zeros: [Double] = [0.0, -0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0]
+        #expect(IEEE_754.MinMax.minimum(zeros)?.sign == .minus)
+        #expect(IEEE_754.MinMax.maximum(zeros)?.sign == .plus)
+        #expect(IEEE_754.MinMax.minimumMagnitude(zeros)?.sign == .minus)
+        #expect(IEEE_754.MinMax.maximumMagnitude(zeros)?.sign == .plus)
+    }
+
+    @Test func `NaN propagation and skipping`() {
+        let values: [Double] = [3, 1, 4, 1, 5, 9, 2, 6, .nan, 5, 3]
+        #expect(IEEE_754.MinMax.minimum(values)?.isNaN == true)
+        #expect(IEEE_754.MinMax.maximumMagnitude(values)?.isNaN == true)
+        #expect(IEEE_754.MinMax.minimumNumber(values) == 1)
+        #expect(IEEE_754.MinMax.maximumNumber(values) == 9)
+        #expect(IEEE_754.MinMax.maximumNumber([Double](repeating: .nan, count: 12))?.isNaN == true)
+    }
+
+    @Test func `magnitude ties`() {
+        let values: [Double] = [3, -3, 2, -2]
+        #expect(IEEE_754.MinMax.minimumMagnitude(values) == -2)
+        #expect(IEEE_754.MinMax.maximumMagnitude(values) == 3)
+    }
+
+    @Test func `empty collection`() {
+        #expect(IEEE_754.MinMax.minimum([Double]()) == nil)
+        #expect(IEEE_754.MinMax.minMax([Float]()) == nil)
+    }
+
+    @Test func `fused minMax`() {
+        let values = (0..<1_000).map { Double($0) - 500.5 }
+        let extremes = IEEE_754.MinMax.minMax(values)
+        #expect(extremes?.minimum == -500.5)
+        #expect(extremes?.maximum == 498.5)
+
+        let withNaN = values + [.nan]
+        #expect(IEEE_754.MinMax.minMax(withNaN)?.minimum.isNaN == true)
+        #expect(IEEE_754.MinMax.minMaxNumber(withNaN)?.maximum == 498.5)
+    }
+
+    @Test func `slices and non-contiguous collections`() {
+        let values: [Double] = [9, 8, 7, 6, 5, 4, 3, 2, 1, 0]
+        #expect(IEEE_754.MinMax.minimum(values[2..<6]) == 4)
+        #expect(IEEE_754.MinMax.maximum(values.lazy.map { -$0 }) == 0)
+    }
+
+    @Test func `Float reductions`() {
+        let values: [Float] = [2.5, -0.0, .nan, -8, 0.0, 1, 1, 1, 1, 1, 7]
+        #expect(IEEE_754.MinMax.minimumNumber(values) == -8)
+        #expect(IEEE_754.MinMax.maximumMagnitudeNumber(values) == -8)
+        #expect(IEEE_754.MinMax.minimumMagnitudeNumber(values)?.bitPattern == Float(-0.0).bitPattern)
+        #expect(IEEE_754.MinMax.maximum(values)?.isNaN == true)
+    }
+}
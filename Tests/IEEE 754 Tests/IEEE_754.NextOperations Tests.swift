@@ -248,3 +248,81 @@ struct NextOperationsEdgeCasesTests {
         #expect(up == value, "nextUp(nextDown(x)) should equal x")
     }
 }
+
+// MARK: - Batch Operations
+
+@Suite("IEEE_754.NextOperations - Batch operations")
+struct NextOperationsBatchTests {
+    /// Every class of value, long enough to leave a partial final block
+    static let column: [Double] = [
+        0, -0.0, 1, -1, 3.14, -2.5e-300, .leastNonzeroMagnitude, -.leastNonzeroMagnitude,
+        .leastNormalMagnitude, -.leastNormalMagnitude.nextDown, .greatestFiniteMagnitude, -.greatestFiniteMagnitude,
+        .infinity, -.infinity, .nan, -.nan, .signalingNaN, 1e100, -1e-100,
+    ]
+
+    @Test func `nextUp and nextDown match the scalar operations`() {
+        let up = IEEE_754.NextOperations.nextUp(Self.column)
+        let down = IEEE_754.NextOperations.nextDown(Self.column)
+        #expect(up.map(\.bitPattern) == Self.column.map { IEEE_754.NextOperations.nextUp($0).bitPattern })
+        #expect(down.map(\.bitPattern) == Self.column.map { IEEE_754.NextOperations.nextDown($0).bitPattern })
+        #expect(IEEE_754.NextOperations.nextUp(Self.column.lazy.map { $0 }).map(\.bitPattern) == up.map(\.bitPattern))
+        #expect(IEEE_754.NextOperations.nextUp([Double]()).isEmpty)
+    }
+
+    @Test func `in-place stepping widens an interval`() {
+        var lower = Self.column
+        var upper = Self.column
+        IEEE_754.NextOperations.formNextDown(&lower)
+        IEEE_754.NextOperations.formNextUp(&upper)
+        #expect(lower.map(\.bitPattern) == IEEE_754.NextOperations.nextDown(Self.column).map(\.bitPattern))
+        #expect(upper.map(\.bitPattern) == IEEE_754.NextOperations.nextUp(Self.column).map(\.bitPattern))
+    }
+
+    @Test func `nextAfter matches the scalar operation`() {
+        let targets = Self.column.reversed() as [Double]
+        let next = IEEE_754.NextOperations.nextAfter(Self.column, toward: targets)
+        let expected = zip(Self.column, targets).map { IEEE_754.NextOperations.nextAfter($0, toward: $1) }
+        #expect(next.map(\.bitPattern) == expected.map(\.bitPattern))
+        #expect(IEEE_754.NextOperations.nextAfter([-0.0, 0.0], toward: [0.0, -0.0]).map(\.sign) == [.plus, .minus])
+    }
+
+    @Test func `ulpDistance counts representable values`() {
+        #expect(IEEE_754.NextOperations.ulpDistance(1.0, 1.0.nextUp) == 1)
+        #expect(IEEE_754.NextOperations.ulpDistance(1.0.nextUp, 1.0) == 1)
+        #expect(IEEE_754.NextOperations.ulpDistance(-0.0, 0.0) == 0)
+        #expect(IEEE_754.NextOperations.ulpDistance(-Double.leastNonzeroMagnitude, .leastNonzeroMagnitude) == 2)
+        #expect(IEEE_754.NextOperations.ulpDistance(.greatestFiniteMagnitude, .infinity) == 1)
+        #expect(IEEE_754.NextOperations.ulpDistance(1.0, 2.0) == 1 << 52)
+        #expect(IEEE_754.NextOperations.ulpDistance(.nan, 1.0) == .max)
+        #expect(IEEE_754.NextOperations.ulpDistance(-.infinity, .infinity) == 0xFFE0_0000_0000_0000)
+    }
+
+    @Test func `batch ulpDistance matches the scalar kernel`() {
+        let computed = (0..<37).map { Double($0) * 0.1 }
+        let reference = (0..<37).map { Double($0) / 10 }
+        let distances = IEEE_754.NextOperations.ulpDistance(computed, reference)
+        #expect(distances == zip(computed, reference).map { IEEE_754.NextOperations.ulpDistance($0, $1) })
+        #expect(distances.contains { $0 > 0 })
+        #expect(IEEE_754.NextOperations.maximumUlpDistance(computed, reference) == distances.max())
+        #expect(IEEE_754.NextOperations.maximumUlpDistance([Double](), [Double]()) == 0)
+        #expect(IEEE_754.NextOperations.maximumUlpDistance(Self.column, Self.column) == .max)
+    }
+
+    @Test func `Float batch operations`() {
+        let column: [Float] = Self.column.map(Float.init)
+        let up = IEEE_754.NextOperations.nextUp(column)
+        #expect(up.map(\.bitPattern) == column.map { IEEE_754.NextOperations.nextUp($0).bitPattern })
+        var down = column
+        IEEE_754.NextOperations.formNextDown(&down)
+        #expect(down.map(\.bitPattern) == column.map { IEEE_754.NextOperations.nextDown($0).bitPattern })
+
+        let targets = column.reversed() as [Float]
+        let next = IEEE_754.NextOperations.nextAfter(column, toward: targets)
+        let expected = zip(column, targets).map { IEEE_754.NextOperations.nextAfter($0, toward: $1) }
+        #expect(next.map(\.bitPattern) == expected.map(\.bitPattern))
+
+        #expect(IEEE_754.NextOperations.ulpDistance(Float(1), Float(2)) == 1 << 23)
+        #expect(IEEE_754.NextOperations.ulpDistance(up, column).filter { $0 != .max }.allSatisfy { $0 <= 1 })
+        #expect(IEEE_754.NextOperations.maximumUlpDistance(up.filter { !$0.isNaN }, column.filter { !$0.isNaN }) == 1)
+    }
+}
@@ -246,3 +246,73 @@ struct PayloadPreservationTests {
         #expect(negativeNaN.isNaN, "Negated NaN should still be NaN")
     }
 }
+
+// MARK: - Batch Payload Tests
+
+@Suite("IEEE_754.Payload - Batch scans")
+struct PayloadBatchTests {
+    /// Numbers with tagged NaNs on both sides of every 8-element block boundary
+    static let column: [Double] = (0..<45).map { index -> Double in
+        switch index {
+        case 0, 7, 8, 30: IEEE_754.Payload.encodeQuietNaN(payload: UInt64(index + 1))
+        case 19: -IEEE_754.Payload.encodeQuietNaN(payload: UInt64(0x7_FFFF_FFFF_FFFF))
+        case 23: IEEE_754.Payload.encodeSignalingNaN(payload: 2)
+        case 44: .nan
+        case 12: .infinity
+        default: Double(index) * 0.5
+        }
+    }
+
+    @Test func `scan matches the scalar loop`() {
+        let scan = IEEE_754.Payload.scan(Self.column)
+        let expected = Self.column.indices.filter { Self.column[$0].isNaN }
+        #expect(scan.indices == expected)
+        #expect(scan.payloads == expected.map { IEEE_754.Payload.extract(from: Self.column[$0])! })
+        #expect(scan.indices == [0, 7, 8, 19, 23, 30, 44])
+        #expect(IEEE_754.Payload.scan(Self.column.lazy.map { $0 }) == scan)
+        #expect(IEEE_754.Payload.scan([Double]()).count == 0)
+    }
+
+    @Test func `dense payload column`() {
+        let column = IEEE_754.Payload.payloads(Self.column)
+        #expect(column == Self.column.map { IEEE_754.Payload.extract(from: $0) ?? .max })
+        #expect(IEEE_754.Payload.payloads([1.0, .nan], default: 99) == [99, 0])
+    }
+
+    @Test func `lookup table rewrites payloads in place`() {
+        var values = Self.column
+        let table: [UInt64] = [100, 101, 0, 103, 104, 105, 106, 107, 108, 109]
+        #expect(IEEE_754.Payload.remap(&values, table: table) == 5)
+
+        // Payloads inside the table are replaced, others are left alone
+        #expect(IEEE_754.Payload.extract(from: values[0]) == 101)
+        #expect(IEEE_754.Payload.extract(from: values[7]) == 108)
+        #expect(IEEE_754.Payload.extract(from: values[8]) == 109)
+        #expect(IEEE_754.Payload.extract(from: values[30]) == 31)
+        #expect(IEEE_754.Payload.extract(from: values[44]) == 100)
+        #expect(values[19].bitPattern == Self.column[19].bitPattern)
+
+        // A signaling NaN mapped to payload 0 stays a signaling NaN
+        #expect(values[23].isSignalingNaN)
+        #expect(IEEE_754.Payload.extract(from: values[23]) == 1)
+
+        for index in Self.column.indices where !Self.column[index].isNaN {
+            #expect(values[index] == Self.column[index])
+        }
+    }
+
+    @Test func `Float batch operations`() {
+        var values: [Float] = Self.column.map { $0.isNaN ? .nan : Float($0) }
+        values[3] = IEEE_754.Payload.encodeQuietNaN(payload: UInt32(2))
+        values[9] = -IEEE_754.Payload.encodeSignalingNaN(payload: UInt32(1))
+
+        let scan = IEEE_754.Payload.scan(values)
+        #expect(scan.indices == values.indices.filter { values[$0].isNaN })
+        #expect(IEEE_754.Payload.payloads(values) == values.map { IEEE_754.Payload.extract(from: $0) ?? .max })
+
+        #expect(IEEE_754.Payload.remap(&values, table: [0, 5, 6]) == scan.count)
+        #expect(IEEE_754.Payload.extract(from: values[3]) == 6)
+        #expect(values[9].isSignalingNaN && values[9].sign == .minus)
+        #expect(IEEE_754.Payload.extract(from: values[9]) == 5)
+    }
+}
@@ -253,3 +253,48 @@ struct ScalingEdgeCasesTests {
         #expect(nextExp > 0, "maxNormal should have positive exponent")
     }
 }
+
+// MARK: - Batch Operations
+
+@Suite("IEEE_754.Scaling - Batch operations")
+struct ScalingBatchTests {
+    /// Every class of value, long enough to leave a partial final block
+    static let column: [Double] = [
+        0, -0.0, 1, -1, 3.14, -2.5e-300, 8, 0.75, 1e308, -1e308,
+        .leastNonzeroMagnitude, -.leastNonzeroMagnitude, .leastNormalMagnitude, .leastNormalMagnitude.nextDown,
+        .greatestFiniteMagnitude, .infinity, -.infinity, .nan, .signalingNaN, 123.456, Double.ulpOfOne,
+    ]
+
+    @Test(arguments: [0, 1, -1, 10, -10, 52, -52, 1023, -1022, -1074])
+    func `scaleB matches the scalar operation`(n: Int) {
+        let scaled = IEEE_754.Scaling.scaleB(Self.column, n)
+        #expect(scaled.map(\.bitPattern) == Self.column.map { IEEE_754.Scaling.scaleB($0, n).bitPattern })
+    }
+
+    @Test func `scaleB beyond the exponent range stays correctly rounded`() {
+        let values: [Double] = [.greatestFiniteMagnitude, 1, .leastNonzeroMagnitude, 0x1.8p1000]
+        // The scalar multiply by 2ⁿ would give 0 and ∞ here
+        #expect(IEEE_754.Scaling.scaleB(values, -2000) == [0x1.fffffffffffffp-977, 0, 0, 0x1.8p-1000])
+        #expect(IEEE_754.Scaling.scaleB(values, 2000) == [.infinity, .infinity, 0x1p926, .infinity])
+        #expect(IEEE_754.Scaling.scaleB(values, .max) == [.infinity, .infinity, .infinity, .infinity])
+        #expect(IEEE_754.Scaling.scaleB(values, .min) == [0, 0, 0, 0])
+    }
+
+    @Test func `logB and significand match the scalar operations`() {
+        #expect(IEEE_754.Scaling.logB(Self.column) == Self.column.map { IEEE_754.Scaling.logB($0) })
+        let significands = IEEE_754.Scaling.significand(Self.column)
+        #expect(significands.map(\.bitPattern) == Self.column.map { IEEE_754.Scaling.significand($0).bitPattern })
+        #expect(IEEE_754.Scaling.logB([8.0, 0.75, .leastNonzeroMagnitude]) == [3, -1, -1074])
+    }
+
+    @Test func `Float batch operations`() {
+        let column: [Float] = Self.column.map(Float.init) + [.leastNonzeroMagnitude, 0x1p-140, -0x1.fp-130]
+        for n in [0, 3, -3, 127, -126, -149] {
+            let scaled = IEEE_754.Scaling.scaleB(column, n)
+            #expect(scaled.map(\.bitPattern) == column.map { IEEE_754.Scaling.scaleB($0, n).bitPattern })
+        }
+        #expect(IEEE_754.Scaling.logB(column) == column.map { IEEE_754.Scaling.logB($0) })
+        let significands = IEEE_754.Scaling.significand(column)
+        #expect(significands.map(\.bitPattern) == column.map { IEEE_754.Scaling.significand($0).bitPattern })
+    }
+}
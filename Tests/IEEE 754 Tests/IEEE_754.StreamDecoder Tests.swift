@@ -0,0 +1,100 @@
+// IEEE_754.StreamDecoder Tests.swift
+// swift-ieee-754
+//
+// Tests for incremental decoding of chunked byte streams
+
+import Testing
+
+@testable import IEEE_754
+
+@Suite("IEEE_754.StreamDecoder - Push API")
+struct StreamDecoderPushTests {
+    static let doubles: [Double] = (0..<257).map { Double($0) * 1.25 - 100 } + [.nan, -.infinity, -0.0]
+
+    /// Splits `bytes` into chunks whose sizes cycle through `sizes`
+    static func chunks(_ bytes: [UInt8], sizes: [Int]) -> [ArraySlice<UInt8>] {
+        var result: [ArraySlice<UInt8>] = []
+        var start = 0
+        var index = 0
+        while start < bytes.count {
+            let end = min(bytes.count, start + sizes[index % sizes.count])
+            result.append(bytes[start..<end])
+            start = end
+            index += 1
+        }
+        return result
+    }
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `every split point decodes the same values`(endianness: Binary.Endianness) throws {
+        let bytes = IEEE_754.Binary64.bytes(from: Self.doubles, endianness: endianness)
+        for sizes in [[1], [3], [7], [8], [9], [5, 0, 11], [4096]] {
+            var decoder = IEEE_754.StreamDecoder(of: Double.self, endianness: endianness)
+            var decoded: [Double] = []
+            for chunk in Self.chunks(bytes, sizes: sizes) {
+                decoded += decoder.decode(chunk)
+            }
+            try decoder.finish()
+            #expect(decoded.map(\.bitPattern) == Self.doubles.map(\.bitPattern))
+        }
+    }
+
+    @Test(arguments: [Binary.Endianness.little, .big])
+    func `float streams`(endianness: Binary.Endianness) throws {
+        let floats = Self.doubles.map { Float($0) }
+        let bytes = IEEE_754.Binary32.bytes(from: floats, endianness: endianness)
+        var decoder = IEEE_754.StreamDecoder(of: Float.self, endianness: endianness)
+        var decoded: [Float] = []
+        for chunk in Self.chunks(bytes, sizes: [3, 6, 1]) {
+            chunk.withUnsafeBytes { decoder.decode($0, into: &decoded) }
+        }
+        try decoder.finish()
+        #expect(decoded.map(\.bitPattern) == floats.map(\.bitPattern))
+    }
+
+    @Test func `partial elements are carried`() {
+        var decoder = IEEE_754.StreamDecoder(of: Double.self)
+        let one = IEEE_754.Binary64.bytes(from: 1.0)
+        #expect(decoder.decode(one.prefix(5)).isEmpty)
+        #expect(decoder.pendingByteCount == 5)
+        #expect(decoder.decode(one.suffix(3) + one.prefix(2)) == [1.0])
+        #expect(decoder.pendingByteCount == 2)
+        #expect(decoder.decode([UInt8]()).isEmpty)
+        #expect(decoder.pendingByteCount == 2)
+    }
+
+    @Test func `finish reports a truncated stream`() {
+        var decoder = IEEE_754.StreamDecoder(of: Double.self)
+        _ = decoder.decode([UInt8](repeating: 0, count: 13))
+        #expect(throws: IEEE_754.StreamError.truncated(pendingByteCount: 5)) {
+            try decoder.finish()
+        }
+    }
+}
+
+@Suite("IEEE_754.StreamDecoder - AsyncSequence")
+struct StreamDecoderAsyncTests {
+    static func stream(_ chunks: [[UInt8]]) -> AsyncStream<[UInt8]> {
+        AsyncStream { continuation in
+            for chunk in chunks { continuation.yield(chunk) }
+            continuation.finish()
+        }
+    }
+
+    @Test func `yields one batch per completing chunk`() async throws {
+        let bytes = IEEE_754.Binary64.bytes(from: [1.0, 2.0, 3.0], endianness: .big)
+        let chunks = [Array(bytes[0..<4]), Array(bytes[4..<12]), Array(bytes[12..<24])]
+        var batches: [[Double]] = []
+        for try await batch in Self.stream(chunks).decodingIEEE754(Double.self, endianness: .big) {
+            batches.append(batch)
+        }
+        #expect(batches == [[1.0], [2.0, 3.0]])
+    }
+
+    @Test func `throws when the stream ends inside an element`() async {
+        let chunks = [IEEE_754.Binary32.bytes(from: 1.5) + [0, 0]]
+        await #expect(throws: IEEE_754.StreamError.truncated(pendingByteCount: 2)) {
+            for try await _ in Self.stream(chunks).decodingIEEE754(Float.self) {}
+        }
+    }
+}
@@ -239,6 +239,141 @@ struct DoubleArrayTests {
     }
 }
 
+@Suite("Array<Double> - Raw buffer deserialization")
+struct DoubleArrayRawBufferTests {
+    static let values: [Double] = [1.5, -2.25, .infinity, -0.0, .leastNonzeroMagnitude]
+
+    @Test func `decodes from UnsafeRawBufferPointer`() {
+        let bytes = Self.values.flatMap { $0.bytes() }
+        let decoded = bytes.withUnsafeBytes { [Double](bytes: $0) }
+        #expect(decoded == Self.values)
+    }
+
+    @Test func `decodes big-endian from UnsafeRawBufferPointer`() {
+        let bytes = Self.values.flatMap { $0.bytes(endianness: .big) }
+        let decoded = bytes.withUnsafeBytes { [Double](bytes: $0, endianness: .big) }
+        #expect(decoded == Self.values)
+    }
+
+    @Test func `decodes from unaligned buffer`() {
+        let bytes = [0xAA] + Self.values.flatMap { $0.bytes() }
+        let decoded = bytes.withUnsafeBytes { buffer in
+            [Double](bytes: UnsafeRawBufferPointer(rebasing: buffer[1...]))
+        }
+        #expect(decoded == Self.values)
+    }
+
+    @Test func `raw buffer with invalid byte count returns nil`() {
+        let bytes = [UInt8](repeating: 0, count: 8 + 1)
+        let decoded = bytes.withUnsafeBytes { [Double](bytes: $0) }
+        #expect(decoded == nil)
+    }
+
+    @Test func `empty raw buffer returns empty array`() {
+        let decoded = [Double](bytes: UnsafeRawBufferPointer(start: nil, count: 0))
+        #expect(decoded?.isEmpty == true)
+    }
+
+    @Test func `array slice with non-zero start index`() {
+        let bytes = [0xAA, 0xBB] + Self.values.flatMap { $0.bytes(endianness: .big) }
+        let decoded = [Double](bytes: bytes[2...], endianness: .big)
+        #expect(decoded == Self.values)
+    }
+
+    @Test func `non-contiguous collection falls back to a single copy`() {
+        let bytes = Self.values.flatMap { $0.bytes() }
+        let decoded = [Double](bytes: bytes.lazy.map { $0 })
+        #expect(decoded == Self.values)
+    }
+
+    @Test func `NaN bit patterns are preserved`() {
+        let nan = Double(nan: 0x15, signaling: true)
+        let decoded = [Double](bytes: nan.bytes(endianness: .big), endianness: .big)
+        #expect(decoded?.first?.bitPattern == nan.bitPattern)
+    }
+
+    @Test func `matches Binary64 values(from:)`() {
+        let bytes = Self.values.flatMap { $0.bytes(endianness: .big) }
+        let viaArray = [Double](bytes: bytes, endianness: .big)
+        let viaFormat = bytes.withUnsafeBytes { IEEE_754.Binary64.values(from: $0, endianness: .big) }
+        #expect(viaArray == viaFormat)
+    }
+}
+
+// MARK: - Total Order Sorting
+
+@Suite("Array<Double> - Total order sorting")
+struct `Array<Double> Total Order Sorting` {
+    static let specials: [Double] = [
+        .nan, -.nan, .infinity, -.infinity, 0.0, -0.0, 1.0, -1.0,
+        .leastNonzeroMagnitude, -.leastNonzeroMagnitude, .greatestFiniteMagnitude,
+        -.greatestFiniteMagnitude, .leastNormalMagnitude, Double(nan: 7, signaling: false), .signalingNaN,
+    ]
+
+    /// Reference order built from the standard library's totalOrder predicate
+    static func reference(_ values: [Double], magnitude: Bool = false) -> [UInt64] {
+        values
+            .map { magnitude ? $0.magnitude : $0 }
+            .sorted { $0.isTotallyOrdered(belowOrEqualTo: $1) && !$1.isTotallyOrdered(belowOrEqualTo: $0) }
+            .map(\.bitPattern)
+    }
+
+    @Test func `orders specials like totalOrder`() {
+        let sorted = Self.specials.sortedByTotalOrder()
+        #expect(sorted.map(\.bitPattern) == Self.reference(Self.specials))
+        #expect(sorted.first?.sign == .minus && sorted.first?.isNaN == true)
+        #expect(sorted.last?.isNaN == true)
+    }
+
+    @Test func `negative zero sorts before positive zero`() {
+        var values: [Double] = [0.0, -0.0, 0.0, -0.0]
+        values.sortByTotalOrder()
+        #expect(values.map { $0.sign } == [.minus, .minus, .plus, .plus])
+    }
+
+    @Test func `random values match reference`() {
+        let values = (0..<5_000).map { _ in Double(bitPattern: .random(in: 0 ... .max)) }
+        #expect(values.sortedByTotalOrder().map(\.bitPattern) == Self.reference(values))
+    }
+
+    @Test func `narrow range skips constant bytes`() {
+        let values = (0..<1_000).map { _ in Double.random(in: 1.0..<2.0) }
+        #expect(values.sortedByTotalOrder() == values.sorted())
+    }
+
+    @Test func `empty and single element`() {
+        #expect([Double]().sortedByTotalOrder().isEmpty)
+        #expect([Double(3.5)].sortedByTotalOrder() == [3.5])
+    }
+
+    @Test func `magnitude order`() {
+        let values: [Double] = [-3.0, 2.0, -1.0, .nan, -0.0, 0.5, -.infinity]
+        let sorted = values.sortedByTotalOrderMag()
+        #expect(sorted.map(\.magnitude.bitPattern) == Self.reference(values, magnitude: true))
+        #expect(Array(sorted.prefix(3)) == [-0.0, 0.5, -1.0])
+    }
+
+    @Test func `magnitude ties keep input order`() {
+        let sorted = [Double]([2.0, -2.0, 1.0, -1.0]).sortedByTotalOrderMag()
+        #expect(sorted.map(\.bitPattern) == [Double]([1.0, -1.0, 2.0, -2.0]).map(\.bitPattern))
+    }
+
+    /// Sorts in a synchronous context, where the sequential overloads are chosen
+    static func sequential(_ values: [Double]) -> (totalOrder: [Double], magnitude: [Double]) {
+        (values.sortedByTotalOrder(), values.sortedByTotalOrderMag())
+    }
+
+    @Test func `concurrent sort matches sequential`() async {
+        let values = (0..<300_000).map { _ in Double(bitPattern: .random(in: 0 ... .max)) }
+        let sequential = Self.sequential(values)
+        let concurrent = await values.sortedByTotalOrder()
+        #expect(concurrent.map(\.bitPattern) == sequential.totalOrder.map(\.bitPattern))
+
+        let concurrentMag = await values.sortedByTotalOrderMag()
+        #expect(concurrentMag.map(\.bitPattern) == sequential.magnitude.map(\.bitPattern))
+    }
+}
+
 // MARK: - Performance Tests
 
 extension `Performance Tests` {
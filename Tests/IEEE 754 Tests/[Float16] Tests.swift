@@ -0,0 +1,80 @@
+// [Float16] Tests.swift
+// swift-ieee-754
+//
+// Tests for [Float16] array extensions
+
+import Testing
+
+@testable import IEEE_754
+
+#if !((os(macOS) || targetEnvironment(macCatalyst)) && arch(x86_64))
+
+    // MARK: - Total Order Sorting
+
+    @Suite("Array<Float16> - Total order sorting")
+    struct `Array<Float16> Total Order Sorting` {
+        static let specials: [Float16] = [
+            .nan, -.nan, .infinity, -.infinity, 0.0, -0.0, 1.0, -1.0,
+            .leastNonzeroMagnitude, -.leastNonzeroMagnitude, .greatestFiniteMagnitude,
+            -.greatestFiniteMagnitude, .leastNormalMagnitude, Float16(nan: 7, signaling: false), .signalingNaN,
+        ]
+
+        /// Reference order built from the standard library's totalOrder predicate
+        static func reference(_ values: [Float16], magnitude: Bool = false) -> [UInt16] {
+            values
+                .map { magnitude ? $0.magnitude : $0 }
+                .sorted { $0.isTotallyOrdered(belowOrEqualTo: $1) && !$1.isTotallyOrdered(belowOrEqualTo: $0) }
+                .map(\.bitPattern)
+        }
+
+        @Test func `orders specials like totalOrder`() {
+            let sorted = Self.specials.sortedByTotalOrder()
+            #expect(sorted.map(\.bitPattern) == Self.reference(Self.specials))
+            #expect(sorted.first?.sign == .minus && sorted.first?.isNaN == true)
+            #expect(sorted.last?.isNaN == true)
+        }
+
+        @Test func `negative zero sorts before positive zero`() {
+            var values: [Float16] = [0.0, -0.0, 0.0, -0.0]
+            values.sortByTotalOrder()
+            #expect(values.map { $0.sign } == [.minus, .minus, .plus, .plus])
+        }
+
+        @Test func `every encoding matches reference`() {
+            let values = (UInt16.min...UInt16.max).reversed().map { Float16(bitPattern: $0) }
+            #expect(values.sortedByTotalOrder().map(\.bitPattern) == Self.reference(values))
+        }
+
+        @Test func `empty and single element`() {
+            #expect([Float16]().sortedByTotalOrder().isEmpty)
+            #expect([Float16(3.5)].sortedByTotalOrder() == [3.5])
+        }
+
+        @Test func `magnitude order`() {
+            let values: [Float16] = [-3.0, 2.0, -1.0, .nan, -0.0, 0.5, -.infinity]
+            let sorted = values.sortedByTotalOrderMag()
+            #expect(sorted.map(\.magnitude.bitPattern) == Self.reference(values, magnitude: true))
+            #expect(Array(sorted.prefix(3)) == [-0.0, 0.5, -1.0])
+        }
+
+        @Test func `magnitude ties keep input order`() {
+            let sorted = [Float16]([2.0, -2.0, 1.0, -1.0]).sortedByTotalOrderMag()
+            #expect(sorted.map(\.bitPattern) == [Float16]([1.0, -1.0, 2.0, -2.0]).map(\.bitPattern))
+        }
+
+        /// Sorts in a synchronous context, where the sequential overloads are chosen
+        static func sequential(_ values: [Float16]) -> (totalOrder: [Float16], magnitude: [Float16]) {
+            (values.sortedByTotalOrder(), values.sortedByTotalOrderMag())
+        }
+
+        @Test func `concurrent sort matches sequential`() async {
+            let values = (0..<300_000).map { _ in Float16(bitPattern: .random(in: 0 ... .max)) }
+            let sequential = Self.sequential(values)
+            let concurrent = await values.sortedByTotalOrder()
+            #expect(concurrent.map(\.bitPattern) == sequential.totalOrder.map(\.bitPattern))
+
+            let concurrentMag = await values.sortedByTotalOrderMag()
+            #expect(concurrentMag.map(\.bitPattern) == sequential.magnitude.map(\.bitPattern))
+        }
+    }
+#endif